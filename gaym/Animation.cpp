@@ -1,6 +1,183 @@
-#include "stdafx.h"
 #include "Animation.h"
 #include <fstream>
+#include <algorithm>
+
+// ── 압축 파라미터 ─────────────────────────────────────────────────────────
+// 키 축소 허용 오차. 이 범위 안에서 선형 보간으로 재현되는 중간 키는 버림.
+static constexpr float kPositionTolerance = 0.0005f;
+static constexpr float kRotationTolerance = 0.0005f;   // 쿼터니언 성분 단위 (≈0.06도)
+static constexpr float kScaleTolerance    = 0.0005f;
+
+// smallest-three: 버린 최대 성분 외 나머지 세 성분은 [-1/√2, 1/√2] 범위
+static constexpr float kQuatComponentRange = 0.70710678f;
+static constexpr float kQuatQuantizeMax    = 32767.0f;   // 15bit
+
+PackedQuat PackedQuat::Pack(const XMFLOAT4& q)
+{
+    float c[4] = { q.x, q.y, q.z, q.w };
+    float fLength = sqrtf(c[0] * c[0] + c[1] * c[1] + c[2] * c[2] + c[3] * c[3]);
+    if (fLength > 0.0f)
+    {
+        for (float& v : c) v /= fLength;
+    }
+    else
+    {
+        c[3] = 1.0f;
+    }
+
+    int nLargest = 0;
+    for (int i = 1; i < 4; ++i)
+        if (fabsf(c[i]) > fabsf(c[nLargest])) nLargest = i;
+
+    // q 와 -q 는 같은 회전 → 버리는 성분이 항상 양수가 되도록 부호 정리
+    float fSign = (c[nLargest] < 0.0f) ? -1.0f : 1.0f;
+
+    uint16_t n[3];
+    int k = 0;
+    for (int i = 0; i < 4; ++i)
+    {
+        if (i == nLargest) continue;
+        float t = (c[i] * fSign / kQuatComponentRange + 1.0f) * 0.5f;
+        t = t < 0.0f ? 0.0f : (t > 1.0f ? 1.0f : t);
+        n[k++] = static_cast<uint16_t>(t * kQuatQuantizeMax + 0.5f);
+    }
+
+    PackedQuat packed;
+    packed.m_nA = static_cast<uint16_t>(n[0] | ((nLargest >> 1) << 15));
+    packed.m_nB = static_cast<uint16_t>(n[1] | ((nLargest & 1) << 15));
+    packed.m_nC = n[2];
+    return packed;
+}
+
+XMFLOAT4 PackedQuat::Unpack() const
+{
+    auto decode = [](uint16_t n) {
+        return ((n & 0x7FFF) / kQuatQuantizeMax * 2.0f - 1.0f) * kQuatComponentRange;
+    };
+
+    int nLargest = ((m_nA >> 15) << 1) | (m_nB >> 15);
+    float a = decode(m_nA), b = decode(m_nB), c = decode(m_nC);
+    float d = sqrtf((std::max)(0.0f, 1.0f - a * a - b * b - c * c));
+
+    float out[4];
+    int k = 0;
+    const float rest[3] = { a, b, c };
+    for (int i = 0; i < 4; ++i)
+        out[i] = (i == nLargest) ? d : rest[k++];
+
+    return XMFLOAT4(out[0], out[1], out[2], out[3]);
+}
+
+namespace
+{
+    float Vector3Error(const XMFLOAT3& a, const XMFLOAT3& b)
+    {
+        return (std::max)(fabsf(a.x - b.x), (std::max)(fabsf(a.y - b.y), fabsf(a.z - b.z)));
+    }
+
+    // q 와 -q 는 같은 회전이므로 둘 중 가까운 쪽 기준
+    float QuaternionError(const XMFLOAT4& a, const XMFLOAT4& b)
+    {
+        float fSame = (std::max)((std::max)(fabsf(a.x - b.x), fabsf(a.y - b.y)), (std::max)(fabsf(a.z - b.z), fabsf(a.w - b.w)));
+        float fFlip = (std::max)((std::max)(fabsf(a.x + b.x), fabsf(a.y + b.y)), (std::max)(fabsf(a.z + b.z), fabsf(a.w + b.w)));
+        return (std::min)(fSame, fFlip);
+    }
+
+    XMFLOAT3 LerpVector3(const XMFLOAT3& a, const XMFLOAT3& b, float t)
+    {
+        XMFLOAT3 out;
+        XMStoreFloat3(&out, XMVectorLerp(XMLoadFloat3(&a), XMLoadFloat3(&b), t));
+        return out;
+    }
+
+    XMFLOAT4 SlerpQuaternion(const XMFLOAT4& a, const XMFLOAT4& b, float t)
+    {
+        XMFLOAT4 out;
+        XMStoreFloat4(&out, XMQuaternionSlerp(XMLoadFloat4(&a), XMLoadFloat4(&b), t));
+        return out;
+    }
+
+    // 키 축소: 마지막으로 남긴 키 ~ 후보 키 사이를 보간했을 때 그 사이 원본 키가 전부
+    // 허용 오차 안이면 중간 키를 버림 (greedy). vDecoded 는 양자화 후 값, vRaw 는 원본.
+    template <typename TValue, typename TInterp, typename TError>
+    void ReduceKeys(const std::vector<TValue>& vDecoded, const std::vector<TValue>& vRaw, float fTolerance,
+                    TInterp interp, TError error, std::vector<uint16_t>& outKeys)
+    {
+        outKeys.clear();
+        const int n = (int)vRaw.size();
+        if (n == 0) return;
+
+        outKeys.push_back(0);
+
+        // 상수 채널 (대부분의 scale, 움직이지 않는 본) → 키 1개
+        bool bConstant = true;
+        for (int i = 1; i < n && bConstant; ++i)
+            bConstant = error(vDecoded[0], vRaw[i]) <= fTolerance;
+        if (bConstant) return;
+
+        int nStart = 0;
+        for (int nEnd = nStart + 2; nEnd < n; ++nEnd)
+        {
+            bool bFits = true;
+            for (int i = nStart + 1; i < nEnd && bFits; ++i)
+            {
+                float t = (float)(i - nStart) / (float)(nEnd - nStart);
+                bFits = error(interp(vDecoded[nStart], vDecoded[nEnd], t), vRaw[i]) <= fTolerance;
+            }
+
+            if (!bFits)
+            {
+                nStart = nEnd - 1;
+                outKeys.push_back(static_cast<uint16_t>(nStart));
+            }
+        }
+        if (n > 1) outKeys.push_back(static_cast<uint16_t>(n - 1));
+    }
+
+    // fFrame 이하의 마지막 키 인덱스
+    inline int FindKey(const std::vector<uint16_t>& vFrames, float fFrame)
+    {
+        auto it = std::upper_bound(vFrames.begin(), vFrames.end(), fFrame,
+            [](float f, uint16_t nKey) { return f < (float)nKey; });
+        int nKey = (int)(it - vFrames.begin()) - 1;
+        return nKey < 0 ? 0 : nKey;
+    }
+
+    inline XMVECTOR SampleChannel(const Vector3Channel& channel, float fFrame)
+    {
+        int nKey = FindKey(channel.m_vFrames, fFrame);
+        if (nKey + 1 >= (int)channel.m_vFrames.size())
+            return XMLoadFloat3(&channel.m_vValues[nKey]);
+
+        float t = (fFrame - channel.m_vFrames[nKey]) / (float)(channel.m_vFrames[nKey + 1] - channel.m_vFrames[nKey]);
+        return XMVectorLerp(XMLoadFloat3(&channel.m_vValues[nKey]), XMLoadFloat3(&channel.m_vValues[nKey + 1]), t);
+    }
+
+    inline XMVECTOR SampleChannel(const QuaternionChannel& channel, float fFrame)
+    {
+        int nKey = FindKey(channel.m_vFrames, fFrame);
+        XMFLOAT4 q0 = channel.m_vValues[nKey].Unpack();
+        if (nKey + 1 >= (int)channel.m_vFrames.size())
+            return XMLoadFloat4(&q0);
+
+        XMFLOAT4 q1 = channel.m_vValues[nKey + 1].Unpack();
+        float t = (fFrame - channel.m_vFrames[nKey]) / (float)(channel.m_vFrames[nKey + 1] - channel.m_vFrames[nKey]);
+        return XMQuaternionSlerp(XMLoadFloat4(&q0), XMLoadFloat4(&q1), t);
+    }
+
+    template <typename TValue>
+    size_t ChannelBytes(const std::vector<uint16_t>& vFrames, const std::vector<TValue>& vValues)
+    {
+        return vFrames.capacity() * sizeof(uint16_t) + vValues.capacity() * sizeof(TValue);
+    }
+}
+
+void CompressedBoneTrack::Sample(float fFrame, XMVECTOR& outPos, XMVECTOR& outRot, XMVECTOR& outScale) const
+{
+    outPos   = SampleChannel(m_position, fFrame);
+    outRot   = SampleChannel(m_rotation, fFrame);
+    outScale = SampleChannel(m_scale, fFrame);
+}
 
 // Helper to read C# 7-bit encoded string
 std::string ReadString(FILE* pInFile)
@@ -126,13 +303,15 @@ bool AnimationSet::LoadAnimationFromFile(const char* pstrFileName)
                 track.m_vKeyframes[f].m_xmf4Rotation = ReadVector4(pInFile);
                 track.m_vKeyframes[f].m_xmf3Scale = ReadVector3(pInFile);
             }
-            pClip->m_vBoneTracks.push_back(track);
+
+            // 원본 AoS 키는 여기서 압축 트랙으로 바꾸고 버림
+            CompressedBoneTrack compressed;
+            compressed.m_nBoneIndex = FindOrAddBone(track.m_strBoneName);
+            CompressTrack(track, compressed);
+            pClip->m_vTracks.push_back(std::move(compressed));
         }
         if (!VerifyTag(pInFile, "</Clip>")) { fclose(pInFile); return false; }
 
-        // 블렌드 성능 최적화용 본명→인덱스 맵 구축 (O(본²) 선형 서치 제거)
-        pClip->BuildBoneIndex();
-
         m_vClips.push_back(pClip);
         m_mapClips[pClip->m_strName] = pClip;
     }
@@ -147,21 +326,219 @@ bool AnimationSet::LoadAnimationFromFile(const char* pstrFileName)
             sprintf_s(buf, "  - \"%s\" (%.2fs)\n", clip->m_strName.c_str(), clip->m_fDuration);
             OutputDebugStringA(buf);
         }
+
+        // 압축 리포트 (원본 대비 크기 / 키 수 / 최대 오차)
+        OutputDebugStringA(("[AnimSet] Compression: " + BuildCompressionReport()).c_str());
     }
 
     fclose(pInFile);
     return true;
 }
 
-AnimationClip* AnimationSet::GetClip(const std::string& strName)
+std::string AnimationSet::BuildCompressionReport() const
+{
+    char report[256];
+    sprintf_s(report, "%zu bones, %.1fKB -> %.1fKB (%.1f%%), keys %zu -> %zu, "
+        "max err pos=%.5f rot=%.5f scale=%.5f\n",
+        m_vBoneNames.size(), m_report.nRawBytes / 1024.0, m_report.nCompressedBytes / 1024.0,
+        m_report.nRawBytes ? 100.0 * m_report.nCompressedBytes / m_report.nRawBytes : 0.0,
+        m_report.nRawKeys, m_report.nKeptKeys,
+        m_report.fMaxPositionError, m_report.fMaxRotationError, m_report.fMaxScaleError);
+    return report;
+}
+
+const AnimationClip* AnimationSet::GetClip(const std::string& strName) const
 {
     auto it = m_mapClips.find(strName);
     if (it != m_mapClips.end()) return it->second.get();
     return nullptr;
 }
 
-AnimationClip* AnimationSet::GetClip(int index)
+const AnimationClip* AnimationSet::GetClip(int index) const
 {
-    if (index >= 0 && index < m_vClips.size()) return m_vClips[index].get();
+    if (index >= 0 && index < (int)m_vClips.size()) return m_vClips[index].get();
     return nullptr;
 }
+
+size_t AnimationSet::GetResidentBytes() const
+{
+    size_t nBytes = sizeof(AnimationSet);
+    for (const auto& pClip : m_vClips)
+    {
+        nBytes += sizeof(AnimationClip) + pClip->m_strName.capacity();
+        for (const auto& track : pClip->m_vTracks)
+        {
+            nBytes += sizeof(CompressedBoneTrack);
+            nBytes += ChannelBytes(track.m_position.m_vFrames, track.m_position.m_vValues);
+            nBytes += ChannelBytes(track.m_rotation.m_vFrames, track.m_rotation.m_vValues);
+            nBytes += ChannelBytes(track.m_scale.m_vFrames, track.m_scale.m_vValues);
+        }
+    }
+    // 스켈레톤 본 이름 테이블 (노드 + 키 문자열 대략치)
+    for (const auto& strName : m_vBoneNames)
+        nBytes += (sizeof(std::string) + strName.capacity()) * 2 + sizeof(int) + sizeof(void*) * 2;
+    return nBytes;
+}
+
+int AnimationSet::FindOrAddBone(const std::string& strBoneName)
+{
+    auto it = m_mapBoneNameToIndex.find(strBoneName);
+    if (it != m_mapBoneNameToIndex.end()) return it->second;
+
+    int nIndex = (int)m_vBoneNames.size();
+    m_vBoneNames.push_back(strBoneName);
+    m_mapBoneNameToIndex.emplace(strBoneName, nIndex);
+    return nIndex;
+}
+
+void AnimationSet::CompressTrack(const BoneTrack& rawTrack, CompressedBoneTrack& outTrack)
+{
+    // 프레임 번호는 uint16 으로 저장 — 그 이상 긴 트랙은 앞부분만 사용
+    const int n = (int)(std::min)(rawTrack.m_vKeyframes.size(), (size_t)UINT16_MAX);
+    outTrack.m_nFrameCount = n;
+
+    m_report.nRawBytes += rawTrack.m_vKeyframes.size() * sizeof(Keyframe);
+    m_report.nRawKeys += (size_t)n * 3;
+    if (n == 0) return;
+
+    std::vector<XMFLOAT3> vRawPos(n), vRawScale(n);
+    std::vector<XMFLOAT4> vRawRot(n), vDecodedRot(n);
+    std::vector<PackedQuat> vPackedRot(n);
+    for (int i = 0; i < n; ++i)
+    {
+        const Keyframe& key = rawTrack.m_vKeyframes[i];
+        vRawPos[i] = key.m_xmf3Position;
+        vRawScale[i] = key.m_xmf3Scale;
+        vRawRot[i] = key.m_xmf4Rotation;
+        vPackedRot[i] = PackedQuat::Pack(key.m_xmf4Rotation);
+        vDecodedRot[i] = vPackedRot[i].Unpack();
+    }
+
+    // 채널별 키 축소 (양자화 오차까지 포함해서 원본과 비교)
+    ReduceKeys(vRawPos, vRawPos, kPositionTolerance, LerpVector3, Vector3Error, outTrack.m_position.m_vFrames);
+    ReduceKeys(vDecodedRot, vRawRot, kRotationTolerance, SlerpQuaternion, QuaternionError, outTrack.m_rotation.m_vFrames);
+    ReduceKeys(vRawScale, vRawScale, kScaleTolerance, LerpVector3, Vector3Error, outTrack.m_scale.m_vFrames);
+
+    for (uint16_t nKey : outTrack.m_position.m_vFrames) outTrack.m_position.m_vValues.push_back(vRawPos[nKey]);
+    for (uint16_t nKey : outTrack.m_rotation.m_vFrames) outTrack.m_rotation.m_vValues.push_back(vPackedRot[nKey]);
+    for (uint16_t nKey : outTrack.m_scale.m_vFrames)    outTrack.m_scale.m_vValues.push_back(vRawScale[nKey]);
+
+    outTrack.m_position.m_vFrames.shrink_to_fit(); outTrack.m_position.m_vValues.shrink_to_fit();
+    outTrack.m_rotation.m_vFrames.shrink_to_fit(); outTrack.m_rotation.m_vValues.shrink_to_fit();
+    outTrack.m_scale.m_vFrames.shrink_to_fit();    outTrack.m_scale.m_vValues.shrink_to_fit();
+
+    // 리포트: 원본 모든 프레임에서 압축 트랙을 다시 샘플링해 실제 오차 측정
+    for (int i = 0; i < n; ++i)
+    {
+        XMVECTOR pos, rot, scale;
+        outTrack.Sample((float)i, pos, rot, scale);
+
+        XMFLOAT3 p, sc;
+        XMFLOAT4 r;
+        XMStoreFloat3(&p, pos);
+        XMStoreFloat4(&r, rot);
+        XMStoreFloat3(&sc, scale);
+
+        m_report.fMaxPositionError = (std::max)(m_report.fMaxPositionError, Vector3Error(p, vRawPos[i]));
+        m_report.fMaxRotationError = (std::max)(m_report.fMaxRotationError, QuaternionError(r, vRawRot[i]));
+        m_report.fMaxScaleError    = (std::max)(m_report.fMaxScaleError, Vector3Error(sc, vRawScale[i]));
+    }
+
+    m_report.nKeptKeys += outTrack.m_position.m_vFrames.size()
+                        + outTrack.m_rotation.m_vFrames.size()
+                        + outTrack.m_scale.m_vFrames.size();
+    m_report.nCompressedBytes += sizeof(CompressedBoneTrack)
+        + ChannelBytes(outTrack.m_position.m_vFrames, outTrack.m_position.m_vValues)
+        + ChannelBytes(outTrack.m_rotation.m_vFrames, outTrack.m_rotation.m_vValues)
+        + ChannelBytes(outTrack.m_scale.m_vFrames, outTrack.m_scale.m_vValues);
+}
+
+// ── AnimationSetCache ────────────────────────────────────────────────────
+std::mutex AnimationSetCache::s_mutex;
+std::unordered_map<std::string, std::shared_ptr<const AnimationSet>> AnimationSetCache::s_mapSets;
+AnimationSetCache::Stats AnimationSetCache::s_stats;
+
+std::shared_ptr<const AnimationSet> AnimationSetCache::Acquire(const std::string& strFileName)
+{
+    std::lock_guard<std::mutex> lock(s_mutex);
+
+    auto it = s_mapSets.find(strFileName);
+    if (it != s_mapSets.end())
+    {
+        ++s_stats.nHits;
+        return it->second;
+    }
+
+    ++s_stats.nMisses;
+
+    // 성공한 세트만 캐싱 — 실패한 경로는 다음 Acquire 때 다시 시도한다 (호출자는 nullptr 를 받는다)
+    auto pSet = std::make_shared<AnimationSet>();
+    if (!pSet->LoadAnimationFromFile(strFileName.c_str()))
+    {
+        ++s_stats.nFailures;
+        return nullptr;
+    }
+
+    s_stats.nResidentBytes += pSet->GetResidentBytes();
+    s_mapSets.emplace(strFileName, pSet);
+    s_stats.nSets = s_mapSets.size();
+    return pSet;
+}
+
+size_t AnimationSetCache::ReleaseUnused()
+{
+    std::lock_guard<std::mutex> lock(s_mutex);
+
+    size_t nReleased = 0;
+    for (auto it = s_mapSets.begin(); it != s_mapSets.end(); )
+    {
+        if (it->second.use_count() == 1)
+        {
+            s_stats.nResidentBytes -= it->second->GetResidentBytes();
+            it = s_mapSets.erase(it);
+            ++nReleased;
+        }
+        else
+        {
+            ++it;
+        }
+    }
+    s_stats.nSets = s_mapSets.size();
+    return nReleased;
+}
+
+AnimationSetCache::Stats AnimationSetCache::GetStats()
+{
+    std::lock_guard<std::mutex> lock(s_mutex);
+    return s_stats;
+}
+
+void AnimationSetCache::LogStats()
+{
+    Stats stats = GetStats();
+    char buf[192];
+    sprintf_s(buf, "[AnimCache] sets=%zu resident=%.1fKB hits=%zu misses=%zu failures=%zu\n",
+        stats.nSets, stats.nResidentBytes / 1024.0, stats.nHits, stats.nMisses, stats.nFailures);
+    OutputDebugStringA(buf);
+}
+
+std::string AnimationSetCache::BuildReport()
+{
+    std::lock_guard<std::mutex> lock(s_mutex);
+
+    char line[192];
+    sprintf_s(line, "anim sets: %zu  resident: %.1fKB  hits: %zu  misses: %zu  failures: %zu\n",
+        s_stats.nSets, s_stats.nResidentBytes / 1024.0, s_stats.nHits, s_stats.nMisses, s_stats.nFailures);
+    std::string report = line;
+
+    // 경로 순으로 정렬해 실행마다 같은 순서로 비교할 수 있게
+    std::vector<const std::string*> vPaths;
+    vPaths.reserve(s_mapSets.size());
+    for (auto& [path, pSet] : s_mapSets)
+        vPaths.push_back(&path);
+    std::sort(vPaths.begin(), vPaths.end(), [](const std::string* a, const std::string* b) { return *a < *b; });
+
+    for (const std::string* pPath : vPaths)
+        report += "  " + *pPath + ": " + s_mapSets[*pPath]->BuildCompressionReport();
+    return report;
+}
@@ -1,11 +1,13 @@
 #pragma once
-#include "stdafx.h"
+#include "PortablePlatform.h"
 #include <string>
 #include <vector>
 #include <map>
 #include <unordered_map>
 #include <memory>
+#include <mutex>
 
+// 파일에서 읽은 원본 키 (로더 내부 중간 표현). 로드 후 CompressedBoneTrack 으로 변환되고 버려짐.
 struct Keyframe
 {
     int m_nFrameIndex;
@@ -20,6 +22,45 @@ struct BoneTrack
     std::vector<Keyframe> m_vKeyframes;
 };
 
+// Smallest-three 양자화 쿼터니언 (48bit).
+// 가장 큰 성분은 버리고(부호는 +로 맞춤) 나머지 셋을 15bit 로 저장, 버린 성분 인덱스 2bit 는
+// m_nA / m_nB 의 최상위 비트에 나눠 담음.
+struct PackedQuat
+{
+    uint16_t m_nA;
+    uint16_t m_nB;
+    uint16_t m_nC;
+
+    static PackedQuat Pack(const XMFLOAT4& q);
+    XMFLOAT4 Unpack() const;
+};
+
+// 채널별 키 배열 (SoA). 키 축소 후 남은 프레임 번호만 오름차순 저장 — 최소 1개.
+struct Vector3Channel
+{
+    std::vector<uint16_t> m_vFrames;
+    std::vector<XMFLOAT3> m_vValues;
+};
+
+struct QuaternionChannel
+{
+    std::vector<uint16_t>   m_vFrames;
+    std::vector<PackedQuat> m_vValues;
+};
+
+struct CompressedBoneTrack
+{
+    int m_nBoneIndex = -1;      // AnimationSet::m_vBoneNames 인덱스 (스켈레톤 인덱스)
+    int m_nFrameCount = 0;      // 원본 키 개수 — 이 범위 밖 프레임은 기존처럼 샘플링 skip
+
+    Vector3Channel    m_position;
+    QuaternionChannel m_rotation;
+    Vector3Channel    m_scale;
+
+    // fFrame 위치(원본 프레임 단위, 소수 허용)의 포즈
+    void Sample(float fFrame, XMVECTOR& outPos, XMVECTOR& outRot, XMVECTOR& outScale) const;
+};
+
 class AnimationClip
 {
 public:
@@ -28,19 +69,19 @@ public:
     float m_fFrameRate;
     int m_nTotalFrames;
 
-    std::vector<BoneTrack> m_vBoneTracks;
-
-    // 본 이름 → m_vBoneTracks 인덱스. 블렌드 시 이전 clip 의 같은 본을 O(1) lookup 하려고 씀.
-    // 로더(AnimationSet::LoadAnimationFromFile) 가 모든 트랙 push 후 BuildBoneIndex() 호출.
-    std::unordered_map<std::string, int> m_mapBoneNameToIndex;
+    std::vector<CompressedBoneTrack> m_vTracks;
+};
 
-    void BuildBoneIndex()
-    {
-        m_mapBoneNameToIndex.clear();
-        m_mapBoneNameToIndex.reserve(m_vBoneTracks.size());
-        for (int i = 0; i < (int)m_vBoneTracks.size(); ++i)
-            m_mapBoneNameToIndex[m_vBoneTracks[i].m_strBoneName] = i;
-    }
+// 압축 결과 (원본 대비 크기/오차). 로드 시 세트 단위로 누적해서 로그.
+struct AnimationCompressionReport
+{
+    size_t nRawBytes = 0;
+    size_t nCompressedBytes = 0;
+    size_t nRawKeys = 0;        // 채널 단위 (트랙당 pos/rot/scale 3채널)
+    size_t nKeptKeys = 0;
+    float fMaxPositionError = 0.0f;
+    float fMaxRotationError = 0.0f;   // 쿼터니언 성분 최대 오차
+    float fMaxScaleError = 0.0f;
 };
 
 class AnimationSet
@@ -51,9 +92,60 @@ public:
 
     bool LoadAnimationFromFile(const char* pstrFileName);
     
-    AnimationClip* GetClip(const std::string& strName);
-    AnimationClip* GetClip(int index);
+    const AnimationClip* GetClip(const std::string& strName) const;
+    const AnimationClip* GetClip(int index) const;
+
+    // 키프레임/트랙 이름 등 이 세트가 잡고 있는 대략적인 CPU 메모리
+    size_t GetResidentBytes() const;
+
+    // 스켈레톤: 세트 내 모든 clip 트랙의 본 이름 합집합. 트랙은 이름 대신 이 인덱스를 가짐.
+    // AnimationComponent 는 바인딩 시 한 번만 이름으로 찾고, 이후엔 인덱스 배열만 순회.
+    int GetBoneCount() const { return (int)m_vBoneNames.size(); }
+    const std::string& GetBoneName(int index) const { return m_vBoneNames[index]; }
+
+    const AnimationCompressionReport& GetCompressionReport() const { return m_report; }
+    // "N bones, rawKB -> compKB (%), keys a -> b, max err ..." 한 줄 (개행 포함)
+    std::string BuildCompressionReport() const;
 
     std::vector<std::shared_ptr<AnimationClip>> m_vClips;
     std::map<std::string, std::shared_ptr<AnimationClip>> m_mapClips;
+
+private:
+    int FindOrAddBone(const std::string& strBoneName);
+    void CompressTrack(const BoneTrack& rawTrack, CompressedBoneTrack& outTrack);
+
+    std::vector<std::string> m_vBoneNames;
+    std::unordered_map<std::string, int> m_mapBoneNameToIndex;
+    AnimationCompressionReport m_report;
+};
+
+// 파일 경로 → AnimationSet 공유 캐시.
+// 같은 _Anim.bin 을 쓰는 인스턴스(웨이브의 동일 몬스터 등)는 한 번만 파싱하고
+// 불변(const) 세트를 공유. 재생 상태(현재 clip, 시간, 블렌드)는 AnimationComponent 가 따로 가짐.
+class AnimationSetCache
+{
+public:
+    struct Stats
+    {
+        size_t nHits = 0;
+        size_t nMisses = 0;
+        size_t nFailures = 0;   // 로드 실패 (캐싱하지 않음)
+        size_t nSets = 0;
+        size_t nResidentBytes = 0;
+    };
+
+    static std::shared_ptr<const AnimationSet> Acquire(const std::string& strFileName);
+
+    // 캐시만 잡고 있는 (사용 중인 컴포넌트가 없는) 세트 해제. 반환값 = 해제한 세트 수
+    static size_t ReleaseUnused();
+
+    static Stats GetStats();
+    static void LogStats();
+    // 캐시 통계 + 세트별 압축 리포트 (헤드리스 리포트 등에 붙인다)
+    static std::string BuildReport();
+
+private:
+    static std::mutex s_mutex;
+    static std::unordered_map<std::string, std::shared_ptr<const AnimationSet>> s_mapSets;
+    static Stats s_stats;
 };
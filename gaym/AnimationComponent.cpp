@@ -6,6 +6,7 @@
 #include "Dx12App.h"
 #include "Scene.h"
 #include "Camera.h"
+#include "SimProfiler.h"
 #include <functional>
 #include <vector>
 
@@ -14,8 +15,6 @@ int  AnimationComponent::s_nGlobalFrame    = 0;
 
 AnimationComponent::AnimationComponent(GameObject* pOwner) : Component(pOwner)
 {
-    m_pAnimationSet = std::make_shared<AnimationSet>();
-
     // Phase 는 owner 포인터 해시 기반 — 생성 순서에 따라 그룹이 섞여 몰림 방지.
     // kPhaseGroupCount 로 나눠 Update 마다 s_nGlobalFrame 과 매칭되는 그룹만 본 계산.
     m_iUpdatePhase = static_cast<int>(reinterpret_cast<uintptr_t>(pOwner) % kPhaseGroupCount);
@@ -32,6 +31,7 @@ void AnimationComponent::Init(ID3D12Device* pDevice, ID3D12GraphicsCommandList*
     m_vHierarchyTransforms.clear();
     BuildBoneCache(m_pOwner);
     CollectHierarchyNodes(m_pOwner);
+    BindSkeleton();
 }
 
 void AnimationComponent::BuildBoneCache(GameObject* pGameObject)
@@ -56,7 +56,18 @@ void AnimationComponent::CollectHierarchyNodes(GameObject* pGameObject)
     Mesh* pMesh = pGameObject->GetMesh();
     if (pMesh && (pMesh->GetType() & 0x10))
     {
-        m_vSkinnedMeshes.push_back({ static_cast<SkinnedMesh*>(pMesh), pGameObject });
+        CachedSkinnedMesh entry{ static_cast<SkinnedMesh*>(pMesh), pGameObject };
+
+        // 스키닝 본도 여기서 한 번만 이름 → TransformComponent 로 바인딩
+        entry.vBoneTransforms.reserve(entry.pMesh->m_vBoneNames.size());
+        for (const auto& strBoneName : entry.pMesh->m_vBoneNames)
+        {
+            auto it = m_mapBoneTransforms.find(strBoneName);
+            entry.vBoneTransforms.push_back(it != m_mapBoneTransforms.end() ? it->second : nullptr);
+        }
+        // 본 행렬은 오브젝트 CB 가 아니라 공유 팔레트에 — 실제 본 개수만큼만 잡는다
+        pGameObject->AllocateBonePalette((UINT)entry.pMesh->m_vBoneNames.size());
+        m_vSkinnedMeshes.push_back(std::move(entry));
     }
     if (auto* pT = pGameObject->GetTransform())
         m_vHierarchyTransforms.push_back(pT);
@@ -67,12 +78,42 @@ void AnimationComponent::CollectHierarchyNodes(GameObject* pGameObject)
 
 void AnimationComponent::LoadAnimation(const char* pstrFileName)
 {
-    m_pAnimationSet->LoadAnimationFromFile(pstrFileName);
+    // 같은 파일은 프로세스 전체에서 한 번만 파싱 — 동일 몬스터 N 마리 스폰 시 파싱/메모리 1회분
+    m_pAnimationSet = AnimationSetCache::Acquire(pstrFileName);
+    m_pCurrentClip = nullptr;
+    m_pPreviousClip = nullptr;
+    m_bIsBlending = false;
+    m_bIsPlaying = false;
+    BindSkeleton();
+}
+
+void AnimationComponent::BindSkeleton()
+{
+    m_vBoneBindings.clear();
+    m_vPreviousPose.clear();
+    if (!m_pAnimationSet) return;
+
+    const int nBones = m_pAnimationSet->GetBoneCount();
+    m_vBoneBindings.assign(nBones, nullptr);
+    m_vPreviousPose.assign(nBones, BonePose());
+    m_nPoseStamp = 0;
+
+    // Skip root object - its transform is managed by game logic (position, scale)
+    TransformComponent* pRootTransform = m_pOwner ? m_pOwner->GetTransform() : nullptr;
+
+    for (int i = 0; i < nBones; ++i)
+    {
+        auto it = m_mapBoneTransforms.find(m_pAnimationSet->GetBoneName(i));
+        if (it != m_mapBoneTransforms.end() && it->second != pRootTransform)
+            m_vBoneBindings[i] = it->second;
+    }
 }
 
 void AnimationComponent::Play(std::string strClipName, bool bLoop)
 {
-    AnimationClip* pClip = m_pAnimationSet->GetClip(strClipName);
+    if (!m_pAnimationSet) return;
+
+    const AnimationClip* pClip = m_pAnimationSet->GetClip(strClipName);
     if (pClip)
     {
         m_pCurrentClip = pClip;
@@ -90,7 +131,7 @@ void AnimationComponent::Stop()
 
 void AnimationComponent::CrossFade(const std::string& strClipName, float fBlendDuration, bool bLoop, bool bForceRestart)
 {
-    AnimationClip* pNewClip = m_pAnimationSet->GetClip(strClipName);
+    const AnimationClip* pNewClip = m_pAnimationSet ? m_pAnimationSet->GetClip(strClipName) : nullptr;
     if (!pNewClip)
     {
         char buffer[256];
@@ -134,6 +175,8 @@ void AnimationComponent::Restart()
 
 void AnimationComponent::Update(float deltaTime)
 {
+    SimProfileScope profile(SimSubsystem::Animation);
+
     if (!m_bIsPlaying || !m_pCurrentClip) return;
 
     // ── LOD skip 결정 (플레이어 등 m_bCullEnabled=false 는 건너뜀) ─────────
@@ -142,29 +185,17 @@ void AnimationComponent::Update(float deltaTime)
     // (A) Frustum culling: 카메라 뷰 밖이면 본 계산 완전 skip (누적도 안 함 — 다시 보일 때 그 자리부터).
     if (m_bCullEnabled)
     {
-        // Frustum 체크 — 탑뷰여도 방 경계 넘는 몬스터는 카메라 밖
+        // Frustum 체크 — 탑뷰여도 방 경계 넘는 몬스터는 카메라 밖.
+        // 프러스텀은 Scene::Update 가 프레임당 한 번 만든 것을 같이 쓴다
         bool bInFrustum = true;
         if (Scene* pScene = Dx12App::GetInstance() ? Dx12App::GetInstance()->GetScene() : nullptr)
         {
-            if (CCamera* pCam = pScene->GetCamera())
+            if (m_pOwner && m_pOwner->GetTransform())
             {
-                XMMATRIX matProj = XMLoadFloat4x4(&pCam->GetProjectionMatrix());
-                XMMATRIX matView = XMLoadFloat4x4(&pCam->GetViewMatrix());
-                BoundingFrustum frustum;
-                BoundingFrustum::CreateFromMatrix(frustum, matProj);
-
-                // projMatrix 기반 frustum 은 view space 기준 → view 의 역변환으로 world 로 옮김
-                XMVECTOR det;
-                XMMATRIX matInvView = XMMatrixInverse(&det, matView);
-                frustum.Transform(frustum, matInvView);
-
-                if (m_pOwner && m_pOwner->GetTransform())
-                {
-                    XMFLOAT3 p = m_pOwner->GetTransform()->GetPosition();
-                    // 넉넉한 반경 (몬스터 scale 5.0 기준 + 마진)
-                    BoundingSphere sph({ p.x, p.y + 3.0f, p.z }, 8.0f);
-                    bInFrustum = frustum.Intersects(sph);
-                }
+                XMFLOAT3 p = m_pOwner->GetTransform()->GetPosition();
+                // 넉넉한 반경 (몬스터 scale 5.0 기준 + 마진)
+                const float center[3] = { p.x, p.y + 3.0f, p.z };
+                bInFrustum = pScene->GetViewFrustum().TestSphere(center, 8.0f);
             }
         }
 
@@ -233,7 +264,8 @@ void AnimationComponent::Update(float deltaTime)
     float fRatio = fFrame - nFrame;
     if (nFrame >= m_pCurrentClip->m_nTotalFrames - 1)
     {
-        nFrame = m_pCurrentClip->m_nTotalFrames - 1;
+        // 키가 없는 clip (Golem01 의 Golem_T_ge) 은 0 → 아래 트랙 범위 검사에서 전부 skip
+        nFrame = (std::max)(m_pCurrentClip->m_nTotalFrames - 1, 0);
         nNextFrame = nFrame;
         fRatio = 0.0f;
     }
@@ -249,59 +281,58 @@ void AnimationComponent::Update(float deltaTime)
         fPrevRatio = fPrevFrameF - nPrevFrame;
         if (nPrevFrame >= m_pPreviousClip->m_nTotalFrames - 1)
         {
-            nPrevFrame = m_pPreviousClip->m_nTotalFrames - 1;
+            nPrevFrame = (std::max)(m_pPreviousClip->m_nTotalFrames - 1, 0);
             nPrevNextFrame = nPrevFrame;
             fPrevRatio = 0.0f;
         }
     }
 
-    // Apply to bones
-    for (const auto& track : m_pCurrentClip->m_vBoneTracks)
+    // Sample previous clip pose into the per-bone scratch buffer (if blending)
+    if (m_bIsBlending && m_pPreviousClip)
     {
-        auto it = m_mapBoneTransforms.find(track.m_strBoneName);
-        if (it == m_mapBoneTransforms.end()) continue;
-
-        TransformComponent* pTransform = it->second;
+        ++m_nPoseStamp;
+        const float fPrevSampleFrame = nPrevFrame + fPrevRatio;
+        for (const auto& track : m_pPreviousClip->m_vTracks)
+        {
+            if (!m_vBoneBindings[track.m_nBoneIndex]) continue;
+            if (nPrevFrame >= track.m_nFrameCount || nPrevNextFrame >= track.m_nFrameCount)
+                continue;
+
+            XMVECTOR prevPos, prevRot, prevScale;
+            track.Sample(fPrevSampleFrame, prevPos, prevRot, prevScale);
+
+            BonePose& pose = m_vPreviousPose[track.m_nBoneIndex];
+            XMStoreFloat3(&pose.xmf3Position, prevPos);
+            XMStoreFloat4(&pose.xmf4Rotation, prevRot);
+            XMStoreFloat3(&pose.xmf3Scale, prevScale);
+            pose.nStamp = m_nPoseStamp;
+        }
+    }
 
-        // Skip root object - its transform is managed by game logic (position, scale)
-        if (pTransform == m_pOwner->GetTransform()) continue;
+    // Apply to bones (스켈레톤 인덱스로 바로 접근 — 이름 lookup 없음)
+    const float fSampleFrame = nFrame + fRatio;
+    const bool bBlendPrevious = m_bIsBlending && m_pPreviousClip;
+    for (const auto& track : m_pCurrentClip->m_vTracks)
+    {
+        TransformComponent* pTransform = m_vBoneBindings[track.m_nBoneIndex];
+        if (!pTransform) continue;
 
-        if (nFrame >= (int)track.m_vKeyframes.size() || nNextFrame >= (int)track.m_vKeyframes.size())
+        if (nFrame >= track.m_nFrameCount || nNextFrame >= track.m_nFrameCount)
             continue;
 
         // Sample current clip pose
-        const Keyframe& k1 = track.m_vKeyframes[nFrame];
-        const Keyframe& k2 = track.m_vKeyframes[nNextFrame];
-
-        XMVECTOR currPos = XMVectorLerp(XMLoadFloat3(&k1.m_xmf3Position), XMLoadFloat3(&k2.m_xmf3Position), fRatio);
-        XMVECTOR currRot = XMQuaternionSlerp(XMLoadFloat4(&k1.m_xmf4Rotation), XMLoadFloat4(&k2.m_xmf4Rotation), fRatio);
-        XMVECTOR currScale = XMVectorLerp(XMLoadFloat3(&k1.m_xmf3Scale), XMLoadFloat3(&k2.m_xmf3Scale), fRatio);
+        XMVECTOR finalPos, finalRot, finalScale;
+        track.Sample(fSampleFrame, finalPos, finalRot, finalScale);
 
-        XMVECTOR finalPos = currPos;
-        XMVECTOR finalRot = currRot;
-        XMVECTOR finalScale = currScale;
-
-        // Blend with previous clip if blending.
-        // AnimationClip::m_mapBoneNameToIndex 로 O(1) lookup (이전엔 이전 clip 본 트랙 전체 선형 서치 — O(본²))
-        if (m_bIsBlending && m_pPreviousClip)
+        // Blend with previous clip if it had a track for this bone
+        if (bBlendPrevious)
         {
-            auto mapIt = m_pPreviousClip->m_mapBoneNameToIndex.find(track.m_strBoneName);
-            if (mapIt != m_pPreviousClip->m_mapBoneNameToIndex.end())
+            const BonePose& pose = m_vPreviousPose[track.m_nBoneIndex];
+            if (pose.nStamp == m_nPoseStamp)
             {
-                const BoneTrack& prevTrack = m_pPreviousClip->m_vBoneTracks[mapIt->second];
-                if (nPrevFrame < (int)prevTrack.m_vKeyframes.size() && nPrevNextFrame < (int)prevTrack.m_vKeyframes.size())
-                {
-                    const Keyframe& pk1 = prevTrack.m_vKeyframes[nPrevFrame];
-                    const Keyframe& pk2 = prevTrack.m_vKeyframes[nPrevNextFrame];
-
-                    XMVECTOR prevPos = XMVectorLerp(XMLoadFloat3(&pk1.m_xmf3Position), XMLoadFloat3(&pk2.m_xmf3Position), fPrevRatio);
-                    XMVECTOR prevRot = XMQuaternionSlerp(XMLoadFloat4(&pk1.m_xmf4Rotation), XMLoadFloat4(&pk2.m_xmf4Rotation), fPrevRatio);
-                    XMVECTOR prevScale = XMVectorLerp(XMLoadFloat3(&pk1.m_xmf3Scale), XMLoadFloat3(&pk2.m_xmf3Scale), fPrevRatio);
-
-                    finalPos = XMVectorLerp(prevPos, currPos, fBlendWeight);
-                    finalRot = XMQuaternionSlerp(prevRot, currRot, fBlendWeight);
-                    finalScale = XMVectorLerp(prevScale, currScale, fBlendWeight);
-                }
+                finalPos = XMVectorLerp(XMLoadFloat3(&pose.xmf3Position), finalPos, fBlendWeight);
+                finalRot = XMQuaternionSlerp(XMLoadFloat4(&pose.xmf4Rotation), finalRot, fBlendWeight);
+                finalScale = XMVectorLerp(XMLoadFloat3(&pose.xmf3Scale), finalScale, fBlendWeight);
             }
         }
 
@@ -343,13 +374,10 @@ void AnimationComponent::Update(float deltaTime)
 
             XMMATRIX matRootInvWorld = XMMatrixInverse(nullptr, XMLoadFloat4x4(&pMeshHolder->GetTransform()->GetWorldMatrix()));
 
-            for (size_t i = 0; i < pSkinnedMesh->m_vBoneNames.size(); ++i)
+            for (size_t i = 0; i < entry.vBoneTransforms.size(); ++i)
             {
-                auto it = m_mapBoneTransforms.find(pSkinnedMesh->m_vBoneNames[i]);
-                if (it != m_mapBoneTransforms.end())
+                if (TransformComponent* pBoneTransform = entry.vBoneTransforms[i])
                 {
-                    TransformComponent* pBoneTransform = it->second;
-
                     XMMATRIX matBoneWorld = XMLoadFloat4x4(&pBoneTransform->GetWorldMatrix());
                     XMMATRIX matInvBindPose = XMLoadFloat4x4(&pSkinnedMesh->m_vBindPoses[i]);
 
@@ -54,8 +54,9 @@ public:
     float GetPlaybackSpeed() const { return m_fPlaybackSpeed; }
 
 private:
-    std::shared_ptr<AnimationSet> m_pAnimationSet;
-    AnimationClip* m_pCurrentClip = nullptr;
+    // AnimationSetCache 에서 받은 공유 세트 (읽기 전용). 재생 상태는 아래 멤버들이 인스턴스별로 가짐.
+    std::shared_ptr<const AnimationSet> m_pAnimationSet;
+    const AnimationClip* m_pCurrentClip = nullptr;
 
     float m_fCurrentTime = 0.0f;
     float m_fTimeOffset = 0.0f;  // Random offset to desync animations
@@ -64,7 +65,7 @@ private:
     bool m_bIsPlaying = false;
 
     // Blending state
-    AnimationClip* m_pPreviousClip = nullptr;
+    const AnimationClip* m_pPreviousClip = nullptr;
     float m_fPreviousTime = 0.0f;
     bool m_bPreviousLoop = false;
 
@@ -72,16 +73,33 @@ private:
     float m_fBlendDuration = 0.2f;
     float m_fBlendTimer = 0.0f;
 
-    // Cache to quickly find bone TransformComponents by name
+    // Cache to quickly find bone TransformComponents by name (바인딩 시에만 사용)
     std::map<std::string, TransformComponent*> m_mapBoneTransforms;
 
     void BuildBoneCache(GameObject* pGameObject);
 
+    // 스켈레톤 인덱스(AnimationSet 본 테이블) → 본 TransformComponent.
+    // Init / LoadAnimation 시 한 번 이름으로 바인딩. 루트·미매칭 본은 nullptr.
+    std::vector<TransformComponent*> m_vBoneBindings;
+    void BindSkeleton();
+
+    // 블렌드 중 이전 clip 포즈 (스켈레톤 인덱스별). nStamp == m_nPoseStamp 일 때만 이번 프레임 값.
+    struct BonePose
+    {
+        XMFLOAT3 xmf3Position;
+        XMFLOAT4 xmf4Rotation;
+        XMFLOAT3 xmf3Scale;
+        uint32_t nStamp = 0;
+    };
+    std::vector<BonePose> m_vPreviousPose;
+    uint32_t m_nPoseStamp = 0;
+
     // 매 프레임 재귀 스캔 제거용 캐시. Init()의 BuildBoneCache 에서 한 번만 채움.
     struct CachedSkinnedMesh
     {
         SkinnedMesh* pMesh;
         GameObject*  pHolder;
+        std::vector<TransformComponent*> vBoneTransforms;  // pMesh->m_vBoneNames 순서, 미매칭 nullptr
     };
     std::vector<CachedSkinnedMesh>     m_vSkinnedMeshes;
     std::vector<TransformComponent*>   m_vHierarchyTransforms; // ForceUpdateTransforms 대상
@@ -0,0 +1,92 @@
+#include "stdafx.h"
+#include "BonePalette.h"
+#include "Dx12App.h"
+#include <cstdio>
+
+BonePalette& BonePalette::Get()
+{
+    static BonePalette s_Palette;
+    return s_Palette;
+}
+
+void BonePalette::Init()
+{
+    if (m_pd3dBuffer)
+        return;
+
+    m_Allocator = BonePaletteAllocator(0);
+    Grow(kInitialCapacity);
+}
+
+uint32_t BonePalette::Allocate(uint32_t nBones)
+{
+    if (!m_pd3dBuffer || nBones == 0)
+        return BonePaletteAllocator::InvalidOffset;
+
+    uint32_t nOffset = m_Allocator.Allocate(nBones);
+    if (nOffset == BonePaletteAllocator::InvalidOffset)
+    {
+        Grow(m_Allocator.GetCapacity() + nBones);
+        nOffset = m_Allocator.Allocate(nBones);
+    }
+
+    // 매칭 안 된 본은 한 번도 안 써지므로 이전 주인의 행렬이 남지 않게 비운다
+    if (nOffset != BonePaletteAllocator::InvalidOffset)
+        ZeroMemory(m_pMapped + nOffset, sizeof(XMFLOAT4X4) * nBones);
+    return nOffset;
+}
+
+void BonePalette::Free(uint32_t nOffset, uint32_t nBones)
+{
+    m_Allocator.Free(nOffset, nBones);
+}
+
+void BonePalette::Write(uint32_t nIndex, const XMFLOAT4X4& xmf4x4Bone)
+{
+    m_pMapped[nIndex] = xmf4x4Bone;
+    m_nFrameUploadBytes += sizeof(XMFLOAT4X4);
+}
+
+void BonePalette::Grow(uint32_t nMinCapacity)
+{
+    uint32_t nOldCapacity = m_Allocator.GetCapacity();
+    uint32_t nNewCapacity = (std::max)(nOldCapacity * 2, kInitialCapacity);
+    while (nNewCapacity < nMinCapacity)
+        nNewCapacity *= 2;
+
+    ComPtr<ID3D12Resource> pd3dNewBuffer = Dx12App::CreateBufferResource(NULL, sizeof(XMFLOAT4X4) * nNewCapacity,
+        D3D12_HEAP_TYPE_UPLOAD, D3D12_RESOURCE_STATE_GENERIC_READ);
+
+    XMFLOAT4X4* pNewMapped = nullptr;
+    D3D12_RANGE d3dReadRange = { 0, 0 };
+    CHECK_HR(pd3dNewBuffer->Map(0, &d3dReadRange, (void**)&pNewMapped));
+
+    if (m_pd3dBuffer)
+    {
+        memcpy(pNewMapped, m_pMapped, sizeof(XMFLOAT4X4) * nOldCapacity);
+        m_pd3dBuffer->Unmap(0, NULL);
+        m_vRetiredBuffers.push_back(m_pd3dBuffer);
+    }
+
+    m_pd3dBuffer = pd3dNewBuffer;
+    m_pMapped = pNewMapped;
+    m_Allocator.Grow(nNewCapacity);
+}
+
+void BonePalette::OnGpuIdle()
+{
+    m_vRetiredBuffers.clear();
+    m_nLastFrameUploadBytes = m_nFrameUploadBytes;
+    m_nFrameUploadBytes = 0;
+}
+
+std::string BonePalette::BuildReport() const
+{
+    BonePaletteStats stats = m_Allocator.GetStats();
+    char line[256];
+    snprintf(line, sizeof(line),
+        "bone palette: %u/%u matrices (peak %u, %u ranges, largest free %u)  buffer: %.2f KB  upload/frame: %.2f KB\n",
+        stats.used, stats.capacity, stats.peakUsed, stats.allocations, stats.largestFree,
+        stats.capacity * sizeof(XMFLOAT4X4) / 1024.0, m_nLastFrameUploadBytes / 1024.0);
+    return line;
+}
@@ -0,0 +1,50 @@
+#pragma once
+#include "stdafx.h"
+#include "BonePaletteAllocator.h"
+
+// ============================================================================
+// BonePalette
+// 스킨드 메쉬 본 행렬을 담는 UPLOAD 힙 StructuredBuffer<float4x4> (셰이더 t11, 루트 파라미터 13).
+// 오브젝트 상수 버퍼에는 본 행렬 대신 이 버퍼 안의 시작 위치(gBoneOffset)만 둔다.
+//
+// 구간은 BonePaletteAllocator 가 메쉬의 실제 본 개수만큼 잘라 준다. 모자라면 버퍼를 두 배로
+// 키우고 내용을 옮긴다 — 이전 버퍼는 이미 기록된 드로우가 있을 수 있어 OnGpuIdle 까지 들고 있는다.
+// 항상 매핑된 상태이며 CPU 는 Update 중에 쓰고 GPU 는 같은 프레임 렌더에서 읽는다
+// (FrameAdvance 가 매 프레임 WaitForGpuComplete 하므로 이중 버퍼가 필요 없다). 메인 스레드 전용.
+// ============================================================================
+class BonePalette
+{
+public:
+    static constexpr uint32_t kInitialCapacity = 4096;  // 행렬 개수 (256KB)
+
+    static BonePalette& Get();
+
+    // 디바이스를 만든 뒤 한 번 (Dx12App::CreateBufferResource 사용)
+    void Init();
+
+    // 0 으로 채운 nBones 개 구간의 시작 위치. 실패하면 BonePaletteAllocator::InvalidOffset
+    uint32_t Allocate(uint32_t nBones);
+    void     Free(uint32_t nOffset, uint32_t nBones);
+
+    void Write(uint32_t nIndex, const XMFLOAT4X4& xmf4x4Bone);
+
+    D3D12_GPU_VIRTUAL_ADDRESS GetGpuVirtualAddress() const { return m_pd3dBuffer ? m_pd3dBuffer->GetGPUVirtualAddress() : 0; }
+
+    // GPU 가 멈춘 지점 — 교체된 버퍼 해제 + 프레임 업로드 통계 마감
+    void OnGpuIdle();
+
+    uint64_t GetLastFrameUploadBytes() const { return m_nLastFrameUploadBytes; }
+    BonePaletteStats GetStats() const { return m_Allocator.GetStats(); }
+    std::string BuildReport() const;
+
+private:
+    void Grow(uint32_t nMinCapacity);
+
+    BonePaletteAllocator  m_Allocator;
+    ComPtr<ID3D12Resource> m_pd3dBuffer;
+    XMFLOAT4X4*           m_pMapped = nullptr;
+    std::vector<ComPtr<ID3D12Resource>> m_vRetiredBuffers;
+
+    uint64_t m_nFrameUploadBytes = 0;
+    uint64_t m_nLastFrameUploadBytes = 0;
+};
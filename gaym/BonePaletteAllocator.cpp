@@ -0,0 +1,100 @@
+#include "BonePaletteAllocator.h"
+#include <algorithm>
+#include <iterator>
+
+BonePaletteAllocator::BonePaletteAllocator(uint32_t nCapacity)
+{
+    Grow(nCapacity);
+}
+
+uint32_t BonePaletteAllocator::Allocate(uint32_t nCount)
+{
+    if (nCount == 0)
+        return InvalidOffset;
+
+    for (auto it = m_mapFree.begin(); it != m_mapFree.end(); ++it)
+    {
+        if (it->second < nCount)
+            continue;
+
+        const uint32_t nOffset = it->first;
+        const uint32_t nRemain = it->second - nCount;
+        m_mapFree.erase(it);
+        if (nRemain > 0)
+            m_mapFree.emplace(nOffset + nCount, nRemain);
+
+        m_Stats.used += nCount;
+        m_Stats.peakUsed = (std::max)(m_Stats.peakUsed, m_Stats.used);
+        m_Stats.allocations++;
+        return nOffset;
+    }
+    return InvalidOffset;
+}
+
+void BonePaletteAllocator::Free(uint32_t nOffset, uint32_t nCount)
+{
+    if (nOffset == InvalidOffset || nCount == 0)
+        return;
+
+    m_Stats.used -= (std::min)(m_Stats.used, nCount);
+    m_Stats.allocations--;
+
+    auto itNext = m_mapFree.lower_bound(nOffset);
+
+    // 앞 구간과 붙어 있으면 합친다
+    if (itNext != m_mapFree.begin())
+    {
+        auto itPrev = std::prev(itNext);
+        if (itPrev->first + itPrev->second == nOffset)
+        {
+            nOffset = itPrev->first;
+            nCount += itPrev->second;
+            m_mapFree.erase(itPrev);
+        }
+    }
+    // 뒤 구간과 붙어 있으면 합친다
+    if (itNext != m_mapFree.end() && nOffset + nCount == itNext->first)
+    {
+        nCount += itNext->second;
+        m_mapFree.erase(itNext);
+    }
+    m_mapFree.emplace(nOffset, nCount);
+}
+
+void BonePaletteAllocator::Grow(uint32_t nNewCapacity)
+{
+    if (nNewCapacity <= m_Stats.capacity)
+        return;
+
+    const uint32_t nOld = m_Stats.capacity;
+    m_Stats.capacity = nNewCapacity;
+
+    // 끝에 빈 구간이 있으면 늘리고, 없으면 새로 붙인다
+    if (!m_mapFree.empty())
+    {
+        auto itLast = std::prev(m_mapFree.end());
+        if (itLast->first + itLast->second == nOld)
+        {
+            itLast->second += nNewCapacity - nOld;
+            return;
+        }
+    }
+    m_mapFree.emplace(nOld, nNewCapacity - nOld);
+}
+
+void BonePaletteAllocator::Reset()
+{
+    const uint32_t nCapacity = m_Stats.capacity;
+    m_mapFree.clear();
+    m_Stats = BonePaletteStats();
+    Grow(nCapacity);
+}
+
+BonePaletteStats BonePaletteAllocator::GetStats() const
+{
+    BonePaletteStats stats = m_Stats;
+    stats.largestFree = 0;
+    for (const auto& [nOffset, nCount] : m_mapFree)
+        stats.largestFree = (std::max)(stats.largestFree, nCount);
+    return stats;
+}
@@ -0,0 +1,45 @@
+#pragma once
+#include <cstdint>
+#include <map>
+
+// ============================================================================
+// BonePaletteAllocator
+// 본 팔레트 버퍼(행렬 단위)의 구간 할당기. 스킨드 메쉬마다 실제 본 개수만큼 연속 구간을 준다.
+//
+//  - 빈 구간은 offset → count 맵으로 관리하고 First-fit 으로 자른다
+//  - Free 는 앞뒤 빈 구간과 합쳐 단편화를 줄인다
+//  - 공간이 모자라면 Allocate 가 InvalidOffset 을 돌려준다 — Grow 로 용량을 늘린 뒤 다시 시도
+//
+// D3D12 에 의존하지 않는다 (실제 버퍼는 BonePalette 가 가짐). 메인 스레드 전용.
+// ============================================================================
+
+struct BonePaletteStats
+{
+    uint32_t capacity = 0;          // 행렬 개수
+    uint32_t used = 0;
+    uint32_t peakUsed = 0;
+    uint32_t allocations = 0;       // 살아 있는 구간 수
+    uint32_t largestFree = 0;
+};
+
+class BonePaletteAllocator
+{
+public:
+    static constexpr uint32_t InvalidOffset = UINT32_MAX;
+
+    explicit BonePaletteAllocator(uint32_t nCapacity = 0);
+
+    uint32_t Allocate(uint32_t nCount);
+    void     Free(uint32_t nOffset, uint32_t nCount);
+
+    // 뒤쪽에 빈 구간을 덧붙인다 (줄이는 것은 지원하지 않음)
+    void     Grow(uint32_t nNewCapacity);
+    void     Reset();
+
+    uint32_t GetCapacity() const { return m_Stats.capacity; }
+    BonePaletteStats GetStats() const;
+
+private:
+    std::map<uint32_t, uint32_t> m_mapFree;     // offset → count
+    BonePaletteStats m_Stats;
+};
@@ -0,0 +1,149 @@
+#include "CollisionBroadphase.h"
+#include <algorithm>
+#include <cmath>
+
+void CollisionBroadphase::BeginFrame()
+{
+    ++m_frameCounter;
+}
+
+uint32_t CollisionBroadphase::Submit(uint32_t colliderID, uint32_t order, bool bEnabled,
+                                     CollisionLayer layer, CollisionLayer mask, bool& bOutNew)
+{
+    bOutNew = false;
+    uint32_t slot;
+
+    auto it = m_slotByID.find(colliderID);
+    if (it != m_slotByID.end())
+    {
+        slot = it->second;
+        if (m_proxies[slot].lastSeenFrame == m_frameCounter)
+            return InvalidSlot;   // Same collider listed twice - keep the first occurrence
+    }
+    else
+    {
+        if (!m_freeSlots.empty())
+        {
+            slot = m_freeSlots.back();
+            m_freeSlots.pop_back();
+        }
+        else
+        {
+            slot = static_cast<uint32_t>(m_proxies.size());
+            m_proxies.emplace_back();
+        }
+        m_slotByID.emplace(colliderID, slot);
+        m_sortedSlots.push_back(slot);
+        bOutNew = true;
+    }
+
+    Proxy& proxy = m_proxies[slot];
+    proxy.colliderID = colliderID;
+    proxy.order = order;
+    proxy.lastSeenFrame = m_frameCounter;
+    proxy.bEnabled = bEnabled;
+    proxy.layer = layer;
+    proxy.mask = mask;
+    return slot;
+}
+
+void CollisionBroadphase::SetBounds(uint32_t slot, const float center[3], const float extents[3])
+{
+    Proxy& proxy = m_proxies[slot];
+    for (int axis = 0; axis < 3; ++axis)
+    {
+        proxy.center[axis] = center[axis];
+        proxy.extents[axis] = extents[axis];
+    }
+}
+
+void CollisionBroadphase::EndFrame(std::vector<uint32_t>* pOutEvicted)
+{
+    // Evict proxies whose collider was not submitted this frame (deleted objects, previous room)
+    size_t writeIndex = 0;
+    for (size_t readIndex = 0; readIndex < m_sortedSlots.size(); ++readIndex)
+    {
+        const uint32_t slot = m_sortedSlots[readIndex];
+        Proxy& proxy = m_proxies[slot];
+        if (proxy.lastSeenFrame != m_frameCounter)
+        {
+            m_slotByID.erase(proxy.colliderID);
+            m_freeSlots.push_back(slot);
+            proxy = Proxy();
+            if (pOutEvicted)
+                pOutEvicted->push_back(slot);
+            continue;
+        }
+        m_sortedSlots[writeIndex++] = slot;
+    }
+    m_sortedSlots.resize(writeIndex);
+
+    // Insertion sort by min X - order barely changes between frames, so this is close to O(n)
+    for (size_t i = 1; i < m_sortedSlots.size(); ++i)
+    {
+        const uint32_t slot = m_sortedSlots[i];
+        const float minX = MinX(m_proxies[slot]);
+        size_t j = i;
+        while (j > 0 && MinX(m_proxies[m_sortedSlots[j - 1]]) > minX)
+        {
+            m_sortedSlots[j] = m_sortedSlots[j - 1];
+            --j;
+        }
+        m_sortedSlots[j] = slot;
+    }
+}
+
+void CollisionBroadphase::FindCandidatePairs(std::vector<std::pair<uint32_t, uint32_t>>& outPairs) const
+{
+    outPairs.clear();
+
+    const size_t count = m_sortedSlots.size();
+    for (size_t i = 0; i < count; ++i)
+    {
+        const Proxy& a = m_proxies[m_sortedSlots[i]];
+        if (!a.bEnabled)
+            continue;
+
+        const float maxX = a.center[0] + a.extents[0] + Margin;
+
+        for (size_t j = i + 1; j < count; ++j)
+        {
+            const Proxy& b = m_proxies[m_sortedSlots[j]];
+            if (MinX(b) > maxX)
+                break;  // Sorted by min X - nothing further can overlap on X
+
+            if (!b.bEnabled)
+                continue;
+
+            if (fabsf(a.center[1] - b.center[1]) > a.extents[1] + b.extents[1] + Margin)
+                continue;
+            if (fabsf(a.center[2] - b.center[2]) > a.extents[2] + b.extents[2] + Margin)
+                continue;
+
+            // Same rule as ColliderComponent::ShouldCollideWith
+            if (!HasLayer(a.mask, b.layer) || !HasLayer(b.mask, a.layer))
+                continue;
+
+            if (a.order < b.order) outPairs.emplace_back(a.order, b.order);
+            else                   outPairs.emplace_back(b.order, a.order);
+        }
+    }
+
+    std::sort(outPairs.begin(), outPairs.end());
+}
+
+uint32_t CollisionBroadphase::FindSlot(uint32_t colliderID) const
+{
+    auto it = m_slotByID.find(colliderID);
+    if (it == m_slotByID.end() || m_proxies[it->second].lastSeenFrame != m_frameCounter)
+        return InvalidSlot;
+    return it->second;
+}
+
+void CollisionBroadphase::Clear()
+{
+    m_proxies.clear();
+    m_freeSlots.clear();
+    m_slotByID.clear();
+    m_sortedSlots.clear();
+}
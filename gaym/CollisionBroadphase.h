@@ -0,0 +1,67 @@
+#pragma once
+#include <vector>
+#include <unordered_map>
+#include <utility>
+#include <cstddef>
+#include <cstdint>
+#include "CollisionLayer.h"
+
+// Persistent sweep-and-prune broadphase used by CollisionManager.
+// Proxies are keyed by collider ID and live across frames; only bounds of moved colliders are
+// refreshed by the owner. Layer masks are applied here, so the narrowphase sees only pairs
+// that could actually collide. Has no DirectX dependency so it can be verified on the CPU alone.
+class CollisionBroadphase
+{
+public:
+    static constexpr uint32_t InvalidSlot = 0xFFFFFFFF;
+
+    // Small slack on the AABB overlap test so touching OBBs (which Intersects() accepts)
+    // are never rejected by float rounding in the corner-derived AABB
+    static constexpr float Margin = 0.001f;
+
+    // Starts a new frame of Submit() calls
+    void BeginFrame();
+
+    // Registers a collider for this frame at index 'order' of the frame's collider list.
+    // Returns the proxy slot, or InvalidSlot if the same ID was already submitted this frame.
+    // bOutNew is set when the proxy was created (the owner must then call SetBounds)
+    uint32_t Submit(uint32_t colliderID, uint32_t order, bool bEnabled,
+                    CollisionLayer layer, CollisionLayer mask, bool& bOutNew);
+
+    // World AABB of a proxy as center/extents (same layout as DirectX::BoundingBox)
+    void SetBounds(uint32_t slot, const float center[3], const float extents[3]);
+
+    // Evicts proxies that were not submitted this frame and restores the min X order.
+    // Evicted slots are appended to pOutEvicted so the owner can drop per-slot data
+    void EndFrame(std::vector<uint32_t>* pOutEvicted = nullptr);
+
+    // Candidate pairs as (lower order, higher order), sorted the way a full i < j loop visits them
+    void FindCandidatePairs(std::vector<std::pair<uint32_t, uint32_t>>& outPairs) const;
+
+    // Slot of a collider submitted this frame, or InvalidSlot
+    uint32_t FindSlot(uint32_t colliderID) const;
+
+    void Clear();
+    size_t GetProxyCount() const { return m_sortedSlots.size(); }
+
+private:
+    struct Proxy
+    {
+        uint32_t colliderID = 0;
+        uint32_t order = 0;              // Index in this frame's combined collider list
+        uint64_t lastSeenFrame = 0;
+        bool bEnabled = false;
+        CollisionLayer layer = CollisionLayer::None;
+        CollisionLayer mask = CollisionLayer::All;
+        float center[3] = {};
+        float extents[3] = {};
+    };
+
+    static float MinX(const Proxy& proxy) { return proxy.center[0] - proxy.extents[0]; }
+
+    std::vector<Proxy> m_proxies;
+    std::vector<uint32_t> m_freeSlots;
+    std::unordered_map<uint32_t, uint32_t> m_slotByID;   // colliderID -> slot in m_proxies
+    std::vector<uint32_t> m_sortedSlots;                 // Slots sorted by AABB min X
+    uint64_t m_frameCounter = 0;
+};
@@ -52,13 +52,15 @@ void CollisionManager::Update(const std::vector<ColliderComponent*>& globalColli
     allColliders.insert(allColliders.end(), globalColliders.begin(), globalColliders.end());
     allColliders.insert(allColliders.end(), roomColliders.begin(), roomColliders.end());
 
-    // Check all pairs (O(n^2) - can be optimized with spatial partitioning later)
-    for (size_t i = 0; i < allColliders.size(); ++i)
+    // Broadphase: sweep-and-prune over persistent proxies, layer masks applied up front
+    UpdateProxies(allColliders);
+    m_broadphase.FindCandidatePairs(m_candidatePairs);
+
+    // Candidates come in the same (i < j) order as a full all-pairs loop,
+    // so Enter/Stay callbacks and wall push-out happen in an identical sequence
+    for (const auto& candidate : m_candidatePairs)
     {
-        for (size_t j = i + 1; j < allColliders.size(); ++j)
-        {
-            CheckCollision(allColliders[i], allColliders[j]);
-        }
+        CheckCollision(allColliders[candidate.first], allColliders[candidate.second]);
     }
 
     // Check for collision exits (pairs that were colliding last frame but not this frame)
@@ -66,16 +68,14 @@ void CollisionManager::Update(const std::vector<ColliderComponent*>& globalColli
     {
         if (m_currentFrameCollisions.find(pair) == m_currentFrameCollisions.end())
         {
-            // Find the colliders by ID
+            // Find the colliders by ID (only those present in this frame's list)
             ColliderComponent* pA = nullptr;
             ColliderComponent* pB = nullptr;
 
-            for (auto* pCollider : allColliders)
-            {
-                if (pCollider->GetColliderID() == pair.id1) pA = pCollider;
-                if (pCollider->GetColliderID() == pair.id2) pB = pCollider;
-                if (pA && pB) break;
-            }
+            const uint32_t slotA = m_broadphase.FindSlot(pair.id1);
+            if (slotA != CollisionBroadphase::InvalidSlot) pA = m_proxyCache[slotA].pCollider;
+            const uint32_t slotB = m_broadphase.FindSlot(pair.id2);
+            if (slotB != CollisionBroadphase::InvalidSlot) pB = m_proxyCache[slotB].pCollider;
 
             // Notify exit
             if (pA && pB)
@@ -87,6 +87,58 @@ void CollisionManager::Update(const std::vector<ColliderComponent*>& globalColli
     }
 }
 
+void CollisionManager::UpdateProxies(const std::vector<ColliderComponent*>& allColliders)
+{
+    m_broadphase.BeginFrame();
+
+    for (uint32_t i = 0; i < static_cast<uint32_t>(allColliders.size()); ++i)
+    {
+        ColliderComponent* pCollider = allColliders[i];
+        if (!pCollider)
+            continue;
+
+        bool bNewProxy = false;
+        const uint32_t slot = m_broadphase.Submit(pCollider->GetColliderID(), i, pCollider->IsEnabled(),
+                                                  pCollider->GetLayer(), pCollider->GetCollisionMask(), bNewProxy);
+        if (slot == CollisionBroadphase::InvalidSlot)
+            continue;   // Same collider listed twice - keep the first occurrence
+
+        if (slot >= m_proxyCache.size())
+            m_proxyCache.resize(slot + 1);
+        if (bNewProxy)
+            m_proxyCache[slot] = ProxyCache();
+        m_proxyCache[slot].pCollider = pCollider;
+
+        if (pCollider->IsEnabled())
+            RefreshProxyBounds(slot);
+    }
+
+    // Drop cached data of colliders that were not submitted this frame
+    m_evictedSlots.clear();
+    m_broadphase.EndFrame(&m_evictedSlots);
+    for (uint32_t slot : m_evictedSlots)
+        m_proxyCache[slot] = ProxyCache();
+}
+
+void CollisionManager::RefreshProxyBounds(uint32_t slot)
+{
+    ProxyCache& cache = m_proxyCache[slot];
+    const BoundingOrientedBox& obb = cache.pCollider->GetBoundingBox();
+
+    // The OBB only changes when the owner's TransformComponent moved, so skip the rebuild otherwise
+    if (cache.bHasBounds && memcmp(&obb, &cache.cachedObb, sizeof(BoundingOrientedBox)) == 0)
+        return;
+
+    cache.cachedObb = obb;
+    cache.bHasBounds = true;
+
+    XMFLOAT3 corners[BoundingOrientedBox::CORNER_COUNT];
+    obb.GetCorners(corners);
+    BoundingBox aabb;
+    BoundingBox::CreateFromPoints(aabb, BoundingOrientedBox::CORNER_COUNT, corners, sizeof(XMFLOAT3));
+    m_broadphase.SetBounds(slot, &aabb.Center.x, &aabb.Extents.x);
+}
+
 void CollisionManager::CheckCollision(ColliderComponent* pA, ColliderComponent* pB)
 {
     if (!pA || !pB)
@@ -178,4 +230,8 @@ void CollisionManager::ClearCollisionState()
 {
     m_previousFrameCollisions.clear();
     m_currentFrameCollisions.clear();
+
+    m_broadphase.Clear();
+    m_proxyCache.clear();
+    m_candidatePairs.clear();
 }
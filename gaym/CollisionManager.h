@@ -2,6 +2,8 @@
 #include <vector>
 #include <set>
 #include <cstdint>
+#include <DirectXCollision.h>
+#include "CollisionBroadphase.h"
 
 class ColliderComponent;
 
@@ -48,6 +50,20 @@ public:
     void ClearCollisionState();
 
 private:
+    // Per-slot data the broadphase does not keep (indexed by CollisionBroadphase slot)
+    struct ProxyCache
+    {
+        ColliderComponent* pCollider = nullptr;
+        bool bHasBounds = false;         // False until the first enabled frame builds the AABB
+
+        // Last OBB the AABB was built from (AABB is refreshed only when this changes)
+        DirectX::BoundingOrientedBox cachedObb;
+    };
+
+    // Submit this frame's colliders and refresh AABBs of moved colliders
+    void UpdateProxies(const std::vector<ColliderComponent*>& allColliders);
+    void RefreshProxyBounds(uint32_t slot);
+
     void CheckCollision(ColliderComponent* pA, ColliderComponent* pB);
     // Push a dynamic object (Player/Enemy) out of a Wall collider on the XZ plane
     static void ResolveWallPenetration(ColliderComponent* pDynamic, ColliderComponent* pWall);
@@ -58,4 +74,10 @@ private:
 
     // Registered colliders (optional - can be used for optimization)
     std::vector<ColliderComponent*> m_registeredColliders;
+
+    // Broadphase state (persistent across frames)
+    CollisionBroadphase m_broadphase;
+    std::vector<ProxyCache> m_proxyCache;
+    std::vector<uint32_t> m_evictedSlots;
+    std::vector<std::pair<uint32_t, uint32_t>> m_candidatePairs;
 };
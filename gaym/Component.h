@@ -1,21 +1,105 @@
 #pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
 
 class GameObject; // Forward declaration
 struct ID3D12GraphicsCommandList; // Forward declaration
 struct ID3D12Device; // Forward declaration
 class InputSystem; // Forward declaration for InputSystem
 
+using ComponentTypeId = uint32_t;
+static constexpr ComponentTypeId MAX_COMPONENT_TYPES     = 32;
+static constexpr ComponentTypeId INVALID_COMPONENT_TYPE  = 0xFFFFFFFF;
+
+// 컴포넌트 타입마다 처음 쓰일 때 0부터 순서대로 ID를 부여 (RTTI 없이 슬롯/배열 인덱스로 사용)
+// 워커 스레드에서 처음 요청될 수도 있으므로 카운터는 atomic
+class ComponentTypeIds
+{
+public:
+    template<typename T>
+    static ComponentTypeId Get()
+    {
+        static const ComponentTypeId id = s_nNextId.fetch_add(1, std::memory_order_relaxed);
+        return id;
+    }
+
+private:
+    static inline std::atomic<ComponentTypeId> s_nNextId{ 0 };
+};
+
 class Component
 {
 public:
     Component(GameObject* pOwner) : m_pOwner(pOwner) {}
-    virtual ~Component() = default;
+    virtual ~Component();
 
     virtual void Init(ID3D12Device* pDevice, ID3D12GraphicsCommandList* pCommandList) {}
     virtual void Update(float deltaTime) {}
     virtual void Render(ID3D12GraphicsCommandList* pCommandList) {}
 
     GameObject* GetOwner() { return m_pOwner; }
+    ComponentTypeId GetTypeId() const { return m_nTypeId; }
+
 protected:
     GameObject* m_pOwner;
-};
\ No newline at end of file
+
+private:
+    friend class GameObject;
+    friend class ComponentRegistry;
+
+    ComponentTypeId m_nTypeId     = INVALID_COMPONENT_TYPE;  // AddComponent에서 설정
+    uint32_t        m_nDenseIndex = 0;                       // ComponentRegistry 타입별 배열 내 위치
+};
+
+// 살아 있는 모든 컴포넌트를 타입별 밀집 배열로 관리 (씬 전체 질의용).
+// AddComponent에서 등록되고 컴포넌트 소멸자에서 swap-remove로 빠진다.
+// 프로세스 전역이라 로드돼 있는 모든 방의 컴포넌트가 섞여 나온다 -> 방 단위 질의는 GameObject::m_pOwnerRoom으로 거른다.
+// ForEach 도중에 같은 타입 컴포넌트를 추가/삭제하면 안 된다.
+class ComponentRegistry
+{
+public:
+    template<typename T, typename Fn>
+    static void ForEach(Fn&& fn)
+    {
+        for (Component* pComponent : Storage()[ComponentTypeIds::Get<T>()])
+            fn(static_cast<T*>(pComponent));
+    }
+
+    template<typename T>
+    static size_t Count() { return Storage()[ComponentTypeIds::Get<T>()].size(); }
+
+private:
+    friend class GameObject;
+    friend class Component;
+
+    static void Register(Component* pComponent)
+    {
+        auto& v = Storage()[pComponent->m_nTypeId];
+        pComponent->m_nDenseIndex = static_cast<uint32_t>(v.size());
+        v.push_back(pComponent);
+    }
+
+    static void Unregister(Component* pComponent)
+    {
+        auto& v = Storage()[pComponent->m_nTypeId];
+        Component* pLast = v.back();
+        v[pComponent->m_nDenseIndex] = pLast;
+        pLast->m_nDenseIndex = pComponent->m_nDenseIndex;
+        v.pop_back();
+    }
+
+    // 정적 객체 소멸 순서와 무관하게 종료 시 남은 GameObject가 해제될 수 있도록 일부러 해제하지 않는다
+    static std::vector<Component*>* Storage()
+    {
+        static std::vector<Component*>* s_pComponents = new std::vector<Component*>[MAX_COMPONENT_TYPES];
+        return s_pComponents;
+    }
+};
+
+inline Component::~Component()
+{
+    if (m_nTypeId != INVALID_COMPONENT_TYPE)
+        ComponentRegistry::Unregister(this);
+}
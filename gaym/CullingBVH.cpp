@@ -0,0 +1,597 @@
+#include "CullingBVH.h"
+#include <algorithm>
+#include <cmath>
+
+namespace
+{
+    constexpr int kStaticLeafSize = 4;
+
+    // 평면 하나에 대해: 0 = 완전히 바깥, 1 = 걸침, 2 = 완전히 안쪽
+    inline int ClassifyAABB(const float plane[4], const CullAABB& box)
+    {
+        float pv = plane[3], nv = plane[3];
+        for (int a = 0; a < 3; a++)
+        {
+            if (plane[a] >= 0.0f) { pv += plane[a] * box.vMax[a]; nv += plane[a] * box.vMin[a]; }
+            else                  { pv += plane[a] * box.vMin[a]; nv += plane[a] * box.vMax[a]; }
+        }
+        if (pv < 0.0f) return 0;
+        return (nv >= 0.0f) ? 2 : 1;
+    }
+
+    // mask 의 평면만 검사. 바깥이면 false, 완전히 안쪽인 평면은 mask 에서 뺀다
+    inline bool CullWithMask(const CullFrustum& frustum, const CullAABB& box, uint32_t& mask)
+    {
+        for (int p = 0; p < 6; p++)
+        {
+            if (!(mask & (1u << p)))
+                continue;
+            int nClass = ClassifyAABB(frustum.planes[p], box);
+            if (nClass == 0)
+                return false;
+            if (nClass == 2)
+                mask &= ~(1u << p);
+        }
+        return true;
+    }
+
+    inline CullAABB Fatten(const CullAABB& box, float fMargin)
+    {
+        CullAABB fat = box;
+        for (int a = 0; a < 3; a++)
+        {
+            fat.vMin[a] -= fMargin;
+            fat.vMax[a] += fMargin;
+        }
+        return fat;
+    }
+}
+
+// =============================================================================
+// CullAABB / CullFrustum
+// =============================================================================
+
+CullAABB CullAABB::Union(const CullAABB& a, const CullAABB& b)
+{
+    CullAABB out;
+    for (int i = 0; i < 3; i++)
+    {
+        out.vMin[i] = (std::min)(a.vMin[i], b.vMin[i]);
+        out.vMax[i] = (std::max)(a.vMax[i], b.vMax[i]);
+    }
+    return out;
+}
+
+bool CullAABB::Contains(const CullAABB& other) const
+{
+    for (int i = 0; i < 3; i++)
+    {
+        if (other.vMin[i] < vMin[i] || other.vMax[i] > vMax[i])
+            return false;
+    }
+    return true;
+}
+
+bool CullAABB::Overlaps(const CullAABB& other) const
+{
+    for (int i = 0; i < 3; i++)
+    {
+        if (other.vMax[i] < vMin[i] || other.vMin[i] > vMax[i])
+            return false;
+    }
+    return true;
+}
+
+float CullAABB::SurfaceArea() const
+{
+    float dx = vMax[0] - vMin[0], dy = vMax[1] - vMin[1], dz = vMax[2] - vMin[2];
+    return 2.0f * (dx * dy + dy * dz + dz * dx);
+}
+
+CullFrustum CullFrustum::FromViewProj(const float m[16])
+{
+    // clip = v * M 이므로 clip 의 각 성분은 M 의 열. 평면은 열 조합 (Gribb/Hartmann)
+    auto col = [&](int c, int r) { return m[r * 4 + c]; };
+
+    CullFrustum f;
+    for (int r = 0; r < 4; r++)
+    {
+        f.planes[0][r] = col(3, r) + col(0, r);   // left
+        f.planes[1][r] = col(3, r) - col(0, r);   // right
+        f.planes[2][r] = col(3, r) + col(1, r);   // bottom
+        f.planes[3][r] = col(3, r) - col(1, r);   // top
+        f.planes[4][r] = col(2, r);               // near (D3D: 0 <= z)
+        f.planes[5][r] = col(3, r) - col(2, r);   // far
+    }
+
+    // 구 검사용으로 법선 정규화
+    for (auto& plane : f.planes)
+    {
+        float fLen = std::sqrt(plane[0] * plane[0] + plane[1] * plane[1] + plane[2] * plane[2]);
+        if (fLen > 0.0f)
+        {
+            for (float& v : plane)
+                v /= fLen;
+        }
+    }
+    return f;
+}
+
+bool CullFrustum::TestAABB(const CullAABB& box) const
+{
+    for (const auto& plane : planes)
+    {
+        if (ClassifyAABB(plane, box) == 0)
+            return false;
+    }
+    return true;
+}
+
+bool CullFrustum::TestSphere(const float center[3], float fRadius) const
+{
+    for (const auto& plane : planes)
+    {
+        if (plane[0] * center[0] + plane[1] * center[1] + plane[2] * center[2] + plane[3] < -fRadius)
+            return false;
+    }
+    return true;
+}
+
+// =============================================================================
+// StaticBVH
+// =============================================================================
+
+void StaticBVH::Build(const std::vector<CullAABB>& vBoxes, const std::vector<int>& vItems)
+{
+    Clear();
+    if (vItems.empty())
+        return;
+
+    m_vBoxes = vBoxes;
+    m_vItems = vItems;
+    m_vNodes.reserve(vItems.size() * 2 / kStaticLeafSize + 1);
+    BuildRecursive(m_vBoxes, 0, static_cast<int>(m_vItems.size()));
+}
+
+void StaticBVH::Clear()
+{
+    m_vNodes.clear();
+    m_vItems.clear();
+    m_vBoxes.clear();
+}
+
+int StaticBVH::BuildRecursive(std::vector<CullAABB>& vBoxes, int nFirst, int nCount)
+{
+    int nNode = static_cast<int>(m_vNodes.size());
+    m_vNodes.emplace_back();
+
+    CullAABB box = vBoxes[nFirst];
+    CullAABB centroids;
+    for (int a = 0; a < 3; a++)
+        centroids.vMin[a] = centroids.vMax[a] = (box.vMin[a] + box.vMax[a]) * 0.5f;
+    for (int i = nFirst + 1; i < nFirst + nCount; i++)
+    {
+        box = CullAABB::Union(box, vBoxes[i]);
+        for (int a = 0; a < 3; a++)
+        {
+            float c = (vBoxes[i].vMin[a] + vBoxes[i].vMax[a]) * 0.5f;
+            centroids.vMin[a] = (std::min)(centroids.vMin[a], c);
+            centroids.vMax[a] = (std::max)(centroids.vMax[a], c);
+        }
+    }
+    m_vNodes[nNode].box = box;
+    m_vNodes[nNode].nFirst = nFirst;
+    m_vNodes[nNode].nCount = nCount;
+
+    if (nCount <= kStaticLeafSize)
+        return nNode;
+
+    // 중심점 분포가 가장 넓은 축에서 개수 기준 중앙 분할
+    int nAxis = 0;
+    float fBest = -1.0f;
+    for (int a = 0; a < 3; a++)
+    {
+        float fExtent = centroids.vMax[a] - centroids.vMin[a];
+        if (fExtent > fBest) { fBest = fExtent; nAxis = a; }
+    }
+
+    // 박스와 아이템을 같이 재배열
+    std::vector<int> vOrder(nCount);
+    for (int i = 0; i < nCount; i++)
+        vOrder[i] = nFirst + i;
+    int nHalf = nCount / 2;
+    std::nth_element(vOrder.begin(), vOrder.begin() + nHalf, vOrder.end(),
+        [&](int a, int b)
+        {
+            return vBoxes[a].vMin[nAxis] + vBoxes[a].vMax[nAxis] < vBoxes[b].vMin[nAxis] + vBoxes[b].vMax[nAxis];
+        });
+
+    std::vector<CullAABB> vBoxTmp(nCount);
+    std::vector<int> vItemTmp(nCount);
+    for (int i = 0; i < nCount; i++)
+    {
+        vBoxTmp[i] = vBoxes[vOrder[i]];
+        vItemTmp[i] = m_vItems[vOrder[i]];
+    }
+    std::copy(vBoxTmp.begin(), vBoxTmp.end(), vBoxes.begin() + nFirst);
+    std::copy(vItemTmp.begin(), vItemTmp.end(), m_vItems.begin() + nFirst);
+
+    int nLeft = BuildRecursive(vBoxes, nFirst, nHalf);
+    int nRight = BuildRecursive(vBoxes, nFirst + nHalf, nCount - nHalf);
+    m_vNodes[nNode].nLeft = nLeft;
+    m_vNodes[nNode].nRight = nRight;
+    return nNode;
+}
+
+void StaticBVH::Query(const CullFrustum& frustum, std::vector<int>& outItems) const
+{
+    if (m_vNodes.empty())
+        return;
+
+    struct Entry { int nNode; uint32_t mask; };
+    Entry stack[64];
+    int nTop = 0;
+    stack[nTop++] = { 0, 0x3Fu };
+
+    while (nTop > 0)
+    {
+        Entry e = stack[--nTop];
+        const Node& node = m_vNodes[e.nNode];
+
+        uint32_t mask = e.mask;
+        if (!CullWithMask(frustum, node.box, mask))
+            continue;
+
+        // 완전히 안쪽이면 구간을 그대로 넣는다
+        if (mask == 0)
+        {
+            outItems.insert(outItems.end(), m_vItems.begin() + node.nFirst, m_vItems.begin() + node.nFirst + node.nCount);
+            continue;
+        }
+
+        if (node.nLeft < 0)
+        {
+            for (int i = node.nFirst; i < node.nFirst + node.nCount; i++)
+            {
+                uint32_t itemMask = mask;
+                if (CullWithMask(frustum, m_vBoxes[i], itemMask))
+                    outItems.push_back(m_vItems[i]);
+            }
+            continue;
+        }
+
+        stack[nTop++] = { node.nLeft, mask };
+        stack[nTop++] = { node.nRight, mask };
+    }
+}
+
+// =============================================================================
+// DynamicAABBTree
+// =============================================================================
+
+int DynamicAABBTree::AllocateNode()
+{
+    if (m_nFreeList >= 0)
+    {
+        int nNode = m_nFreeList;
+        m_nFreeList = m_vNodes[nNode].nNextFree;
+        m_vNodes[nNode] = Node();
+        return nNode;
+    }
+    m_vNodes.emplace_back();
+    return static_cast<int>(m_vNodes.size()) - 1;
+}
+
+void DynamicAABBTree::FreeNode(int nNode)
+{
+    m_vNodes[nNode].nNextFree = m_nFreeList;
+    m_vNodes[nNode].nItem = -1;
+    m_nFreeList = nNode;
+}
+
+int DynamicAABBTree::Insert(const CullAABB& box, int nItem)
+{
+    int nLeaf = AllocateNode();
+    m_vNodes[nLeaf].box = Fatten(box, kFatMargin);
+    m_vNodes[nLeaf].tight = box;
+    m_vNodes[nLeaf].nItem = nItem;
+    InsertLeaf(nLeaf);
+    m_nProxyCount++;
+    return nLeaf;
+}
+
+void DynamicAABBTree::Remove(int nProxy)
+{
+    RemoveLeaf(nProxy);
+    FreeNode(nProxy);
+    m_nProxyCount--;
+}
+
+bool DynamicAABBTree::Move(int nProxy, const CullAABB& box)
+{
+    m_vNodes[nProxy].tight = box;
+    if (m_vNodes[nProxy].box.Contains(box))
+        return false;
+
+    RemoveLeaf(nProxy);
+    m_vNodes[nProxy].box = Fatten(box, kFatMargin);
+    InsertLeaf(nProxy);
+    return true;
+}
+
+void DynamicAABBTree::Clear()
+{
+    m_vNodes.clear();
+    m_nRoot = -1;
+    m_nFreeList = -1;
+    m_nProxyCount = 0;
+}
+
+void DynamicAABBTree::InsertLeaf(int nLeaf)
+{
+    if (m_nRoot < 0)
+    {
+        m_nRoot = nLeaf;
+        m_vNodes[nLeaf].nParent = -1;
+        return;
+    }
+
+    // 표면적 증가가 가장 적은 쪽으로 내려가 형제를 고른다
+    const CullAABB leafBox = m_vNodes[nLeaf].box;
+    int nIndex = m_nRoot;
+    while (m_vNodes[nIndex].nLeft >= 0)
+    {
+        const Node& node = m_vNodes[nIndex];
+        float fArea = node.box.SurfaceArea();
+        float fCombined = CullAABB::Union(node.box, leafBox).SurfaceArea();
+        float fCost = 2.0f * fCombined;
+        float fInherit = 2.0f * (fCombined - fArea);
+
+        auto childCost = [&](int nChild)
+        {
+            const Node& child = m_vNodes[nChild];
+            float fNew = CullAABB::Union(child.box, leafBox).SurfaceArea();
+            return (child.nLeft < 0) ? fNew + fInherit : (fNew - child.box.SurfaceArea()) + fInherit;
+        };
+        float fCostLeft = childCost(node.nLeft);
+        float fCostRight = childCost(node.nRight);
+
+        if (fCost < fCostLeft && fCost < fCostRight)
+            break;
+        nIndex = (fCostLeft < fCostRight) ? node.nLeft : node.nRight;
+    }
+
+    int nSibling = nIndex;
+    int nOldParent = m_vNodes[nSibling].nParent;
+    int nNewParent = AllocateNode();
+    m_vNodes[nNewParent].nParent = nOldParent;
+    m_vNodes[nNewParent].box = CullAABB::Union(leafBox, m_vNodes[nSibling].box);
+    m_vNodes[nNewParent].nLeft = nSibling;
+    m_vNodes[nNewParent].nRight = nLeaf;
+    m_vNodes[nSibling].nParent = nNewParent;
+    m_vNodes[nLeaf].nParent = nNewParent;
+
+    if (nOldParent >= 0)
+    {
+        if (m_vNodes[nOldParent].nLeft == nSibling)
+            m_vNodes[nOldParent].nLeft = nNewParent;
+        else
+            m_vNodes[nOldParent].nRight = nNewParent;
+    }
+    else
+    {
+        m_nRoot = nNewParent;
+    }
+
+    Refit(m_vNodes[nLeaf].nParent);
+}
+
+void DynamicAABBTree::RemoveLeaf(int nLeaf)
+{
+    if (nLeaf == m_nRoot)
+    {
+        m_nRoot = -1;
+        return;
+    }
+
+    int nParent = m_vNodes[nLeaf].nParent;
+    int nGrandParent = m_vNodes[nParent].nParent;
+    int nSibling = (m_vNodes[nParent].nLeft == nLeaf) ? m_vNodes[nParent].nRight : m_vNodes[nParent].nLeft;
+
+    if (nGrandParent >= 0)
+    {
+        if (m_vNodes[nGrandParent].nLeft == nParent)
+            m_vNodes[nGrandParent].nLeft = nSibling;
+        else
+            m_vNodes[nGrandParent].nRight = nSibling;
+        m_vNodes[nSibling].nParent = nGrandParent;
+        FreeNode(nParent);
+        Refit(nGrandParent);
+    }
+    else
+    {
+        m_nRoot = nSibling;
+        m_vNodes[nSibling].nParent = -1;
+        FreeNode(nParent);
+    }
+}
+
+void DynamicAABBTree::Refit(int nNode)
+{
+    while (nNode >= 0)
+    {
+        Node& node = m_vNodes[nNode];
+        node.box = CullAABB::Union(m_vNodes[node.nLeft].box, m_vNodes[node.nRight].box);
+        nNode = node.nParent;
+    }
+}
+
+void DynamicAABBTree::CollectLeaves(int nNode, std::vector<int>& outItems) const
+{
+    std::vector<int> stack;
+    stack.push_back(nNode);
+    while (!stack.empty())
+    {
+        const Node& node = m_vNodes[stack.back()];
+        stack.pop_back();
+        if (node.nLeft < 0)
+        {
+            outItems.push_back(node.nItem);
+            continue;
+        }
+        stack.push_back(node.nLeft);
+        stack.push_back(node.nRight);
+    }
+}
+
+void DynamicAABBTree::Query(const CullFrustum& frustum, std::vector<int>& outItems) const
+{
+    if (m_nRoot < 0)
+        return;
+
+    // 삽입 순서에 따라 균형이 깨질 수 있어 깊이 제한이 없는 힙 스택을 쓴다
+    struct Entry { int nNode; uint32_t mask; };
+    std::vector<Entry> stack;
+    stack.push_back({ m_nRoot, 0x3Fu });
+
+    while (!stack.empty())
+    {
+        Entry e = stack.back();
+        stack.pop_back();
+        const Node& node = m_vNodes[e.nNode];
+
+        uint32_t mask = e.mask;
+        if (!CullWithMask(frustum, node.box, mask))
+            continue;
+
+        if (node.nLeft < 0)
+        {
+            if (mask == 0 || CullWithMask(frustum, node.tight, mask))
+                outItems.push_back(node.nItem);
+            continue;
+        }
+        if (mask == 0)
+        {
+            CollectLeaves(e.nNode, outItems);
+            continue;
+        }
+
+        stack.push_back({ node.nLeft, mask });
+        stack.push_back({ node.nRight, mask });
+    }
+}
+
+void DynamicAABBTree::Query(const CullAABB& box, std::vector<int>& outItems) const
+{
+    if (m_nRoot < 0)
+        return;
+
+    // 투사체마다 매 프레임 불리므로 스택은 재사용한다
+    static thread_local std::vector<int> stack;
+    stack.clear();
+    stack.push_back(m_nRoot);
+
+    while (!stack.empty())
+    {
+        const Node& node = m_vNodes[stack.back()];
+        stack.pop_back();
+        if (!node.box.Overlaps(box))
+            continue;
+
+        if (node.nLeft < 0)
+        {
+            if (node.tight.Overlaps(box))
+                outItems.push_back(node.nItem);
+            continue;
+        }
+        stack.push_back(node.nLeft);
+        stack.push_back(node.nRight);
+    }
+}
+
+// =============================================================================
+// VisibilityCuller
+// =============================================================================
+
+void VisibilityCuller::Build(const std::vector<CullAABB>& vBoxes, const std::vector<uint8_t>& vDynamic)
+{
+    Clear();
+    m_vProxies.assign(vBoxes.size(), kStaticItem);
+
+    std::vector<CullAABB> vStaticBoxes;
+    std::vector<int> vStaticItems;
+    vStaticBoxes.reserve(vBoxes.size());
+    vStaticItems.reserve(vBoxes.size());
+
+    for (size_t i = 0; i < vBoxes.size(); i++)
+    {
+        if (vDynamic[i])
+        {
+            m_vProxies[i] = m_DynamicTree.Insert(vBoxes[i], static_cast<int>(i));
+        }
+        else
+        {
+            vStaticBoxes.push_back(vBoxes[i]);
+            vStaticItems.push_back(static_cast<int>(i));
+        }
+    }
+    m_StaticBVH.Build(vStaticBoxes, vStaticItems);
+}
+
+void VisibilityCuller::Clear()
+{
+    m_StaticBVH.Clear();
+    m_DynamicTree.Clear();
+    m_vProxies.clear();
+    m_vFreeItems.clear();
+}
+
+void VisibilityCuller::MoveItem(int nItem, const CullAABB& box)
+{
+    if (m_vProxies[nItem] >= 0)
+        m_DynamicTree.Move(m_vProxies[nItem], box);
+    else
+        m_vProxies[nItem] = m_DynamicTree.Insert(box, nItem);   // 정적 BVH 쪽 리프는 다음 Build 까지 질의에서 걸러낸다
+}
+
+int VisibilityCuller::AddItem(const CullAABB& box)
+{
+    int nItem;
+    if (!m_vFreeItems.empty())
+    {
+        nItem = m_vFreeItems.back();
+        m_vFreeItems.pop_back();
+    }
+    else
+    {
+        nItem = static_cast<int>(m_vProxies.size());
+        m_vProxies.push_back(kRemovedItem);
+    }
+
+    // 재사용한 번호에 정적 BVH 리프가 남아 있어도 프록시가 있으면 질의에서 걸러진다
+    m_vProxies[nItem] = m_DynamicTree.Insert(box, nItem);
+    return nItem;
+}
+
+void VisibilityCuller::RemoveItem(int nItem)
+{
+    if (m_vProxies[nItem] >= 0)
+        m_DynamicTree.Remove(m_vProxies[nItem]);
+    m_vProxies[nItem] = kRemovedItem;
+    m_vFreeItems.push_back(nItem);
+}
+
+void VisibilityCuller::Query(const CullFrustum& frustum, std::vector<int>& outItems) const
+{
+    outItems.clear();
+
+    m_vStaticHits.clear();
+    m_StaticBVH.Query(frustum, m_vStaticHits);
+    for (int nItem : m_vStaticHits)
+    {
+        if (m_vProxies[nItem] == kStaticItem)
+            outItems.push_back(nItem);
+    }
+
+    m_DynamicTree.Query(frustum, outItems);
+}
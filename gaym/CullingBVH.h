@@ -0,0 +1,145 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// 프러스텀 컬링용 공간 구조. DirectX 타입에 의존하지 않아 CPU 만으로 검증할 수 있다.
+//   - StaticBVH       : 방 지형처럼 움직이지 않는 것. 한 번 빌드하고 질의만 한다
+//   - DynamicAABBTree : 움직이는 것. 여유(fat) AABB 를 벗어날 때만 다시 넣는다
+//   - VisibilityCuller: 위 둘을 아이템 index 하나로 묶는다 (정적 아이템이 움직이면 동적 트리로 옮김)
+
+struct CullAABB
+{
+    float vMin[3] = { 0.0f, 0.0f, 0.0f };
+    float vMax[3] = { 0.0f, 0.0f, 0.0f };
+
+    static CullAABB Union(const CullAABB& a, const CullAABB& b);
+    bool  Contains(const CullAABB& other) const;
+    bool  Overlaps(const CullAABB& other) const;
+    float SurfaceArea() const;
+};
+
+// 6 평면 프러스텀. 평면은 (nx, ny, nz, d) 이고 안쪽이 양수
+struct CullFrustum
+{
+    float planes[6][4] = {};
+
+    // 행 벡터 곱(v * M, DirectX 규약) 행렬에서 평면 추출. 원근/직교 모두 된다 (clip z 0~1)
+    static CullFrustum FromViewProj(const float m[16]);
+
+    bool TestAABB(const CullAABB& box) const;
+    bool TestSphere(const float center[3], float fRadius) const;
+};
+
+// =============================================================================
+// StaticBVH
+// =============================================================================
+class StaticBVH
+{
+public:
+    // vBoxes[i] 는 vItems[i] 의 박스. 빌드 중 순서를 바꿔 노드마다 연속 구간이 되게 한다
+    void Build(const std::vector<CullAABB>& vBoxes, const std::vector<int>& vItems);
+    void Clear();
+
+    // 겹치는 아이템을 outItems 에 추가. 완전히 안쪽인 서브트리는 아이템 박스 검사 없이 통째로 넣는다
+    void Query(const CullFrustum& frustum, std::vector<int>& outItems) const;
+
+    size_t GetNodeCount() const { return m_vNodes.size(); }
+
+private:
+    struct Node
+    {
+        CullAABB box;
+        int      nLeft = -1;     // -1 이면 리프
+        int      nRight = -1;
+        int      nFirst = 0;     // 서브트리가 덮는 m_vItems 구간
+        int      nCount = 0;
+    };
+
+    int BuildRecursive(std::vector<CullAABB>& vBoxes, int nFirst, int nCount);
+
+    std::vector<Node>     m_vNodes;
+    std::vector<int>      m_vItems;
+    std::vector<CullAABB> m_vBoxes;   // m_vItems 와 같은 순서
+};
+
+// =============================================================================
+// DynamicAABBTree
+// =============================================================================
+class DynamicAABBTree
+{
+public:
+    static constexpr float kFatMargin = 1.0f;  // 월드 단위. 이만큼 움직이기 전엔 트리를 건드리지 않는다
+
+    int  Insert(const CullAABB& box, int nItem);      // 프록시 id 반환
+    void Remove(int nProxy);
+    bool Move(int nProxy, const CullAABB& box);       // fat 박스를 벗어나서 다시 넣었으면 true
+    void Clear();
+
+    void Query(const CullFrustum& frustum, std::vector<int>& outItems) const;
+
+    // 실제(tight) 박스가 box 와 겹치는 아이템을 outItems 에 추가 (순서 없음)
+    void Query(const CullAABB& box, std::vector<int>& outItems) const;
+
+    int  GetProxyCount() const { return m_nProxyCount; }
+
+private:
+    struct Node
+    {
+        CullAABB box;            // 리프는 fat 박스
+        CullAABB tight;          // 리프의 실제 박스 (질의 마지막 판정용)
+        int      nParent = -1;
+        int      nLeft = -1;     // -1 이면 리프
+        int      nRight = -1;
+        int      nItem = -1;
+        int      nNextFree = -1;
+    };
+
+    int  AllocateNode();
+    void FreeNode(int nNode);
+    void InsertLeaf(int nLeaf);
+    void RemoveLeaf(int nLeaf);
+    void Refit(int nNode);
+    void CollectLeaves(int nNode, std::vector<int>& outItems) const;
+
+    std::vector<Node> m_vNodes;
+    int m_nRoot = -1;
+    int m_nFreeList = -1;
+    int m_nProxyCount = 0;
+};
+
+// =============================================================================
+// VisibilityCuller
+// =============================================================================
+class VisibilityCuller
+{
+public:
+    // 아이템 전체 재구성. vDynamic[i] 가 0 이 아니면 처음부터 동적 트리에 넣는다
+    void Build(const std::vector<CullAABB>& vBoxes, const std::vector<uint8_t>& vDynamic);
+    void Clear();
+
+    // 아이템 박스가 바뀌었을 때. 정적 BVH 에 있던 아이템이면 동적 트리로 옮긴다
+    void MoveItem(int nItem, const CullAABB& box);
+
+    // 다음 Build 전에 생긴/사라진 아이템. 새 아이템은 동적 트리로 들어가고, 지운 번호는 AddItem 이 재사용한다
+    int  AddItem(const CullAABB& box);
+    void RemoveItem(int nItem);
+
+    // 프러스텀과 겹치는 아이템 index 를 outItems 에 채운다 (순서 없음, 중복 없음)
+    void Query(const CullFrustum& frustum, std::vector<int>& outItems) const;
+
+    bool   IsDynamic(int nItem) const { return m_vProxies[nItem] >= 0; }
+    size_t GetItemCount() const { return m_vProxies.size(); }
+    int    GetDynamicCount() const { return m_DynamicTree.GetProxyCount(); }
+
+private:
+    StaticBVH        m_StaticBVH;
+    DynamicAABBTree  m_DynamicTree;
+    static constexpr int kStaticItem = -1;
+    static constexpr int kRemovedItem = -2;
+
+    std::vector<int> m_vProxies;     // 아이템 → 동적 트리 프록시 (kStaticItem 이면 정적 BVH, kRemovedItem 이면 빈 번호)
+    std::vector<int> m_vFreeItems;
+    mutable std::vector<int> m_vStaticHits;
+};
@@ -0,0 +1,75 @@
+#include "stdafx.h"
+#include "D3D12FluidSimStateBackend.h"
+
+ID3D12Resource* D3D12FluidSimStateBackend::CreateBuffer(UINT64 nBytes, D3D12_HEAP_TYPE d3dHeapType, D3D12_RESOURCE_FLAGS d3dFlags,
+                                                        D3D12_RESOURCE_STATES d3dInitialState, UINT64& nAllocatedBytes)
+{
+    D3D12_HEAP_PROPERTIES heapProps = {};
+    heapProps.Type = d3dHeapType;
+
+    D3D12_RESOURCE_DESC desc = {};
+    desc.Dimension          = D3D12_RESOURCE_DIMENSION_BUFFER;
+    desc.Width              = nBytes;
+    desc.Height             = 1;
+    desc.DepthOrArraySize   = 1;
+    desc.MipLevels          = 1;
+    desc.Format             = DXGI_FORMAT_UNKNOWN;
+    desc.SampleDesc.Count   = 1;
+    desc.Layout             = D3D12_TEXTURE_LAYOUT_ROW_MAJOR;
+    desc.Flags              = d3dFlags;
+
+    ID3D12Resource* pd3dBuffer = nullptr;
+    HRESULT hr = m_pd3dDevice->CreateCommittedResource(&heapProps, D3D12_HEAP_FLAG_NONE, &desc,
+        d3dInitialState, nullptr, IID_PPV_ARGS(&pd3dBuffer));
+    if (FAILED(hr))
+        return nullptr;
+
+    nAllocatedBytes += m_pd3dDevice->GetResourceAllocationInfo(0, 1, &desc).SizeInBytes;
+    return pd3dBuffer;
+}
+
+bool D3D12FluidSimStateBackend::Create(const FluidSimStateDesc& desc, FluidSimState& state)
+{
+    UINT64 nBytes = 0;
+    state.pStateBuffer  = CreateBuffer(desc.nStateBytes, D3D12_HEAP_TYPE_DEFAULT,
+        D3D12_RESOURCE_FLAG_ALLOW_UNORDERED_ACCESS, D3D12_RESOURCE_STATE_COMMON, nBytes);
+    state.pRenderBuffer = CreateBuffer(desc.nRenderBytes, D3D12_HEAP_TYPE_DEFAULT,
+        D3D12_RESOURCE_FLAG_ALLOW_UNORDERED_ACCESS, D3D12_RESOURCE_STATE_COMMON, nBytes);
+    state.pHashBuffer   = CreateBuffer(desc.nHashBytes, D3D12_HEAP_TYPE_DEFAULT,
+        D3D12_RESOURCE_FLAG_ALLOW_UNORDERED_ACCESS, D3D12_RESOURCE_STATE_UNORDERED_ACCESS, nBytes);
+    state.pUploadBuffer = CreateBuffer(desc.nUploadBytes, D3D12_HEAP_TYPE_UPLOAD,
+        D3D12_RESOURCE_FLAG_NONE, D3D12_RESOURCE_STATE_GENERIC_READ, nBytes);
+
+    if (!state.pStateBuffer || !state.pRenderBuffer || !state.pHashBuffer || !state.pUploadBuffer)
+    {
+        OutputDebugStringA("[FluidSimStatePool] 버퍼 생성 실패\n");
+        Release(state);
+        return false;
+    }
+
+    D3D12_RANGE d3dReadRange = { 0, 0 };
+    if (FAILED(static_cast<ID3D12Resource*>(state.pUploadBuffer)->Map(0, &d3dReadRange, (void**)&state.pMappedUpload)))
+    {
+        Release(state);
+        return false;
+    }
+
+    state.nRenderBufferState = D3D12_RESOURCE_STATE_COMMON;
+    state.gpuBytes = nBytes;
+    return true;
+}
+
+void D3D12FluidSimStateBackend::Release(FluidSimState& state)
+{
+    // 풀은 GPU 가 멈춘 지점(Trim)이나 종료 시에만 해제한다
+    if (state.pUploadBuffer && state.pMappedUpload)
+        static_cast<ID3D12Resource*>(state.pUploadBuffer)->Unmap(0, nullptr);
+
+    for (void* pResource : { state.pStateBuffer, state.pRenderBuffer, state.pHashBuffer, state.pUploadBuffer })
+        if (pResource)
+            static_cast<ID3D12Resource*>(pResource)->Release();
+
+    FluidSimStateDesc desc = state.desc;
+    state = {};
+    state.desc = desc;
+}
@@ -0,0 +1,24 @@
+#pragma once
+#include "stdafx.h"
+#include "FluidSimStatePool.h"
+
+// ============================================================================
+// D3D12FluidSimStateBackend
+// FluidSimStateDesc 대로 커밋 리소스 네 개를 만든다.
+//   상태 / 렌더 / 해시 : DEFAULT, UAV (해시는 UNORDERED_ACCESS, 상태·렌더는 COMMON 에서 시작)
+//   업로드             : UPLOAD, 만들 때 매핑해서 해제할 때까지 유지
+// ============================================================================
+class D3D12FluidSimStateBackend : public FluidSimStateBackend
+{
+public:
+    explicit D3D12FluidSimStateBackend(ID3D12Device* pd3dDevice) : m_pd3dDevice(pd3dDevice) { }
+
+    bool Create(const FluidSimStateDesc& desc, FluidSimState& state) override;
+    void Release(FluidSimState& state) override;
+
+private:
+    ID3D12Resource* CreateBuffer(UINT64 nBytes, D3D12_HEAP_TYPE d3dHeapType, D3D12_RESOURCE_FLAGS d3dFlags,
+                                 D3D12_RESOURCE_STATES d3dInitialState, UINT64& nAllocatedBytes);
+
+    ID3D12Device* m_pd3dDevice = nullptr;
+};
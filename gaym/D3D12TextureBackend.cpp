@@ -0,0 +1,78 @@
+#include "stdafx.h"
+#include "D3D12TextureBackend.h"
+#include "WICTextureLoader12.h"
+#include "D3dx12.h"
+
+bool D3D12TextureBackend::Decode(const std::string& path, TextureImage& image)
+{
+    std::wstring wstrPath(path.begin(), path.end());
+
+    std::unique_ptr<uint8_t[]> decodedData;
+    D3D12_SUBRESOURCE_DATA subresource = {};
+    D3D12_RESOURCE_DESC desc = {};
+    HRESULT hr = DirectX::DecodeWICTextureFromFile(wstrPath.c_str(), 0, DirectX::WIC_LOADER_DEFAULT, decodedData, subresource, desc);
+    if (FAILED(hr))
+    {
+        char buffer[512];
+        sprintf_s(buffer, "[TextureCache] Failed to decode: %s (0x%08X)\n", path.c_str(), (unsigned)hr);
+        OutputDebugStringA(buffer);
+        return false;
+    }
+
+    image.width     = static_cast<uint32_t>(desc.Width);
+    image.height    = desc.Height;
+    image.format    = static_cast<uint32_t>(desc.Format);
+    image.rowPitch  = static_cast<uint32_t>(subresource.RowPitch);
+    image.sizeBytes = static_cast<size_t>(subresource.SlicePitch);
+    image.pixels    = std::move(decodedData);
+    return true;
+}
+
+bool D3D12TextureBackend::Upload(const TextureImage& image, TextureResource& resource)
+{
+    if (!m_pd3dDevice || !m_pd3dCommandList)
+        return false;
+
+    D3D12_RESOURCE_DESC desc = CD3DX12_RESOURCE_DESC::Tex2D(static_cast<DXGI_FORMAT>(image.format), image.width, image.height, 1, 1);
+    CD3DX12_HEAP_PROPERTIES defaultHeapProperties(D3D12_HEAP_TYPE_DEFAULT);
+
+    ID3D12Resource* pd3dTexture = nullptr;
+    HRESULT hr = m_pd3dDevice->CreateCommittedResource(&defaultHeapProperties, D3D12_HEAP_FLAG_NONE, &desc,
+        D3D12_RESOURCE_STATE_COPY_DEST, nullptr, IID_PPV_ARGS(&pd3dTexture));
+    if (FAILED(hr))
+        return false;
+
+    D3D12_SUBRESOURCE_DATA subresource = {};
+    subresource.pData      = image.pixels.get();
+    subresource.RowPitch   = image.rowPitch;
+    subresource.SlicePitch = image.sizeBytes;
+
+    UINT64 nBytes = GetRequiredIntermediateSize(pd3dTexture, 0, 1);
+    ComPtr<ID3D12Resource> pd3dUploadBuffer;
+    pd3dUploadBuffer.Attach(CreateBufferResource(m_pd3dDevice, m_pd3dCommandList, NULL, (UINT)nBytes, D3D12_HEAP_TYPE_UPLOAD, D3D12_RESOURCE_STATE_GENERIC_READ, NULL));
+    UpdateSubresources(m_pd3dCommandList, pd3dTexture, pd3dUploadBuffer.Get(), 0, 0, 1, &subresource);
+
+    D3D12_RESOURCE_BARRIER barrier = CD3DX12_RESOURCE_BARRIER::Transition(pd3dTexture, D3D12_RESOURCE_STATE_COPY_DEST, D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE);
+    m_pd3dCommandList->ResourceBarrier(1, &barrier);
+
+    m_vPendingUploads.push_back(std::move(pd3dUploadBuffer));
+
+    D3D12_RESOURCE_ALLOCATION_INFO allocInfo = m_pd3dDevice->GetResourceAllocationInfo(0, 1, &desc);
+    resource.pResource = pd3dTexture;
+    resource.gpuBytes  = allocInfo.SizeInBytes;
+    return true;
+}
+
+void D3D12TextureBackend::Release(TextureResource& resource)
+{
+    // 캐시가 들고 있던 참조만 놓는다. 이미 기록된 SRV 가 같은 프레임에 쓰일 수 있으므로
+    // TextureCache 는 Trim 을 GPU 가 멈춘 지점에서만 부른다
+    if (resource.pResource)
+        static_cast<ID3D12Resource*>(resource.pResource)->Release();
+    resource = {};
+}
+
+void D3D12TextureBackend::OnGpuIdle()
+{
+    m_vPendingUploads.clear();
+}
@@ -0,0 +1,29 @@
+#pragma once
+#include "stdafx.h"
+#include "TextureCache.h"
+
+// ============================================================================
+// D3D12TextureBackend
+// WIC 로 디코드하고, 현재 커맨드 리스트에 복사 명령을 기록해 DEFAULT 힙 텍스처를 만든다.
+// 업로드 버퍼는 복사가 끝날 때까지 들고 있다가 OnGpuIdle 에서 한꺼번에 해제.
+//
+// Acquire 직전에 SetCommandList 로 기록할 리스트를 지정해야 한다 (GameObject::Load* 가 처리).
+// ============================================================================
+class D3D12TextureBackend : public TextureBackend
+{
+public:
+    explicit D3D12TextureBackend(ID3D12Device* pd3dDevice) : m_pd3dDevice(pd3dDevice) { }
+
+    void SetCommandList(ID3D12GraphicsCommandList* pd3dCommandList) { m_pd3dCommandList = pd3dCommandList; }
+
+    bool Decode(const std::string& path, TextureImage& image) override;
+    bool Upload(const TextureImage& image, TextureResource& resource) override;
+    void Release(TextureResource& resource) override;
+    void OnGpuIdle() override;
+
+private:
+    ID3D12Device*              m_pd3dDevice = nullptr;
+    ID3D12GraphicsCommandList* m_pd3dCommandList = nullptr;
+
+    std::vector<ComPtr<ID3D12Resource>> m_vPendingUploads;  // GPU 복사 완료 대기
+};
@@ -12,6 +12,11 @@
 #include "TransformComponent.h"
 #include "Room.h"
 #include "EnemyComponent.h"
+#include "SimProfiler.h"
+#include "D3D12TextureBackend.h"
+#include "BonePalette.h"
+#include "D3D12FluidSimStateBackend.h"
+#include "Animation.h"
 #include <DescriptorHeap.h>  // DirectXTK12
 #include <sstream>
 #include <iomanip>
@@ -140,6 +145,9 @@ void Dx12App::OnCreate(HINSTANCE hInstance, HWND hMainWnd)
 
     CreateDirect3DDevice();
     CreateCommandQueueAndList();
+    TextureCache::Get().SetBackend(std::make_unique<D3D12TextureBackend>(m_pd3dDevice.Get()));
+    BonePalette::Get().Init();
+    FluidSimStatePool::Get().SetBackend(std::make_unique<D3D12FluidSimStateBackend>(m_pd3dDevice.Get()));
     CreateSwapChain(hInstance, hMainWnd);
     CreateRtvAndDsvDescriptorHeaps();
     CreateRenderTargetViews();
@@ -190,6 +198,9 @@ void Dx12App::OnDestroy()
     }
 
     WaitForGpuComplete();
+    TextureCache::Get().OnGpuIdle();
+    BonePalette::Get().OnGpuIdle();
+    FluidSimStatePool::Get().Trim();
     if (m_pdxgiSwapChain)
     {
         m_pdxgiSwapChain->SetFullscreenState(FALSE, NULL);
@@ -197,6 +208,84 @@ void Dx12App::OnDestroy()
     CloseHandle(m_hFenceEvent);
 }
 
+void Dx12App::OnCreateHeadless()
+{
+    m_hInstance = NULL;
+    m_hWnd = NULL;
+
+    // GPU가 없는 머신에서도 돌도록 WARP 어댑터 사용 (리소스 생성/업로드만 하고 그리지는 않음)
+    CHECK_HR(CreateDXGIFactory2(0, __uuidof(IDXGIFactory4), (void**)&m_pdxgiFactory));
+    ComPtr<IDXGIAdapter> pWarpAdapter;
+    CHECK_HR(m_pdxgiFactory->EnumWarpAdapter(__uuidof(IDXGIAdapter), (void**)&pWarpAdapter));
+    CHECK_HR(D3D12CreateDevice(pWarpAdapter.Get(), D3D_FEATURE_LEVEL_12_0, __uuidof(ID3D12Device), (void**)&m_pd3dDevice));
+
+    CreateCommandQueueAndList();
+    TextureCache::Get().SetBackend(std::make_unique<D3D12TextureBackend>(m_pd3dDevice.Get()));
+    BonePalette::Get().Init();
+    FluidSimStatePool::Get().SetBackend(std::make_unique<D3D12FluidSimStateBackend>(m_pd3dDevice.Get()));
+
+    // 스왑체인이 없으므로 펜스는 여기서 만든다
+    CHECK_HR(m_pd3dDevice->CreateFence(0, D3D12_FENCE_FLAG_NONE, __uuidof(ID3D12Fence), (void**)&m_pd3dFence));
+    m_hFenceEvent = CreateEvent(NULL, FALSE, FALSE, NULL);
+
+    // rooms.json / room_*.json, Player/Enemies .bin 로드는 일반 실행과 같은 Scene::Init 경로
+    CHECK_HR(m_pd3dCommandList->Reset(m_pd3dCommandAllocator.Get(), NULL));
+
+    m_pScene = std::make_unique<Scene>();
+    m_pScene->Init(m_pd3dDevice.Get(), m_pd3dCommandList.Get());
+    m_pScene->UpdatePersistentDescriptorEnd();
+
+    CHECK_HR(m_pd3dCommandList->Close());
+    ID3D12CommandList* ppd3dCommandLists[] = { m_pd3dCommandList.Get() };
+    m_pd3dCommandQueue->ExecuteCommandLists(_countof(ppd3dCommandLists), ppd3dCommandLists);
+    WaitForGpuComplete();
+}
+
+std::string Dx12App::RunHeadless(int nFrames, float fDeltaTime, int nRoomIndex)
+{
+    ID3D12CommandList* ppd3dCommandLists[] = { m_pd3dCommandList.Get() };
+
+    // 방 지정 + 전투 시작 (Active 진입 시 적 스폰)
+    CHECK_HR(m_pd3dCommandAllocator->Reset());
+    CHECK_HR(m_pd3dCommandList->Reset(m_pd3dCommandAllocator.Get(), NULL));
+    if (nRoomIndex >= 0)
+        m_pScene->TransitionToRoomByIndex(nRoomIndex);
+    if (CRoom* pRoom = m_pScene->GetCurrentRoom())
+        pRoom->SetState(RoomState::Active);
+    CHECK_HR(m_pd3dCommandList->Close());
+    m_pd3dCommandQueue->ExecuteCommandLists(_countof(ppd3dCommandLists), ppd3dCommandLists);
+    WaitForGpuComplete();
+
+    SimProfiler& profiler = SimProfiler::Get();
+    profiler.Reset();
+    profiler.SetEnabled(true);
+
+    for (int i = 0; i < nFrames; ++i)
+    {
+        // 스폰 등으로 Update 중 업로드 명령이 기록될 수 있어 커맨드 리스트는 매 프레임 열고 닫는다
+        CHECK_HR(m_pd3dCommandAllocator->Reset());
+        CHECK_HR(m_pd3dCommandList->Reset(m_pd3dCommandAllocator.Get(), NULL));
+
+        profiler.BeginFrame();
+        m_pScene->Update(fDeltaTime, &m_inputSystem);
+        DamageNumberManager::Get().Update(fDeltaTime);
+        profiler.EndFrame();
+
+        m_inputSystem.Reset();
+
+        CHECK_HR(m_pd3dCommandList->Close());
+        m_pd3dCommandQueue->ExecuteCommandLists(_countof(ppd3dCommandLists), ppd3dCommandLists);
+        WaitForGpuComplete();
+        TextureCache::Get().OnGpuIdle();
+        BonePalette::Get().OnGpuIdle();
+        FluidSimStatePool::Get().Trim();
+    }
+
+    profiler.SetEnabled(false);
+    return profiler.BuildReport() + TextureCache::Get().BuildReport() + BonePalette::Get().BuildReport()
+         + FluidSimStatePool::Get().BuildReport() + AnimationSetCache::BuildReport();
+}
+
 void Dx12App::CreateDirect3DDevice()
 {
     UINT nDXGIFactoryFlags = 0;
@@ -459,6 +548,11 @@ void Dx12App::FrameAdvance()
 
     WaitForGpuComplete();
 
+    // GPU 가 멈춘 지점 — 지난 프레임 텍스처 업로드 버퍼 해제 + 캐시 예산 정리
+    TextureCache::Get().OnGpuIdle();
+    BonePalette::Get().OnGpuIdle();
+    FluidSimStatePool::Get().Trim();
+
     CHECK_HR(m_pd3dCommandAllocator->Reset());
     CHECK_HR(m_pd3dCommandList->Reset(m_pd3dCommandAllocator.Get(), NULL));
 
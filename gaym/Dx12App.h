@@ -30,6 +30,11 @@ public:
     void ToggleFullscreen();
     void OnResize(UINT nWidth, UINT nHeight);
 
+    // 헤드리스 실행 (-headless): 창/스왑체인/렌더링 없이 WARP 디바이스로 Scene 게임플레이만 돌린다.
+    // RunHeadless는 고정 dt로 nFrames 틱하고 서브시스템별 시간 표(SimProfiler)를 돌려준다.
+    void OnCreateHeadless();
+    std::string RunHeadless(int nFrames, float fDeltaTime, int nRoomIndex);
+
     InputSystem& GetInputSystem() { return m_inputSystem; } // Added getter for InputSystem
     ID3D12Device* GetDevice() const { return m_pd3dDevice.Get(); }
     ID3D12GraphicsCommandList* GetCommandList() const { return m_pd3dCommandList.Get(); }
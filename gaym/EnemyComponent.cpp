@@ -10,6 +10,7 @@
 #include "Dx12App.h"
 #include "MathUtils.h"
 #include "BossPhaseController.h"
+#include "SimProfiler.h"
 #include <algorithm>
 
 EnemyComponent::EnemyComponent(GameObject* pOwner)
@@ -23,6 +24,8 @@ EnemyComponent::~EnemyComponent()
 
 void EnemyComponent::Update(float deltaTime)
 {
+    SimProfileScope profile(SimSubsystem::AI);
+
     // Decay hit flash every frame
     if (m_fHitFlashTimer > 0.f)
     {
@@ -396,10 +399,11 @@ void EnemyComponent::MoveTowardsTarget(float dt)
     XMFLOAT2 separationForce = { 0.0f, 0.0f };
     if (m_pRoom)
     {
-        const auto& enemies = m_pRoom->GetEnemies();
-        for (EnemyComponent* pOther : enemies)
+        // 방의 이웃 격자로 분리 반경 안의 적만 받는다 (O(n²) 전체 순회 대신)
+        m_pRoom->QueryEnemiesInRadius2D(myPos, m_fSeparationRadius, m_vNeighbors);
+        for (EnemyComponent* pOther : m_vNeighbors)
         {
-            if (pOther == this || !pOther || pOther->IsDead()) continue;
+            if (pOther == this) continue;
 
             GameObject* pOtherOwner = pOther->GetOwner();
             if (!pOtherOwner) continue;
@@ -180,6 +180,7 @@ public:
     // Separation (avoid stacking with other enemies)
     void SetSeparationRadius(float fRadius) { m_fSeparationRadius = fRadius; }
     void SetSeparationStrength(float fStrength) { m_fSeparationStrength = fStrength; }
+    float GetSeparationStrength() const { return m_fSeparationStrength; }
 
     // Animation
     void SetAnimationComponent(AnimationComponent* pAnimComp) { m_pAnimationComp = pAnimComp; }
@@ -298,6 +299,7 @@ private:
     // Separation (avoid stacking) — 몬스터끼리 좀 더 퍼지는 느낌. 서버 Monster.cpp SEP_* 와 동일 값 유지 필수.
     float m_fSeparationRadius = 8.0f;    // 밀어내는 범위 (이전 5.0)
     float m_fSeparationStrength = 14.0f; // 밀어내는 힘 (이전 10.0)
+    std::vector<EnemyComponent*> m_vNeighbors;  // 분리 조향 이웃 질의 버퍼
 
     // Smooth rotation
     float m_fRotationSpeed = 180.0f;     // Degrees per second
@@ -0,0 +1,119 @@
+#include "EnemyNeighborGrid.h"
+#include <algorithm>
+#include <cmath>
+
+int EnemyNeighborGrid::CellX(float x) const
+{
+    int c = (int)floorf((x - m_fMinX) * m_fInvCellSize);
+    return (std::min)((std::max)(c, 0), m_nCellsX - 1);
+}
+
+int EnemyNeighborGrid::CellZ(float z) const
+{
+    int c = (int)floorf((z - m_fMinZ) * m_fInvCellSize);
+    return (std::min)((std::max)(c, 0), m_nCellsZ - 1);
+}
+
+void EnemyNeighborGrid::Build(const float* pX, const float* pZ, int nCount)
+{
+    m_vItems.resize(nCount);
+    m_vItemCell.resize(nCount);
+    m_vX.resize(nCount);
+    m_vZ.resize(nCount);
+    if (nCount == 0)
+    {
+        m_nCellsX = m_nCellsZ = 0;
+        m_vCellStart.assign(1, 0);
+        return;
+    }
+
+    float fMaxX = pX[0], fMaxZ = pZ[0];
+    m_fMinX = pX[0];
+    m_fMinZ = pZ[0];
+    for (int i = 1; i < nCount; ++i)
+    {
+        m_fMinX = (std::min)(m_fMinX, pX[i]); fMaxX = (std::max)(fMaxX, pX[i]);
+        m_fMinZ = (std::min)(m_fMinZ, pZ[i]); fMaxZ = (std::max)(fMaxZ, pZ[i]);
+    }
+
+    // 셀 수 상한을 넘으면 셀을 두 배씩 키운다
+    const int nMaxCells = (std::max)(nCount * kMaxCellsPerItem, 16);
+    m_fActiveCellSize = m_fCellSize;
+    for (;;)
+    {
+        m_nCellsX = (int)((fMaxX - m_fMinX) / m_fActiveCellSize) + 1;
+        m_nCellsZ = (int)((fMaxZ - m_fMinZ) / m_fActiveCellSize) + 1;
+        if ((long long)m_nCellsX * m_nCellsZ <= nMaxCells)
+            break;
+        m_fActiveCellSize *= 2.0f;
+    }
+    m_fInvCellSize = 1.0f / m_fActiveCellSize;
+
+    const int nCells = m_nCellsX * m_nCellsZ;
+    m_vCellStart.assign(nCells + 1, 0);
+
+    for (int i = 0; i < nCount; ++i)
+    {
+        int nCell = CellZ(pZ[i]) * m_nCellsX + CellX(pX[i]);
+        m_vItemCell[i] = nCell;
+        ++m_vCellStart[nCell];
+    }
+
+    // exclusive prefix sum → 셀 시작 위치
+    int sum = 0;
+    for (int c = 0; c < nCells; ++c)
+    {
+        int n = m_vCellStart[c];
+        m_vCellStart[c] = sum;
+        sum += n;
+    }
+
+    // 항목 순서대로 배치 (안정 정렬 → 셀 안에서는 항목 번호 오름차순)
+    for (int i = 0; i < nCount; ++i)
+    {
+        int nSlot = m_vCellStart[m_vItemCell[i]]++;
+        m_vItems[nSlot] = i;
+        m_vX[nSlot] = pX[i];
+        m_vZ[nSlot] = pZ[i];
+    }
+
+    for (int c = nCells; c > 0; --c)
+        m_vCellStart[c] = m_vCellStart[c - 1];
+    m_vCellStart[0] = 0;
+}
+
+void EnemyNeighborGrid::Clear()
+{
+    m_vItems.clear();
+    m_vItemCell.clear();
+    m_vX.clear();
+    m_vZ.clear();
+    m_vCellStart.assign(1, 0);
+    m_nCellsX = m_nCellsZ = 0;
+}
+
+void EnemyNeighborGrid::Query(float x, float z, float fRadius, std::vector<int>& outItems) const
+{
+    outItems.clear();
+    if (m_vItems.empty())
+        return;
+
+    const int x0 = CellX(x - fRadius), x1 = CellX(x + fRadius);
+    const int z0 = CellZ(z - fRadius), z1 = CellZ(z + fRadius);
+    const float r2 = fRadius * fRadius;
+
+    for (int cz = z0; cz <= z1; ++cz)
+    {
+        for (int cx = x0; cx <= x1; ++cx)
+        {
+            const int nCell = cz * m_nCellsX + cx;
+            for (int s = m_vCellStart[nCell]; s < m_vCellStart[nCell + 1]; ++s)
+            {
+                const float dx = m_vX[s] - x;
+                const float dz = m_vZ[s] - z;
+                if (dx * dx + dz * dz <= r2)
+                    outItems.push_back(m_vItems[s]);
+            }
+        }
+    }
+}
@@ -0,0 +1,54 @@
+#pragma once
+#include <vector>
+
+// ============================================================================
+// EnemyNeighborGrid
+// 방 하나의 적 위치(XZ 평면)를 담는 균일 격자. "반경 r 안의 적" 질의를 전체 순회 대신
+// 주변 셀 몇 개만 훑도록 한다 (분리 조향이 적 수의 제곱으로 늘던 것을 막음).
+//
+//  - 프레임마다 Build 로 통째로 다시 만든다: 셀별 개수 → prefix sum → 셀 순서로 배치
+//    (FluidSPHSolver 의 counting sort 와 같은 방식, 할당은 커질 때만)
+//  - 범위는 들어온 위치의 경계 상자. 멀리 떨어진 적 하나 때문에 셀이 폭증하지 않도록
+//    셀 수가 항목 수의 kMaxCellsPerItem 배를 넘으면 셀을 키운다
+//  - Query 결과 순서는 셀 순서 (z, x), 셀 안에서는 항목 번호 오름차순 — 입력이 같으면 항상 같다.
+//    전체 순회와는 더하는 순서만 달라서 합은 부동소수 반올림 차이 안에서 같다
+//
+// D3D 에 의존하지 않는다 (CRoom 이 항목 번호와 EnemyComponent 를 잇는다). 메인 스레드 전용.
+// ============================================================================
+class EnemyNeighborGrid
+{
+public:
+    static constexpr float kDefaultCellSize = 8.0f;     // 분리 반경과 같게
+    static constexpr int   kMaxCellsPerItem = 4;
+
+    explicit EnemyNeighborGrid(float fCellSize = kDefaultCellSize) : m_fCellSize(fCellSize) { }
+
+    void  SetCellSize(float fCellSize) { m_fCellSize = fCellSize; }
+    float GetCellSize() const { return m_fCellSize; }
+
+    // 항목 i 의 위치는 (pX[i], pZ[i])
+    void Build(const float* pX, const float* pZ, int nCount);
+    void Clear();
+
+    // (x, z) 에서 평면 거리 fRadius 이하인 항목 번호 (Build 시점 위치 기준)
+    void Query(float x, float z, float fRadius, std::vector<int>& outItems) const;
+
+    int GetCount() const { return (int)m_vItems.size(); }
+
+private:
+    int CellX(float x) const;
+    int CellZ(float z) const;
+
+    float m_fCellSize;
+    float m_fActiveCellSize = kDefaultCellSize;   // 셀 수 제한 때문에 키웠을 수 있음
+    float m_fInvCellSize = 1.0f / kDefaultCellSize;
+    float m_fMinX = 0.0f;
+    float m_fMinZ = 0.0f;
+    int   m_nCellsX = 0;
+    int   m_nCellsZ = 0;
+
+    std::vector<int>   m_vCellStart;   // [셀 수 + 1] 셀별 시작 위치
+    std::vector<int>   m_vItemCell;    // 항목 → 셀
+    std::vector<int>   m_vItems;       // 셀 순서로 정렬된 항목 번호
+    std::vector<float> m_vX, m_vZ;     // m_vItems 와 같은 순서의 위치
+};
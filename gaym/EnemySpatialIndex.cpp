@@ -0,0 +1,160 @@
+#include "EnemySpatialIndex.h"
+#include <algorithm>
+#include <cmath>
+
+CullAABB EnemySpatialIndex::SphereBox(const float center[3], float fRadius)
+{
+    CullAABB box;
+    for (int a = 0; a < 3; a++)
+    {
+        box.vMin[a] = center[a] - fRadius;
+        box.vMax[a] = center[a] + fRadius;
+    }
+    return box;
+}
+
+int EnemySpatialIndex::Add(const float center[3], float fRadius)
+{
+    int nHandle;
+    if (m_nFreeList >= 0)
+    {
+        nHandle = m_nFreeList;
+        m_nFreeList = m_vEntries[nHandle].nNextFree;
+    }
+    else
+    {
+        nHandle = (int)m_vEntries.size();
+        m_vEntries.emplace_back();
+    }
+
+    Entry& e = m_vEntries[nHandle];
+    e.center[0] = center[0]; e.center[1] = center[1]; e.center[2] = center[2];
+    e.fRadius = fRadius;
+    e.nOrder = m_nNextOrder++;
+    e.nNextFree = -1;
+    e.nProxy = m_Tree.Insert(SphereBox(center, fRadius), nHandle);
+    m_nCount++;
+    return nHandle;
+}
+
+void EnemySpatialIndex::Move(int nHandle, const float center[3], float fRadius)
+{
+    Entry& e = m_vEntries[nHandle];
+    e.center[0] = center[0]; e.center[1] = center[1]; e.center[2] = center[2];
+    e.fRadius = fRadius;
+    m_Tree.Move(e.nProxy, SphereBox(center, fRadius));
+}
+
+void EnemySpatialIndex::Remove(int nHandle)
+{
+    Entry& e = m_vEntries[nHandle];
+    if (e.nProxy < 0)
+        return;
+
+    m_Tree.Remove(e.nProxy);
+    e.nProxy = -1;
+    e.nNextFree = m_nFreeList;
+    m_nFreeList = nHandle;
+    m_nCount--;
+}
+
+void EnemySpatialIndex::Clear()
+{
+    m_vEntries.clear();
+    m_Tree.Clear();
+    m_nFreeList = -1;
+    m_nCount = 0;
+}
+
+bool EnemySpatialIndex::SweepSphereSphere(const float p0[3], const float p1[3], float r,
+                                          const float c[3], float R, float& outT)
+{
+    // |p0 + t*d - c| = r + R 의 작은 근
+    const float fSum = r + R;
+    const float m[3] = { p0[0] - c[0], p0[1] - c[1], p0[2] - c[2] };
+    const float d[3] = { p1[0] - p0[0], p1[1] - p0[1], p1[2] - p0[2] };
+
+    const float fC = m[0] * m[0] + m[1] * m[1] + m[2] * m[2] - fSum * fSum;
+    if (fC <= 0.0f)
+    {
+        outT = 0.0f;
+        return true;
+    }
+
+    const float fA = d[0] * d[0] + d[1] * d[1] + d[2] * d[2];
+    const float fB = m[0] * d[0] + m[1] * d[1] + m[2] * d[2];
+    if (fA <= 1e-12f || fB >= 0.0f)
+        return false;                       // 안 움직였거나 멀어지는 중
+
+    const float fDisc = fB * fB - fA * fC;
+    if (fDisc < 0.0f)
+        return false;
+
+    const float t = (-fB - sqrtf(fDisc)) / fA;
+    if (t > 1.0f)
+        return false;
+
+    outT = (std::max)(t, 0.0f);
+    return true;
+}
+
+void EnemySpatialIndex::SweepSphere(const float p0[3], const float p1[3], float fRadius,
+                                    std::vector<EnemySweepHit>& outHits) const
+{
+    outHits.clear();
+    if (m_nCount == 0)
+        return;
+
+    CullAABB sweep;
+    for (int a = 0; a < 3; a++)
+    {
+        sweep.vMin[a] = (std::min)(p0[a], p1[a]) - fRadius;
+        sweep.vMax[a] = (std::max)(p0[a], p1[a]) + fRadius;
+    }
+
+    static thread_local std::vector<int> candidates;
+    candidates.clear();
+    m_Tree.Query(sweep, candidates);
+
+    for (int nHandle : candidates)
+    {
+        const Entry& e = m_vEntries[nHandle];
+        float t;
+        if (SweepSphereSphere(p0, p1, fRadius, e.center, e.fRadius, t))
+            outHits.push_back({ nHandle, t });
+    }
+
+    std::sort(outHits.begin(), outHits.end(), [this](const EnemySweepHit& a, const EnemySweepHit& b)
+    {
+        if (a.t != b.t)
+            return a.t < b.t;
+        return m_vEntries[a.nHandle].nOrder < m_vEntries[b.nHandle].nOrder;
+    });
+}
+
+void EnemySpatialIndex::QuerySphere(const float center[3], float fRadius, std::vector<int>& outHandles) const
+{
+    outHandles.clear();
+    if (m_nCount == 0)
+        return;
+
+    static thread_local std::vector<int> candidates;
+    candidates.clear();
+    m_Tree.Query(SphereBox(center, fRadius), candidates);
+
+    for (int nHandle : candidates)
+    {
+        const Entry& e = m_vEntries[nHandle];
+        const float dx = e.center[0] - center[0];
+        const float dy = e.center[1] - center[1];
+        const float dz = e.center[2] - center[2];
+        const float fSum = e.fRadius + fRadius;
+        if (dx * dx + dy * dy + dz * dz <= fSum * fSum)
+            outHandles.push_back(nHandle);
+    }
+
+    std::sort(outHandles.begin(), outHandles.end(), [this](int a, int b)
+    {
+        return m_vEntries[a].nOrder < m_vEntries[b].nOrder;
+    });
+}
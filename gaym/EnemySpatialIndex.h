@@ -0,0 +1,61 @@
+#pragma once
+#include "CullingBVH.h"
+#include <cstdint>
+#include <vector>
+
+// ============================================================================
+// EnemySpatialIndex
+// 방 하나에 있는 적들의 피격 구체를 DynamicAABBTree 에 담아 두는 색인. 투사체 충돌을
+// "투사체 x 방 오브젝트 전체" 순회 대신 스윕 박스 질의 + 후보 몇 개 정밀 판정으로 바꾼다.
+//
+//  - 적 하나 = 핸들 하나. Move 는 여유(fat) 박스를 벗어날 때만 트리를 고친다
+//  - SweepSphere 는 이번 프레임 이동 구간 전체를 검사하므로 dt 가 커도 얇은 적을 뚫지 않는다
+//  - 결과는 (처음 닿는 시점 t, 등록 순서) 로 정렬 — 트리 모양/핸들 재사용과 무관하게 항상 같다
+//
+// D3D 에 의존하지 않는다 (CRoom 이 EnemyComponent 와 핸들을 잇는다). 메인 스레드 전용.
+// ============================================================================
+
+struct EnemySweepHit
+{
+    int   nHandle = -1;
+    float t = 0.0f;        // 0 = 이동 시작점에서 이미 겹침, 1 = 끝점
+};
+
+class EnemySpatialIndex
+{
+public:
+    int  Add(const float center[3], float fRadius);     // 핸들 반환
+    void Move(int nHandle, const float center[3], float fRadius);
+    void Remove(int nHandle);
+    void Clear();
+
+    // p0 → p1 로 움직인 반지름 fRadius 구체가 닿는 적. t 오름차순, 같으면 등록 순
+    void SweepSphere(const float p0[3], const float p1[3], float fRadius, std::vector<EnemySweepHit>& outHits) const;
+
+    // center 중심 fRadius 구와 겹치는 적 (등록 순)
+    void QuerySphere(const float center[3], float fRadius, std::vector<int>& outHandles) const;
+
+    // 구간 p0→p1 위를 움직이는 반지름 r 구체가 (c, R) 구에 처음 닿는 t (0~1). 안 닿으면 false
+    static bool SweepSphereSphere(const float p0[3], const float p1[3], float r,
+                                  const float c[3], float R, float& outT);
+
+    int GetCount() const { return m_nCount; }
+
+private:
+    struct Entry
+    {
+        float    center[3] = { 0.0f, 0.0f, 0.0f };
+        float    fRadius = 0.0f;
+        int      nProxy = -1;        // -1 이면 빈 칸
+        uint32_t nOrder = 0;         // 등록 순서 (결정적 정렬용)
+        int      nNextFree = -1;
+    };
+
+    static CullAABB SphereBox(const float center[3], float fRadius);
+
+    std::vector<Entry> m_vEntries;
+    DynamicAABBTree    m_Tree;
+    int                m_nFreeList = -1;
+    int                m_nCount = 0;
+    uint32_t           m_nNextOrder = 0;
+};
@@ -798,6 +798,15 @@ void EnemySpawner::Init(ID3D12Device* pDevice, ID3D12GraphicsCommandList* pComma
     m_pBoxMesh = new CubeMesh(pDevice, pCommandList, 1.0f, 0.02f, 1.0f);
     m_pBoxMesh->AddRef();
 
+    // 프리셋 메시 .bin 을 워커 풀에서 병렬 파싱 — 스폰 시에는 GameObject 생성만 한다
+    std::vector<std::string> vMeshPaths;
+    for (const auto& [name, data] : m_mapPresets)
+    {
+        if (!data.m_strMeshPath.empty())
+            vMeshPaths.push_back(data.m_strMeshPath);
+    }
+    MeshLoader::PreloadFiles(vMeshPaths);
+
     OutputDebugString(L"[EnemySpawner] Initialized with default presets\n");
 }
 
@@ -869,6 +878,9 @@ void EnemySpawner::SpawnRoomEnemies(CRoom* pRoom, const RoomSpawnConfig& config,
     wchar_t buffer[128];
     swprintf_s(buffer, L"[EnemySpawner] Spawned %zu enemies in room\n", config.m_vEnemySpawns.size());
     OutputDebugString(buffer);
+
+    // 웨이브 단위로 애니메이션 공유 캐시 hit/miss, 상주 메모리 확인
+    AnimationSetCache::LogStats();
 }
 
 GameObject* EnemySpawner::CreateCubeEnemy(CRoom* pRoom, const XMFLOAT3& position, const XMFLOAT3& scale, const XMFLOAT4& color)
@@ -41,7 +41,13 @@ struct FluidSphereDepthCB
     // total: 176 bytes
 };
 
-static constexpr float PI_F = 3.14159265358979323846f;
+// FluidSimStatePool 의 업로드/버퍼 배치와 구조체 크기가 맞아야 한다
+static_assert(sizeof(GPUParticle) == FluidSimStatePool::kParticleStateStride, "GPUParticle stride mismatch");
+static_assert(sizeof(FluidParticleRenderData) == FluidSimStatePool::kRenderDataStride, "FluidParticleRenderData stride mismatch");
+static_assert(sizeof(GPUControlPoint) == FluidSimStatePool::kControlPointStride, "GPUControlPoint stride mismatch");
+static_assert(sizeof(FluidPassCB) <= FluidSimStatePool::kPassCBBytes, "FluidPassCB exceeds pool slot");
+static_assert(sizeof(FluidSphereDepthCB) <= FluidSimStatePool::kDepthPassCBBytes, "FluidSphereDepthCB exceeds pool slot");
+static_assert(((sizeof(SPHConstants) + 255u) & ~255u) == FluidSimStatePool::kSPHCBStride, "SPHConstants stride mismatch");
 
 // Inline HLSL shader code for fluid particles
 static const char* g_FluidShaderCode = R"(
@@ -151,37 +157,11 @@ XMFLOAT3 FluidParticleSystem::RandInSphere(float radius)
 // ============================================================================
 FluidParticleSystem::FluidParticleSystem()
 {
-    memset(m_HashTable.data(), 0, sizeof(SpatialHashCell) * HASH_TABLE_SIZE);
 }
 
 FluidParticleSystem::~FluidParticleSystem()
 {
-    if (m_pParticleBuffer && m_pMappedParticles)
-    {
-        m_pParticleBuffer->Unmap(0, nullptr);
-        m_pMappedParticles = nullptr;
-    }
-    if (m_pPassCB && m_pMappedPassCB)
-    {
-        m_pPassCB->Unmap(0, nullptr);
-        m_pMappedPassCB = nullptr;
-    }
-    if (m_pDepthPassCB && m_pMappedDepthPassCB)
-    {
-        m_pDepthPassCB->Unmap(0, nullptr);
-        m_pMappedDepthPassCB = nullptr;
-    }
-    // GPU SPH 리소스 해제
-    if (m_pSPHCB && m_pMappedSPHCB)
-    {
-        m_pSPHCB->Unmap(0, nullptr);
-        m_pMappedSPHCB = nullptr;
-    }
-    if (m_pCPBuffer && m_pMappedCPBuffer)
-    {
-        m_pCPBuffer->Unmap(0, nullptr);
-        m_pMappedCPBuffer = nullptr;
-    }
+    ReleaseSimState();
 }
 
 // ============================================================================
@@ -190,249 +170,95 @@ FluidParticleSystem::~FluidParticleSystem()
 void FluidParticleSystem::Init(ID3D12Device* pDevice, ID3D12GraphicsCommandList* /*pCommandList*/,
                                CDescriptorHeap* pDescriptorHeap, UINT nSrvDescriptorIndex)
 {
+    m_pd3dDevice          = pDevice;
     m_pDescriptorHeap     = pDescriptorHeap;
     m_nSrvDescriptorIndex = nSrvDescriptorIndex;
 
-    // 1. Particle upload buffer (StructuredBuffer source)
-    UINT64 bufferSize = sizeof(FluidParticleRenderData) * MAX_PARTICLES;
+    // 버퍼는 Spawn 에서 파티클 수에 맞춰 FluidSimStatePool 에서 빌린다 (AcquireSimState)
 
-    D3D12_HEAP_PROPERTIES heapProps = {};
-    heapProps.Type = D3D12_HEAP_TYPE_UPLOAD;
+    // Build shared pipeline (root signature, shaders, PSO) - once for all instances
+    BuildSharedPipeline(pDevice);
 
-    D3D12_RESOURCE_DESC bufDesc = {};
-    bufDesc.Dimension          = D3D12_RESOURCE_DIMENSION_BUFFER;
-    bufDesc.Width              = bufferSize;
-    bufDesc.Height             = 1;
-    bufDesc.DepthOrArraySize   = 1;
-    bufDesc.MipLevels          = 1;
-    bufDesc.Format             = DXGI_FORMAT_UNKNOWN;
-    bufDesc.SampleDesc.Count   = 1;
-    bufDesc.Layout             = D3D12_TEXTURE_LAYOUT_ROW_MAJOR;
-    bufDesc.Flags              = D3D12_RESOURCE_FLAG_NONE;
+    // GPU SPH 파이프라인 빌드
+    BuildSPHPipeline(pDevice);
+    m_bGPUInited = true;
 
-    HRESULT hr = pDevice->CreateCommittedResource(
-        &heapProps, D3D12_HEAP_FLAG_NONE,
-        &bufDesc, D3D12_RESOURCE_STATE_GENERIC_READ,
-        nullptr, IID_PPV_ARGS(&m_pParticleBuffer));
-    if (FAILED(hr)) { OutputDebugStringA("[FluidPS] Failed to create particle buffer\n"); return; }
+    OutputDebugStringA("[FluidParticleSystem] Initialized (GPU SPH enabled)\n");
+}
 
-    m_pParticleBuffer->Map(0, nullptr, (void**)&m_pMappedParticles);
+// ============================================================================
+// GPU 상태 대여 (FluidSimStatePool)
+// ============================================================================
+bool FluidParticleSystem::AcquireSimState(int nParticles)
+{
+    if (!m_bGPUInited || !m_pd3dDevice || !m_pDescriptorHeap)
+        return false;
 
-    // 2. SRV for StructuredBuffer
+    FluidSimStateDesc desc = FluidSimStatePool::MakeDesc(nParticles);
+    if (m_pSimState && m_pSimState->desc.nCapacity == desc.nCapacity)
+        return true;
+
+    ReleaseSimState();
+
+    m_pSimState = FluidSimStatePool::Get().Acquire(nParticles);
+    if (!m_pSimState)
+    {
+        OutputDebugStringA("[FluidPS] GPU sim state 대여 실패\n");
+        return false;
+    }
+
+    const FluidSimStateDesc& d = m_pSimState->desc;
+    m_pGPUStateBuffer  = static_cast<ID3D12Resource*>(m_pSimState->pStateBuffer);
+    m_pGPURenderBuffer = static_cast<ID3D12Resource*>(m_pSimState->pRenderBuffer);
+    m_pHashBuffer      = static_cast<ID3D12Resource*>(m_pSimState->pHashBuffer);
+    m_pUploadBuffer    = static_cast<ID3D12Resource*>(m_pSimState->pUploadBuffer);
+    m_eGPURenderBufferState = static_cast<D3D12_RESOURCE_STATES>(m_pSimState->nRenderBufferState);
+
+    BYTE* pUpload = m_pSimState->pMappedUpload;
+    m_pMappedPassCB      = pUpload + d.nPassCBOffset;
+    m_pMappedDepthPassCB = pUpload + d.nDepthPassCBOffset;
+    m_pMappedSPHCB       = pUpload + d.nSPHCBOffset;
+    m_pMappedCPBuffer    = reinterpret_cast<GPUControlPoint*>(pUpload + d.nCPOffset);
+    m_pMappedParticles   = reinterpret_cast<FluidParticleRenderData*>(pUpload + d.nRenderDataOffset);
+    m_pMappedInit        = reinterpret_cast<GPUParticle*>(pUpload + d.nInitOffset);
+
+    // 이 시스템 슬롯의 SRV 를 빌린 렌더 버퍼로 다시 쓴다 (Update 중이라 기록된 드로우 없음)
     D3D12_SHADER_RESOURCE_VIEW_DESC srvDesc = {};
     srvDesc.Format                     = DXGI_FORMAT_UNKNOWN;
     srvDesc.ViewDimension              = D3D12_SRV_DIMENSION_BUFFER;
     srvDesc.Shader4ComponentMapping    = D3D12_DEFAULT_SHADER_4_COMPONENT_MAPPING;
     srvDesc.Buffer.FirstElement        = 0;
-    srvDesc.Buffer.NumElements         = MAX_PARTICLES;
+    srvDesc.Buffer.NumElements         = (UINT)d.nCapacity;
     srvDesc.Buffer.StructureByteStride = sizeof(FluidParticleRenderData);
     srvDesc.Buffer.Flags               = D3D12_BUFFER_SRV_FLAG_NONE;
 
-    D3D12_CPU_DESCRIPTOR_HANDLE srvCpuHandle = pDescriptorHeap->GetCPUHandle(nSrvDescriptorIndex);
-    pDevice->CreateShaderResourceView(m_pParticleBuffer.Get(), &srvDesc, srvCpuHandle);
-
-    // 3. Small pass CB (ViewProj + CameraRight + CameraUp) - 256 bytes aligned
-    UINT passCBSize = (sizeof(FluidPassCB) + 255) & ~255;
-    D3D12_RESOURCE_DESC cbDesc = bufDesc;
-    cbDesc.Width = passCBSize;
-
-    hr = pDevice->CreateCommittedResource(
-        &heapProps, D3D12_HEAP_FLAG_NONE,
-        &cbDesc, D3D12_RESOURCE_STATE_GENERIC_READ,
-        nullptr, IID_PPV_ARGS(&m_pPassCB));
-    if (FAILED(hr)) { OutputDebugStringA("[FluidPS] Failed to create pass CB\n"); return; }
-    m_pPassCB->Map(0, nullptr, &m_pMappedPassCB);
-
-    // 3b. SSF depth pass CB (FluidSphereDepthCB, 256바이트 정렬)
-    {
-        UINT depthCBSize = (sizeof(FluidSphereDepthCB) + 255) & ~255;
-        D3D12_RESOURCE_DESC depthCBDesc = cbDesc;
-        depthCBDesc.Width = depthCBSize;
-
-        hr = pDevice->CreateCommittedResource(
-            &heapProps, D3D12_HEAP_FLAG_NONE,
-            &depthCBDesc, D3D12_RESOURCE_STATE_GENERIC_READ,
-            nullptr, IID_PPV_ARGS(&m_pDepthPassCB));
-        if (FAILED(hr)) { OutputDebugStringA("[FluidPS] SSF depth CB 생성 실패\n"); }
-        else { m_pDepthPassCB->Map(0, nullptr, &m_pMappedDepthPassCB); }
-    }
-
-    // 4-6. Build shared pipeline (root signature, shaders, PSO) - once for all instances
-    BuildSharedPipeline(pDevice);
-
-    // ============================================================================
-    // GPU SPH 리소스 생성
-    // ============================================================================
-    {
-        D3D12_HEAP_PROPERTIES defaultHeapProps = {};
-        defaultHeapProps.Type = D3D12_HEAP_TYPE_DEFAULT;
-
-        // m_pGPUStateBuffer: DEFAULT, UAV (GPUParticle x MAX_PARTICLES)
-        {
-            D3D12_RESOURCE_DESC desc = {};
-            desc.Dimension          = D3D12_RESOURCE_DIMENSION_BUFFER;
-            desc.Width              = sizeof(GPUParticle) * MAX_PARTICLES;
-            desc.Height             = 1;
-            desc.DepthOrArraySize   = 1;
-            desc.MipLevels          = 1;
-            desc.Format             = DXGI_FORMAT_UNKNOWN;
-            desc.SampleDesc.Count   = 1;
-            desc.Layout             = D3D12_TEXTURE_LAYOUT_ROW_MAJOR;
-            desc.Flags              = D3D12_RESOURCE_FLAG_ALLOW_UNORDERED_ACCESS;
-
-            hr = pDevice->CreateCommittedResource(
-                &defaultHeapProps, D3D12_HEAP_FLAG_NONE,
-                &desc, D3D12_RESOURCE_STATE_COMMON,
-                nullptr, IID_PPV_ARGS(&m_pGPUStateBuffer));
-            if (FAILED(hr)) { OutputDebugStringA("[FluidPS] GPU state buffer 생성 실패\n"); }
-        }
-
-        // m_pGPURenderBuffer: DEFAULT, UAV (FluidParticleRenderData x MAX_PARTICLES)
-        {
-            D3D12_RESOURCE_DESC desc = {};
-            desc.Dimension          = D3D12_RESOURCE_DIMENSION_BUFFER;
-            desc.Width              = sizeof(FluidParticleRenderData) * MAX_PARTICLES;
-            desc.Height             = 1;
-            desc.DepthOrArraySize   = 1;
-            desc.MipLevels          = 1;
-            desc.Format             = DXGI_FORMAT_UNKNOWN;
-            desc.SampleDesc.Count   = 1;
-            desc.Layout             = D3D12_TEXTURE_LAYOUT_ROW_MAJOR;
-            desc.Flags              = D3D12_RESOURCE_FLAG_ALLOW_UNORDERED_ACCESS;
-
-            hr = pDevice->CreateCommittedResource(
-                &defaultHeapProps, D3D12_HEAP_FLAG_NONE,
-                &desc, D3D12_RESOURCE_STATE_COMMON,
-                nullptr, IID_PPV_ARGS(&m_pGPURenderBuffer));
-            if (FAILED(hr)) { OutputDebugStringA("[FluidPS] GPU render buffer 생성 실패\n"); }
-            m_eGPURenderBufferState = D3D12_RESOURCE_STATE_COMMON;
-        }
-
-        // m_pInitUpload: UPLOAD (GPUParticle x MAX_PARTICLES)
-        {
-            D3D12_RESOURCE_DESC desc = {};
-            desc.Dimension          = D3D12_RESOURCE_DIMENSION_BUFFER;
-            desc.Width              = sizeof(GPUParticle) * MAX_PARTICLES;
-            desc.Height             = 1;
-            desc.DepthOrArraySize   = 1;
-            desc.MipLevels          = 1;
-            desc.Format             = DXGI_FORMAT_UNKNOWN;
-            desc.SampleDesc.Count   = 1;
-            desc.Layout             = D3D12_TEXTURE_LAYOUT_ROW_MAJOR;
-            desc.Flags              = D3D12_RESOURCE_FLAG_NONE;
-
-            hr = pDevice->CreateCommittedResource(
-                &heapProps, D3D12_HEAP_FLAG_NONE,
-                &desc, D3D12_RESOURCE_STATE_GENERIC_READ,
-                nullptr, IID_PPV_ARGS(&m_pInitUpload));
-            if (FAILED(hr)) { OutputDebugStringA("[FluidPS] GPU init upload buffer 생성 실패\n"); }
-        }
-
-        // m_pSPHCB: UPLOAD, SPHConstants 크기에 맞게 256 bytes 정렬 (3 서브스텝 분)
-        {
-            const UINT64 spCBSize = 3 * ((sizeof(SPHConstants) + 255u) & ~255u);
-            D3D12_RESOURCE_DESC desc = {};
-            desc.Dimension          = D3D12_RESOURCE_DIMENSION_BUFFER;
-            desc.Width              = spCBSize;
-            desc.Height             = 1;
-            desc.DepthOrArraySize   = 1;
-            desc.MipLevels          = 1;
-            desc.Format             = DXGI_FORMAT_UNKNOWN;
-            desc.SampleDesc.Count   = 1;
-            desc.Layout             = D3D12_TEXTURE_LAYOUT_ROW_MAJOR;
-            desc.Flags              = D3D12_RESOURCE_FLAG_NONE;
-
-            hr = pDevice->CreateCommittedResource(
-                &heapProps, D3D12_HEAP_FLAG_NONE,
-                &desc, D3D12_RESOURCE_STATE_GENERIC_READ,
-                nullptr, IID_PPV_ARGS(&m_pSPHCB));
-            if (FAILED(hr)) { OutputDebugStringA("[FluidPS] SPH CB 생성 실패\n"); }
-            else { m_pSPHCB->Map(0, nullptr, (void**)&m_pMappedSPHCB); }
-        }
-
-        // m_pCPBuffer: UPLOAD, MAX_GPU_CPS x 32 bytes
-        {
-            D3D12_RESOURCE_DESC desc = {};
-            desc.Dimension          = D3D12_RESOURCE_DIMENSION_BUFFER;
-            desc.Width              = sizeof(GPUControlPoint) * MAX_GPU_CPS;
-            desc.Height             = 1;
-            desc.DepthOrArraySize   = 1;
-            desc.MipLevels          = 1;
-            desc.Format             = DXGI_FORMAT_UNKNOWN;
-            desc.SampleDesc.Count   = 1;
-            desc.Layout             = D3D12_TEXTURE_LAYOUT_ROW_MAJOR;
-            desc.Flags              = D3D12_RESOURCE_FLAG_NONE;
-
-            hr = pDevice->CreateCommittedResource(
-                &heapProps, D3D12_HEAP_FLAG_NONE,
-                &desc, D3D12_RESOURCE_STATE_GENERIC_READ,
-                nullptr, IID_PPV_ARGS(&m_pCPBuffer));
-            if (FAILED(hr)) { OutputDebugStringA("[FluidPS] CP buffer 생성 실패\n"); }
-            else { m_pCPBuffer->Map(0, nullptr, (void**)&m_pMappedCPBuffer); }
-        }
-
-        // m_pHashCountBuffer: DEFAULT, UAV (uint x GPU_HASH_TABLE_SIZE)
-        {
-            D3D12_RESOURCE_DESC desc = {};
-            desc.Dimension          = D3D12_RESOURCE_DIMENSION_BUFFER;
-            desc.Width              = sizeof(uint32_t) * GPU_HASH_TABLE_SIZE;
-            desc.Height             = 1;
-            desc.DepthOrArraySize   = 1;
-            desc.MipLevels          = 1;
-            desc.Format             = DXGI_FORMAT_UNKNOWN;
-            desc.SampleDesc.Count   = 1;
-            desc.Layout             = D3D12_TEXTURE_LAYOUT_ROW_MAJOR;
-            desc.Flags              = D3D12_RESOURCE_FLAG_ALLOW_UNORDERED_ACCESS;
-
-            hr = pDevice->CreateCommittedResource(
-                &defaultHeapProps, D3D12_HEAP_FLAG_NONE,
-                &desc, D3D12_RESOURCE_STATE_UNORDERED_ACCESS,
-                nullptr, IID_PPV_ARGS(&m_pHashCountBuffer));
-            if (FAILED(hr)) { OutputDebugStringA("[FluidPS] Hash count buffer 생성 실패\n"); }
-        }
-
-        // m_pHashEntryBuffer: DEFAULT, UAV (uint x GPU_HASH_TABLE_SIZE * GPU_MAX_PER_CELL)
-        {
-            D3D12_RESOURCE_DESC desc = {};
-            desc.Dimension          = D3D12_RESOURCE_DIMENSION_BUFFER;
-            desc.Width              = sizeof(uint32_t) * GPU_HASH_TABLE_SIZE * GPU_MAX_PER_CELL;
-            desc.Height             = 1;
-            desc.DepthOrArraySize   = 1;
-            desc.MipLevels          = 1;
-            desc.Format             = DXGI_FORMAT_UNKNOWN;
-            desc.SampleDesc.Count   = 1;
-            desc.Layout             = D3D12_TEXTURE_LAYOUT_ROW_MAJOR;
-            desc.Flags              = D3D12_RESOURCE_FLAG_ALLOW_UNORDERED_ACCESS;
-
-            hr = pDevice->CreateCommittedResource(
-                &defaultHeapProps, D3D12_HEAP_FLAG_NONE,
-                &desc, D3D12_RESOURCE_STATE_UNORDERED_ACCESS,
-                nullptr, IID_PPV_ARGS(&m_pHashEntryBuffer));
-            if (FAILED(hr)) { OutputDebugStringA("[FluidPS] Hash entry buffer 생성 실패\n"); }
-        }
-
-        // SRV를 m_pGPURenderBuffer에 등록 (기존 m_pParticleBuffer SRV를 덮어씀)
-        if (m_pGPURenderBuffer)
-        {
-            D3D12_SHADER_RESOURCE_VIEW_DESC srvDescGPU = {};
-            srvDescGPU.Format                     = DXGI_FORMAT_UNKNOWN;
-            srvDescGPU.ViewDimension              = D3D12_SRV_DIMENSION_BUFFER;
-            srvDescGPU.Shader4ComponentMapping    = D3D12_DEFAULT_SHADER_4_COMPONENT_MAPPING;
-            srvDescGPU.Buffer.FirstElement        = 0;
-            srvDescGPU.Buffer.NumElements         = MAX_PARTICLES;
-            srvDescGPU.Buffer.StructureByteStride = sizeof(FluidParticleRenderData);
-            srvDescGPU.Buffer.Flags               = D3D12_BUFFER_SRV_FLAG_NONE;
-
-            D3D12_CPU_DESCRIPTOR_HANDLE srvCpuHandle2 = pDescriptorHeap->GetCPUHandle(nSrvDescriptorIndex);
-            pDevice->CreateShaderResourceView(m_pGPURenderBuffer.Get(), &srvDescGPU, srvCpuHandle2);
-        }
-    }
+    D3D12_CPU_DESCRIPTOR_HANDLE srvCpuHandle = m_pDescriptorHeap->GetCPUHandle(m_nSrvDescriptorIndex);
+    m_pd3dDevice->CreateShaderResourceView(m_pGPURenderBuffer.Get(), &srvDesc, srvCpuHandle);
+    return true;
+}
 
-    // GPU SPH 파이프라인 빌드
-    BuildSPHPipeline(pDevice);
-    m_bGPUInited = true;
+void FluidParticleSystem::ReleaseSimState()
+{
+    if (!m_pSimState)
+        return;
 
-    OutputDebugStringA("[FluidParticleSystem] Initialized (GPU SPH enabled)\n");
+    // 렌더 버퍼 상태 추적은 버퍼와 함께 다음 주인에게 넘어간다
+    m_pSimState->nRenderBufferState = static_cast<uint32_t>(m_eGPURenderBufferState);
+    FluidSimStatePool::Get().Release(m_pSimState);
+    m_pSimState = nullptr;
+
+    m_pGPUStateBuffer.Reset();
+    m_pGPURenderBuffer.Reset();
+    m_pHashBuffer.Reset();
+    m_pUploadBuffer.Reset();
+    m_pMappedPassCB      = nullptr;
+    m_pMappedDepthPassCB = nullptr;
+    m_pMappedSPHCB       = nullptr;
+    m_pMappedCPBuffer    = nullptr;
+    m_pMappedParticles   = nullptr;
+    m_pMappedInit        = nullptr;
+    m_eGPURenderBufferState = D3D12_RESOURCE_STATE_COMMON;
+    m_bNeedsUpload = false;
 }
 
 // ============================================================================
@@ -573,6 +399,9 @@ void FluidParticleSystem::Spawn(const XMFLOAT3& center, const FluidParticleConfi
     m_Particles.clear();
     m_Particles.resize(count);
 
+    // 파티클 수에 맞는 등급의 GPU 상태 (해시 테이블도 이 등급 크기)
+    AcquireSimState(count);
+
     int nucleusCount = (int)(count * config.nucleusFraction);
 
     // 스폰 그룹별 파티클 수 합산 (핵 + 위성 그룹 + 나머지)
@@ -663,27 +492,22 @@ void FluidParticleSystem::Spawn(const XMFLOAT3& center, const FluidParticleConfi
     }
 
     // GPU SPH: 초기 파티클 상태를 업로드 버퍼에 저장
-    if (m_pInitUpload && m_bGPUInited)
+    if (m_pMappedInit && m_bGPUInited)
     {
-        GPUParticle* pMapped = nullptr;
-        m_pInitUpload->Map(0, nullptr, (void**)&pMapped);
-        if (pMapped)
+        GPUParticle* pMapped = m_pMappedInit;
+        memset(pMapped, 0, sizeof(GPUParticle) * count);
+        for (int i = 0; i < count; ++i)
         {
-            memset(pMapped, 0, sizeof(GPUParticle) * MAX_PARTICLES);
-            for (int i = 0; i < count; ++i)
-            {
-                pMapped[i].pos         = m_Particles[i].position;
-                pMapped[i].density     = m_Particles[i].density;
-                pMapped[i].vel         = m_Particles[i].velocity;
-                pMapped[i].nearDensity = 0.f;
-                pMapped[i].force       = { 0, 0, 0 };
-                pMapped[i].mass        = m_Particles[i].mass;
-                pMapped[i].active      = m_Particles[i].active ? 1 : 0;
-                pMapped[i].cpGroup     = m_Particles[i].cpGroup;
-                pMapped[i]._pad[0]     = 0.f;
-                pMapped[i]._pad[1]     = 0.f;
-            }
-            m_pInitUpload->Unmap(0, nullptr);
+            pMapped[i].pos         = m_Particles[i].position;
+            pMapped[i].density     = m_Particles[i].density;
+            pMapped[i].vel         = m_Particles[i].velocity;
+            pMapped[i].nearDensity = 0.f;
+            pMapped[i].force       = { 0, 0, 0 };
+            pMapped[i].mass        = m_Particles[i].mass;
+            pMapped[i].active      = m_Particles[i].active ? 1 : 0;
+            pMapped[i].cpGroup     = m_Particles[i].cpGroup;
+            pMapped[i]._pad[0]     = 0.f;
+            pMapped[i]._pad[1]     = 0.f;
         }
         m_bNeedsUpload = true;
     }
@@ -693,9 +517,11 @@ void FluidParticleSystem::Spawn(const XMFLOAT3& center, const FluidParticleConfi
 
 void FluidParticleSystem::Clear()
 {
-    m_Particles.clear();
+    // 큰 이펙트가 남긴 용량을 슬롯이 계속 들고 있지 않도록 CPU 쪽도 비운다
+    std::vector<FluidParticle>().swap(m_Particles);
     m_ControlPoints.clear();
     m_nActiveCount = 0;
+    ReleaseSimState();
 }
 
 void FluidParticleSystem::SetControlPoints(const std::vector<FluidControlPoint>& cps)
@@ -714,338 +540,81 @@ void FluidParticleSystem::ClearControlPoints()
 }
 
 // ============================================================================
-// SPH Kernel Functions (Clavet 2005 / Sebastian Lague dual-density relaxation)
+// SPH CPU fallback
 // ============================================================================
-float FluidParticleSystem::ViscLaplacian(float r, float h) const
-{
-    if (r >= h) return 0.0f;
-    float h6 = h * h * h * h * h * h;
-    return (45.0f / (PI_F * h6)) * (h - r);
-}
-
-// ============================================================================
-// Spatial Hash
-// ============================================================================
-int FluidParticleSystem::HashCell(int cx, int cy, int cz) const
-{
-    unsigned int h = (unsigned int)(cx * 73856093) ^ (unsigned int)(cy * 19349663) ^ (unsigned int)(cz * 83492791);
-    return (int)(h & (HASH_TABLE_SIZE - 1));
-}
-
-void FluidParticleSystem::CellFromPos(const XMFLOAT3& p, int& cx, int& cy, int& cz) const
-{
-    float invH = 1.0f / m_Config.smoothingRadius;
-    cx = (int)floorf(p.x * invH);
-    cy = (int)floorf(p.y * invH);
-    cz = (int)floorf(p.z * invH);
-}
-
-void FluidParticleSystem::BuildSpatialHash()
+void FluidParticleSystem::StepCPU(float dt)
 {
-    for (int i = 0; i < HASH_TABLE_SIZE; ++i)
-        m_HashTable[i].count = 0;
-
-    int n = (int)m_Particles.size();
-    for (int i = 0; i < n; ++i)
+    // 활성 파티클만 솔버 SoA로 옮긴다 (솔버는 자기 순서로 정렬해서 계산)
+    m_CPUActive.clear();
+    for (int i = 0; i < (int)m_Particles.size(); ++i)
     {
-        if (!m_Particles[i].active) continue;
-        int cx, cy, cz;
-        CellFromPos(m_Particles[i].position, cx, cy, cz);
-        int h = HashCell(cx, cy, cz);
-        auto& cell = m_HashTable[h];
-        if (cell.count < MAX_PER_CELL)
-        {
-            cell.particles[cell.count++] = i;
-        }
+        if (m_Particles[i].active)
+            m_CPUActive.push_back(i);
     }
-}
-
-int FluidParticleSystem::GetNeighbors(int i, int* out, int maxOut) const
-{
-    int count = 0;
-    int cx, cy, cz;
-    CellFromPos(m_Particles[i].position, cx, cy, cz);
 
-    float h2 = m_Config.smoothingRadius * m_Config.smoothingRadius;
+    const int n = (int)m_CPUActive.size();
+    if (n == 0) return;
 
-    for (int dx = -1; dx <= 1; ++dx)
+    m_CPUSolver.Resize(n);
+    float* px = m_CPUSolver.PosX(); float* py = m_CPUSolver.PosY(); float* pz = m_CPUSolver.PosZ();
+    float* vx = m_CPUSolver.VelX(); float* vy = m_CPUSolver.VelY(); float* vz = m_CPUSolver.VelZ();
+    float* mass = m_CPUSolver.Mass();
+    for (int k = 0; k < n; ++k)
     {
-        for (int dy = -1; dy <= 1; ++dy)
-        {
-            for (int dz = -1; dz <= 1; ++dz)
-            {
-                int h = HashCell(cx + dx, cy + dy, cz + dz);
-                const auto& cell = m_HashTable[h];
-                for (int k = 0; k < cell.count; ++k)
-                {
-                    int j = cell.particles[k];
-                    if (j == i) continue;
-
-                    float rx = m_Particles[i].position.x - m_Particles[j].position.x;
-                    float ry = m_Particles[i].position.y - m_Particles[j].position.y;
-                    float rz = m_Particles[i].position.z - m_Particles[j].position.z;
-                    float r2 = rx * rx + ry * ry + rz * rz;
-
-                    if (r2 < h2)
-                    {
-                        if (count < maxOut)
-                            out[count++] = j;
-                    }
-                }
-            }
-        }
-    }
-    return count;
-}
-
-// ============================================================================
-// SPH Density — Clavet 2005 이중 밀도 완화 (GPU와 동일한 SpikyPow2 + SpikyPow3)
-// ============================================================================
-void FluidParticleSystem::ComputeDensityPressure()
-{
-    float h  = m_Config.smoothingRadius;
-    float h2 = h * h;
-    float h5 = h2 * h2 * h;
-    float h6 = h5 * h;
-    // 커널 상수 (GPU DispatchSPH의 kSpikyPow2/kSpikyPow3와 동일)
-    float kPow2 = 15.0f / (2.0f * PI_F * h5);   // SpikyPow2 정규화
-    float kPow3 = 15.0f / (PI_F * h6);           // SpikyPow3 정규화
-
-    int neighbors[MAX_NEIGHBOR_SEARCH];
-    int n = (int)m_Particles.size();
-
-    for (int i = 0; i < n; ++i)
+        const FluidParticle& p = m_Particles[m_CPUActive[k]];
+        px[k] = p.position.x; py[k] = p.position.y; pz[k] = p.position.z;
+        vx[k] = p.velocity.x; vy[k] = p.velocity.y; vz[k] = p.velocity.z;
+        mass[k] = p.mass;
+    }
+
+    FluidSPHParams& params = m_CPUParams;
+    params.smoothingRadius        = m_Config.smoothingRadius;
+    params.restDensity            = m_Config.restDensity;
+    params.stiffness              = m_Config.stiffness;
+    params.nearPressureMultiplier = m_Config.nearPressureMultiplier;
+    params.viscosity              = m_Config.viscosity;
+    params.boundaryStiffness      = m_Config.boundaryStiffness;
+
+    // Gravity 모드: CP 인력 대신 중력 적용
+    params.useGravity = (m_MotionMode == ParticleMotionMode::Gravity);
+    params.gravity    = { m_GravityDesc.gravity.x, m_GravityDesc.gravity.y, m_GravityDesc.gravity.z };
+
+    params.controlPoints.clear();
+    for (const auto& cp : m_ControlPoints)
     {
-        if (!m_Particles[i].active) continue;
-
-        // 자기 기여: r=0 → SpikyPow2(0,h) = h² * kPow2 (GPU와 동일)
-        float density     = h2 * kPow2;
-        float nearDensity = 0.0f;
-
-        int nCount = GetNeighbors(i, neighbors, MAX_NEIGHBOR_SEARCH);
-        for (int k = 0; k < nCount; ++k)
-        {
-            int j = neighbors[k];
-            float rx = m_Particles[i].position.x - m_Particles[j].position.x;
-            float ry = m_Particles[i].position.y - m_Particles[j].position.y;
-            float rz = m_Particles[i].position.z - m_Particles[j].position.z;
-            float r2 = rx * rx + ry * ry + rz * rz;
-            if (r2 >= h2) continue;
-
-            float r = sqrtf(r2);
-            float v = h - r;
-            density     += v * v * kPow2;       // SpikyPow2: K*(h-r)^2
-            nearDensity += v * v * v * kPow3;   // SpikyPow3: K*(h-r)^3
-        }
-
-        m_Particles[i].density     = (std::max)(density, 0.001f);
-        m_Particles[i].nearDensity = (std::max)(nearDensity, 0.0f);
+        FluidSPHControlPoint scp;
+        scp.position           = { cp.position.x, cp.position.y, cp.position.z };
+        scp.attractionStrength = cp.attractionStrength;
+        scp.sphereRadius       = cp.sphereRadius;
+        params.controlPoints.push_back(scp);
     }
-}
 
-// ============================================================================
-// SPH Forces — Clavet 2005 이중 밀도 완화 (GPU와 동일한 압력 공식)
-// ============================================================================
-void FluidParticleSystem::ComputeForces()
-{
-    float h  = m_Config.smoothingRadius;
-    float h2 = h * h;
-    float h5 = h2 * h2 * h;
-    float h6 = h5 * h;
-    // DerivSpikyPow2: -2*K2*(h-r),  DerivSpikyPow3: -3*K3*(h-r)^2
-    float kPow2Grad = 30.0f / (2.0f * PI_F * h5);  // GPU kSpikyPow2Grad
-    float kPow3Grad = 45.0f / (PI_F * h6);          // GPU kSpikyPow3Grad
-
-    int neighbors[MAX_NEIGHBOR_SEARCH];
-    int n = (int)m_Particles.size();
+    params.globalGravity = m_GlobalGravityStrength;
 
-    for (int i = 0; i < n; ++i)
+    params.boxActive = m_ConfinementBox.active;
+    if (params.boxActive)
     {
-        if (!m_Particles[i].active) continue;
-
-        float fx = 0.0f, fy = 0.0f, fz = 0.0f;
-
-        float densityI      = m_Particles[i].density;
-        float nearDensityI  = m_Particles[i].nearDensity;
-        float pressI        = m_Config.stiffness * (densityI - m_Config.restDensity);
-        float nearPressI    = m_Config.nearPressureMultiplier * nearDensityI;
-
-        int nCount = GetNeighbors(i, neighbors, MAX_NEIGHBOR_SEARCH);
-        for (int k = 0; k < nCount; ++k)
-        {
-            int j = neighbors[k];
-            float rx = m_Particles[i].position.x - m_Particles[j].position.x;
-            float ry = m_Particles[i].position.y - m_Particles[j].position.y;
-            float rz = m_Particles[i].position.z - m_Particles[j].position.z;
-            float rLen = sqrtf(rx * rx + ry * ry + rz * rz);
-            if (rLen < 0.0001f || rLen >= h) continue;
-
-            float densityJ      = (std::max)(m_Particles[j].density, 0.001f);
-            float nearDensityJ  = (std::max)(m_Particles[j].nearDensity, 0.001f);
-            float pressJ        = m_Config.stiffness * (densityJ - m_Config.restDensity);
-            float nearPressJ    = m_Config.nearPressureMultiplier * nearDensityJ;
-
-            float sharedPress     = (pressI + pressJ) * 0.5f;
-            float sharedNearPress = (nearPressI + nearPressJ) * 0.5f;
-
-            // 방향: j → i (GPU와 동일: diff = pos_i - pos_j)
-            float dirX = rx / rLen;
-            float dirY = ry / rLen;
-            float dirZ = rz / rLen;
-
-            // 압력 구배 커널 도함수 (음수값)
-            float v = h - rLen;
-            float dPress     = -v * kPow2Grad;        // DerivSpikyPow2
-            float dNearPress = -v * v * kPow3Grad;    // DerivSpikyPow3
-
-            // GPU와 동일: f -= dir * (dW*P/rho + dWnear*Pnear/rho_near) * mass_j
-            float pForce = (dPress * sharedPress / densityJ
-                          + dNearPress * sharedNearPress / nearDensityJ)
-                          * m_Particles[j].mass;
-            fx -= dirX * pForce;
-            fy -= dirY * pForce;
-            fz -= dirZ * pForce;
-
-            // 점성 (기존 유지 - GPU와 동일)
-            float viscLap = ViscLaplacian(rLen, h);
-            float vScale = m_Config.viscosity * m_Particles[j].mass / densityJ * viscLap;
-            fx += (m_Particles[j].velocity.x - m_Particles[i].velocity.x) * vScale;
-            fy += (m_Particles[j].velocity.y - m_Particles[i].velocity.y) * vScale;
-            fz += (m_Particles[j].velocity.z - m_Particles[i].velocity.z) * vScale;
-        }
-
-        // Gravity 모드: CP 인력 대신 중력 적용
-        if (m_MotionMode == ParticleMotionMode::Gravity) {
-            fx += m_GravityDesc.gravity.x * m_Particles[i].mass;
-            fy += m_GravityDesc.gravity.y * m_Particles[i].mass;
-            fz += m_GravityDesc.gravity.z * m_Particles[i].mass;
-        }
-        else {
-            // ControlPoint / OrbitalCP 모드: 기존 CP 인력 + swirl
-            for (const auto& cp : m_ControlPoints)
-            {
-                float dx = cp.position.x - m_Particles[i].position.x;
-                float dy = cp.position.y - m_Particles[i].position.y;
-                float dz = cp.position.z - m_Particles[i].position.z;
-                float dist = sqrtf(dx * dx + dy * dy + dz * dz);
-
-                if (dist < 0.001f) continue;
-
-                float invDist = 1.0f / dist;
-                float ndx = dx * invDist;
-                float ndy = dy * invDist;
-                float ndz = dz * invDist;
-
-                // Soft attraction (attenuated by distance)
-                float attraction = cp.attractionStrength / (1.0f + dist * 0.5f);
-                fx += ndx * attraction;
-                fy += ndy * attraction;
-                fz += ndz * attraction;
-
-                // Gentle swirl: tangential force = cross(Y_up, toward_cp)
-                // Creates horizontal rotation around the control point
-                float swirlStrength = cp.attractionStrength * 0.35f;
-                // tangent = cross((0,1,0), (ndx,ndy,ndz)) = (ndz, 0, -ndx)
-                fx += ndz * swirlStrength;
-                fz += -ndx * swirlStrength;
-
-                // Boundary: strong inward force if outside sphere radius
-                if (dist > cp.sphereRadius)
-                {
-                    float overshoot = dist - cp.sphereRadius;
-                    float boundaryForce = m_Config.boundaryStiffness * overshoot;
-                    fx += ndx * boundaryForce;
-                    fy += ndy * boundaryForce;
-                    fz += ndz * boundaryForce;
-                }
-            }
-        }
-
-        // 전역 중력 (모든 모드에서 선택적 적용)
-        if (m_GlobalGravityStrength > 0.f) {
-            fy -= m_GlobalGravityStrength * m_Particles[i].mass;
-        }
-
-        // ConfinementBox 경계력 (모든 모드에서 선택적 적용)
-        if (m_ConfinementBox.active) {
-            XMVECTOR toParticle = XMVectorSubtract(
-                XMLoadFloat3(&m_Particles[i].position),
-                XMLoadFloat3(&m_ConfinementBox.center));
-            float localX = XMVectorGetX(XMVector3Dot(toParticle, XMLoadFloat3(&m_ConfinementBox.axisX)));
-            float localY = XMVectorGetX(XMVector3Dot(toParticle, XMLoadFloat3(&m_ConfinementBox.axisY)));
-            float localZ = XMVectorGetX(XMVector3Dot(toParticle, XMLoadFloat3(&m_ConfinementBox.axisZ)));
-
-            XMVECTOR forceVec = XMVectorZero();
-            float bStiff = m_Config.boundaryStiffness;
-
-            auto applyAxisForce = [&](float localCoord, float halfExt, const XMFLOAT3& axis) {
-                if (localCoord > halfExt) {
-                    float excess = localCoord - halfExt;
-                    XMVECTOR axisVec = XMLoadFloat3(&axis);
-                    forceVec = XMVectorSubtract(forceVec, XMVectorScale(axisVec, bStiff * excess));
-                } else if (localCoord < -halfExt) {
-                    float excess = -halfExt - localCoord;
-                    XMVECTOR axisVec = XMLoadFloat3(&axis);
-                    forceVec = XMVectorAdd(forceVec, XMVectorScale(axisVec, bStiff * excess));
-                }
-            };
-
-            applyAxisForce(localX, m_ConfinementBox.halfExtents.x, m_ConfinementBox.axisX);
-            applyAxisForce(localY, m_ConfinementBox.halfExtents.y, m_ConfinementBox.axisY);
-            applyAxisForce(localZ, m_ConfinementBox.halfExtents.z, m_ConfinementBox.axisZ);
-
-            XMFLOAT3 boxForce;
-            XMStoreFloat3(&boxForce, forceVec);
-            fx += boxForce.x;
-            fy += boxForce.y;
-            fz += boxForce.z;
-        }
-
-        m_Particles[i].force = { fx, fy, fz };
+        auto toVec = [](const XMFLOAT3& v) { return FluidSPHVec3{ v.x, v.y, v.z }; };
+        params.boxCenter      = toVec(m_ConfinementBox.center);
+        params.boxHalfExtents = toVec(m_ConfinementBox.halfExtents);
+        params.boxAxisX       = toVec(m_ConfinementBox.axisX);
+        params.boxAxisY       = toVec(m_ConfinementBox.axisY);
+        params.boxAxisZ       = toVec(m_ConfinementBox.axisZ);
     }
-}
 
-// ============================================================================
-// Integration
-// ============================================================================
-void FluidParticleSystem::Integrate(float dt)
-{
-    const float DAMPING = 0.995f;
-    const float MAX_SPEED = 12.0f;
-    int n = (int)m_Particles.size();
+    m_CPUSolver.Step(params, dt);
 
-    for (int i = 0; i < n; ++i)
+    const float* density     = m_CPUSolver.Density();
+    const float* nearDensity = m_CPUSolver.NearDensity();
+    const float* fx = m_CPUSolver.ForceX(); const float* fy = m_CPUSolver.ForceY(); const float* fz = m_CPUSolver.ForceZ();
+    for (int k = 0; k < n; ++k)
     {
-        if (!m_Particles[i].active) continue;
-
-        float invDensity = 1.0f / (std::max)(m_Particles[i].density, 0.001f);
-
-        // acceleration = force / density
-        m_Particles[i].velocity.x += (m_Particles[i].force.x * invDensity) * dt;
-        m_Particles[i].velocity.y += (m_Particles[i].force.y * invDensity) * dt;
-        m_Particles[i].velocity.z += (m_Particles[i].force.z * invDensity) * dt;
-
-        // Damping
-        m_Particles[i].velocity.x *= DAMPING;
-        m_Particles[i].velocity.y *= DAMPING;
-        m_Particles[i].velocity.z *= DAMPING;
-
-        // Speed clamping
-        float speed2 = m_Particles[i].velocity.x * m_Particles[i].velocity.x
-                      + m_Particles[i].velocity.y * m_Particles[i].velocity.y
-                      + m_Particles[i].velocity.z * m_Particles[i].velocity.z;
-        if (speed2 > MAX_SPEED * MAX_SPEED)
-        {
-            float scale = MAX_SPEED / sqrtf(speed2);
-            m_Particles[i].velocity.x *= scale;
-            m_Particles[i].velocity.y *= scale;
-            m_Particles[i].velocity.z *= scale;
-        }
-
-        // Position update
-        m_Particles[i].position.x += m_Particles[i].velocity.x * dt;
-        m_Particles[i].position.y += m_Particles[i].velocity.y * dt;
-        m_Particles[i].position.z += m_Particles[i].velocity.z * dt;
+        FluidParticle& p = m_Particles[m_CPUActive[k]];
+        p.position    = { px[k], py[k], pz[k] };
+        p.velocity    = { vx[k], vy[k], vz[k] };
+        p.force       = { fx[k], fy[k], fz[k] };
+        p.density     = density[k];
+        p.nearDensity = nearDensity[k];
     }
 }
 
@@ -1153,10 +722,7 @@ void FluidParticleSystem::Update(float deltaTime)
     }
 
     // GPU가 비활성인 경우 CPU fallback SPH 시뮬레이션
-    BuildSpatialHash();
-    ComputeDensityPressure();
-    ComputeForces();
-    Integrate(dt);
+    StepCPU(dt);
 }
 
 // ============================================================================
@@ -1182,7 +748,7 @@ void FluidParticleSystem::UploadRenderData()
         if (m_BeamDesc.spreadRadius > 0.001f) invMaxRadius = 1.0f / m_BeamDesc.spreadRadius;
     }
 
-    for (int i = 0; i < n && renderIdx < MAX_PARTICLES; ++i)
+    for (int i = 0; i < n && renderIdx < m_pSimState->desc.nCapacity; ++i)
     {
         if (!m_Particles[i].active) continue;
 
@@ -1256,7 +822,7 @@ void FluidParticleSystem::UploadRenderData()
 void FluidParticleSystem::Render(ID3D12GraphicsCommandList* pCommandList,
                                  const XMFLOAT4X4& viewProj, const XMFLOAT3& cameraRight, const XMFLOAT3& cameraUp)
 {
-    if (m_Particles.empty() || !s_pPSO || !s_pRootSignature) return;
+    if (m_Particles.empty() || !m_pSimState || !s_pPSO || !s_pRootSignature) return;
 
     // Update pass CB
     if (m_pMappedPassCB)
@@ -1282,7 +848,7 @@ void FluidParticleSystem::Render(ID3D12GraphicsCommandList* pCommandList,
     pCommandList->SetGraphicsRootSignature(s_pRootSignature.Get());
 
     // Bind root parameters
-    pCommandList->SetGraphicsRootConstantBufferView(0, m_pPassCB->GetGPUVirtualAddress());
+    pCommandList->SetGraphicsRootConstantBufferView(0, GetUploadAddress(m_pSimState->desc.nPassCBOffset));
 
     D3D12_GPU_DESCRIPTOR_HANDLE srvGpuHandle = m_pDescriptorHeap->GetGPUHandle(m_nSrvDescriptorIndex);
     pCommandList->SetGraphicsRootDescriptorTable(1, srvGpuHandle);
@@ -1524,7 +1090,7 @@ void FluidParticleSystem::RenderDepth(
 {
     if (!pSSF || !pSSF->IsInitialized()) return;
     if (m_Particles.empty()) return;
-    if (!m_pDepthPassCB || !m_pMappedDepthPassCB) return;
+    if (!m_pSimState || !m_pMappedDepthPassCB) return;
     if (m_nActiveCount == 0) return;
 
     // GPU 렌더 버퍼 상태 전환: NON_PIXEL_SHADER_RESOURCE (SRV로 읽기)
@@ -1571,7 +1137,7 @@ void FluidParticleSystem::RenderDepth(
     ID3D12DescriptorHeap* heaps[] = { m_pDescriptorHeap->GetHeap() };
     pCmdList->SetDescriptorHeaps(1, heaps);
 
-    pCmdList->SetGraphicsRootConstantBufferView(0, m_pDepthPassCB->GetGPUVirtualAddress());
+    pCmdList->SetGraphicsRootConstantBufferView(0, GetUploadAddress(m_pSimState->desc.nDepthPassCBOffset));
 
     D3D12_GPU_DESCRIPTOR_HANDLE srvGpuHandle = m_pDescriptorHeap->GetGPUHandle(m_nSrvDescriptorIndex);
     pCmdList->SetGraphicsRootDescriptorTable(1, srvGpuHandle);
@@ -1589,7 +1155,7 @@ void FluidParticleSystem::RenderThicknessOnly(
 {
     if (!pSSF || !pSSF->IsInitialized()) return;
     if (m_Particles.empty()) return;
-    if (!m_pDepthPassCB || !m_pMappedDepthPassCB) return;
+    if (!m_pSimState || !m_pMappedDepthPassCB) return;
     if (m_nActiveCount == 0) return;
 
     // GPU 렌더 버퍼는 RenderDepth에서 이미 NON_PIXEL_SHADER_RESOURCE 상태로 전환됨
@@ -1602,7 +1168,7 @@ void FluidParticleSystem::RenderThicknessOnly(
     ID3D12DescriptorHeap* heaps[] = { m_pDescriptorHeap->GetHeap() };
     pCmdList->SetDescriptorHeaps(1, heaps);
 
-    pCmdList->SetGraphicsRootConstantBufferView(0, m_pDepthPassCB->GetGPUVirtualAddress());
+    pCmdList->SetGraphicsRootConstantBufferView(0, GetUploadAddress(m_pSimState->desc.nDepthPassCBOffset));
 
     D3D12_GPU_DESCRIPTOR_HANDLE srvGpuHandle = m_pDescriptorHeap->GetGPUHandle(m_nSrvDescriptorIndex);
     pCmdList->SetGraphicsRootDescriptorTable(1, srvGpuHandle);
@@ -1657,7 +1223,7 @@ static const char* g_SPHComputeShader = R"_SPH_A_(
         int   gMotionMode;
         float gGlobalGravity;
         int   gBoxActive;
-        float gPad0;
+        uint  gHashTableMask;   // 해시 테이블 크기 - 1 (등급별, power-of-2)
         float3 gGravityVec;
         float  gPad1;
         float3 gBoxCenter;  float gPad2;
@@ -1701,16 +1267,15 @@ static const char* g_SPHComputeShader = R"_SPH_A_(
     RWStructuredBuffer<GPUParticle>             gParticles   : register(u0);
     RWStructuredBuffer<FluidParticleRenderData> gRenderData  : register(u1);
     StructuredBuffer<GPUControlPoint>           gCPs         : register(t0);
-    RWStructuredBuffer<uint>                    gHashCount   : register(u2);  // [GPU_HASH_TABLE_SIZE]
-    RWStructuredBuffer<uint>                    gHashEntries : register(u3);  // [GPU_HASH_TABLE_SIZE * GPU_MAX_PER_CELL]
+    RWStructuredBuffer<uint>                    gHashCount   : register(u2);  // [gHashTableMask + 1]
+    RWStructuredBuffer<uint>                    gHashEntries : register(u3);  // [(gHashTableMask + 1) * GPU_MAX_PER_CELL]
 
     // ---- 공간 해시 상수 ----
-    static const uint GPU_HASH_TABLE_SIZE = 8192u;
     static const uint GPU_MAX_PER_CELL    = 32u;
 
     uint CalcHashCell(int cx, int cy, int cz) {
         return (((uint)cx * 73856093u) ^ ((uint)cy * 19349663u) ^ ((uint)cz * 83492791u))
-               & (GPU_HASH_TABLE_SIZE - 1u);
+               & gHashTableMask;
     }
 
     // ---- 이중 밀도 완화용 SPH 커널 (Sebastian Lague / Clavet 2005) ----
@@ -1749,7 +1314,7 @@ static const char* g_SPHComputeShader = R"_SPH_A_(
     void CS_HashClear(uint3 dtid : SV_DispatchThreadID)
     {
         uint idx = dtid.x;
-        if (idx < GPU_HASH_TABLE_SIZE)
+        if (idx <= gHashTableMask)
             gHashCount[idx] = 0u;
     }
 
@@ -2177,7 +1742,7 @@ void FluidParticleSystem::DispatchSPH(ID3D12GraphicsCommandList* pCmdList, float
     if (!m_bGPUInited || m_Particles.empty()) return;
     if (!s_pSPHRootSig || !s_pDensityPSO || !s_pForcesPSO || !s_pIntegratePSO) return;
     if (!s_pHashClearPSO || !s_pHashBuildPSO) return;
-    if (!m_pHashCountBuffer || !m_pHashEntryBuffer) return;
+    if (!m_pSimState || !m_pHashBuffer) return;
 
     // Beam 모드: CPU에서 처리 후 GPU 렌더 버퍼로 복사
     if (m_MotionMode == ParticleMotionMode::Beam)
@@ -2189,7 +1754,7 @@ void FluidParticleSystem::DispatchSPH(ID3D12GraphicsCommandList* pCmdList, float
     int N = (int)m_Particles.size();
 
     // 1. 초기 업로드 처리
-    if (m_bNeedsUpload && m_pInitUpload && m_pGPUStateBuffer)
+    if (m_bNeedsUpload && m_pGPUStateBuffer)
     {
         // State buffer: COMMON -> COPY_DEST
         {
@@ -2203,8 +1768,8 @@ void FluidParticleSystem::DispatchSPH(ID3D12GraphicsCommandList* pCmdList, float
         }
 
         pCmdList->CopyBufferRegion(m_pGPUStateBuffer.Get(), 0,
-                                    m_pInitUpload.Get(), 0,
-                                    sizeof(GPUParticle) * MAX_PARTICLES);
+                                    m_pUploadBuffer.Get(), m_pSimState->desc.nInitOffset,
+                                    sizeof(GPUParticle) * N);
 
         // COPY_DEST -> UAV
         {
@@ -2265,7 +1830,7 @@ void FluidParticleSystem::DispatchSPH(ID3D12GraphicsCommandList* pCmdList, float
         cb.motionMode    = (m_MotionMode == ParticleMotionMode::Gravity) ? 1 : 0;
         cb.globalGravity = m_GlobalGravityStrength;
         cb.boxActive     = m_ConfinementBox.active ? 1 : 0;
-        cb.pad0          = 0.f;
+        cb.hashTableMask = (uint32_t)m_pSimState->desc.nHashTableSize - 1u;
         cb.gravityVec    = m_GravityDesc.gravity;
         cb.pad1          = 0.f;
         cb.boxCenter     = m_ConfinementBox.center;
@@ -2375,14 +1940,14 @@ void FluidParticleSystem::DispatchSPH(ID3D12GraphicsCommandList* pCmdList, float
     // 4. Compute shader dispatch (3 서브스텝 - Sebastian Lague 방식)
     UINT numGroups = ((UINT)N + 63) / 64;
     const UINT64 cbStride = ((sizeof(SPHConstants) + 255u) & ~255u);
-    D3D12_GPU_VIRTUAL_ADDRESS cbBase = m_pSPHCB->GetGPUVirtualAddress();
+    D3D12_GPU_VIRTUAL_ADDRESS cbBase = GetUploadAddress(m_pSimState->desc.nSPHCBOffset);
 
     pCmdList->SetComputeRootSignature(s_pSPHRootSig.Get());
     pCmdList->SetComputeRootUnorderedAccessView(1, m_pGPUStateBuffer->GetGPUVirtualAddress());
     pCmdList->SetComputeRootUnorderedAccessView(2, m_pGPURenderBuffer->GetGPUVirtualAddress());
-    pCmdList->SetComputeRootShaderResourceView(3,  m_pCPBuffer->GetGPUVirtualAddress());
-    pCmdList->SetComputeRootUnorderedAccessView(4, m_pHashCountBuffer->GetGPUVirtualAddress());
-    pCmdList->SetComputeRootUnorderedAccessView(5, m_pHashEntryBuffer->GetGPUVirtualAddress());
+    pCmdList->SetComputeRootShaderResourceView(3,  GetUploadAddress(m_pSimState->desc.nCPOffset));
+    pCmdList->SetComputeRootUnorderedAccessView(4, m_pHashBuffer->GetGPUVirtualAddress());
+    pCmdList->SetComputeRootUnorderedAccessView(5, m_pHashBuffer->GetGPUVirtualAddress() + m_pSimState->desc.nHashEntryOffset);
 
     // 전역 UAV 배리어 (모든 UAV 쓰기 완료 대기)
     auto GlobalUAVBarrier = [&]() {
@@ -2401,7 +1966,7 @@ void FluidParticleSystem::DispatchSPH(ID3D12GraphicsCommandList* pCmdList, float
     };
 
     // 해시 클리어 dispatch 그룹 수
-    UINT hashClearGroups = (GPU_HASH_TABLE_SIZE + 63) / 64;
+    UINT hashClearGroups = ((UINT)m_pSimState->desc.nHashTableSize + 63) / 64;
 
     for (int sub = 0; sub < 3; sub++)
     {
@@ -2465,7 +2030,7 @@ void FluidParticleSystem::DispatchSPH(ID3D12GraphicsCommandList* pCmdList, float
 // ============================================================================
 void FluidParticleSystem::CopyBeamRenderDataToGPU(ID3D12GraphicsCommandList* pCmdList)
 {
-    if (!m_pMappedParticles || !m_pGPURenderBuffer || !m_pParticleBuffer) return;
+    if (!m_pMappedParticles || !m_pGPURenderBuffer || !m_pUploadBuffer) return;
 
     // CPU에서 렌더 데이터 업로드 (기존 UPLOAD 버퍼에)
     UploadRenderData();
@@ -2485,7 +2050,7 @@ void FluidParticleSystem::CopyBeamRenderDataToGPU(ID3D12GraphicsCommandList* pCm
 
     // UPLOAD -> DEFAULT 복사
     pCmdList->CopyBufferRegion(m_pGPURenderBuffer.Get(), 0,
-                                m_pParticleBuffer.Get(), 0,
+                                m_pUploadBuffer.Get(), m_pSimState->desc.nRenderDataOffset,
                                 sizeof(FluidParticleRenderData) * m_nActiveCount);
 
     // COPY_DEST -> NON_PIXEL_SHADER_RESOURCE
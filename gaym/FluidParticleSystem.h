@@ -3,8 +3,9 @@
 #include "stdafx.h"
 #include "FluidParticle.h"
 #include "VFXTypes.h"
+#include "FluidSPHSolver.h"
+#include "FluidSimStatePool.h"
 #include <vector>
-#include <array>
 
 class CDescriptorHeap;
 class ScreenSpaceFluid;
@@ -37,7 +38,7 @@ struct SPHConstants {
     int      particleCount; float h; float h2; float restDensity;     // 16
     float    stiffness; float viscosity; float dt; float damping;     // 16
     float    maxSpeed; int motionMode; float globalGravity; int boxActive; // 16
-    float    pad0;                                                     // 4
+    uint32_t hashTableMask;                                            // 4  해시 테이블 크기 - 1 (FluidSimStatePool 등급별)
     XMFLOAT3 gravityVec; float pad1;                                   // 16
     XMFLOAT3 boxCenter; float pad2;                                    // 16 (offset 68)
     float    _pad[3];                                                  // 12 (offset 84, float4를 r6=offset 96에 정렬)
@@ -82,9 +83,10 @@ public:
               CDescriptorHeap* pDescriptorHeap, UINT nSrvDescriptorIndex);
 
     // Spawn particles around a center point (replaces current particles)
+    // 파티클 수에 맞는 GPU 상태를 FluidSimStatePool 에서 빌린다
     void Spawn(const XMFLOAT3& center, const FluidParticleConfig& config);
 
-    // Remove all particles
+    // Remove all particles (빌린 GPU 상태도 풀에 돌려준다)
     void Clear();
 
     // Control points
@@ -158,21 +160,8 @@ public:
     void ApplyRandomSidewaysImpulse(const XMFLOAT3& worldAxis, float maxImpulse);
 
 private:
-    // SPH phases (CPU fallback - 유지하되 GPU 모드에서는 미사용)
-    void BuildSpatialHash();
-    void ComputeDensityPressure();
-    void ComputeForces();
-    void Integrate(float dt);
-
-    // Collect neighbors for particle at index i (writes into out, returns count)
-    int  GetNeighbors(int i, int* out, int maxOut) const;
-
-    // SPH kernel helpers (Clavet 2005 / Sebastian Lague dual-density relaxation)
-    float    ViscLaplacian(float r, float h) const;
-
-    // Hash helpers
-    int  HashCell(int cx, int cy, int cz) const;
-    void CellFromPos(const XMFLOAT3& p, int& cx, int& cy, int& cz) const;
+    // SPH CPU fallback (GPU 모드에서는 미사용): 활성 파티클을 SoA 솔버로 옮겨 한 스텝 진행
+    void StepCPU(float dt);
 
     // Upload visible particles to GPU buffer and set m_nActiveCount
     void UploadRenderData();
@@ -180,6 +169,14 @@ private:
     // Beam 모드: CPU 렌더 데이터를 GPU 렌더 버퍼로 복사
     void CopyBeamRenderDataToGPU(ID3D12GraphicsCommandList* pCmdList);
 
+    // 풀에서 nParticles 용 GPU 상태를 빌려 버퍼/매핑 포인터/SRV 를 연결 (이미 같은 등급이면 그대로)
+    bool AcquireSimState(int nParticles);
+    void ReleaseSimState();
+    D3D12_GPU_VIRTUAL_ADDRESS GetUploadAddress(uint64_t nOffset) const
+    {
+        return m_pUploadBuffer->GetGPUVirtualAddress() + nOffset;
+    }
+
     // Simulation state
     std::vector<FluidParticle>     m_Particles;
     std::vector<FluidControlPoint> m_ControlPoints;
@@ -194,29 +191,24 @@ private:
     float                          m_GlobalGravityStrength = 0.f;
     std::vector<FluidControlPoint> m_OrbitalCPs; // OrbitalCP 모드 위성 CP 포함
 
-    // Spatial hash (power-of-2 table, direct-mapped cells)
-    static constexpr int HASH_TABLE_SIZE      = 8192;
-    static constexpr int MAX_PER_CELL         = 32;
-    static constexpr int MAX_NEIGHBOR_SEARCH  = 27 * MAX_PER_CELL;
-    static constexpr int MAX_PARTICLES        = 6144;
+    static constexpr int MAX_PARTICLES        = FluidSimStatePool::kMaxCapacity;
 
-    struct SpatialHashCell
-    {
-        int particles[MAX_PER_CELL];
-        int count = 0;
-    };
-    std::array<SpatialHashCell, HASH_TABLE_SIZE> m_HashTable;
+    // CPU fallback SPH (SoA + counting-sort 해시, WorkerPool 병렬)
+    FluidSPHSolver                 m_CPUSolver;
+    FluidSPHParams                 m_CPUParams;
+    std::vector<int>               m_CPUActive;    // 솔버 인덱스 → m_Particles 인덱스
 
-    // D3D12 resources (기존 빌보드 렌더링용)
-    ComPtr<ID3D12Resource>      m_pParticleBuffer;      // Upload heap, persistently mapped
+    // 풀에서 빌린 GPU 상태 (Spawn ~ Clear). 아래 버퍼/매핑 포인터는 이 상태를 가리킨다
+    ID3D12Device*               m_pd3dDevice        = nullptr;
+    FluidSimState*              m_pSimState         = nullptr;
+
+    // Upload heap, persistently mapped — CB 들 + 빌보드 렌더 데이터 + Spawn 초기 상태 (FluidSimStateDesc 배치)
+    ComPtr<ID3D12Resource>      m_pUploadBuffer;
     FluidParticleRenderData*    m_pMappedParticles  = nullptr;
     int                         m_nActiveCount      = 0;
 
-    ComPtr<ID3D12Resource>      m_pPassCB;              // Internal pass constant buffer
-    void*                       m_pMappedPassCB     = nullptr;
-
-    ComPtr<ID3D12Resource>      m_pDepthPassCB;         // SSF depth pass constant buffer
-    void*                       m_pMappedDepthPassCB = nullptr;
+    void*                       m_pMappedPassCB     = nullptr;   // Internal pass constant buffer
+    void*                       m_pMappedDepthPassCB = nullptr;  // SSF depth pass constant buffer
 
     CDescriptorHeap*            m_pDescriptorHeap       = nullptr;
     UINT                        m_nSrvDescriptorIndex   = 0;
@@ -240,18 +232,14 @@ private:
     // GPU 버퍼
     ComPtr<ID3D12Resource> m_pGPUStateBuffer;    // DEFAULT, UAV - 파티클 상태 (GPUParticle)
     ComPtr<ID3D12Resource> m_pGPURenderBuffer;   // DEFAULT, UAV - 렌더 데이터 출력 (FluidParticleRenderData)
-    ComPtr<ID3D12Resource> m_pInitUpload;        // UPLOAD - Spawn시 초기 상태 업로드
-    ComPtr<ID3D12Resource> m_pSPHCB;             // UPLOAD - SPH 상수 버퍼
-    BYTE*                  m_pMappedSPHCB = nullptr;
-    ComPtr<ID3D12Resource> m_pCPBuffer;          // UPLOAD - Control Points
-    GPUControlPoint*       m_pMappedCPBuffer = nullptr;
-    static constexpr int   MAX_GPU_CPS = 16;
-
-    // 공간 해싱 GPU 버퍼
-    static constexpr int   GPU_HASH_TABLE_SIZE = 8192;  // power-of-2, 2^13
-    static constexpr int   GPU_MAX_PER_CELL    = 32;    // 셀당 최대 파티클 수
-    ComPtr<ID3D12Resource> m_pHashCountBuffer;  // DEFAULT, UAV - 해시 셀 카운트 [TABLE_SIZE]
-    ComPtr<ID3D12Resource> m_pHashEntryBuffer;  // DEFAULT, UAV - 해시 셀 엔트리 [TABLE_SIZE * MAX_PER_CELL]
+    GPUParticle*           m_pMappedInit = nullptr;      // 업로드 버퍼 - Spawn시 초기 상태
+    BYTE*                  m_pMappedSPHCB = nullptr;     // 업로드 버퍼 - SPH 상수 버퍼 (서브스텝 수만큼)
+    GPUControlPoint*       m_pMappedCPBuffer = nullptr;  // 업로드 버퍼 - Control Points
+    static constexpr int   MAX_GPU_CPS = FluidSimStatePool::kMaxControlPoints;
+
+    // 공간 해싱 GPU 버퍼 — 테이블 크기는 등급별 (m_pSimState->desc.nHashTableSize)
+    static constexpr int   GPU_MAX_PER_CELL    = FluidSimStatePool::kHashMaxPerCell;  // 셀당 최대 파티클 수
+    ComPtr<ID3D12Resource> m_pHashBuffer;        // DEFAULT, UAV - [셀 카운트 x T][셀 엔트리 x T x MAX_PER_CELL]
 
     bool m_bGPUInited   = false;
     bool m_bNeedsUpload = false;
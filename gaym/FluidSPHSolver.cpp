@@ -0,0 +1,437 @@
+#include "FluidSPHSolver.h"
+#include "WorkerPool.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+
+static constexpr float SPH_PI = 3.14159265358979323846f;
+
+// 워커마다 이웃 목록 버퍼를 하나씩 (커질 때만 재할당)
+static thread_local std::vector<int>   t_NeighborJ;
+static thread_local std::vector<float> t_NeighborR2;
+
+static inline int SPHHashCell(int cx, int cy, int cz, int tableSize)
+{
+    unsigned int h = (unsigned int)(cx * 73856093) ^ (unsigned int)(cy * 19349663) ^ (unsigned int)(cz * 83492791);
+    return (int)(h & (tableSize - 1));
+}
+
+FluidSPHSolver::FluidSPHSolver()
+{
+    m_CellStart.assign(HASH_TABLE_SIZE + 1, 0);
+}
+
+void FluidSPHSolver::Resize(int count)
+{
+    m_Count = (std::max)(count, 0);
+
+    for (auto* v : { &m_PosX, &m_PosY, &m_PosZ, &m_VelX, &m_VelY, &m_VelZ,
+                     &m_Density, &m_NearDensity, &m_ForceX, &m_ForceY, &m_ForceZ,
+                     &m_SX, &m_SY, &m_SZ, &m_SVX, &m_SVY, &m_SVZ, &m_SMass,
+                     &m_SDensity, &m_SNearDensity, &m_SFX, &m_SFY, &m_SFZ })
+        v->resize(m_Count, 0.f);
+    m_Mass.resize(m_Count, 1.f);
+
+    for (auto* v : { &m_ParticleBucket, &m_SortedToParticle, &m_CellX, &m_CellY, &m_CellZ })
+        v->resize(m_Count, 0);
+}
+
+// ============================================================================
+// Step
+// ============================================================================
+void FluidSPHSolver::Step(const FluidSPHParams& params, float dt, bool parallel)
+{
+    if (m_Count == 0) return;
+
+    m_InvH = 1.0f / params.smoothingRadius;
+
+    WorkerPool& pool = m_pWorkerPool ? *m_pWorkerPool : WorkerPool::Get();
+    auto run = [&](const WorkerPool::RangeFunc& func)
+    {
+        if (parallel)
+            pool.ParallelFor(m_Count, PARALLEL_GRAIN, func);
+        else
+            func(0, m_Count);
+    };
+
+    run([this](int b, int e) { ComputeBuckets(b, e); });
+    SortBuckets();
+    run([this](int b, int e) { GatherSorted(b, e); });
+
+    const float h = params.smoothingRadius;
+    run([this, h](int b, int e) { ComputeDensity(b, e, h); });
+    run([this, &params](int b, int e) { ComputeForces(b, e, params); });
+    run([this, &params, dt](int b, int e) { Integrate(b, e, params, dt); });
+}
+
+// ============================================================================
+// Spatial Hash (counting sort)
+// ============================================================================
+void FluidSPHSolver::ComputeBuckets(int begin, int end)
+{
+    for (int p = begin; p < end; ++p)
+    {
+        int cx = (int)floorf(m_PosX[p] * m_InvH);
+        int cy = (int)floorf(m_PosY[p] * m_InvH);
+        int cz = (int)floorf(m_PosZ[p] * m_InvH);
+        m_ParticleBucket[p] = SPHHashCell(cx, cy, cz, HASH_TABLE_SIZE);
+    }
+}
+
+void FluidSPHSolver::SortBuckets()
+{
+    std::fill(m_CellStart.begin(), m_CellStart.end(), 0);
+
+    for (int p = 0; p < m_Count; ++p)
+        ++m_CellStart[m_ParticleBucket[p]];
+
+    // exclusive prefix sum → 버킷 시작 위치
+    int sum = 0;
+    for (int b = 0; b < HASH_TABLE_SIZE; ++b)
+    {
+        int c = m_CellStart[b];
+        m_CellStart[b] = sum;
+        sum += c;
+    }
+
+    // 원래 순서대로 배치 (안정 정렬 → 버킷 안의 순서가 항상 같다)
+    // 배치가 끝나면 m_CellStart[b]는 b의 끝(= b+1의 시작)을 가리키므로 한 칸씩 밀어준다
+    for (int p = 0; p < m_Count; ++p)
+        m_SortedToParticle[m_CellStart[m_ParticleBucket[p]]++] = p;
+
+    for (int b = HASH_TABLE_SIZE; b > 0; --b)
+        m_CellStart[b] = m_CellStart[b - 1];
+    m_CellStart[0] = 0;
+}
+
+void FluidSPHSolver::GatherSorted(int begin, int end)
+{
+    for (int i = begin; i < end; ++i)
+    {
+        const int p = m_SortedToParticle[i];
+        m_SX[i]    = m_PosX[p];
+        m_SY[i]    = m_PosY[p];
+        m_SZ[i]    = m_PosZ[p];
+        m_SVX[i]   = m_VelX[p];
+        m_SVY[i]   = m_VelY[p];
+        m_SVZ[i]   = m_VelZ[p];
+        m_SMass[i] = m_Mass[p];
+        m_CellX[i] = (int)floorf(m_SX[i] * m_InvH);
+        m_CellY[i] = (int)floorf(m_SY[i] * m_InvH);
+        m_CellZ[i] = (int)floorf(m_SZ[i] * m_InvH);
+    }
+}
+
+int FluidSPHSolver::CollectNeighbors(int i, float h2, std::vector<int>& outJ, std::vector<float>& outR2) const
+{
+    int buckets[27];
+    int bucketCount = 0;
+    int candidates  = 0;
+    uint64_t seen   = 0;   // 버킷 하위 6비트 필터 (겹칠 때만 목록을 다시 확인)
+
+    for (int dx = -1; dx <= 1; ++dx)
+    {
+        for (int dy = -1; dy <= 1; ++dy)
+        {
+            for (int dz = -1; dz <= 1; ++dz)
+            {
+                int b = SPHHashCell(m_CellX[i] + dx, m_CellY[i] + dy, m_CellZ[i] + dz, HASH_TABLE_SIZE);
+
+                // 이웃 셀 둘이 같은 버킷으로 해시되면 한 번만 훑는다 (이중 합산 방지)
+                if (m_CellStart[b] == m_CellStart[b + 1])
+                    continue;
+
+                const uint64_t bit = 1ull << (b & 63);
+                if (seen & bit)
+                {
+                    bool dup = false;
+                    for (int k = 0; k < bucketCount; ++k)
+                        dup |= (buckets[k] == b);
+                    if (dup)
+                        continue;
+                }
+                seen |= bit;
+
+                buckets[bucketCount++] = b;
+                candidates += m_CellStart[b + 1] - m_CellStart[b];
+            }
+        }
+    }
+
+    if ((int)outJ.size() < candidates)
+    {
+        outJ.resize(candidates);
+        outR2.resize(candidates);
+    }
+
+    const float xi = m_SX[i], yi = m_SY[i], zi = m_SZ[i];
+    const float* sx = m_SX.data();
+    const float* sy = m_SY.data();
+    const float* sz = m_SZ.data();
+    int*   nj  = outJ.data();
+    float* nr2 = outR2.data();
+
+    int count = 0;
+    for (int k = 0; k < bucketCount; ++k)
+    {
+        const int jEnd = m_CellStart[buckets[k] + 1];
+        for (int j = m_CellStart[buckets[k]]; j < jEnd; ++j)
+        {
+            // 항상 쓰고, 조건을 만족할 때만 커서를 전진 (분기 없는 압축)
+            const float rx = xi - sx[j];
+            const float ry = yi - sy[j];
+            const float rz = zi - sz[j];
+            const float r2 = rx * rx + ry * ry + rz * rz;
+            nj[count]  = j;
+            nr2[count] = r2;
+            count += (r2 < h2) & (j != i);
+        }
+    }
+    return count;
+}
+
+// ============================================================================
+// SPH Density — Clavet 2005 이중 밀도 완화 (GPU와 동일한 SpikyPow2 + SpikyPow3)
+// ============================================================================
+void FluidSPHSolver::ComputeDensity(int begin, int end, float h)
+{
+    const float h2 = h * h;
+    const float h5 = h2 * h2 * h;
+    const float h6 = h5 * h;
+    const float kPow2 = 15.0f / (2.0f * SPH_PI * h5);   // SpikyPow2 정규화
+    const float kPow3 = 15.0f / (SPH_PI * h6);           // SpikyPow3 정규화
+
+    std::vector<int>&   nj  = t_NeighborJ;
+    std::vector<float>& nr2 = t_NeighborR2;
+
+    for (int i = begin; i < end; ++i)
+    {
+        const int count = CollectNeighbors(i, h2, nj, nr2);
+        const float* r2 = nr2.data();
+
+        float sum2 = 0.0f;   // Σ (h-r)^2
+        float sum3 = 0.0f;   // Σ (h-r)^3
+        for (int k = 0; k < count; ++k)
+        {
+            const float v = h - sqrtf(r2[k]);
+            sum2 += v * v;
+            sum3 += v * v * v;
+        }
+
+        // 자기 기여: r=0 → SpikyPow2(0,h) = h² * kPow2 (GPU와 동일)
+        const float density     = h2 * kPow2 + sum2 * kPow2;
+        const float nearDensity = sum3 * kPow3;
+
+        m_SDensity[i]     = (std::max)(density, 0.001f);
+        m_SNearDensity[i] = (std::max)(nearDensity, 0.0f);
+    }
+}
+
+// ============================================================================
+// SPH Forces — Clavet 2005 이중 밀도 완화 (GPU와 동일한 압력 공식)
+// ============================================================================
+void FluidSPHSolver::ComputeForces(int begin, int end, const FluidSPHParams& params)
+{
+    const float h  = params.smoothingRadius;
+    const float h2 = h * h;
+    const float h5 = h2 * h2 * h;
+    const float h6 = h5 * h;
+    // DerivSpikyPow2: -2*K2*(h-r),  DerivSpikyPow3: -3*K3*(h-r)^2
+    const float kPow2Grad = 30.0f / (2.0f * SPH_PI * h5);
+    const float kPow3Grad = 45.0f / (SPH_PI * h6);
+    const float kViscLap  = 45.0f / (SPH_PI * h6);
+
+    const float stiffness = params.stiffness;
+    const float restDensity = params.restDensity;
+    const float nearMult  = params.nearPressureMultiplier;
+    const float viscosity = params.viscosity;
+
+    const float* sx  = m_SX.data();
+    const float* sy  = m_SY.data();
+    const float* sz  = m_SZ.data();
+    const float* svx = m_SVX.data();
+    const float* svy = m_SVY.data();
+    const float* svz = m_SVZ.data();
+    const float* sm  = m_SMass.data();
+    const float* sd  = m_SDensity.data();
+    const float* snd = m_SNearDensity.data();
+
+    std::vector<int>&   nj  = t_NeighborJ;
+    std::vector<float>& nr2 = t_NeighborR2;
+
+    for (int i = begin; i < end; ++i)
+    {
+        const float xi = sx[i], yi = sy[i], zi = sz[i];
+        const float vxi = svx[i], vyi = svy[i], vzi = svz[i];
+        const float pressI     = stiffness * (sd[i] - restDensity);
+        const float nearPressI = nearMult * snd[i];
+
+        float fx = 0.0f, fy = 0.0f, fz = 0.0f;
+
+        const int count = CollectNeighbors(i, h2, nj, nr2);
+        const int*   js = nj.data();
+        const float* r2 = nr2.data();
+        for (int k = 0; k < count; ++k)
+        {
+            const int j = js[k];
+
+            // 방향: j → i (GPU와 동일: diff = pos_i - pos_j)
+            const float rx   = xi - sx[j];
+            const float ry   = yi - sy[j];
+            const float rz   = zi - sz[j];
+            const float rLen = sqrtf(r2[k]);
+
+            // 겹친 입자(r≈0)는 방향이 없으므로 0으로 마스킹
+            const float mask   = (rLen >= 0.0001f) ? 1.0f : 0.0f;
+            const float invLen = 1.0f / (std::max)(rLen, 0.0001f);
+
+            const float densityJ     = (std::max)(sd[j], 0.001f);
+            const float nearDensityJ = (std::max)(snd[j], 0.001f);
+            const float pressJ       = stiffness * (densityJ - restDensity);
+            const float nearPressJ   = nearMult * nearDensityJ;
+
+            const float sharedPress     = (pressI + pressJ) * 0.5f;
+            const float sharedNearPress = (nearPressI + nearPressJ) * 0.5f;
+
+            // 압력 구배 커널 도함수 (음수값)
+            const float v          = h - rLen;
+            const float dPress     = -v * kPow2Grad;
+            const float dNearPress = -v * v * kPow3Grad;
+
+            // f -= dir * (dW*P/rho + dWnear*Pnear/rho_near) * mass_j
+            const float pForce = (dPress * sharedPress / densityJ
+                                + dNearPress * sharedNearPress / nearDensityJ)
+                                * sm[j] * invLen * mask;
+
+            // 점성
+            const float vScale = viscosity * sm[j] / densityJ * (kViscLap * v) * mask;
+
+            fx += -rx * pForce + (svx[j] - vxi) * vScale;
+            fy += -ry * pForce + (svy[j] - vyi) * vScale;
+            fz += -rz * pForce + (svz[j] - vzi) * vScale;
+        }
+
+        const float massI = sm[i];
+
+        // Gravity 모드: CP 인력 대신 중력 적용
+        if (params.useGravity)
+        {
+            fx += params.gravity.x * massI;
+            fy += params.gravity.y * massI;
+            fz += params.gravity.z * massI;
+        }
+        else
+        {
+            // ControlPoint / OrbitalCP 모드: CP 인력 + swirl
+            for (const auto& cp : params.controlPoints)
+            {
+                float dx = cp.position.x - xi;
+                float dy = cp.position.y - yi;
+                float dz = cp.position.z - zi;
+                float dist = sqrtf(dx * dx + dy * dy + dz * dz);
+
+                if (dist < 0.001f) continue;
+
+                float invDist = 1.0f / dist;
+                float ndx = dx * invDist;
+                float ndy = dy * invDist;
+                float ndz = dz * invDist;
+
+                // Soft attraction (attenuated by distance)
+                float attraction = cp.attractionStrength / (1.0f + dist * 0.5f);
+                fx += ndx * attraction;
+                fy += ndy * attraction;
+                fz += ndz * attraction;
+
+                // Gentle swirl: tangent = cross((0,1,0), toward_cp) = (ndz, 0, -ndx)
+                float swirlStrength = cp.attractionStrength * 0.35f;
+                fx += ndz * swirlStrength;
+                fz += -ndx * swirlStrength;
+
+                // Boundary: strong inward force if outside sphere radius
+                if (dist > cp.sphereRadius)
+                {
+                    float boundaryForce = params.boundaryStiffness * (dist - cp.sphereRadius);
+                    fx += ndx * boundaryForce;
+                    fy += ndy * boundaryForce;
+                    fz += ndz * boundaryForce;
+                }
+            }
+        }
+
+        // 전역 중력 (모든 모드에서 선택적 적용)
+        if (params.globalGravity > 0.f)
+            fy -= params.globalGravity * massI;
+
+        // ConfinementBox 경계력 (모든 모드에서 선택적 적용)
+        if (params.boxActive)
+        {
+            const float tx = xi - params.boxCenter.x;
+            const float ty = yi - params.boxCenter.y;
+            const float tz = zi - params.boxCenter.z;
+            const float bStiff = params.boundaryStiffness;
+
+            auto applyAxisForce = [&](const FluidSPHVec3& axis, float halfExt)
+            {
+                float local = tx * axis.x + ty * axis.y + tz * axis.z;
+                float push = 0.f;
+                if (local > halfExt)       push = -(local - halfExt);
+                else if (local < -halfExt) push = (-halfExt - local);
+                fx += axis.x * bStiff * push;
+                fy += axis.y * bStiff * push;
+                fz += axis.z * bStiff * push;
+            };
+
+            applyAxisForce(params.boxAxisX, params.boxHalfExtents.x);
+            applyAxisForce(params.boxAxisY, params.boxHalfExtents.y);
+            applyAxisForce(params.boxAxisZ, params.boxHalfExtents.z);
+        }
+
+        m_SFX[i] = fx;
+        m_SFY[i] = fy;
+        m_SFZ[i] = fz;
+    }
+}
+
+// ============================================================================
+// Integration (정렬 순서로 계산해서 원래 순서로 돌려놓는다)
+// ============================================================================
+void FluidSPHSolver::Integrate(int begin, int end, const FluidSPHParams& params, float dt)
+{
+    const float damping  = params.damping;
+    const float maxSpeed = params.maxSpeed;
+
+    for (int i = begin; i < end; ++i)
+    {
+        // acceleration = force / density
+        const float invDensity = 1.0f / m_SDensity[i];
+
+        float vx = (m_SVX[i] + m_SFX[i] * invDensity * dt) * damping;
+        float vy = (m_SVY[i] + m_SFY[i] * invDensity * dt) * damping;
+        float vz = (m_SVZ[i] + m_SFZ[i] * invDensity * dt) * damping;
+
+        // Speed clamping
+        const float speed2 = vx * vx + vy * vy + vz * vz;
+        if (speed2 > maxSpeed * maxSpeed)
+        {
+            const float scale = maxSpeed / sqrtf(speed2);
+            vx *= scale;
+            vy *= scale;
+            vz *= scale;
+        }
+
+        const int p = m_SortedToParticle[i];
+        m_VelX[p] = vx;
+        m_VelY[p] = vy;
+        m_VelZ[p] = vz;
+        m_PosX[p] = m_SX[i] + vx * dt;
+        m_PosY[p] = m_SY[i] + vy * dt;
+        m_PosZ[p] = m_SZ[i] + vz * dt;
+
+        m_Density[p]     = m_SDensity[i];
+        m_NearDensity[p] = m_SNearDensity[i];
+        m_ForceX[p]      = m_SFX[i];
+        m_ForceY[p]      = m_SFY[i];
+        m_ForceZ[p]      = m_SFZ[i];
+    }
+}
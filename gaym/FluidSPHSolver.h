@@ -0,0 +1,130 @@
+#pragma once
+
+#include <vector>
+
+class WorkerPool;
+
+// ============================================================================
+// FluidSPHSolver
+// FluidParticleSystem의 CPU fallback SPH (Clavet 2005 / Sebastian Lague 이중 밀도 완화).
+// D3D/DirectXMath 의존이 없어서 헤드리스로도 돌릴 수 있다.
+//
+//  - 파티클 상태는 SoA (posX[], posY[], ... ) 로 보관
+//  - 공간 해시는 counting sort: 셀별 개수 → prefix sum → 셀 순서로 재배치.
+//    이웃 탐색은 27개 셀의 연속 구간을 그대로 훑으므로 이웃 인덱스 복사가 없다
+//  - 밀도/힘 커널은 정렬된 SoA 구간 위에서 분기 없는 루프로 돌고 (자동 벡터화 대상)
+//    WorkerPool로 파티클 청크를 나눠 병렬 처리한다
+//  - 파티클마다 이웃을 항상 같은 순서로 더하므로 쓰레드 수와 무관하게 결과가 같다
+// ============================================================================
+
+struct FluidSPHVec3
+{
+    float x = 0.f, y = 0.f, z = 0.f;
+};
+
+struct FluidSPHControlPoint
+{
+    FluidSPHVec3 position;
+    float        attractionStrength = 20.0f;
+    float        sphereRadius       = 3.0f;
+};
+
+// 한 스텝에 필요한 설정값 (FluidParticleConfig + 운동 모드에서 채운다)
+struct FluidSPHParams
+{
+    float smoothingRadius        = 1.5f;
+    float restDensity            = 7.0f;
+    float stiffness              = 60.0f;
+    float nearPressureMultiplier = 2.0f;
+    float viscosity              = 0.30f;
+    float boundaryStiffness      = 200.0f;
+    float damping                = 0.995f;
+    float maxSpeed               = 12.0f;
+
+    // true면 CP 인력 대신 gravity 적용 (ParticleMotionMode::Gravity)
+    bool         useGravity = false;
+    FluidSPHVec3 gravity    = { 0.f, -9.8f, 0.f };
+
+    std::vector<FluidSPHControlPoint> controlPoints;
+
+    float globalGravity = 0.f;
+
+    // ConfinementBox (OBB)
+    bool         boxActive = false;
+    FluidSPHVec3 boxCenter;
+    FluidSPHVec3 boxHalfExtents = { 1.f, 1.f, 1.f };
+    FluidSPHVec3 boxAxisX = { 1.f, 0.f, 0.f };
+    FluidSPHVec3 boxAxisY = { 0.f, 1.f, 0.f };
+    FluidSPHVec3 boxAxisZ = { 0.f, 0.f, 1.f };
+};
+
+class FluidSPHSolver
+{
+public:
+    FluidSPHSolver();
+
+    // 파티클 수 변경 (기존 값은 유지, 늘어난 칸은 0 / mass 1)
+    void Resize(int count);
+    int  GetCount() const { return m_Count; }
+
+    // SoA 상태 (원래 파티클 순서)
+    float* PosX() { return m_PosX.data(); }
+    float* PosY() { return m_PosY.data(); }
+    float* PosZ() { return m_PosZ.data(); }
+    float* VelX() { return m_VelX.data(); }
+    float* VelY() { return m_VelY.data(); }
+    float* VelZ() { return m_VelZ.data(); }
+    float* Mass() { return m_Mass.data(); }
+    const float* Density()     const { return m_Density.data(); }
+    const float* NearDensity() const { return m_NearDensity.data(); }
+    const float* ForceX()      const { return m_ForceX.data(); }
+    const float* ForceY()      const { return m_ForceY.data(); }
+    const float* ForceZ()      const { return m_ForceZ.data(); }
+
+    // 해시 → 밀도 → 힘 → 적분 한 스텝. parallel=false면 호출 쓰레드에서만 실행
+    void Step(const FluidSPHParams& params, float dt, bool parallel = true);
+
+    // 병렬 스텝이 쓸 풀 (nullptr이면 WorkerPool::Get())
+    void SetWorkerPool(WorkerPool* pPool) { m_pWorkerPool = pPool; }
+
+private:
+    // 공간 해시 (counting sort): 버킷 계산(병렬) → 개수/prefix sum/배치(직렬, 안정) → 정렬 SoA 복사(병렬)
+    void ComputeBuckets(int begin, int end);
+    void SortBuckets();
+    void GatherSorted(int begin, int end);
+
+    void ComputeDensity(int begin, int end, float h);
+    void ComputeForces(int begin, int end, const FluidSPHParams& params);
+    void Integrate(int begin, int end, const FluidSPHParams& params, float dt);
+
+    // 정렬 순서 i 입자의 반경 h 안 이웃(자기 제외)을 outJ/outR2에 모은다, 반환값 = 개수.
+    // 27셀 버킷 구간을 분기 없이 훑어 압축하므로 개수 제한이 없다
+    int  CollectNeighbors(int i, float h2, std::vector<int>& outJ, std::vector<float>& outR2) const;
+
+    static constexpr int HASH_TABLE_SIZE = 8192;   // power-of-2 (GPU 경로와 같은 해시)
+    static constexpr int PARALLEL_GRAIN  = 256;    // ParallelFor 청크 크기
+
+    int                m_Count = 0;
+    float              m_InvH  = 1.f;
+    WorkerPool*        m_pWorkerPool = nullptr;
+
+    // 원래 순서의 SoA 상태
+    std::vector<float> m_PosX, m_PosY, m_PosZ;
+    std::vector<float> m_VelX, m_VelY, m_VelZ;
+    std::vector<float> m_Mass;
+    std::vector<float> m_Density, m_NearDensity;
+    std::vector<float> m_ForceX, m_ForceY, m_ForceZ;
+
+    // counting sort 결과
+    std::vector<int>   m_CellStart;      // [HASH_TABLE_SIZE + 1] 버킷별 시작 위치 (정렬 순서)
+    std::vector<int>   m_ParticleBucket; // 원래 순서 → 버킷
+    std::vector<int>   m_SortedToParticle;
+    std::vector<int>   m_CellX, m_CellY, m_CellZ; // 정렬 순서 → 셀 좌표
+
+    // 정렬 순서의 SoA 사본 (커널 입력/출력)
+    std::vector<float> m_SX, m_SY, m_SZ;
+    std::vector<float> m_SVX, m_SVY, m_SVZ;
+    std::vector<float> m_SMass;
+    std::vector<float> m_SDensity, m_SNearDensity;
+    std::vector<float> m_SFX, m_SFY, m_SFZ;
+};
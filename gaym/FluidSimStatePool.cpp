@@ -0,0 +1,186 @@
+#include "FluidSimStatePool.h"
+#include <algorithm>
+#include <cstdio>
+
+namespace
+{
+    inline uint64_t AlignUp(uint64_t n, uint64_t a) { return (n + a - 1) & ~(a - 1); }
+
+    inline int NextPow2(int n)
+    {
+        int p = 1;
+        while (p < n) p <<= 1;
+        return p;
+    }
+}
+
+FluidSimStatePool& FluidSimStatePool::Get()
+{
+    static FluidSimStatePool s_Pool;
+    return s_Pool;
+}
+
+FluidSimStatePool::~FluidSimStatePool()
+{
+    Clear();
+}
+
+void FluidSimStatePool::SetBackend(std::unique_ptr<FluidSimStateBackend> pBackend)
+{
+    Clear();
+    m_pBackend = std::move(pBackend);
+}
+
+int FluidSimStatePool::TierIndex(int nCapacity)
+{
+    for (int i = 0; i < kTierCount; ++i)
+        if (nCapacity <= kTierCapacities[i])
+            return i;
+    return kTierCount - 1;
+}
+
+FluidSimStateDesc FluidSimStatePool::MakeDesc(int nParticles)
+{
+    FluidSimStateDesc desc;
+    desc.nCapacity      = kTierCapacities[TierIndex((std::max)(nParticles, 1))];
+    desc.nHashTableSize = (std::min)((std::max)(NextPow2(desc.nCapacity * 4), 1024), 8192);
+
+    const uint64_t nCap  = (uint64_t)desc.nCapacity;
+    const uint64_t nHash = (uint64_t)desc.nHashTableSize;
+
+    desc.nStateBytes      = nCap * kParticleStateStride;
+    desc.nRenderBytes     = nCap * kRenderDataStride;
+    desc.nHashEntryOffset = AlignUp(nHash * sizeof(uint32_t), 256);
+    desc.nHashBytes       = desc.nHashEntryOffset + nHash * kHashMaxPerCell * sizeof(uint32_t);
+
+    // CB 는 256 바이트 정렬이 필요해서 앞쪽에 모은다
+    uint64_t nOffset = 0;
+    desc.nPassCBOffset      = nOffset; nOffset += kPassCBBytes;
+    desc.nDepthPassCBOffset = nOffset; nOffset += kDepthPassCBBytes;
+    desc.nSPHCBOffset       = nOffset; nOffset += (uint64_t)kSPHCBStride * kSPHSubsteps;
+    desc.nCPOffset          = nOffset; nOffset += AlignUp((uint64_t)kControlPointStride * kMaxControlPoints, 256);
+    desc.nRenderDataOffset  = nOffset; nOffset += AlignUp(nCap * kRenderDataStride, 256);
+    desc.nInitOffset        = nOffset; nOffset += nCap * kParticleStateStride;
+    desc.nUploadBytes       = nOffset;
+    return desc;
+}
+
+FluidSimState* FluidSimStatePool::Acquire(int nParticles)
+{
+    if (!m_pBackend)
+        return nullptr;
+
+    m_Stats.acquires++;
+
+    FluidSimStateDesc desc = MakeDesc(nParticles);
+    std::vector<FluidSimState*>& vFree = m_vFree[TierIndex(desc.nCapacity)];
+
+    FluidSimState* pState = nullptr;
+    if (!vFree.empty())
+    {
+        pState = vFree.back();
+        vFree.pop_back();
+        m_Stats.reuses++;
+        m_Stats.idleStates--;
+        m_Stats.idleBytes -= pState->gpuBytes;
+    }
+    else
+    {
+        auto pNew = std::make_unique<FluidSimState>();
+        pNew->desc = desc;
+        if (!m_pBackend->Create(desc, *pNew))
+        {
+            m_Stats.failures++;
+            return nullptr;
+        }
+        pState = pNew.release();
+        m_Stats.creates++;
+    }
+
+    m_Stats.liveStates++;
+    m_Stats.liveBytes += pState->gpuBytes;
+    m_Stats.peakBytes = (std::max)(m_Stats.peakBytes, m_Stats.liveBytes + m_Stats.idleBytes);
+    return pState;
+}
+
+void FluidSimStatePool::Release(FluidSimState* pState)
+{
+    if (!pState)
+        return;
+
+    m_Stats.liveStates--;
+    m_Stats.liveBytes -= pState->gpuBytes;
+    m_Stats.idleStates++;
+    m_Stats.idleBytes += pState->gpuBytes;
+    m_vFree[TierIndex(pState->desc.nCapacity)].push_back(pState);
+}
+
+void FluidSimStatePool::Trim()
+{
+    for (int i = kTierCount - 1; i >= 0 && m_Stats.idleBytes > m_nIdleBudget; --i)
+    {
+        std::vector<FluidSimState*>& vFree = m_vFree[i];
+        while (!vFree.empty() && m_Stats.idleBytes > m_nIdleBudget)
+        {
+            Destroy(vFree.back());
+            vFree.pop_back();
+            m_Stats.trims++;
+        }
+    }
+}
+
+void FluidSimStatePool::Clear()
+{
+    for (auto& vFree : m_vFree)
+    {
+        for (FluidSimState* pState : vFree)
+            Destroy(pState);
+        vFree.clear();
+    }
+}
+
+void FluidSimStatePool::Destroy(FluidSimState* pState)
+{
+    m_Stats.idleStates--;
+    m_Stats.idleBytes -= pState->gpuBytes;
+    if (m_pBackend)
+        m_pBackend->Release(*pState);
+    delete pState;
+}
+
+std::string FluidSimStatePool::BuildReport() const
+{
+    char line[384];
+    snprintf(line, sizeof(line),
+        "fluid sim states: %u live (%.2f MB)  %u idle (%.2f MB)  peak: %.2f MB\n"
+        "acquires: %llu  reuses: %llu  creates: %llu  failures: %llu  trims: %llu\n",
+        m_Stats.liveStates, m_Stats.liveBytes / (1024.0 * 1024.0),
+        m_Stats.idleStates, m_Stats.idleBytes / (1024.0 * 1024.0),
+        m_Stats.peakBytes / (1024.0 * 1024.0),
+        (unsigned long long)m_Stats.acquires, (unsigned long long)m_Stats.reuses,
+        (unsigned long long)m_Stats.creates, (unsigned long long)m_Stats.failures,
+        (unsigned long long)m_Stats.trims);
+    return line;
+}
+
+// =============================================================================
+// NullFluidSimStateBackend
+// =============================================================================
+
+bool NullFluidSimStateBackend::Create(const FluidSimStateDesc& desc, FluidSimState& state)
+{
+    const uint64_t kPlacement = 64 * 1024;
+
+    state.pMappedUpload = new uint8_t[desc.nUploadBytes]();
+    state.pUploadBuffer = state.pMappedUpload;
+    state.gpuBytes = AlignUp(desc.nStateBytes, kPlacement) + AlignUp(desc.nRenderBytes, kPlacement)
+                   + AlignUp(desc.nHashBytes, kPlacement) + AlignUp(desc.nUploadBytes, kPlacement);
+    return true;
+}
+
+void NullFluidSimStateBackend::Release(FluidSimState& state)
+{
+    delete[] state.pMappedUpload;
+    state.pMappedUpload = nullptr;
+    state.pUploadBuffer = nullptr;
+}
@@ -0,0 +1,142 @@
+#pragma once
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+// ============================================================================
+// FluidSimStatePool
+// FluidParticleSystem 의 GPU 시뮬레이션 상태(파티클 상태/렌더/해시 버퍼 + 업로드/CB)를 모아 둔 풀.
+// 슬롯마다 최대 크기(6144 파티클, 해시 8192 셀) 버퍼를 들고 있던 것을, 이펙트가 시작될 때
+// 파티클 수에 맞는 등급(tier)으로 빌리고 끝나면 돌려주도록 바꾼다. 쉬는 슬롯은 GPU 메모리 0.
+//
+//  - 등급은 파티클 수를 올림한 용량 (256, 512, ... 6144). 해시 테이블은 용량의 4배를
+//    2의 거듭제곱으로 올림 (1024 ~ 8192) — 점유 셀 ≤ 파티클 수이므로 부하율 0.25 이하
+//  - 돌려받은 상태는 같은 등급 free list 에 넣고 다음 Acquire 가 재사용한다
+//  - 쉬는 상태가 예산을 넘으면 Trim 에서 큰 등급부터 해제한다
+//
+// 실제 리소스 생성은 FluidSimStateBackend 가 한다 — D3D12FluidSimStateBackend 또는
+// NullFluidSimStateBackend (디바이스 없이 메모리/버스트 측정용).
+// Acquire/Release 는 Update 중에만 (렌더 기록 중엔 부르지 않는다), Trim 은 GPU 가 멈춘 지점에서만.
+// 메인 스레드 전용.
+// ============================================================================
+
+// 등급별 버퍼 크기와 업로드 버퍼 안의 배치 (바이트)
+struct FluidSimStateDesc
+{
+    int      nCapacity = 0;          // 파티클 수 상한
+    int      nHashTableSize = 0;     // power-of-2
+
+    uint64_t nStateBytes = 0;        // DEFAULT UAV: GPUParticle x nCapacity
+    uint64_t nRenderBytes = 0;       // DEFAULT UAV: FluidParticleRenderData x nCapacity
+    uint64_t nHashBytes = 0;         // DEFAULT UAV: [count x T][entries x T x kHashMaxPerCell]
+    uint64_t nHashEntryOffset = 0;
+
+    uint64_t nUploadBytes = 0;       // UPLOAD (항상 매핑): CB 들 + 렌더 데이터 + Spawn 초기 상태
+    uint64_t nPassCBOffset = 0;
+    uint64_t nDepthPassCBOffset = 0;
+    uint64_t nSPHCBOffset = 0;       // 서브스텝 수만큼 연속
+    uint64_t nCPOffset = 0;
+    uint64_t nRenderDataOffset = 0;
+    uint64_t nInitOffset = 0;
+};
+
+// 백엔드가 만든 리소스 한 벌
+struct FluidSimState
+{
+    FluidSimStateDesc desc;
+
+    void*    pStateBuffer = nullptr;     // D3D12: ID3D12Resource* (AddRef 된 상태)
+    void*    pRenderBuffer = nullptr;
+    void*    pHashBuffer = nullptr;
+    void*    pUploadBuffer = nullptr;
+    uint8_t* pMappedUpload = nullptr;
+
+    uint32_t nRenderBufferState = 0;     // D3D12_RESOURCE_STATES — 빌려간 시스템이 추적, 다음 주인에게 넘어감
+    uint64_t gpuBytes = 0;
+};
+
+class FluidSimStateBackend
+{
+public:
+    virtual ~FluidSimStateBackend() = default;
+
+    virtual bool Create(const FluidSimStateDesc& desc, FluidSimState& state) = 0;
+    virtual void Release(FluidSimState& state) = 0;
+};
+
+// 디바이스 없는 백엔드. 업로드 영역만 실제로 할당하고 GPU 버퍼는 크기만 기록
+// (커밋 리소스처럼 버퍼마다 64KB 로 올림)
+class NullFluidSimStateBackend : public FluidSimStateBackend
+{
+public:
+    bool Create(const FluidSimStateDesc& desc, FluidSimState& state) override;
+    void Release(FluidSimState& state) override;
+};
+
+struct FluidSimStatePoolStats
+{
+    uint64_t acquires = 0;
+    uint64_t reuses = 0;            // free list 에서 꺼냄
+    uint64_t creates = 0;           // 백엔드 생성
+    uint64_t failures = 0;
+    uint64_t trims = 0;             // 예산 초과로 해제
+    uint32_t liveStates = 0;
+    uint32_t idleStates = 0;
+    uint64_t liveBytes = 0;
+    uint64_t idleBytes = 0;
+    uint64_t peakBytes = 0;         // live + idle 최대
+};
+
+class FluidSimStatePool
+{
+public:
+    // GPU 레이아웃 (FluidParticleSystem 의 GPUParticle / FluidParticleRenderData / CB 구조체와 같아야 함)
+    static constexpr int kParticleStateStride = 64;
+    static constexpr int kRenderDataStride    = 32;
+    static constexpr int kPassCBBytes         = 256;
+    static constexpr int kDepthPassCBBytes    = 256;
+    static constexpr int kSPHCBStride         = 512;
+    static constexpr int kSPHSubsteps         = 3;
+    static constexpr int kMaxControlPoints    = 16;
+    static constexpr int kControlPointStride  = 32;
+    static constexpr int kHashMaxPerCell      = 32;
+
+    static constexpr int kTierCount = 6;
+    static constexpr int kTierCapacities[kTierCount] = { 256, 512, 1024, 2048, 4096, 6144 };
+    static constexpr int kMaxCapacity = 6144;
+
+    static FluidSimStatePool& Get();
+
+    void                  SetBackend(std::unique_ptr<FluidSimStateBackend> pBackend);
+    FluidSimStateBackend* GetBackend() const { return m_pBackend.get(); }
+
+    // 쉬는 상태를 남겨 둘 한도 (빌려 간 상태는 한도와 상관없이 유지)
+    void SetIdleBudget(uint64_t bytes) { m_nIdleBudget = bytes; }
+
+    // nParticles 를 담을 등급의 배치 (kMaxCapacity 를 넘으면 잘림)
+    static FluidSimStateDesc MakeDesc(int nParticles);
+
+    // 실패하면 nullptr
+    FluidSimState* Acquire(int nParticles);
+    void           Release(FluidSimState* pState);
+
+    void Trim();        // 쉬는 상태가 예산을 넘으면 큰 등급부터 해제
+    void Clear();       // 쉬는 상태 전부 해제 (종료 시)
+
+    FluidSimStatePoolStats GetStats() const { return m_Stats; }
+    std::string            BuildReport() const;
+
+private:
+    FluidSimStatePool() = default;
+    ~FluidSimStatePool();
+
+    static int TierIndex(int nCapacity);
+    void       Destroy(FluidSimState* pState);
+
+    std::unique_ptr<FluidSimStateBackend> m_pBackend;
+    std::vector<FluidSimState*>           m_vFree[kTierCount];   // 등급별 쉬는 상태
+
+    uint64_t m_nIdleBudget = 48ull * 1024 * 1024;   // 64 슬롯이 한꺼번에 끝나도 다음 버스트가 재사용할 만큼
+    FluidSimStatePoolStats m_Stats;
+};
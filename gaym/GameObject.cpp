@@ -2,12 +2,9 @@
 #include "GameObject.h"
 #include "Component.h"
 #include "TransformComponent.h"
-#include "WICTextureLoader12.h"
-#include "D3dx12.h"
-#include <map>
-
-// GPU 텍스처 캐시 — 맵 전환 시 동일 파일을 재업로드하지 않도록 유지
-static std::map<std::wstring, ComPtr<ID3D12Resource>> s_textureCache;
+#include "D3D12TextureBackend.h"
+#include "BonePalette.h"
+#include <unordered_map>
 
 bool GameObject::s_bDebugNoTexture = false;
 
@@ -23,6 +20,41 @@ GameObject::GameObject()
 GameObject::~GameObject()
 {
     if (m_pd3dcbGameObject) m_pd3dcbGameObject->Unmap(0, NULL);
+    if (m_nBoneCount > 0) BonePalette::Get().Free(m_nBoneOffset, m_nBoneCount);
+}
+
+void GameObject::AllocateBonePalette(UINT nBones)
+{
+    if (m_nBoneCount > 0)
+    {
+        BonePalette::Get().Free(m_nBoneOffset, m_nBoneCount);
+        m_nBoneOffset = UINT_MAX;
+        m_nBoneCount = 0;
+    }
+
+    UINT nOffset = BonePalette::Get().Allocate(nBones);
+    if (nOffset == BonePaletteAllocator::InvalidOffset)
+        return;
+
+    m_nBoneOffset = nOffset;
+    m_nBoneCount = nBones;
+}
+
+void GameObject::SetBoneTransform(int index, const XMFLOAT4X4& matrix)
+{
+    if (index >= 0 && (UINT)index < m_nBoneCount)
+        BonePalette::Get().Write(m_nBoneOffset + index, matrix);
+}
+
+void GameObject::SetSkinned(bool bSkinned)
+{
+    if (!m_pcbMappedGameObject)
+        return;
+
+    // 팔레트 구간이 없으면 스키닝할 행렬도 없다 — 바인드 포즈로 그린다
+    bool bHasPalette = bSkinned && m_nBoneCount > 0;
+    m_pcbMappedGameObject->m_bIsSkinned = bHasPalette ? 1 : 0;
+    m_pcbMappedGameObject->m_nBoneOffset = bHasPalette ? m_nBoneOffset : 0;
 }
 
 void GameObject::Init(ID3D12Device* pDevice, ID3D12GraphicsCommandList* pCommandList)
@@ -131,17 +163,40 @@ void GameObject::CreateConstantBuffer(ID3D12Device* pDevice, ID3D12GraphicsComma
     pDevice->CreateConstantBufferView(&d3dcbvDesc, d3dCbvCPUDescriptorHandle);
 }
 
-void GameObject::LoadTexture(ID3D12Device* pd3dDevice, ID3D12GraphicsCommandList* pd3dCommandList, D3D12_CPU_DESCRIPTOR_HANDLE srvCpuHandle)
+// 캐시 백엔드(D3D12TextureBackend)가 이번 커맨드 리스트에 복사 명령을 기록하도록 지정하고 획득
+static TextureHandle AcquireTexture(ID3D12GraphicsCommandList* pd3dCommandList, const std::string& path)
 {
-    if (m_strTextureName.empty()) return;
+    TextureCache& cache = TextureCache::Get();
+    auto pBackend = static_cast<D3D12TextureBackend*>(cache.GetBackend());
+    if (!pBackend)
+        return {};
 
-    // Convert .tga extension to .png (TGA files have been converted to PNG)
-    std::string textureName = m_strTextureName;
-    size_t tgaPos = textureName.rfind(".tga");
-    if (tgaPos != std::string::npos)
-    {
-        textureName.replace(tgaPos, 4, ".png");
-    }
+    pBackend->SetCommandList(pd3dCommandList);
+    return cache.Acquire(path);
+}
+
+// SRV는 새 디스크립터 슬롯에 항상 새로 생성 (슬롯이 매번 달라지므로)
+static void CreateTextureSrv(ID3D12Device* pd3dDevice, const TextureHandle& texture, D3D12_CPU_DESCRIPTOR_HANDLE srvCpuHandle)
+{
+    ID3D12Resource* pd3dResource = static_cast<ID3D12Resource*>(texture.GetResource());
+    D3D12_RESOURCE_DESC desc = pd3dResource->GetDesc();
+
+    D3D12_SHADER_RESOURCE_VIEW_DESC srvDesc = {};
+    srvDesc.Shader4ComponentMapping = D3D12_DEFAULT_SHADER_4_COMPONENT_MAPPING;
+    srvDesc.Format = desc.Format;
+    srvDesc.ViewDimension = D3D12_SRV_DIMENSION_TEXTURE2D;
+    srvDesc.Texture2D.MipLevels = desc.MipLevels;
+    pd3dDevice->CreateShaderResourceView(pd3dResource, &srvDesc, srvCpuHandle);
+}
+
+// 머티리얼 텍스처 이름 → 실제 경로. 검색 경로 탐색(GetFileAttributesW)은 이름마다 한 번만
+static const std::string& ResolveTexturePath(const std::string& textureName)
+{
+    static std::unordered_map<std::string, std::string> s_resolvedPaths;
+
+    auto it = s_resolvedPaths.find(textureName);
+    if (it != s_resolvedPaths.end())
+        return it->second;
 
     // Try multiple texture paths
     std::vector<std::string> searchPaths = {
@@ -153,20 +208,33 @@ void GameObject::LoadTexture(ID3D12Device* pd3dDevice, ID3D12GraphicsCommandList
         textureName  // Direct path
     };
 
-    std::wstring wstrTextureName;
-    bool found = false;
+    std::string resolved;
     for (const auto& path : searchPaths)
     {
         std::wstring wpath(path.begin(), path.end());
         if (GetFileAttributesW(wpath.c_str()) != INVALID_FILE_ATTRIBUTES)
         {
-            wstrTextureName = wpath;
-            found = true;
+            resolved = path;
             break;
         }
     }
+    return s_resolvedPaths.emplace(textureName, std::move(resolved)).first->second;
+}
 
-    if (!found)
+void GameObject::LoadTexture(ID3D12Device* pd3dDevice, ID3D12GraphicsCommandList* pd3dCommandList, D3D12_CPU_DESCRIPTOR_HANDLE srvCpuHandle)
+{
+    if (m_strTextureName.empty()) return;
+
+    // Convert .tga extension to .png (TGA files have been converted to PNG)
+    std::string textureName = m_strTextureName;
+    size_t tgaPos = textureName.rfind(".tga");
+    if (tgaPos != std::string::npos)
+    {
+        textureName.replace(tgaPos, 4, ".png");
+    }
+
+    const std::string& path = ResolveTexturePath(textureName);
+    if (path.empty())
     {
         char buffer[256];
         sprintf_s(buffer, "Texture not found in any search path: %s\n", textureName.c_str());
@@ -174,275 +242,98 @@ void GameObject::LoadTexture(ID3D12Device* pd3dDevice, ID3D12GraphicsCommandList
         return;
     }
 
-    // 캐시에 이미 있으면 디스크 I/O + GPU 업로드 없이 재사용
-    auto cacheIt = s_textureCache.find(wstrTextureName);
-    if (cacheIt != s_textureCache.end())
-    {
-        m_pd3dTexture = cacheIt->second;
-    }
-    else
+    // 같은 파일은 캐시에서 공유 — 디스크 I/O + GPU 업로드 없이 재사용
+    m_pTexture = AcquireTexture(pd3dCommandList, path);
+    if (!m_pTexture)
     {
-        std::unique_ptr<uint8_t[]> decodedData;
-        D3D12_SUBRESOURCE_DATA subresource;
-
-        HRESULT hr = DirectX::LoadWICTextureFromFile(pd3dDevice, wstrTextureName.c_str(), m_pd3dTexture.GetAddressOf(), decodedData, subresource);
-        if (FAILED(hr))
-        {
-            char buffer[512];
-            sprintf_s(buffer, "Failed to load texture: %ls\n", wstrTextureName.c_str());
-            OutputDebugStringA(buffer);
-            return;
-        }
-
-        UINT64 nBytes = GetRequiredIntermediateSize(m_pd3dTexture.Get(), 0, 1);
-        m_pd3dTextureUploadBuffer = CreateBufferResource(pd3dDevice, pd3dCommandList, NULL, nBytes, D3D12_HEAP_TYPE_UPLOAD, D3D12_RESOURCE_STATE_GENERIC_READ, NULL);
-        UpdateSubresources(pd3dCommandList, m_pd3dTexture.Get(), m_pd3dTextureUploadBuffer.Get(), 0, 0, 1, &subresource);
-
-        D3D12_RESOURCE_BARRIER barrier = CD3DX12_RESOURCE_BARRIER::Transition(m_pd3dTexture.Get(), D3D12_RESOURCE_STATE_COPY_DEST, D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE);
-        pd3dCommandList->ResourceBarrier(1, &barrier);
-
-        // 캐시에 등록 (이후 전환에서 재사용)
-        s_textureCache[wstrTextureName] = m_pd3dTexture;
+        char buffer[512];
+        sprintf_s(buffer, "Failed to load texture: %s\n", path.c_str());
+        OutputDebugStringA(buffer);
+        return;
     }
 
-    // SRV는 새 디스크립터 슬롯에 항상 새로 생성 (슬롯이 매번 달라지므로)
-    D3D12_SHADER_RESOURCE_VIEW_DESC srvDesc = {};
-    srvDesc.Shader4ComponentMapping = D3D12_DEFAULT_SHADER_4_COMPONENT_MAPPING;
-    srvDesc.Format = m_pd3dTexture->GetDesc().Format;
-    srvDesc.ViewDimension = D3D12_SRV_DIMENSION_TEXTURE2D;
-    srvDesc.Texture2D.MipLevels = m_pd3dTexture->GetDesc().MipLevels;
-    pd3dDevice->CreateShaderResourceView(m_pd3dTexture.Get(), &srvDesc, srvCpuHandle);
+    CreateTextureSrv(pd3dDevice, m_pTexture, srvCpuHandle);
 }
 
 void GameObject::LoadEmissiveTexture(ID3D12Device* pd3dDevice, ID3D12GraphicsCommandList* pd3dCommandList, D3D12_CPU_DESCRIPTOR_HANDLE srvCpuHandle)
 {
     if (m_strEmissiveTextureName.empty()) return;
 
-    std::wstring wstrPath(m_strEmissiveTextureName.begin(), m_strEmissiveTextureName.end());
-
-    auto cacheIt = s_textureCache.find(wstrPath);
-    if (cacheIt != s_textureCache.end())
-    {
-        m_pd3dEmissiveTexture = cacheIt->second;
-    }
-    else
+    m_pEmissiveTexture = AcquireTexture(pd3dCommandList, m_strEmissiveTextureName);
+    if (!m_pEmissiveTexture)
     {
-        std::unique_ptr<uint8_t[]> decodedData;
-        D3D12_SUBRESOURCE_DATA subresource;
-        HRESULT hr = DirectX::LoadWICTextureFromFile(pd3dDevice, wstrPath.c_str(), m_pd3dEmissiveTexture.GetAddressOf(), decodedData, subresource);
-        if (FAILED(hr))
-        {
-            char buf[512];
-            sprintf_s(buf, "[GameObject] Emissive texture not found: %ls\n", wstrPath.c_str());
-            OutputDebugStringA(buf);
-            return;
-        }
-
-        UINT64 nBytes = GetRequiredIntermediateSize(m_pd3dEmissiveTexture.Get(), 0, 1);
-        m_pd3dEmissiveTextureUploadBuffer = CreateBufferResource(pd3dDevice, pd3dCommandList, NULL, nBytes, D3D12_HEAP_TYPE_UPLOAD, D3D12_RESOURCE_STATE_GENERIC_READ, NULL);
-        UpdateSubresources(pd3dCommandList, m_pd3dEmissiveTexture.Get(), m_pd3dEmissiveTextureUploadBuffer.Get(), 0, 0, 1, &subresource);
-
-        D3D12_RESOURCE_BARRIER barrier = CD3DX12_RESOURCE_BARRIER::Transition(m_pd3dEmissiveTexture.Get(), D3D12_RESOURCE_STATE_COPY_DEST, D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE);
-        pd3dCommandList->ResourceBarrier(1, &barrier);
-
-        s_textureCache[wstrPath] = m_pd3dEmissiveTexture;
+        char buf[512];
+        sprintf_s(buf, "[GameObject] Emissive texture not found: %s\n", m_strEmissiveTextureName.c_str());
+        OutputDebugStringA(buf);
+        return;
     }
 
-    D3D12_SHADER_RESOURCE_VIEW_DESC srvDesc = {};
-    srvDesc.Shader4ComponentMapping = D3D12_DEFAULT_SHADER_4_COMPONENT_MAPPING;
-    srvDesc.Format = m_pd3dEmissiveTexture->GetDesc().Format;
-    srvDesc.ViewDimension = D3D12_SRV_DIMENSION_TEXTURE2D;
-    srvDesc.Texture2D.MipLevels = m_pd3dEmissiveTexture->GetDesc().MipLevels;
-    pd3dDevice->CreateShaderResourceView(m_pd3dEmissiveTexture.Get(), &srvDesc, srvCpuHandle);
+    CreateTextureSrv(pd3dDevice, m_pEmissiveTexture, srvCpuHandle);
 
     if (m_pcbMappedGameObject)
         m_pcbMappedGameObject->m_bHasEmissiveTexture = 1;
 }
 
-void GameObject::ReleaseUploadBuffers()
-{
-    if (m_pd3dTextureUploadBuffer) m_pd3dTextureUploadBuffer = nullptr;
-    if (m_pd3dEmissiveTextureUploadBuffer) m_pd3dEmissiveTextureUploadBuffer = nullptr;
-    if (m_pd3dNormalMapUploadBuffer) m_pd3dNormalMapUploadBuffer = nullptr;
-    if (m_pd3dHeightMapUploadBuffer) m_pd3dHeightMapUploadBuffer = nullptr;
-    if (m_pd3dAOMapUploadBuffer) m_pd3dAOMapUploadBuffer = nullptr;
-    if (m_pd3dRoughnessMapUploadBuffer) m_pd3dRoughnessMapUploadBuffer = nullptr;
-}
-
 void GameObject::LoadNormalMap(ID3D12Device* pd3dDevice, ID3D12GraphicsCommandList* pd3dCommandList, D3D12_CPU_DESCRIPTOR_HANDLE srvCpuHandle)
 {
     if (m_strNormalMapName.empty()) return;
 
-    std::wstring wstrNormalMap(m_strNormalMapName.begin(), m_strNormalMapName.end());
-
-    // Check if file exists
-    if (GetFileAttributesW(wstrNormalMap.c_str()) == INVALID_FILE_ATTRIBUTES)
-    {
-        char buffer[256];
-        sprintf_s(buffer, "Normal map not found: %s\n", m_strNormalMapName.c_str());
-        OutputDebugStringA(buffer);
-        return;
-    }
-
-    // Load texture
-    std::unique_ptr<uint8_t[]> decodedData;
-    D3D12_SUBRESOURCE_DATA subresource;
-
-    HRESULT hr = DirectX::LoadWICTextureFromFile(pd3dDevice, wstrNormalMap.c_str(), m_pd3dNormalMap.GetAddressOf(), decodedData, subresource);
-    if (FAILED(hr))
+    m_pNormalMap = AcquireTexture(pd3dCommandList, m_strNormalMapName);
+    if (!m_pNormalMap)
     {
         char buffer[512];
-        sprintf_s(buffer, "Failed to load normal map: %ls\n", wstrNormalMap.c_str());
+        sprintf_s(buffer, "Failed to load normal map: %s\n", m_strNormalMapName.c_str());
         OutputDebugStringA(buffer);
         return;
     }
 
-    UINT64 nBytes = GetRequiredIntermediateSize(m_pd3dNormalMap.Get(), 0, 1);
-    m_pd3dNormalMapUploadBuffer = CreateBufferResource(pd3dDevice, pd3dCommandList, NULL, nBytes, D3D12_HEAP_TYPE_UPLOAD, D3D12_RESOURCE_STATE_GENERIC_READ, NULL);
-    UpdateSubresources(pd3dCommandList, m_pd3dNormalMap.Get(), m_pd3dNormalMapUploadBuffer.Get(), 0, 0, 1, &subresource);
-
-    D3D12_RESOURCE_BARRIER barrier = CD3DX12_RESOURCE_BARRIER::Transition(m_pd3dNormalMap.Get(), D3D12_RESOURCE_STATE_COPY_DEST, D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE);
-    pd3dCommandList->ResourceBarrier(1, &barrier);
-
-    // Create SRV
-    D3D12_SHADER_RESOURCE_VIEW_DESC srvDesc = {};
-    srvDesc.Shader4ComponentMapping = D3D12_DEFAULT_SHADER_4_COMPONENT_MAPPING;
-    srvDesc.Format = m_pd3dNormalMap->GetDesc().Format;
-    srvDesc.ViewDimension = D3D12_SRV_DIMENSION_TEXTURE2D;
-    srvDesc.Texture2D.MipLevels = m_pd3dNormalMap->GetDesc().MipLevels;
-    pd3dDevice->CreateShaderResourceView(m_pd3dNormalMap.Get(), &srvDesc, srvCpuHandle);
-
-    OutputDebugStringA("Normal map loaded successfully\n");
+    CreateTextureSrv(pd3dDevice, m_pNormalMap, srvCpuHandle);
 }
 
 void GameObject::LoadHeightMap(ID3D12Device* pd3dDevice, ID3D12GraphicsCommandList* pd3dCommandList, D3D12_CPU_DESCRIPTOR_HANDLE srvCpuHandle)
 {
     if (m_strHeightMapName.empty()) return;
 
-    std::wstring wstrHeightMap(m_strHeightMapName.begin(), m_strHeightMapName.end());
-
-    // Check if file exists
-    if (GetFileAttributesW(wstrHeightMap.c_str()) == INVALID_FILE_ATTRIBUTES)
-    {
-        char buffer[256];
-        sprintf_s(buffer, "Height map not found: %s\n", m_strHeightMapName.c_str());
-        OutputDebugStringA(buffer);
-        return;
-    }
-
-    // Load texture
-    std::unique_ptr<uint8_t[]> decodedData;
-    D3D12_SUBRESOURCE_DATA subresource;
-
-    HRESULT hr = DirectX::LoadWICTextureFromFile(pd3dDevice, wstrHeightMap.c_str(), m_pd3dHeightMap.GetAddressOf(), decodedData, subresource);
-    if (FAILED(hr))
+    m_pHeightMap = AcquireTexture(pd3dCommandList, m_strHeightMapName);
+    if (!m_pHeightMap)
     {
         char buffer[512];
-        sprintf_s(buffer, "Failed to load height map: %ls\n", wstrHeightMap.c_str());
+        sprintf_s(buffer, "Failed to load height map: %s\n", m_strHeightMapName.c_str());
         OutputDebugStringA(buffer);
         return;
     }
 
-    UINT64 nBytes = GetRequiredIntermediateSize(m_pd3dHeightMap.Get(), 0, 1);
-    m_pd3dHeightMapUploadBuffer = CreateBufferResource(pd3dDevice, pd3dCommandList, NULL, nBytes, D3D12_HEAP_TYPE_UPLOAD, D3D12_RESOURCE_STATE_GENERIC_READ, NULL);
-    UpdateSubresources(pd3dCommandList, m_pd3dHeightMap.Get(), m_pd3dHeightMapUploadBuffer.Get(), 0, 0, 1, &subresource);
-
-    D3D12_RESOURCE_BARRIER barrier = CD3DX12_RESOURCE_BARRIER::Transition(m_pd3dHeightMap.Get(), D3D12_RESOURCE_STATE_COPY_DEST, D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE);
-    pd3dCommandList->ResourceBarrier(1, &barrier);
-
-    // Create SRV
-    D3D12_SHADER_RESOURCE_VIEW_DESC srvDesc = {};
-    srvDesc.Shader4ComponentMapping = D3D12_DEFAULT_SHADER_4_COMPONENT_MAPPING;
-    srvDesc.Format = m_pd3dHeightMap->GetDesc().Format;
-    srvDesc.ViewDimension = D3D12_SRV_DIMENSION_TEXTURE2D;
-    srvDesc.Texture2D.MipLevels = m_pd3dHeightMap->GetDesc().MipLevels;
-    pd3dDevice->CreateShaderResourceView(m_pd3dHeightMap.Get(), &srvDesc, srvCpuHandle);
-
-    OutputDebugStringA("Height map loaded successfully\n");
+    CreateTextureSrv(pd3dDevice, m_pHeightMap, srvCpuHandle);
 }
 
 void GameObject::LoadAOMap(ID3D12Device* pd3dDevice, ID3D12GraphicsCommandList* pd3dCommandList, D3D12_CPU_DESCRIPTOR_HANDLE srvCpuHandle)
 {
     if (m_strAOMapName.empty()) return;
 
-    std::wstring wstrAOMap(m_strAOMapName.begin(), m_strAOMapName.end());
-
-    if (GetFileAttributesW(wstrAOMap.c_str()) == INVALID_FILE_ATTRIBUTES)
-    {
-        char buffer[256];
-        sprintf_s(buffer, "AO map not found: %s\n", m_strAOMapName.c_str());
-        OutputDebugStringA(buffer);
-        return;
-    }
-
-    std::unique_ptr<uint8_t[]> decodedData;
-    D3D12_SUBRESOURCE_DATA subresource;
-
-    HRESULT hr = DirectX::LoadWICTextureFromFile(pd3dDevice, wstrAOMap.c_str(), m_pd3dAOMap.GetAddressOf(), decodedData, subresource);
-    if (FAILED(hr))
+    m_pAOMap = AcquireTexture(pd3dCommandList, m_strAOMapName);
+    if (!m_pAOMap)
     {
         char buffer[512];
-        sprintf_s(buffer, "Failed to load AO map: %ls\n", wstrAOMap.c_str());
+        sprintf_s(buffer, "Failed to load AO map: %s\n", m_strAOMapName.c_str());
         OutputDebugStringA(buffer);
         return;
     }
 
-    UINT64 nBytes = GetRequiredIntermediateSize(m_pd3dAOMap.Get(), 0, 1);
-    m_pd3dAOMapUploadBuffer = CreateBufferResource(pd3dDevice, pd3dCommandList, NULL, nBytes, D3D12_HEAP_TYPE_UPLOAD, D3D12_RESOURCE_STATE_GENERIC_READ, NULL);
-    UpdateSubresources(pd3dCommandList, m_pd3dAOMap.Get(), m_pd3dAOMapUploadBuffer.Get(), 0, 0, 1, &subresource);
-
-    D3D12_RESOURCE_BARRIER barrier = CD3DX12_RESOURCE_BARRIER::Transition(m_pd3dAOMap.Get(), D3D12_RESOURCE_STATE_COPY_DEST, D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE);
-    pd3dCommandList->ResourceBarrier(1, &barrier);
-
-    D3D12_SHADER_RESOURCE_VIEW_DESC srvDesc = {};
-    srvDesc.Shader4ComponentMapping = D3D12_DEFAULT_SHADER_4_COMPONENT_MAPPING;
-    srvDesc.Format = m_pd3dAOMap->GetDesc().Format;
-    srvDesc.ViewDimension = D3D12_SRV_DIMENSION_TEXTURE2D;
-    srvDesc.Texture2D.MipLevels = m_pd3dAOMap->GetDesc().MipLevels;
-    pd3dDevice->CreateShaderResourceView(m_pd3dAOMap.Get(), &srvDesc, srvCpuHandle);
-
-    OutputDebugStringA("AO map loaded successfully\n");
+    CreateTextureSrv(pd3dDevice, m_pAOMap, srvCpuHandle);
 }
 
 void GameObject::LoadRoughnessMap(ID3D12Device* pd3dDevice, ID3D12GraphicsCommandList* pd3dCommandList, D3D12_CPU_DESCRIPTOR_HANDLE srvCpuHandle)
 {
     if (m_strRoughnessMapName.empty()) return;
 
-    std::wstring wstrRoughnessMap(m_strRoughnessMapName.begin(), m_strRoughnessMapName.end());
-
-    if (GetFileAttributesW(wstrRoughnessMap.c_str()) == INVALID_FILE_ATTRIBUTES)
-    {
-        char buffer[256];
-        sprintf_s(buffer, "Roughness map not found: %s\n", m_strRoughnessMapName.c_str());
-        OutputDebugStringA(buffer);
-        return;
-    }
-
-    std::unique_ptr<uint8_t[]> decodedData;
-    D3D12_SUBRESOURCE_DATA subresource;
-
-    HRESULT hr = DirectX::LoadWICTextureFromFile(pd3dDevice, wstrRoughnessMap.c_str(), m_pd3dRoughnessMap.GetAddressOf(), decodedData, subresource);
-    if (FAILED(hr))
+    m_pRoughnessMap = AcquireTexture(pd3dCommandList, m_strRoughnessMapName);
+    if (!m_pRoughnessMap)
     {
         char buffer[512];
-        sprintf_s(buffer, "Failed to load Roughness map: %ls\n", wstrRoughnessMap.c_str());
+        sprintf_s(buffer, "Failed to load Roughness map: %s\n", m_strRoughnessMapName.c_str());
         OutputDebugStringA(buffer);
         return;
     }
 
-    UINT64 nBytes = GetRequiredIntermediateSize(m_pd3dRoughnessMap.Get(), 0, 1);
-    m_pd3dRoughnessMapUploadBuffer = CreateBufferResource(pd3dDevice, pd3dCommandList, NULL, nBytes, D3D12_HEAP_TYPE_UPLOAD, D3D12_RESOURCE_STATE_GENERIC_READ, NULL);
-    UpdateSubresources(pd3dCommandList, m_pd3dRoughnessMap.Get(), m_pd3dRoughnessMapUploadBuffer.Get(), 0, 0, 1, &subresource);
-
-    D3D12_RESOURCE_BARRIER barrier = CD3DX12_RESOURCE_BARRIER::Transition(m_pd3dRoughnessMap.Get(), D3D12_RESOURCE_STATE_COPY_DEST, D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE);
-    pd3dCommandList->ResourceBarrier(1, &barrier);
-
-    D3D12_SHADER_RESOURCE_VIEW_DESC srvDesc = {};
-    srvDesc.Shader4ComponentMapping = D3D12_DEFAULT_SHADER_4_COMPONENT_MAPPING;
-    srvDesc.Format = m_pd3dRoughnessMap->GetDesc().Format;
-    srvDesc.ViewDimension = D3D12_SRV_DIMENSION_TEXTURE2D;
-    srvDesc.Texture2D.MipLevels = m_pd3dRoughnessMap->GetDesc().MipLevels;
-    pd3dDevice->CreateShaderResourceView(m_pd3dRoughnessMap.Get(), &srvDesc, srvCpuHandle);
-
-    OutputDebugStringA("Roughness map loaded successfully\n");
+    CreateTextureSrv(pd3dDevice, m_pRoughnessMap, srvCpuHandle);
 }
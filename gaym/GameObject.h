@@ -4,12 +4,14 @@
 #include <memory>
 #include <string>
 #include "Mesh.h"
+#include "Component.h"
+#include "TextureCache.h"
 
 struct ID3D12GraphicsCommandList; // 전방 선언
 struct ID3D12Device; // 전방 선언
-class Component;                   // 전방 선언
 class TransformComponent;          // 전방 선언
 class InputSystem;                 // 전방 선언 for InputSystem
+class CRoom;                       // 전방 선언
 
 struct MATERIAL
 {
@@ -31,7 +33,7 @@ struct ObjectConstants
     float m_fHitFlash = 0.f;
     UINT m_bIsRocky = 0;  // HLSL: 7 uints + g_HitFlash float = 32B → MATERIAL at offset 96
 	MATERIAL mMaterial;
-    XMFLOAT4X4 m_xmf4x4BoneTransforms[128];
+    UINT m_nBoneOffset = 0;  // 본 행렬은 BonePalette(t11) 에 있음 — 여기엔 시작 위치만
 };
 
 
@@ -85,62 +87,52 @@ public:
 	void LoadTexture(ID3D12Device* pd3dDevice, ID3D12GraphicsCommandList* pd3dCommandList, D3D12_CPU_DESCRIPTOR_HANDLE srvCpuHandle);
     void SetSrvGpuDescriptorHandle(D3D12_GPU_DESCRIPTOR_HANDLE handle) { m_srvGPUDescriptorHandle = handle; }
     D3D12_GPU_DESCRIPTOR_HANDLE GetSrvDescriptorHandle() const { return m_srvGPUDescriptorHandle; }
-    bool HasTexture() const { return m_pd3dTexture != nullptr; }
+    bool HasTexture() const { return m_pTexture != nullptr; }
 
     // Normal map texture support
     void SetNormalMapName(const std::string& strName) { m_strNormalMapName = strName; }
     void LoadNormalMap(ID3D12Device* pd3dDevice, ID3D12GraphicsCommandList* pd3dCommandList, D3D12_CPU_DESCRIPTOR_HANDLE srvCpuHandle);
     void SetNormalMapSrvGpuHandle(D3D12_GPU_DESCRIPTOR_HANDLE handle) { m_normalMapSrvGPUHandle = handle; }
     D3D12_GPU_DESCRIPTOR_HANDLE GetNormalMapSrvHandle() const { return m_normalMapSrvGPUHandle; }
-    bool HasNormalMap() const { return m_pd3dNormalMap != nullptr; }
+    bool HasNormalMap() const { return m_pNormalMap != nullptr; }
 
     // Height map texture support
     void SetHeightMapName(const std::string& strName) { m_strHeightMapName = strName; }
     void LoadHeightMap(ID3D12Device* pd3dDevice, ID3D12GraphicsCommandList* pd3dCommandList, D3D12_CPU_DESCRIPTOR_HANDLE srvCpuHandle);
     void SetHeightMapSrvGpuHandle(D3D12_GPU_DESCRIPTOR_HANDLE handle) { m_heightMapSrvGPUHandle = handle; }
     D3D12_GPU_DESCRIPTOR_HANDLE GetHeightMapSrvHandle() const { return m_heightMapSrvGPUHandle; }
-    bool HasHeightMap() const { return m_pd3dHeightMap != nullptr; }
+    bool HasHeightMap() const { return m_pHeightMap != nullptr; }
 
     // AO map texture support (for stylized water)
     void SetAOMapName(const std::string& strName) { m_strAOMapName = strName; }
     void LoadAOMap(ID3D12Device* pd3dDevice, ID3D12GraphicsCommandList* pd3dCommandList, D3D12_CPU_DESCRIPTOR_HANDLE srvCpuHandle);
     void SetAOMapSrvGpuHandle(D3D12_GPU_DESCRIPTOR_HANDLE handle) { m_aoMapSrvGPUHandle = handle; }
     D3D12_GPU_DESCRIPTOR_HANDLE GetAOMapSrvHandle() const { return m_aoMapSrvGPUHandle; }
-    bool HasAOMap() const { return m_pd3dAOMap != nullptr; }
+    bool HasAOMap() const { return m_pAOMap != nullptr; }
 
     // Roughness map texture support (for stylized water)
     void SetRoughnessMapName(const std::string& strName) { m_strRoughnessMapName = strName; }
     void LoadRoughnessMap(ID3D12Device* pd3dDevice, ID3D12GraphicsCommandList* pd3dCommandList, D3D12_CPU_DESCRIPTOR_HANDLE srvCpuHandle);
     void SetRoughnessMapSrvGpuHandle(D3D12_GPU_DESCRIPTOR_HANDLE handle) { m_roughnessMapSrvGPUHandle = handle; }
     D3D12_GPU_DESCRIPTOR_HANDLE GetRoughnessMapSrvHandle() const { return m_roughnessMapSrvGPUHandle; }
-    bool HasRoughnessMap() const { return m_pd3dRoughnessMap != nullptr; }
+    bool HasRoughnessMap() const { return m_pRoughnessMap != nullptr; }
 
     // Emissive map texture support
     void SetEmissiveTextureName(const std::string& name) { m_strEmissiveTextureName = name; }
     void LoadEmissiveTexture(ID3D12Device* pd3dDevice, ID3D12GraphicsCommandList* pd3dCommandList, D3D12_CPU_DESCRIPTOR_HANDLE srvCpuHandle);
     void SetEmissiveSrvGpuDescriptorHandle(D3D12_GPU_DESCRIPTOR_HANDLE handle) { m_emissiveSrvGPUDescriptorHandle = handle; }
     D3D12_GPU_DESCRIPTOR_HANDLE GetEmissiveSrvDescriptorHandle() const { return m_emissiveSrvGPUDescriptorHandle; }
-    bool HasEmissiveTexture() const { return m_pd3dEmissiveTexture != nullptr; }
+    bool HasEmissiveTexture() const { return m_pEmissiveTexture != nullptr; }
     void SetHasEmissiveTexture(bool b)
     {
         if (m_pcbMappedGameObject)
             m_pcbMappedGameObject->m_bHasEmissiveTexture = b ? 1 : 0;
     }
 
-    void SetBoneTransform(int index, const XMFLOAT4X4& matrix)
-    {
-        if (m_pcbMappedGameObject && index < 128)
-        {
-            m_pcbMappedGameObject->m_xmf4x4BoneTransforms[index] = matrix;
-        }
-    }
-    void SetSkinned(bool bSkinned)
-    {
-        if (m_pcbMappedGameObject)
-        {
-            m_pcbMappedGameObject->m_bIsSkinned = bSkinned ? 1 : 0;
-        }
-    }
+    // 스킨드 메쉬 본 개수만큼 BonePalette 구간을 잡는다 (다시 부르면 이전 구간은 반납)
+    void AllocateBonePalette(UINT nBones);
+    void SetBoneTransform(int index, const XMFLOAT4X4& matrix);
+    void SetSkinned(bool bSkinned);
     void SetLava(bool bIsLava)
     {
         if (m_pcbMappedGameObject)
@@ -180,17 +172,17 @@ public:
     // Debug: F4 = force all objects to render without texture (see raw geometry/material)
     static bool s_bDebugNoTexture;
 
-	void ReleaseUploadBuffers();
-
 public:
 	char			m_pstrFrameName[64];
 
 	GameObject* m_pParent = nullptr;
+	CRoom* m_pOwnerRoom = nullptr;		// 이 오브젝트를 가진 방 (nullptr = Scene 전역 오브젝트)
 	GameObject* m_pChild = nullptr;
 	GameObject* m_pSibling = nullptr;
 
 private:
 	std::vector<std::unique_ptr<Component>> m_vComponents;
+	Component* m_pComponentSlots[MAX_COMPONENT_TYPES] = {};	// 타입 ID → 컴포넌트 (GetComponent용)
 	TransformComponent* m_pTransform = nullptr;
 
 	ComPtr<ID3D12Resource> m_pd3dcbGameObject = nullptr;
@@ -199,38 +191,36 @@ private:
     D3D12_GPU_DESCRIPTOR_HANDLE m_srvGPUDescriptorHandle;
     D3D12_GPU_DESCRIPTOR_HANDLE m_emissiveSrvGPUDescriptorHandle = {};
 
+	UINT m_nBoneOffset = UINT_MAX;	// BonePalette 구간 (UINT_MAX 면 없음)
+	UINT m_nBoneCount = 0;
+
 	UINT m_nMaterialIndex = 0;
 	MATERIAL m_Material;
 	std::string m_strTextureName;
     std::string m_strEmissiveTextureName;
 
-	ComPtr<ID3D12Resource> m_pd3dTexture = nullptr;
-	ComPtr<ID3D12Resource> m_pd3dTextureUploadBuffer = nullptr;
-    ComPtr<ID3D12Resource> m_pd3dEmissiveTexture = nullptr;
-    ComPtr<ID3D12Resource> m_pd3dEmissiveTextureUploadBuffer = nullptr;
+	// 텍스처는 TextureCache 가 소유 — 같은 파일을 쓰는 오브젝트끼리 공유
+	TextureHandle m_pTexture;
+    TextureHandle m_pEmissiveTexture;
 
     // Normal map texture
     std::string m_strNormalMapName;
-    ComPtr<ID3D12Resource> m_pd3dNormalMap = nullptr;
-    ComPtr<ID3D12Resource> m_pd3dNormalMapUploadBuffer = nullptr;
+    TextureHandle m_pNormalMap;
     D3D12_GPU_DESCRIPTOR_HANDLE m_normalMapSrvGPUHandle = {};
 
     // Height map texture
     std::string m_strHeightMapName;
-    ComPtr<ID3D12Resource> m_pd3dHeightMap = nullptr;
-    ComPtr<ID3D12Resource> m_pd3dHeightMapUploadBuffer = nullptr;
+    TextureHandle m_pHeightMap;
     D3D12_GPU_DESCRIPTOR_HANDLE m_heightMapSrvGPUHandle = {};
 
     // AO map texture (for stylized water)
     std::string m_strAOMapName;
-    ComPtr<ID3D12Resource> m_pd3dAOMap = nullptr;
-    ComPtr<ID3D12Resource> m_pd3dAOMapUploadBuffer = nullptr;
+    TextureHandle m_pAOMap;
     D3D12_GPU_DESCRIPTOR_HANDLE m_aoMapSrvGPUHandle = {};
 
     // Roughness map texture (for stylized water)
     std::string m_strRoughnessMapName;
-    ComPtr<ID3D12Resource> m_pd3dRoughnessMap = nullptr;
-    ComPtr<ID3D12Resource> m_pd3dRoughnessMapUploadBuffer = nullptr;
+    TextureHandle m_pRoughnessMap;
     D3D12_GPU_DESCRIPTOR_HANDLE m_roughnessMapSrvGPUHandle = {};
 
 	Mesh* m_pMesh = nullptr; // Re-added m_pMesh member
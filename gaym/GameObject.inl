@@ -1,5 +1,6 @@
 ﻿// GameObject.inl  — 템플릿 '정의'만 둔다
 #pragma once
+#include <cassert>
 #include <type_traits>
 #include <utility>
 
@@ -7,12 +8,12 @@ template<typename T>
 T* GameObject::GetComponent()
 {
 	static_assert(std::is_base_of_v<Component, T>, "T must derive from Component");
-	for (auto& c : m_vComponents)
-	{
-		if (auto p = dynamic_cast<T*>(c.get()))
-			return p;
-	}
-	return nullptr;
+	// 타입 ID 슬롯 조회 (O(1), RTTI 없음). 모든 컴포넌트가 Component를 직접 상속하므로 dynamic_cast와 결과가 같다
+	// ID는 AddComponent 없이 조회만 해도 부여되므로 슬롯 밖일 수 있다 -> 그런 타입은 붙어 있을 수 없다
+	const ComponentTypeId typeId = ComponentTypeIds::Get<T>();
+	if (typeId >= MAX_COMPONENT_TYPES)
+		return nullptr;
+	return static_cast<T*>(m_pComponentSlots[typeId]);
 }
 
 template<typename T, typename... TArgs>
@@ -23,6 +24,19 @@ T* GameObject::AddComponent(TArgs&&... args)
 	// 모든 컴포넌트는 (GameObject*, ...) 생성자를 가진다는 가정
 	auto up = std::make_unique<T>(this, std::forward<TArgs>(args)...);
 	T* raw = up.get();
+
+	const ComponentTypeId typeId = ComponentTypeIds::Get<T>();
+	assert(typeId < MAX_COMPONENT_TYPES && "MAX_COMPONENT_TYPES 초과");
+	if (typeId < MAX_COMPONENT_TYPES)
+	{
+		raw->m_nTypeId = typeId;
+		ComponentRegistry::Register(raw);
+
+		// 같은 타입이 여러 개면 GetComponent는 기존처럼 첫 번째를 돌려준다
+		if (!m_pComponentSlots[typeId])
+			m_pComponentSlots[typeId] = raw;
+	}
+
 	m_vComponents.emplace_back(std::move(up));
 
 	// Transform 캐시
@@ -0,0 +1,300 @@
+#include "JsonDoc.h"
+#include <algorithm>
+#include <charconv>
+#include <cstring>
+#include <fstream>
+
+static const JsonVal s_JsonNull;
+
+const JsonVal& JsonVal::operator[](size_t idx) const
+{
+    return (type == T::Arr && idx < count) ? items[idx] : s_JsonNull;
+}
+
+const JsonVal* JsonVal::find(std::string_view k) const
+{
+    if (type != T::Obj) return nullptr;
+    for (uint32_t n = 0; n < count; n++)
+        if (keys[n] == k) return &items[n];
+    return nullptr;
+}
+
+const JsonVal& JsonVal::operator[](std::string_view k) const
+{
+    const JsonVal* v = find(k);
+    return v ? *v : s_JsonNull;
+}
+
+// 배열/객체를 닫을 때까지 자식은 스크래치 스택에 쌓아 두었다가, 개수가 정해지면 아레나로 한 번에 옮긴다
+struct JsonDoc::Parser
+{
+    static constexpr int MAX_DEPTH = 256;      // 재귀 파서라 깊이를 막는다 (맵 파일은 10 단 안쪽)
+
+    JsonDoc&                       doc;
+    char*                          p;
+    char*                          end;
+    std::vector<JsonVal>&          stack;
+    std::vector<std::string_view>& keyStack;
+    int                            depth = 0;
+
+    void skipWS()
+    {
+        while (p < end && (unsigned char)*p <= 0x20) p++;
+    }
+
+    template<typename Node>
+    const Node* commit(std::vector<Node>& scratch, size_t base)
+    {
+        const size_t n = scratch.size() - base;
+        Node* dst = static_cast<Node*>(doc.allocate(n * sizeof(Node)));
+        memcpy(dst, scratch.data() + base, n * sizeof(Node));
+        scratch.resize(base);
+        return dst;
+    }
+
+    bool parseValue(JsonVal& v)
+    {
+        skipWS();
+        if (p >= end) return false;
+        switch (*p) {
+        case '{': return parseObject(v);
+        case '[': return parseArray(v);
+        case '"': v.type = JsonVal::T::Str; return parseString(v.str);
+        case 't': v.type = JsonVal::T::Bool; v.b = true;  return literal("true", 4);
+        case 'f': v.type = JsonVal::T::Bool; v.b = false; return literal("false", 5);
+        case 'n': return literal("null", 4);
+        default:  return parseNumber(v);
+        }
+    }
+
+    bool literal(const char* word, size_t n)
+    {
+        if ((size_t)(end - p) < n || memcmp(p, word, n) != 0) return false;
+        p += n;
+        return true;
+    }
+
+    // 닫는 괄호면 true. 쉼표 뒤 닫는 괄호(trailing comma)도 허용
+    bool closeOrComma(char close, bool& closed)
+    {
+        skipWS();
+        if (p >= end) return false;
+        if (*p == ',') { p++; skipWS(); }
+        else if (*p != close) return false;
+        closed = (p < end && *p == close);
+        if (closed) p++;
+        return true;
+    }
+
+    bool parseArray(JsonVal& v)
+    {
+        p++; // skip '['
+        if (++depth > MAX_DEPTH) return false;
+        const size_t base = stack.size();
+        skipWS();
+        bool closed = (p < end && *p == ']');
+        if (closed) p++;
+        while (!closed) {
+            JsonVal item;   // 중첩 파싱이 stack 을 재할당할 수 있으므로 지역에 받은 뒤 push
+            if (!parseValue(item)) return false;
+            stack.push_back(item);
+            if (!closeOrComma(']', closed)) return false;
+        }
+        v.type  = JsonVal::T::Arr;
+        v.count = (uint32_t)(stack.size() - base);
+        v.items = commit(stack, base);
+        depth--;
+        return true;
+    }
+
+    bool parseObject(JsonVal& v)
+    {
+        p++; // skip '{'
+        if (++depth > MAX_DEPTH) return false;
+        const size_t base = stack.size();
+        const size_t keyBase = keyStack.size();
+        skipWS();
+        bool closed = (p < end && *p == '}');
+        if (closed) p++;
+        while (!closed) {
+            std::string_view key;
+            if (p >= end || *p != '"' || !parseString(key)) return false;
+            skipWS();
+            if (p >= end || *p != ':') return false;
+            p++;
+            JsonVal item;
+            if (!parseValue(item)) return false;
+            keyStack.push_back(key);
+            stack.push_back(item);
+            if (!closeOrComma('}', closed)) return false;
+        }
+        v.type  = JsonVal::T::Obj;
+        v.count = (uint32_t)(stack.size() - base);
+        v.items = commit(stack, base);
+        v.keys  = commit(keyStack, keyBase);
+        depth--;
+        return true;
+    }
+
+    static int hexDigit(char c)
+    {
+        if (c >= '0' && c <= '9') return c - '0';
+        if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+        if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+        return -1;
+    }
+
+    bool parseHex4(uint32_t& code)
+    {
+        if (end - p < 4) return false;
+        code = 0;
+        for (int n = 0; n < 4; n++) {
+            const int d = hexDigit(*p++);
+            if (d < 0) return false;
+            code = (code << 4) | (uint32_t)d;
+        }
+        return true;
+    }
+
+    static char* writeUtf8(char* w, uint32_t cp)
+    {
+        if (cp < 0x80)         { *w++ = (char)cp; }
+        else if (cp < 0x800)   { *w++ = (char)(0xC0 | (cp >> 6));  *w++ = (char)(0x80 | (cp & 0x3F)); }
+        else if (cp < 0x10000) { *w++ = (char)(0xE0 | (cp >> 12)); *w++ = (char)(0x80 | ((cp >> 6) & 0x3F)); *w++ = (char)(0x80 | (cp & 0x3F)); }
+        else                   { *w++ = (char)(0xF0 | (cp >> 18)); *w++ = (char)(0x80 | ((cp >> 12) & 0x3F));
+                                 *w++ = (char)(0x80 | ((cp >> 6) & 0x3F)); *w++ = (char)(0x80 | (cp & 0x3F)); }
+        return w;
+    }
+
+    // 버퍼를 제자리에서 고쳐 쓴다 — 풀린 결과는 항상 원문보다 짧거나 같다
+    bool parseString(std::string_view& out)
+    {
+        p++; // skip opening '"'
+        char* begin = p;
+        while (p < end && *p != '"' && *p != '\\') p++;
+
+        char* w = p;
+        while (p < end) {
+            const char c = *p++;
+            if (c == '"') {
+                out = std::string_view(begin, (size_t)(w - begin));
+                return true;
+            }
+            if (c != '\\') { *w++ = c; continue; }
+            if (p >= end) return false;
+            switch (*p++) {
+            case '"':  *w++ = '"';  break;
+            case '\\': *w++ = '\\'; break;
+            case '/':  *w++ = '/';  break;
+            case 'b':  *w++ = '\b'; break;
+            case 'f':  *w++ = '\f'; break;
+            case 'n':  *w++ = '\n'; break;
+            case 'r':  *w++ = '\r'; break;
+            case 't':  *w++ = '\t'; break;
+            case 'u': {
+                uint32_t cp;
+                if (!parseHex4(cp)) return false;
+                if (cp >= 0xD800 && cp < 0xDC00) {
+                    // 하위 서로게이트가 바로 이어지면 합친다. 아니면 U+FFFD 로 두고 뒤의 \u 는 따로 푼다
+                    char* next = p;
+                    uint32_t lo = 0;
+                    if (end - p >= 6 && p[0] == '\\' && p[1] == 'u' && (p += 2, parseHex4(lo)) && lo >= 0xDC00 && lo < 0xE000) {
+                        cp = 0x10000 + ((cp - 0xD800) << 10) + (lo - 0xDC00);
+                    } else {
+                        p  = next;
+                        cp = 0xFFFD;
+                    }
+                } else if (cp >= 0xDC00 && cp < 0xE000) {
+                    cp = 0xFFFD;   // 짝 없는 하위 서로게이트
+                }
+                w = writeUtf8(w, cp);
+                break;
+            }
+            default: return false;
+            }
+        }
+        return false;
+    }
+
+    bool parseNumber(JsonVal& v)
+    {
+        v.type = JsonVal::T::Num;
+        auto [ptr, ec] = std::from_chars(p, end, v.num);
+        if (ec != std::errc() || ptr == p) return false;
+        p = const_cast<char*>(ptr);
+        return true;
+    }
+};
+
+void* JsonDoc::allocate(size_t bytes)
+{
+    bytes = (bytes + 7) & ~(size_t)7;
+    if (bytes > m_nArenaLeft) {
+        // 첫 블록은 파일 크기의 두 배로 잡아 대부분 한 번에 끝나게 하고, 이후 블록은 직전 블록과 같은 크기(요청이 더 크면 그만큼)
+        const size_t lastSize = m_vBlocks.empty() ? m_Buffer.size() * 2 : m_nArenaLeft + (size_t)(m_pArenaCur - m_vBlocks.back().get());
+        const size_t blockSize = (std::max)({ bytes, lastSize, (size_t)16 * 1024 });
+        m_vBlocks.push_back(std::make_unique<char[]>(blockSize));
+        m_pArenaCur  = m_vBlocks.back().get();
+        m_nArenaLeft = blockSize;
+    }
+    void* ptr = m_pArenaCur;
+    m_pArenaCur  += bytes;
+    m_nArenaLeft -= bytes;
+    return ptr;
+}
+
+bool JsonDoc::parseBuffer()
+{
+    m_vBlocks.clear();
+    m_pArenaCur  = nullptr;
+    m_nArenaLeft = 0;
+    m_Root = {};
+
+    char* p   = m_Buffer.data();
+    char* end = p + m_Buffer.size();
+    if (end - p >= 3 && (unsigned char)p[0] == 0xEF && (unsigned char)p[1] == 0xBB && (unsigned char)p[2] == 0xBF)
+        p += 3;   // UTF-8 BOM
+
+    // 스크래치 스택은 파싱마다 재사용 (깊이 × 형제 수 만큼만 자란다)
+    thread_local std::vector<JsonVal>          stack;
+    thread_local std::vector<std::string_view> keyStack;
+    stack.clear();
+    keyStack.clear();
+
+    Parser parser{ *this, p, end, stack, keyStack };
+    JsonVal root;
+    bool ok = parser.parseValue(root);
+    if (ok) {
+        parser.skipWS();
+        ok = (parser.p == end);   // 루트 뒤에 공백 말고 다른 게 있으면 잘못된 문서
+    }
+    if (!ok) {
+        m_Root = {};
+        return false;
+    }
+    m_Root = root;
+    return true;
+}
+
+bool JsonDoc::parse(std::string_view text)
+{
+    m_Buffer.assign(text.begin(), text.end());
+    return parseBuffer();
+}
+
+bool JsonDoc::parseFile(const char* path)
+{
+    std::ifstream fs(path, std::ios::binary | std::ios::ate);
+    if (!fs.is_open()) {
+        m_Root = {};
+        return false;
+    }
+    const std::streamsize size = fs.tellg();
+    fs.seekg(0, std::ios::beg);
+    m_Buffer.resize((size_t)(std::max)(size, (std::streamsize)0));
+    if (size > 0 && !fs.read(m_Buffer.data(), size)) {
+        m_Root = {};
+        return false;
+    }
+    return parseBuffer();
+}
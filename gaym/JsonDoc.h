@@ -0,0 +1,65 @@
+#pragma once
+#include <cstdint>
+#include <memory>
+#include <string_view>
+#include <vector>
+
+// ─────────────────────────────────────────────────────────────────────────────
+//  Minimal JSON value (supports null / bool / number / string / array / object)
+//
+//  JsonDoc 이 파일 버퍼와 노드 아레나를 소유하고, JsonVal 은 그 안을 가리키기만 한다.
+//    · str       : 파일 버퍼 안의 string_view (이스케이프는 제자리에서 풀어 둠)
+//    · 배열/객체 : 아레나에 연속으로 놓인 자식 노드. 객체 키는 파일 순서 그대로 두고 선형 검색
+//  JsonVal 은 자기를 만든 JsonDoc 보다 오래 쓸 수 없다.
+//  D3D 에 의존하지 않는다 (MapLoader, Terrain, 헤드리스 시뮬레이션이 같이 쓴다).
+// ─────────────────────────────────────────────────────────────────────────────
+struct JsonVal
+{
+    enum class T : uint8_t { Null, Bool, Num, Str, Arr, Obj };
+    T        type  = T::Null;
+    bool     b     = false;
+    uint32_t count = 0;                         // Arr / Obj 자식 수
+    double   num   = 0.0;
+    std::string_view        str;
+    const JsonVal*          items = nullptr;    // Arr / Obj: count 개
+    const std::string_view* keys  = nullptr;    // Obj: count 개 (items 와 같은 순서)
+
+    bool   isNull() const { return type == T::Null; }
+    float  f()      const { return (float)num; }
+    int    i()      const { return (int)num; }
+    size_t size()   const { return type == T::Arr ? count : 0; }
+
+    const JsonVal& operator[](size_t idx)          const;
+    const JsonVal& operator[](std::string_view k)  const;
+    bool has(std::string_view k) const { return find(k) != nullptr; }
+    const JsonVal* find(std::string_view k) const;
+};
+
+class JsonDoc
+{
+public:
+    JsonDoc() = default;
+    JsonDoc(JsonDoc&&) = default;
+    JsonDoc& operator=(JsonDoc&&) = default;
+    JsonDoc(const JsonDoc&) = delete;
+    JsonDoc& operator=(const JsonDoc&) = delete;
+
+    // Parse a JSON string (copied into the document). Returns false on error; root() is then Null.
+    bool parse(std::string_view text);
+    // Read file and parse in place.
+    bool parseFile(const char* path);
+
+    const JsonVal& root() const { return m_Root; }
+
+private:
+    struct Parser;
+
+    bool  parseBuffer();
+    void* allocate(size_t bytes);
+
+    std::vector<char>                    m_Buffer;      // 파일 내용 — str 이 가리킨다
+    std::vector<std::unique_ptr<char[]>> m_vBlocks;     // 노드 아레나
+    char*                                m_pArenaCur  = nullptr;
+    size_t                               m_nArenaLeft = 0;
+    JsonVal                              m_Root;
+};
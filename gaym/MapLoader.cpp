@@ -25,140 +25,6 @@
 #include <tuple>
 #include <functional>
 
-// ─────────────────────────────────────────────────────────────────────────────
-//  JSON parser implementation
-// ─────────────────────────────────────────────────────────────────────────────
-
-const JsonVal& JsonVal::operator[](const std::string& k) const
-{
-    static JsonVal sNull;
-    auto it = obj.find(k);
-    return it != obj.end() ? it->second : sNull;
-}
-
-namespace {
-
-struct JParser
-{
-    const char* p;
-    const char* end;
-
-    JParser(const char* s, size_t n) : p(s), end(s + n) {}
-
-    void skipWS()
-    {
-        while (p < end && ((unsigned char)*p <= 0x20 ||
-               (unsigned char)*p == 0xEF ||   // UTF-8 BOM bytes
-               (unsigned char)*p == 0xBB ||
-               (unsigned char)*p == 0xBF))
-            p++;
-    }
-
-    JsonVal parseValue()
-    {
-        skipWS();
-        if (p >= end) return {};
-        switch (*p) {
-        case '{': return parseObject();
-        case '[': return parseArray();
-        case '"': return parseString();
-        case 't': { p += 4; JsonVal v; v.type = JsonVal::T::Bool; v.b = true;  return v; }
-        case 'f': { p += 5; JsonVal v; v.type = JsonVal::T::Bool; v.b = false; return v; }
-        case 'n': { p += 4; return {}; }
-        default:  return parseNumber();
-        }
-    }
-
-    JsonVal parseObject()
-    {
-        JsonVal v; v.type = JsonVal::T::Obj;
-        p++; // skip '{'
-        while (p < end) {
-            skipWS();
-            if (*p == '}') { p++; break; }
-            if (*p == ',') { p++; continue; }
-            if (*p != '"') { p++; continue; } // malformed – skip
-            std::string key = parseString().str;
-            skipWS();
-            if (p < end && *p == ':') p++;
-            v.obj[key] = parseValue();
-        }
-        return v;
-    }
-
-    JsonVal parseArray()
-    {
-        JsonVal v; v.type = JsonVal::T::Arr;
-        p++; // skip '['
-        while (p < end) {
-            skipWS();
-            if (*p == ']') { p++; break; }
-            if (*p == ',') { p++; continue; }
-            v.arr.push_back(parseValue());
-        }
-        return v;
-    }
-
-    JsonVal parseString()
-    {
-        JsonVal v; v.type = JsonVal::T::Str;
-        p++; // skip opening '"'
-        while (p < end && *p != '"') {
-            if (*p == '\\') {
-                p++;
-                if (p >= end) break;
-                switch (*p) {
-                case '"':  v.str += '"';  break;
-                case '\\': v.str += '\\'; break;
-                case '/':  v.str += '/';  break;
-                case 'n':  v.str += '\n'; break;
-                case 'r':  v.str += '\r'; break;
-                case 't':  v.str += '\t'; break;
-                default:   v.str += *p;   break;
-                }
-                p++;
-            } else {
-                v.str += *p++;
-            }
-        }
-        if (p < end) p++; // skip closing '"'
-        return v;
-    }
-
-    JsonVal parseNumber()
-    {
-        JsonVal v; v.type = JsonVal::T::Num;
-        char* endptr = nullptr;
-        v.num = strtod(p, &endptr);
-        if (endptr > p) p = endptr;
-        else p++; // skip unknown char to avoid infinite loop
-        return v;
-    }
-};
-
-} // anonymous namespace
-
-JsonVal JsonVal::parse(const std::string& text)
-{
-    if (text.empty()) return {};
-    JParser jp(text.data(), text.size());
-    return jp.parseValue();
-}
-
-JsonVal JsonVal::parseFile(const char* path)
-{
-    std::ifstream fs(path, std::ios::binary);
-    if (!fs.is_open()) {
-        char buf[256];
-        sprintf_s(buf, "[MapLoader] Cannot open: %s\n", path);
-        OutputDebugStringA(buf);
-        return {};
-    }
-    std::ostringstream ss;
-    ss << fs.rdbuf();
-    return parse(ss.str());
-}
-
 // ─────────────────────────────────────────────────────────────────────────────
 //  OBJ mesh builder helper
 //  Parses an OBJ file and returns GPU mesh buffers (position, normal, uv, index).
@@ -178,7 +44,7 @@ struct ObjResult {
     std::vector<std::string> subGroups;
 };
 std::map<std::string, ObjResult> s_meshCache;
-static std::map<std::string, JsonVal>  s_jsonCache;  // 파싱된 JSON 재사용
+static std::map<std::string, JsonDoc>  s_jsonCache;  // 파싱된 JSON 재사용 (문서째 보관 — JsonVal 이 버퍼를 가리킴)
 
 // Deduplication key: (posIdx, uvIdx, nrmIdx)
 struct FaceKey {
@@ -413,19 +279,21 @@ bool MapLoader::LoadIntoScene(
     DirectX::XMFLOAT3           positionOffset,
     bool                        skipRoomAndSpawn)
 {
-    // s_meshCache / s_jsonCache / s_textureCache — cleared 하지 않고 재사용
+    // s_meshCache / s_jsonCache / TextureCache — cleared 하지 않고 재사용
 
     auto jsonIt = s_jsonCache.find(jsonPath);
     if (jsonIt == s_jsonCache.end())
     {
-        JsonVal parsed = JsonVal::parseFile(jsonPath);
-        if (parsed.isNull()) {
-            OutputDebugStringA("[MapLoader] Failed to parse map.json\n");
+        JsonDoc parsed;
+        if (!parsed.parseFile(jsonPath)) {
+            char buf[256];
+            sprintf_s(buf, "[MapLoader] Cannot open or parse: %s\n", jsonPath);
+            OutputDebugStringA(buf);
             return false;
         }
-        s_jsonCache[jsonPath] = std::move(parsed);
+        jsonIt = s_jsonCache.emplace(jsonPath, std::move(parsed)).first;
     }
-    const JsonVal& root = s_jsonCache[jsonPath];
+    const JsonVal& root = jsonIt->second.root();
 
     // ── 1. Rooms ─────────────────────────────────────────────────────────────
     if (!skipRoomAndSpawn)
@@ -471,7 +339,7 @@ bool MapLoader::LoadIntoScene(
     TorchSystem* pTorchSystemRef = pScene->GetTorchSystem();  // Brazier 감지 시 불 추가용
     for (size_t i = 0; i < mapObjs.size(); i++) {
         const JsonVal& mo = mapObjs[i];
-        std::string meshRelPath = mo["meshFile"].str;
+        std::string meshRelPath(mo["meshFile"].str);
         std::string meshPath = jsonDir + meshRelPath;
 
         ObjResult objRes = LoadObjMesh(pDevice, pCommandList, meshPath);
@@ -502,7 +370,7 @@ bool MapLoader::LoadIntoScene(
         // TorchSystem 의 flame billboard + 조명 공용 재활용. mesh 중복 스폰 X.
         // flameScale 3.5 로 꽤 크게, heightOffset 은 Brazier 스케일 비례 받침 상단.
         {
-            std::string moName = mo.has("name") ? mo["name"].str : "";
+            std::string moName(mo["name"].str);
             if (pTorchSystemRef && moName.find("Brazier_002") != std::string::npos)
             {
                 XMFLOAT3 brazierPos = pGO->GetTransform()->GetPosition();
@@ -552,7 +420,7 @@ bool MapLoader::LoadIntoScene(
         // Helper: load texture from a JSON value
         auto applyTex = [&](GameObject* pTarget, const JsonVal& src) {
             if (src.has("texture") && !src["texture"].str.empty()) {
-                std::string texFullPath = jsonDir + src["texture"].str;
+                std::string texFullPath = jsonDir + std::string(src["texture"].str);
                 pTarget->SetTextureName(texFullPath);
                 D3D12_CPU_DESCRIPTOR_HANDLE cpuHandle;
                 D3D12_GPU_DESCRIPTOR_HANDLE gpuHandle;
@@ -561,7 +429,7 @@ bool MapLoader::LoadIntoScene(
                 pTarget->SetSrvGpuDescriptorHandle(gpuHandle);
             }
             if (src.has("emissiveTexture") && !src["emissiveTexture"].str.empty()) {
-                std::string emTexFullPath = jsonDir + src["emissiveTexture"].str;
+                std::string emTexFullPath = jsonDir + std::string(src["emissiveTexture"].str);
                 pTarget->SetEmissiveTextureName(emTexFullPath);
                 D3D12_CPU_DESCRIPTOR_HANDLE cpuHandle;
                 D3D12_GPU_DESCRIPTOR_HANDLE gpuHandle;
@@ -700,7 +568,7 @@ bool MapLoader::LoadIntoScene(
 
     for (size_t i = 0; i < enemySpawns.size(); i++) {
         const JsonVal& es = enemySpawns[i];
-        std::string presetName = es["presetName"].str;
+        std::string presetName(es["presetName"].str);
         int count = es.has("count") ? es["count"].i() : 1;
         const JsonVal& pos = es["position"];
         XMFLOAT3 spawnPos(pos[0].f()*MAP_SCALE, pos[1].f()*MAP_SCALE, -pos[2].f()*MAP_SCALE);
@@ -721,7 +589,7 @@ bool MapLoader::LoadIntoScene(
             }
 
             // Attack behavior factory (use default parameters; stats are applied via EnemyComponent)
-            std::string attackType = es.has("attackType") ? es["attackType"].str : "Melee";
+            std::string attackType = es.has("attackType") ? std::string(es["attackType"].str) : "Melee";
             ProjectileManager* pProjMgr = pScene->GetProjectileManager();
             if (attackType == "RushFront") {
                 data.m_fnCreateAttack = []() -> std::unique_ptr<IAttackBehavior> {
@@ -744,7 +612,7 @@ bool MapLoader::LoadIntoScene(
             // Attack indicator
             if (es.has("indicator")) {
                 const JsonVal& ind = es["indicator"];
-                std::string indType = ind["type"].str;
+                std::string indType(ind["type"].str);
                 if      (indType == "Circle")     data.m_IndicatorConfig.m_eType = IndicatorType::Circle;
                 else if (indType == "RushCircle") data.m_IndicatorConfig.m_eType = IndicatorType::RushCircle;
                 else if (indType == "RushCone")   data.m_IndicatorConfig.m_eType = IndicatorType::RushCone;
@@ -7,14 +7,22 @@ Mesh::~Mesh()
 {
 }
 
+void Mesh::SetLocalBounds(const XMFLOAT3 *pxmf3Positions, UINT nPositions)
+{
+	m_bHasLocalBounds = (pxmf3Positions && nPositions > 0);
+	if (m_bHasLocalBounds)
+		BoundingBox::CreateFromPoints(m_xmLocalBounds, nPositions, pxmf3Positions, sizeof(XMFLOAT3));
+}
+
 /////////////////////////////////////////////////////////////////////////////////////////////////
 //
-MeshFromFile::MeshFromFile(ID3D12Device *pd3dDevice, ID3D12GraphicsCommandList *pd3dCommandList, MeshLoadInfo *pMeshInfo)
+MeshFromFile::MeshFromFile(ID3D12Device *pd3dDevice, ID3D12GraphicsCommandList *pd3dCommandList, const MeshLoadInfo *pMeshInfo)
 {
 	m_nVertices = pMeshInfo->m_nVertices;
 	m_nType = pMeshInfo->m_nType;
+	SetLocalBounds(pMeshInfo->m_vPositions.data(), (UINT)pMeshInfo->m_vPositions.size());
 
-	m_pd3dPositionBuffer = Dx12App::CreateBufferResource(pMeshInfo->m_pxmf3Positions, sizeof(XMFLOAT3) * m_nVertices, D3D12_HEAP_TYPE_DEFAULT, D3D12_RESOURCE_STATE_VERTEX_AND_CONSTANT_BUFFER, &m_pd3dPositionUploadBuffer);
+	m_pd3dPositionBuffer = Dx12App::CreateBufferResource(pMeshInfo->m_vPositions.data(), sizeof(XMFLOAT3) * m_nVertices, D3D12_HEAP_TYPE_DEFAULT, D3D12_RESOURCE_STATE_VERTEX_AND_CONSTANT_BUFFER, &m_pd3dPositionUploadBuffer);
 
 	m_d3dPositionBufferView.BufferLocation = m_pd3dPositionBuffer->GetGPUVirtualAddress();
 	m_d3dPositionBufferView.StrideInBytes = sizeof(XMFLOAT3);
@@ -31,12 +39,12 @@ MeshFromFile::MeshFromFile(ID3D12Device *pd3dDevice, ID3D12GraphicsCommandList *
 
 		for (int i = 0; i < m_nSubMeshes; i++)
 		{
-			m_pnSubSetIndices[i] = pMeshInfo->m_pnSubSetIndices[i];
-			m_ppd3dSubSetIndexBuffers[i] = Dx12App::CreateBufferResource(pMeshInfo->m_ppnSubSetIndices[i], sizeof(UINT) * m_pnSubSetIndices[i], D3D12_HEAP_TYPE_DEFAULT, D3D12_RESOURCE_STATE_INDEX_BUFFER, &m_ppd3dSubSetIndexUploadBuffers[i]);
+			m_pnSubSetIndices[i] = pMeshInfo->m_vSubSetIndexCounts[i];
+			m_ppd3dSubSetIndexBuffers[i] = Dx12App::CreateBufferResource(pMeshInfo->GetSubSetIndices(i), sizeof(UINT) * m_pnSubSetIndices[i], D3D12_HEAP_TYPE_DEFAULT, D3D12_RESOURCE_STATE_INDEX_BUFFER, &m_ppd3dSubSetIndexUploadBuffers[i]);
 
 			m_pd3dSubSetIndexBufferViews[i].BufferLocation = m_ppd3dSubSetIndexBuffers[i]->GetGPUVirtualAddress();
 			m_pd3dSubSetIndexBufferViews[i].Format = DXGI_FORMAT_R32_UINT;
-			m_pd3dSubSetIndexBufferViews[i].SizeInBytes = sizeof(UINT) * pMeshInfo->m_pnSubSetIndices[i];
+			m_pd3dSubSetIndexBufferViews[i].SizeInBytes = sizeof(UINT) * m_pnSubSetIndices[i];
 		}
 	}
 };
@@ -80,9 +88,9 @@ void MeshFromFile::Render(ID3D12GraphicsCommandList *pd3dCommandList, int nSubSe
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
 //
-MeshIlluminatedFromFile::MeshIlluminatedFromFile(ID3D12Device *pd3dDevice, ID3D12GraphicsCommandList *pd3dCommandList, MeshLoadInfo *pMeshInfo) : MeshFromFile(pd3dDevice, pd3dCommandList, pMeshInfo)
+MeshIlluminatedFromFile::MeshIlluminatedFromFile(ID3D12Device *pd3dDevice, ID3D12GraphicsCommandList *pd3dCommandList, const MeshLoadInfo *pMeshInfo) : MeshFromFile(pd3dDevice, pd3dCommandList, pMeshInfo)
 {
-	m_pd3dNormalBuffer = Dx12App::CreateBufferResource(pMeshInfo->m_pxmf3Normals, sizeof(XMFLOAT3) * m_nVertices, D3D12_HEAP_TYPE_DEFAULT, D3D12_RESOURCE_STATE_VERTEX_AND_CONSTANT_BUFFER, &m_pd3dNormalUploadBuffer);
+	m_pd3dNormalBuffer = Dx12App::CreateBufferResource(pMeshInfo->m_vNormals.data(), sizeof(XMFLOAT3) * m_nVertices, D3D12_HEAP_TYPE_DEFAULT, D3D12_RESOURCE_STATE_VERTEX_AND_CONSTANT_BUFFER, &m_pd3dNormalUploadBuffer);
 
 	m_d3dNormalBufferView.BufferLocation = m_pd3dNormalBuffer->GetGPUVirtualAddress();
 	m_d3dNormalBufferView.StrideInBytes = sizeof(XMFLOAT3);
@@ -90,7 +98,7 @@ MeshIlluminatedFromFile::MeshIlluminatedFromFile(ID3D12Device *pd3dDevice, ID3D1
 
 	if (m_nType & VERTEXT_TEXTURE_COORD0)
 	{
-		m_pd3dTextureCoord0Buffer = Dx12App::CreateBufferResource(pMeshInfo->m_pxmf2TextureCoords0, sizeof(XMFLOAT2) * m_nVertices, D3D12_HEAP_TYPE_DEFAULT, D3D12_RESOURCE_STATE_VERTEX_AND_CONSTANT_BUFFER, &m_pd3dTextureCoord0UploadBuffer);
+		m_pd3dTextureCoord0Buffer = Dx12App::CreateBufferResource(pMeshInfo->m_vTextureCoords0.data(), sizeof(XMFLOAT2) * m_nVertices, D3D12_HEAP_TYPE_DEFAULT, D3D12_RESOURCE_STATE_VERTEX_AND_CONSTANT_BUFFER, &m_pd3dTextureCoord0UploadBuffer);
 
 		m_d3dTextureCoord0BufferView.BufferLocation = m_pd3dTextureCoord0Buffer->GetGPUVirtualAddress();
 		m_d3dTextureCoord0BufferView.StrideInBytes = sizeof(XMFLOAT2);
@@ -127,22 +135,37 @@ void MeshIlluminatedFromFile::Render(ID3D12GraphicsCommandList *pd3dCommandList,
     
     /////////////////////////////////////////////////////////////////////////////////////////////////
     //
-    SkinnedMesh::SkinnedMesh(ID3D12Device *pd3dDevice, ID3D12GraphicsCommandList *pd3dCommandList, MeshLoadInfo *pMeshInfo) : MeshIlluminatedFromFile(pd3dDevice, pd3dCommandList, pMeshInfo)
+    SkinnedMesh::SkinnedMesh(ID3D12Device *pd3dDevice, ID3D12GraphicsCommandList *pd3dCommandList, const MeshLoadInfo *pMeshInfo) : MeshIlluminatedFromFile(pd3dDevice, pd3dCommandList, pMeshInfo)
     {
         m_vBoneNames = pMeshInfo->m_vBoneNames;
         m_vBindPoses = pMeshInfo->m_vBindPoses;
+
+        // 애니메이션 포즈는 바인드 포즈 AABB 를 벗어나므로 보수적으로 넓혀서 컬링에 넣는다
+        InflateSkinnedBounds();
     
-        m_pd3dBoneIndexBuffer = Dx12App::CreateBufferResource(pMeshInfo->m_pxmn4BoneIndices, sizeof(XMINT4) * m_nVertices, D3D12_HEAP_TYPE_DEFAULT, D3D12_RESOURCE_STATE_VERTEX_AND_CONSTANT_BUFFER, &m_pd3dBoneIndexUploadBuffer);
+        m_pd3dBoneIndexBuffer = Dx12App::CreateBufferResource(pMeshInfo->m_vBoneIndices.data(), sizeof(XMINT4) * m_nVertices, D3D12_HEAP_TYPE_DEFAULT, D3D12_RESOURCE_STATE_VERTEX_AND_CONSTANT_BUFFER, &m_pd3dBoneIndexUploadBuffer);
         m_d3dBoneIndexBufferView.BufferLocation = m_pd3dBoneIndexBuffer->GetGPUVirtualAddress();
         m_d3dBoneIndexBufferView.StrideInBytes = sizeof(XMINT4);
         m_d3dBoneIndexBufferView.SizeInBytes = sizeof(XMINT4) * m_nVertices;
     
-        m_pd3dBoneWeightBuffer = Dx12App::CreateBufferResource(pMeshInfo->m_pxmf4BoneWeights, sizeof(XMFLOAT4) * m_nVertices, D3D12_HEAP_TYPE_DEFAULT, D3D12_RESOURCE_STATE_VERTEX_AND_CONSTANT_BUFFER, &m_pd3dBoneWeightUploadBuffer);
+        m_pd3dBoneWeightBuffer = Dx12App::CreateBufferResource(pMeshInfo->m_vBoneWeights.data(), sizeof(XMFLOAT4) * m_nVertices, D3D12_HEAP_TYPE_DEFAULT, D3D12_RESOURCE_STATE_VERTEX_AND_CONSTANT_BUFFER, &m_pd3dBoneWeightUploadBuffer);
         m_d3dBoneWeightBufferView.BufferLocation = m_pd3dBoneWeightBuffer->GetGPUVirtualAddress();
         m_d3dBoneWeightBufferView.StrideInBytes = sizeof(XMFLOAT4);
         m_d3dBoneWeightBufferView.SizeInBytes = sizeof(XMFLOAT4) * m_nVertices;
     }
     
+    void SkinnedMesh::InflateSkinnedBounds()
+    {
+        if (!m_bHasLocalBounds)
+            return;
+
+        // 바인드 포즈를 중심 기준으로 어떻게 돌려도 들어가는 정육면체 (반경 = 대각선 절반) 에 여유를 곱한다.
+        // 스킨 결과는 홀더 로컬 공간이라 (AnimationComponent 의 matRootInvWorld) 월드 행렬로 변환하면 된다
+        const XMFLOAT3& e = m_xmLocalBounds.Extents;
+        const float fRadius = sqrtf(e.x * e.x + e.y * e.y + e.z * e.z) * kSkinnedBoundsMargin;
+        m_xmLocalBounds.Extents = XMFLOAT3(fRadius, fRadius, fRadius);
+    }
+
     SkinnedMesh::~SkinnedMesh()
     {
     }
@@ -193,6 +216,7 @@ void ObjMesh::Build(ID3D12Device* pd3dDevice,
                     const std::vector<UINT>&     indices)
 {
     m_nVertices = (UINT)positions.size();
+    SetLocalBounds(positions.data(), m_nVertices);
     m_nIndices  = (UINT)indices.size();
     m_nType     = VERTEXT_POSITION | VERTEXT_NORMAL | VERTEXT_TEXTURE_COORD0;
 
@@ -278,6 +302,7 @@ CubeMesh::CubeMesh(ID3D12Device* pd3dDevice, ID3D12GraphicsCommandList* pd3dComm
         // Left face (X-)
         { -hw, -hh, -hd }, { -hw, -hh,  hd }, { -hw,  hh,  hd }, { -hw,  hh, -hd }
     };
+    SetLocalBounds(positions, m_nVertices);
 
     // Normals
     XMFLOAT3 normals[24] = {
@@ -6,6 +6,7 @@
 
 #include <vector>
 #include <string>
+#include "MeshFileParser.h"	// VERTEXT_* (.bin vertex stream flags)
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 //
@@ -32,26 +33,29 @@ protected:
 
 	UINT							m_nType = 0;
 
+	// Local-space AABB for culling. Meshes whose extent is not known up front
+	// (vertex-displaced) leave it unset and are treated as always visible.
+	// Skinned meshes use an inflated bind-pose box (SkinnedMesh::InflateSkinnedBounds)
+	bool							m_bHasLocalBounds = false;
+	BoundingBox						m_xmLocalBounds;
+
+	void SetLocalBounds(const XMFLOAT3 *pxmf3Positions, UINT nPositions);
+
 public:
 	UINT GetType() { return(m_nType); }
 	virtual void Render(ID3D12GraphicsCommandList *pd3dCommandList) { }
 	virtual void Render(ID3D12GraphicsCommandList *pd3dCommandList, int nSubSet) { }
-};
 
-/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-//
-#define VERTEXT_POSITION			0x01
-#define VERTEXT_COLOR				0x02
-#define VERTEXT_NORMAL				0x04
-#define VERTEXT_TEXTURE_COORD0		0x08
-#define VERTEXT_BONE_INDEX_WEIGHT   0x10
+	bool HasLocalBounds() const { return(m_bHasLocalBounds); }
+	const BoundingBox& GetLocalBounds() const { return(m_xmLocalBounds); }
+};
 
-/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 //
 class MeshFromFile : public Mesh
 {
 public:
-	MeshFromFile(ID3D12Device *pd3dDevice, ID3D12GraphicsCommandList *pd3dCommandList, class MeshLoadInfo *pMeshInfo);
+	MeshFromFile(ID3D12Device *pd3dDevice, ID3D12GraphicsCommandList *pd3dCommandList, const class MeshLoadInfo *pMeshInfo);
 	virtual ~MeshFromFile();
 
 public:
@@ -79,7 +83,7 @@ public:
 class MeshIlluminatedFromFile : public MeshFromFile
 {
 public:
-	MeshIlluminatedFromFile(ID3D12Device *pd3dDevice, ID3D12GraphicsCommandList *pd3dCommandList, class MeshLoadInfo *pMeshInfo);
+	MeshIlluminatedFromFile(ID3D12Device *pd3dDevice, ID3D12GraphicsCommandList *pd3dCommandList, const class MeshLoadInfo *pMeshInfo);
 	virtual ~MeshIlluminatedFromFile();
 
 	virtual void ReleaseUploadBuffers();
@@ -102,7 +106,7 @@ public:
 class SkinnedMesh : public MeshIlluminatedFromFile
 {
 public:
-	SkinnedMesh(ID3D12Device *pd3dDevice, ID3D12GraphicsCommandList *pd3dCommandList, class MeshLoadInfo *pMeshInfo);
+	SkinnedMesh(ID3D12Device *pd3dDevice, ID3D12GraphicsCommandList *pd3dCommandList, const class MeshLoadInfo *pMeshInfo);
 	virtual ~SkinnedMesh();
 
 	virtual void ReleaseUploadBuffers();
@@ -120,6 +124,12 @@ protected:
 public:
 	std::vector<std::string>		m_vBoneNames;
 	std::vector<XMFLOAT4X4>			m_vBindPoses; // Inverse Bind Pose Matrices
+
+	// 바인드 포즈 대각선 반경에 곱하는 여유 (팔을 뻗는 공격 모션 등)
+	static constexpr float			kSkinnedBoundsMargin = 1.25f;
+
+private:
+	void InflateSkinnedBounds();
 };
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
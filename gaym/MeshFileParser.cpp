@@ -0,0 +1,386 @@
+#include "MeshFileParser.h"
+#include <cstring>
+
+// .bin mesh parsing: CPU data only, no device objects (MeshLoader builds GameObjects from the result)
+namespace
+{
+	// Whole .bin file in memory. Every read is bounds-checked; the first failure sticks
+	class MeshFileReader
+	{
+	public:
+		bool Open(const char* pstrFileName)
+		{
+			FILE* pInFile = NULL;
+			if (::fopen_s(&pInFile, pstrFileName, "rb") != 0 || !pInFile) return false;
+
+			::fseek(pInFile, 0, SEEK_END);
+			long nSize = ::ftell(pInFile);
+			::fseek(pInFile, 0, SEEK_SET);
+			if (nSize > 0)
+			{
+				m_vBuffer.resize((size_t)nSize);
+				if (::fread(m_vBuffer.data(), 1, (size_t)nSize, pInFile) != (size_t)nSize) m_vBuffer.clear();
+			}
+			::fclose(pInFile);
+			return !m_vBuffer.empty();
+		}
+
+		bool IsFailed() const { return m_bFailed; }
+		void Fail() { m_bFailed = true; }
+
+		bool ReadBytes(void* pDest, size_t nBytes)
+		{
+			if (m_bFailed || nBytes > m_vBuffer.size() - m_nPos) { m_bFailed = true; return false; }
+			memcpy(pDest, m_vBuffer.data() + m_nPos, nBytes);
+			m_nPos += nBytes;
+			return true;
+		}
+
+		int ReadInteger()
+		{
+			int nValue = 0;
+			ReadBytes(&nValue, sizeof(int));
+			return nValue;
+		}
+
+		// Element count followed by nCount * sizeof(T) bytes; rejects counts the file cannot hold
+		int ReadCount(size_t nElementSize)
+		{
+			int nCount = ReadInteger();
+			if (nCount < 0 || (size_t)nCount > (m_vBuffer.size() - m_nPos) / nElementSize) { m_bFailed = true; return 0; }
+			return nCount;
+		}
+
+		template <typename T>
+		void ReadArray(std::vector<T>& vDest, int nCount)
+		{
+			vDest.resize(nCount);
+			ReadBytes(vDest.data(), sizeof(T) * nCount);
+		}
+
+		// 7-bit encoded length (C# BinaryWriter). Returns 0 at end of data or if the string does not fit,
+		// which ends the caller's token loop just like the old fread path
+		int ReadString(char* pstrToken, int nBufferSize)
+		{
+			int nStrLength = 0, shift = 0;
+			BYTE byteRead = 0;
+			do {
+				if (m_bFailed || m_nPos >= m_vBuffer.size() || shift > 28) { m_bFailed = true; return 0; }
+				byteRead = m_vBuffer[m_nPos++];
+				nStrLength |= (byteRead & 0x7F) << shift;
+				shift += 7;
+			} while (byteRead & 0x80);
+
+			if ((size_t)nStrLength > m_vBuffer.size() - m_nPos) { m_bFailed = true; return 0; }
+			if (nStrLength >= nBufferSize)
+			{
+				m_nPos += nStrLength;
+				pstrToken[0] = '\0';
+				return 0;
+			}
+
+			memcpy(pstrToken, m_vBuffer.data() + m_nPos, nStrLength);
+			pstrToken[nStrLength] = '\0';
+			m_nPos += nStrLength;
+			return nStrLength;
+		}
+
+	private:
+		std::vector<BYTE>	m_vBuffer;
+		size_t				m_nPos = 0;
+		bool				m_bFailed = false;
+	};
+
+	bool IsTag(const char* pstrToken)
+	{
+		size_t nLength = strlen(pstrToken);
+		return (nLength >= 2) && (pstrToken[0] == '<') && (strchr(pstrToken, '>') != NULL);
+	}
+
+	void ParseMaterials(MeshFileReader& reader, MeshFrameInfo& frameInfo)
+	{
+		char pstrToken[64] = { '\0' };
+		reader.ReadInteger();	// <Materials>: count (events are read until </Materials>)
+
+		for (; ; )
+		{
+			if (reader.ReadString(pstrToken, 64) == 0) break;
+			if (!strcmp(pstrToken, "</Materials>")) break;
+
+			if (!strcmp(pstrToken, "<Material>:"))
+			{
+				reader.ReadInteger();	// material index, events are applied in file order
+			}
+			else if (!strcmp(pstrToken, "<AlbedoColor>:"))
+			{
+				MeshMaterialEvent event;
+				reader.ReadBytes(&event.m_xmf4AlbedoColor, sizeof(float) * 4);
+				frameInfo.m_vMaterialEvents.push_back(event);
+			}
+			else if (!strcmp(pstrToken, "<AlbedoMap>:"))
+			{
+				char pstrTextureName[64] = { 0 };
+				reader.ReadString(pstrTextureName, 64);
+
+				MeshMaterialEvent event;
+				event.m_bAlbedoMap = true;
+				event.m_strAlbedoMap = pstrTextureName;
+				frameInfo.m_vMaterialEvents.push_back(std::move(event));
+			}
+			else if (!strcmp(pstrToken, "<EmissiveColor>:") ||
+					 !strcmp(pstrToken, "<SpecularColor>:"))
+			{
+				XMFLOAT4 xmf4Color;
+				reader.ReadBytes(&xmf4Color, sizeof(float) * 4);
+			}
+			else if (!strcmp(pstrToken, "<Glossiness>:") ||
+					 !strcmp(pstrToken, "<Metallic>:") ||
+					 !strcmp(pstrToken, "<SpecularHighlight>:") ||
+					 !strcmp(pstrToken, "<GlossyReflection>:") ||
+					 !strcmp(pstrToken, "<Smoothness>:"))
+			{
+				float fValue;
+				reader.ReadBytes(&fValue, sizeof(float));
+			}
+			else if (!IsTag(pstrToken))
+			{
+				reader.Fail();
+			}
+			if (reader.IsFailed()) break;
+		}
+	}
+
+	std::unique_ptr<MeshLoadInfo> ParseMeshInfo(MeshFileReader& reader)
+	{
+		char pstrToken[64] = { '\0' };
+		auto pMeshInfo = std::make_unique<MeshLoadInfo>();
+
+		pMeshInfo->m_nVertices = reader.ReadInteger();
+		reader.ReadString(pMeshInfo->m_pstrMeshName, 64);
+
+		for ( ; ; )
+		{
+			if (reader.ReadString(pstrToken, 64) == 0) break;
+
+			if (!strcmp(pstrToken, "<Bounds>:"))
+			{
+				reader.ReadBytes(&pMeshInfo->m_xmf3AABBCenter, sizeof(XMFLOAT3));
+				reader.ReadBytes(&pMeshInfo->m_xmf3AABBExtents, sizeof(XMFLOAT3));
+			}
+			else if (!strcmp(pstrToken, "<Positions>:"))
+			{
+				int nPositions = reader.ReadCount(sizeof(XMFLOAT3));
+				if (nPositions > 0)
+				{
+					pMeshInfo->m_nType |= VERTEXT_POSITION;
+					reader.ReadArray(pMeshInfo->m_vPositions, nPositions);
+				}
+			}
+			else if (!strcmp(pstrToken, "<Colors>:"))
+			{
+				int nColors = reader.ReadCount(sizeof(XMFLOAT4));
+				if (nColors > 0)
+				{
+					pMeshInfo->m_nType |= VERTEXT_COLOR;
+					reader.ReadArray(pMeshInfo->m_vColors, nColors);
+				}
+			}
+			else if (!strcmp(pstrToken, "<Normals>:"))
+			{
+				int nNormals = reader.ReadCount(sizeof(XMFLOAT3));
+				if (nNormals > 0)
+				{
+					pMeshInfo->m_nType |= VERTEXT_NORMAL;
+					reader.ReadArray(pMeshInfo->m_vNormals, nNormals);
+				}
+			}
+			else if (!strcmp(pstrToken, "<TexCoords>:"))
+			{
+				int nTextureCoords = reader.ReadCount(sizeof(XMFLOAT2));
+				if (nTextureCoords > 0)
+				{
+					pMeshInfo->m_nType |= VERTEXT_TEXTURE_COORD0;
+					reader.ReadArray(pMeshInfo->m_vTextureCoords0, nTextureCoords);
+					for (XMFLOAT2& uv : pMeshInfo->m_vTextureCoords0) uv.y = 1.0f - uv.y;
+				}
+			}
+			else if (!strcmp(pstrToken, "<BoneWeights>:"))
+			{
+				// Per vertex: 4 x (int index, float weight)
+				struct BoneInfluence { int nIndex; float fWeight; };
+				int nBoneWeights = reader.ReadCount(sizeof(BoneInfluence) * 4);
+				if (nBoneWeights > 0)
+				{
+					std::vector<BoneInfluence> vInfluences;
+					reader.ReadArray(vInfluences, nBoneWeights * 4);
+					if (!reader.IsFailed())
+					{
+						pMeshInfo->m_nType |= VERTEXT_BONE_INDEX_WEIGHT;
+						pMeshInfo->m_vBoneIndices.resize(nBoneWeights);
+						pMeshInfo->m_vBoneWeights.resize(nBoneWeights);
+						for (int i = 0; i < nBoneWeights; i++)
+						{
+							const BoneInfluence* p = &vInfluences[i * 4];
+							pMeshInfo->m_vBoneIndices[i] = XMINT4(p[0].nIndex, p[1].nIndex, p[2].nIndex, p[3].nIndex);
+							pMeshInfo->m_vBoneWeights[i] = XMFLOAT4(p[0].fWeight, p[1].fWeight, p[2].fWeight, p[3].fWeight);
+						}
+					}
+				}
+			}
+			else if (!strcmp(pstrToken, "<BindPoses>:"))
+			{
+				int nBindPoses = reader.ReadCount(sizeof(XMFLOAT4X4));
+				if (nBindPoses > 0) reader.ReadArray(pMeshInfo->m_vBindPoses, nBindPoses);
+			}
+			else if (!strcmp(pstrToken, "<BoneNames>:"))
+			{
+				int nBoneNames = reader.ReadCount(1);
+				char pstrBoneName[64] = { 0 };
+				pMeshInfo->m_vBoneNames.reserve(nBoneNames);
+				for (int i = 0; i < nBoneNames && !reader.IsFailed(); i++)
+				{
+					reader.ReadString(pstrBoneName, 64);
+					pMeshInfo->m_vBoneNames.push_back(pstrBoneName);
+				}
+			}
+			else if (!strcmp(pstrToken, "<Indices>:"))
+			{
+				int nIndices = reader.ReadCount(sizeof(UINT));
+				if (nIndices > 0) reader.ReadArray(pMeshInfo->m_vIndices, nIndices);
+			}
+			else if (!strcmp(pstrToken, "<SubMeshes>:"))
+			{
+				int nSubMeshes = reader.ReadCount(1);
+				pMeshInfo->m_nSubMeshes = nSubMeshes;
+				pMeshInfo->m_vSubSetIndexCounts.assign(nSubMeshes, 0);
+				pMeshInfo->m_vSubSetIndexStarts.assign(nSubMeshes, 0);
+				for (int i = 0; i < nSubMeshes && !reader.IsFailed(); i++)
+				{
+					pMeshInfo->m_vSubSetIndexStarts[i] = (UINT)pMeshInfo->m_vSubSetIndices.size();
+					reader.ReadString(pstrToken, 64);
+					if (!strcmp(pstrToken, "<SubMesh>:"))
+					{
+						reader.ReadInteger();	// sub-mesh index, always i
+						int nSubIndices = reader.ReadCount(sizeof(UINT));
+						pMeshInfo->m_vSubSetIndexCounts[i] = nSubIndices;
+						if (nSubIndices > 0)
+						{
+							size_t nStart = pMeshInfo->m_vSubSetIndices.size();
+							pMeshInfo->m_vSubSetIndices.resize(nStart + nSubIndices);
+							reader.ReadBytes(pMeshInfo->m_vSubSetIndices.data() + nStart, sizeof(UINT) * nSubIndices);
+						}
+					}
+				}
+			}
+			else if (!strcmp(pstrToken, "</Mesh>"))
+			{
+				break;
+			}
+			else if (!IsTag(pstrToken))
+			{
+				reader.Fail();
+			}
+			if (reader.IsFailed()) break;
+		}
+
+		// Mesh constructors size every vertex buffer by m_nVertices
+		auto validStream = [&](size_t nCount) { return nCount == 0 || nCount == (size_t)pMeshInfo->m_nVertices; };
+		if (pMeshInfo->m_nVertices < 0 ||
+			!validStream(pMeshInfo->m_vPositions.size()) || !validStream(pMeshInfo->m_vColors.size()) ||
+			!validStream(pMeshInfo->m_vNormals.size()) || !validStream(pMeshInfo->m_vTextureCoords0.size()) ||
+			!validStream(pMeshInfo->m_vBoneIndices.size()))
+		{
+			reader.Fail();
+		}
+		return pMeshInfo;
+	}
+
+	void ParseFrameHierarchy(MeshFileReader& reader, MeshFrameInfo& frameInfo, int nDepth)
+	{
+		char pstrToken[64] = { '\0' };
+
+		// Children nest one <Frame> per level; anything deeper than this is a corrupt count
+		if (nDepth > 256) { reader.Fail(); return; }
+
+		for ( ; ; )
+		{
+			if (reader.ReadString(pstrToken, 64) == 0) break;
+
+			if (!strcmp(pstrToken, "<Frame>:"))
+			{
+				reader.ReadInteger();	// frame index
+				reader.ReadString(frameInfo.m_pstrFrameName, 64);
+			}
+			else if (!strcmp(pstrToken, "<Transform>:"))
+			{
+				float pfTransform[13];
+				reader.ReadBytes(pfTransform, sizeof(pfTransform));
+			}
+			else if (!strcmp(pstrToken, "<TransformMatrix>:"))
+			{
+				reader.ReadBytes(&frameInfo.m_xmf4x4Transform, sizeof(XMFLOAT4X4));
+				frameInfo.m_bHasTransform = true;
+			}
+			else if (!strcmp(pstrToken, "<Mesh>:"))
+			{
+				frameInfo.m_pMeshInfo = ParseMeshInfo(reader);
+			}
+			else if (!strcmp(pstrToken, "<Materials>:"))
+			{
+				ParseMaterials(reader, frameInfo);
+			}
+			else if (!strcmp(pstrToken, "<Children>:"))
+			{
+				int nChilds = reader.ReadCount(1);
+				frameInfo.m_vChildren.resize(nChilds);
+				for (int i = 0; i < nChilds && !reader.IsFailed(); i++)
+				{
+					ParseFrameHierarchy(reader, frameInfo.m_vChildren[i], nDepth + 1);
+				}
+			}
+			else if (!strcmp(pstrToken, "</Frame>"))
+			{
+				break;
+			}
+			else if (!IsTag(pstrToken))
+			{
+				reader.Fail();
+			}
+			if (reader.IsFailed()) break;
+		}
+	}
+}
+
+std::shared_ptr<const MeshFrameInfo> ParseMeshFile(const char* pstrFileName)
+{
+	MeshFileReader reader;
+	if (!reader.Open(pstrFileName)) return nullptr;
+
+	std::shared_ptr<MeshFrameInfo> pRoot;
+	char pstrToken[64] = { '\0' };
+
+	for ( ; ; )
+	{
+		if (reader.ReadString(pstrToken, 64) == 0) break;
+
+		if (!strcmp(pstrToken, "<Hierarchy>:"))
+		{
+			pRoot = std::make_shared<MeshFrameInfo>();
+			ParseFrameHierarchy(reader, *pRoot, 0);
+		}
+		else if (!strcmp(pstrToken, "</Hierarchy>"))
+		{
+			break;
+		}
+		if (reader.IsFailed()) break;
+	}
+
+	if (reader.IsFailed())
+	{
+		char buffer[512];
+		sprintf_s(buffer, "MeshLoader: Malformed mesh file: %s\n", pstrFileName);
+		OutputDebugStringA(buffer);
+		return nullptr;
+	}
+	return pRoot;
+}
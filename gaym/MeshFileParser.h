@@ -0,0 +1,100 @@
+#pragma once
+
+#include "PortablePlatform.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+// .bin mesh file -> CPU-side frame tree. No device objects and no stdafx.h, so it also builds
+// on Linux (gaym/Tests); MeshLoader turns the result into GameObjects
+
+// MeshLoadInfo::m_nType bits: vertex streams present in the file
+#define VERTEXT_POSITION			0x01
+#define VERTEXT_COLOR				0x02
+#define VERTEXT_NORMAL				0x04
+#define VERTEXT_TEXTURE_COORD0		0x08
+#define VERTEXT_BONE_INDEX_WEIGHT   0x10
+
+
+class MeshLoadInfo
+
+{
+
+public:
+
+    char                            m_pstrMeshName[256] = { 0 };
+
+
+
+    UINT                            m_nType = 0x00;
+
+
+
+    XMFLOAT3                        m_xmf3AABBCenter = XMFLOAT3(0.0f, 0.0f, 0.0f);
+
+    XMFLOAT3                        m_xmf3AABBExtents = XMFLOAT3(0.0f, 0.0f, 0.0f);
+
+
+
+    // Vertex streams: m_nVertices entries each, empty if the file has no such stream
+    int                             m_nVertices = 0;
+
+    std::vector<XMFLOAT3>           m_vPositions;
+
+    std::vector<XMFLOAT4>           m_vColors;
+
+    std::vector<XMFLOAT3>           m_vNormals;
+
+    std::vector<XMFLOAT2>           m_vTextureCoords0;
+
+    // Skinning Data
+    std::vector<XMINT4>             m_vBoneIndices;
+    std::vector<XMFLOAT4>           m_vBoneWeights;
+    std::vector<std::string> m_vBoneNames;
+    std::vector<XMFLOAT4X4> m_vBindPoses;
+
+    std::vector<UINT>               m_vIndices;
+
+
+
+    // Sub-mesh indices are stored back to back in m_vSubSetIndices
+    int                             m_nSubMeshes = 0;
+
+    std::vector<int>                m_vSubSetIndexCounts;
+
+    std::vector<UINT>               m_vSubSetIndexStarts;
+
+    std::vector<UINT>               m_vSubSetIndices;
+
+    const UINT* GetSubSetIndices(int nSubSet) const { return m_vSubSetIndices.data() + m_vSubSetIndexStarts[nSubSet]; }
+
+};
+
+
+
+// <AlbedoColor> / <AlbedoMap> in file order (applied to the frame's GameObject in the same order)
+struct MeshMaterialEvent
+{
+    bool                            m_bAlbedoMap = false;
+    XMFLOAT4                        m_xmf4AlbedoColor = XMFLOAT4(0.0f, 0.0f, 0.0f, 0.0f);
+    std::string                     m_strAlbedoMap;
+};
+
+
+
+// One <Frame> of a parsed .bin file. CPU data only - safe to build on any thread
+struct MeshFrameInfo
+{
+    char                            m_pstrFrameName[64] = { 0 };
+    bool                            m_bHasTransform = false;
+    XMFLOAT4X4                      m_xmf4x4Transform;
+    std::unique_ptr<MeshLoadInfo>   m_pMeshInfo;
+    std::vector<MeshMaterialEvent>  m_vMaterialEvents;
+    std::vector<MeshFrameInfo>      m_vChildren;
+};
+
+
+
+// Reads the whole file once and parses it from memory. nullptr if missing or malformed
+std::shared_ptr<const MeshFrameInfo> ParseMeshFile(const char* pstrFileName);
@@ -3,128 +3,133 @@
 #include "GameObject.h"
 #include "Mesh.h"
 #include "Scene.h" // Include Scene.h
+#include "WorkerPool.h"
+#include <algorithm>
+#include <unordered_map>
 
-MeshLoadInfo::~MeshLoadInfo()
+namespace
 {
-	if (m_pxmf3Positions) delete[] m_pxmf3Positions;
-	if (m_pxmf4Colors) delete[] m_pxmf4Colors;
-	if (m_pxmf3Normals) delete[] m_pxmf3Normals;
-	if (m_pxmf2TextureCoords0) delete[] m_pxmf2TextureCoords0;
-    if (m_pxmn4BoneIndices) delete[] m_pxmn4BoneIndices;
-    if (m_pxmf4BoneWeights) delete[] m_pxmf4BoneWeights;
+	size_t EstimateParsedBytes(const MeshFrameInfo& frameInfo)
+	{
+		size_t nBytes = sizeof(MeshFrameInfo) + frameInfo.m_vMaterialEvents.capacity() * sizeof(MeshMaterialEvent);
+		if (const MeshLoadInfo* pMeshInfo = frameInfo.m_pMeshInfo.get())
+		{
+			nBytes += sizeof(MeshLoadInfo)
+				+ pMeshInfo->m_vPositions.capacity() * sizeof(XMFLOAT3)
+				+ pMeshInfo->m_vColors.capacity() * sizeof(XMFLOAT4)
+				+ pMeshInfo->m_vNormals.capacity() * sizeof(XMFLOAT3)
+				+ pMeshInfo->m_vTextureCoords0.capacity() * sizeof(XMFLOAT2)
+				+ pMeshInfo->m_vBoneIndices.capacity() * sizeof(XMINT4)
+				+ pMeshInfo->m_vBoneWeights.capacity() * sizeof(XMFLOAT4)
+				+ pMeshInfo->m_vBoneNames.capacity() * sizeof(std::string)
+				+ pMeshInfo->m_vBindPoses.capacity() * sizeof(XMFLOAT4X4)
+				+ pMeshInfo->m_vIndices.capacity() * sizeof(UINT)
+				+ pMeshInfo->m_vSubSetIndexCounts.capacity() * sizeof(int)
+				+ pMeshInfo->m_vSubSetIndexStarts.capacity() * sizeof(UINT)
+				+ pMeshInfo->m_vSubSetIndices.capacity() * sizeof(UINT);
+		}
+		for (const MeshFrameInfo& childInfo : frameInfo.m_vChildren) nBytes += EstimateParsedBytes(childInfo);
+		return nBytes;
+	}
 
-	if (m_pnIndices) delete[] m_pnIndices;
-	
-	if (m_pnSubSetIndices) delete[] m_pnSubSetIndices;
+	// Parsed files, shared by every GameObject built from the same path. Only successful parses are kept;
+	// GPU meshes copy what they need, so entries past the budget are dropped least recently used first
+	struct ParsedMeshEntry
+	{
+		std::shared_ptr<const MeshFrameInfo>	m_pRoot;
+		size_t									m_nBytes = 0;
+		uint64_t								m_nLastUse = 0;
+	};
+	std::unordered_map<std::string, ParsedMeshEntry> s_parsedMeshCache;
+	size_t s_nParsedMeshBytes = 0;
+	size_t s_nParsedMeshBudget = 16ull * 1024 * 1024;
+	uint64_t s_nParsedMeshClock = 0;
+
+	void PublishParsed(const std::string& strFileName, std::shared_ptr<const MeshFrameInfo> pRoot)
+	{
+		ParsedMeshEntry& entry = s_parsedMeshCache[strFileName];
+		s_nParsedMeshBytes -= entry.m_nBytes;
+		entry.m_nBytes = EstimateParsedBytes(*pRoot);
+		entry.m_pRoot = std::move(pRoot);
+		entry.m_nLastUse = ++s_nParsedMeshClock;
+		s_nParsedMeshBytes += entry.m_nBytes;
+	}
 
-	for (int i = 0; i < m_nSubMeshes; i++) if (m_ppnSubSetIndices[i]) delete[] m_ppnSubSetIndices[i];
-	if (m_ppnSubSetIndices) delete[] m_ppnSubSetIndices;
+	void TrimParsedMeshCache()
+	{
+		while (s_nParsedMeshBytes > s_nParsedMeshBudget && !s_parsedMeshCache.empty())
+		{
+			auto itOldest = s_parsedMeshCache.begin();
+			for (auto it = s_parsedMeshCache.begin(); it != s_parsedMeshCache.end(); ++it)
+			{
+				if (it->second.m_nLastUse < itOldest->second.m_nLastUse) itOldest = it;
+			}
+			s_nParsedMeshBytes -= itOldest->second.m_nBytes;
+			s_parsedMeshCache.erase(itOldest);
+		}
+	}
 }
 
-int ReadIntegerFromFile(FILE* pInFile)
+void MeshLoader::PreloadFiles(const std::vector<std::string>& vFileNames)
 {
-	int nValue = 0;
-	UINT nReads = (UINT)::fread(&nValue, sizeof(int), 1, pInFile);
+	std::vector<std::string> vPending;
+	for (const std::string& strFileName : vFileNames)
+	{
+		if (s_parsedMeshCache.count(strFileName)) continue;
+		if (std::find(vPending.begin(), vPending.end(), strFileName) != vPending.end()) continue;
+		vPending.push_back(strFileName);
+	}
+	if (vPending.empty()) return;
 
-	wchar_t buffer[128];
-	swprintf_s(buffer, 128, L"  Read Integer: %d\n", nValue);
-	OutputDebugString(buffer);
+	// Each file parses independently; results are published to the cache here on the calling thread
+	std::vector<std::shared_ptr<const MeshFrameInfo>> vParsed(vPending.size());
+	WorkerPool::Get().ParallelFor((int)vPending.size(), 1, [&](int begin, int end)
+	{
+		for (int i = begin; i < end; i++) vParsed[i] = ParseFile(vPending[i].c_str());
+	});
 
-	return(nValue);
+	for (size_t i = 0; i < vPending.size(); i++)
+	{
+		if (vParsed[i]) PublishParsed(vPending[i], std::move(vParsed[i]));
+	}
+	TrimParsedMeshCache();
 }
 
-float ReadFloatFromFile(FILE* pInFile)
+void MeshLoader::SetParsedCacheBudget(size_t nBytes)
 {
-	float fValue = 0;
-	UINT nReads = (UINT)::fread(&fValue, sizeof(float), 1, pInFile);
-	return(fValue);
+	s_nParsedMeshBudget = nBytes;
+	TrimParsedMeshCache();
 }
 
-BYTE ReadStringFromFile(FILE* pInFile, char* pstrToken, int nBufferSize)
+size_t MeshLoader::GetParsedCacheBytes()
 {
-	if (!pInFile) return 0;
-
-	// Read 7-bit encoded integer for string length (compatible with C# BinaryWriter)
-	int nStrLength = 0;
-	int shift = 0;
-	BYTE byteRead = 0;
-	do {
-		if (fread(&byteRead, sizeof(BYTE), 1, pInFile) != 1) return 0;
-		nStrLength |= (byteRead & 0x7F) << shift;
-		shift += 7;
-	} while (byteRead & 0x80);
-
-	if (nStrLength >= nBufferSize)
-	{
-		// String is too long for buffer, skip it
-		fseek(pInFile, nStrLength, SEEK_CUR);
-		return 0; // Or return nStrLength but indicate truncation? For now return 0 to indicate error/skip.
-	}
-
-	UINT nReads = (UINT)::fread(pstrToken, sizeof(char), nStrLength, pInFile);
-	pstrToken[nStrLength] = '\0';
-
-	return (BYTE)nStrLength;
+	return s_nParsedMeshBytes;
 }
 
-void MeshLoader::LoadMaterialsInfoFromFile(ID3D12Device* pd3dDevice, ID3D12GraphicsCommandList* pd3dCommandList, FILE* pInFile, GameObject* pGameObject, Scene* pScene, const std::string& strMeshDir)
+void MeshLoader::ApplyMaterials(ID3D12Device* pd3dDevice, ID3D12GraphicsCommandList* pd3dCommandList, const MeshFrameInfo& frameInfo, GameObject* pGameObject, Scene* pScene, const std::string& strMeshDir)
 {
-	char pstrToken[64] = { '\0' };
-	int nMaterials = ReadIntegerFromFile(pInFile);
-
 	MATERIAL xmf4Material;
 	ZeroMemory(&xmf4Material, sizeof(MATERIAL));
 
-	for (; ; )
+	for (const MeshMaterialEvent& event : frameInfo.m_vMaterialEvents)
 	{
-		if (ReadStringFromFile(pInFile, pstrToken, 64) == 0) break;
-		if (!strcmp(pstrToken, "</Materials>")) break;
-
-		if (!strcmp(pstrToken, "<Material>:"))
+		if (!event.m_bAlbedoMap)
 		{
-			int nMaterial = ReadIntegerFromFile(pInFile);
+			xmf4Material.m_cDiffuse = event.m_xmf4AlbedoColor;
+			pGameObject->SetMaterial(xmf4Material);
 		}
-		else if (!strcmp(pstrToken, "<AlbedoColor>:"))
+		else if (pScene)
 		{
-			fread(&xmf4Material.m_cDiffuse, sizeof(float), 4, pInFile);
-			if (pGameObject) pGameObject->SetMaterial(xmf4Material);
-		}
-		else if (!strcmp(pstrToken, "<AlbedoMap>:"))
-		{
-			char pstrTextureName[64] = { 0 };
-			ReadStringFromFile(pInFile, pstrTextureName, 64);
-			if (pGameObject && pScene)
-			{
-				// Build full path: {meshDir}/Textures/{filename}
-				std::string fullTexPath = strMeshDir + "Textures/" + pstrTextureName;
-				pGameObject->SetTextureName(fullTexPath.c_str());
+			// Build full path: {meshDir}/Textures/{filename}
+			std::string fullTexPath = strMeshDir + "Textures/" + event.m_strAlbedoMap;
+			pGameObject->SetTextureName(fullTexPath.c_str());
 
-				D3D12_CPU_DESCRIPTOR_HANDLE cpuHandle;
-				D3D12_GPU_DESCRIPTOR_HANDLE gpuHandle;
-				pScene->AllocateDescriptor(&cpuHandle, &gpuHandle);
+			D3D12_CPU_DESCRIPTOR_HANDLE cpuHandle;
+			D3D12_GPU_DESCRIPTOR_HANDLE gpuHandle;
+			pScene->AllocateDescriptor(&cpuHandle, &gpuHandle);
 
-				pGameObject->LoadTexture(pd3dDevice, pd3dCommandList, cpuHandle);
-				pGameObject->SetSrvGpuDescriptorHandle(gpuHandle);
-			}
-		}
-		else if (!strcmp(pstrToken, "<EmissiveColor>:"))
-		{
-			XMFLOAT4 emissive;
-			fread(&emissive, sizeof(float), 4, pInFile);
-		}
-		else if (!strcmp(pstrToken, "<SpecularColor>:"))
-		{
-			XMFLOAT4 specular;
-			fread(&specular, sizeof(float), 4, pInFile);
-		}
-		else if (!strcmp(pstrToken, "<Glossiness>:") ||
-				 !strcmp(pstrToken, "<Metallic>:") ||
-				 !strcmp(pstrToken, "<SpecularHighlight>:") ||
-				 !strcmp(pstrToken, "<GlossyReflection>:") ||
-				 !strcmp(pstrToken, "<Smoothness>:"))
-		{
-			float fValue;
-			fread(&fValue, sizeof(float), 1, pInFile);
+			pGameObject->LoadTexture(pd3dDevice, pd3dCommandList, cpuHandle);
+			pGameObject->SetSrvGpuDescriptorHandle(gpuHandle);
 		}
 	}
 }
@@ -133,297 +138,68 @@ void MeshLoader::LoadMaterialsInfoFromFile(ID3D12Device* pd3dDevice, ID3D12Graph
 
 GameObject* MeshLoader::LoadGeometryFromFile(Scene* pScene, ID3D12Device* pd3dDevice, ID3D12GraphicsCommandList* pd3dCommandList, ID3D12RootSignature* pd3dGraphicsRootSignature, const char* pstrFileName)
 {
-	FILE* pInFile = NULL;
-	if (::fopen_s(&pInFile, pstrFileName, "rb") != 0)
+	// Hold our own reference: trimming below may drop the cache entry
+	std::shared_ptr<const MeshFrameInfo> pRoot;
+	auto it = s_parsedMeshCache.find(pstrFileName);
+	if (it != s_parsedMeshCache.end())
+	{
+		it->second.m_nLastUse = ++s_nParsedMeshClock;
+		pRoot = it->second.m_pRoot;
+	}
+	else
 	{
-		return nullptr;
+		pRoot = ParseFile(pstrFileName);
+		if (!pRoot) return nullptr;
+		PublishParsed(pstrFileName, pRoot);
 	}
-	::rewind(pInFile);
 
 	// Extract directory from mesh path (e.g. "Assets/Enemies/Elementals/StormElemental_Bl/")
 	std::string strMeshDir = pstrFileName;
 	size_t lastSlash = strMeshDir.find_last_of("/\\");
 	strMeshDir = (lastSlash != std::string::npos) ? strMeshDir.substr(0, lastSlash + 1) : "";
 
-	GameObject* pGameObject = NULL;
-	char pstrToken[64] = { '\0' };
-
-	for ( ; ; )
-	{
-		if (::ReadStringFromFile(pInFile, pstrToken, 64) == 0) break;
-
-		if (!strcmp(pstrToken, "<Hierarchy>:"))
-		{
-			pGameObject = MeshLoader::LoadFrameHierarchyFromFile(pScene, pd3dDevice, pd3dCommandList, pd3dGraphicsRootSignature, pInFile, strMeshDir);
-		}
-		else if (!strcmp(pstrToken, "</Hierarchy>"))
-		{
-			break;
-		}
-	}
-    fclose(pInFile);
-	return(pGameObject);
+	GameObject* pGameObject = CreateFrameHierarchy(pScene, pd3dDevice, pd3dCommandList, *pRoot, strMeshDir);
+	TrimParsedMeshCache();
+	return pGameObject;
 }
 
-GameObject* MeshLoader::LoadFrameHierarchyFromFile(Scene* pScene, ID3D12Device* pd3dDevice, ID3D12GraphicsCommandList* pd3dCommandList, ID3D12RootSignature* pd3dGraphicsRootSignature, FILE* pInFile, const std::string& strMeshDir)
+GameObject* MeshLoader::CreateFrameHierarchy(Scene* pScene, ID3D12Device* pd3dDevice, ID3D12GraphicsCommandList* pd3dCommandList, const MeshFrameInfo& frameInfo, const std::string& strMeshDir)
 {
-    char pstrToken[64] = { '\0' };
-    UINT nReads = 0;
-    int nFrame = 0;
-    GameObject* pGameObject = nullptr;
-
-    for ( ; ; )
-    {
-        if (::ReadStringFromFile(pInFile, pstrToken, 64) == 0) break;
+    GameObject* pGameObject = pScene->CreateGameObject(pd3dDevice, pd3dCommandList);
+    strcpy_s(pGameObject->m_pstrFrameName, frameInfo.m_pstrFrameName);
 
-        wchar_t buffer[128];
-        swprintf_s(buffer, 128, L"  Read Token: %hs\n", pstrToken);
-        OutputDebugString(buffer);
+    if (frameInfo.m_bHasTransform) pGameObject->SetTransform(frameInfo.m_xmf4x4Transform);
 
-        if (!strcmp(pstrToken, "<Frame>:"))
-        {
-            pGameObject = pScene->CreateGameObject(pd3dDevice, pd3dCommandList);
-            nFrame = ::ReadIntegerFromFile(pInFile);
-            ::ReadStringFromFile(pInFile, pGameObject->m_pstrFrameName, 64);
-        }
-        else if (!strcmp(pstrToken, "<Transform>:"))
-        {
-            XMFLOAT3 xmf3Position, xmf3Rotation, xmf3Scale;
-            XMFLOAT4 xmf4Rotation;
-            nReads = (UINT)::fread(&xmf3Position, sizeof(float), 3, pInFile);
-            nReads = (UINT)::fread(&xmf3Rotation, sizeof(float), 3, pInFile);
-            nReads = (UINT)::fread(&xmf3Scale, sizeof(float), 3, pInFile);
-            nReads = (UINT)::fread(&xmf4Rotation, sizeof(float), 4, pInFile);
-        }
-        else if (!strcmp(pstrToken, "<TransformMatrix>:"))
-        {
-            XMFLOAT4X4 xmf4x4Transform;
-            nReads = (UINT)::fread(&xmf4x4Transform, sizeof(float), 16, pInFile);
-            if (pGameObject) pGameObject->SetTransform(xmf4x4Transform);
-        }
-        else if (!strcmp(pstrToken, "<Mesh>:"))
-        {
-            MeshLoadInfo *pMeshInfo = MeshLoader::LoadMeshInfoFromFile(pInFile);
-            if (pGameObject && pMeshInfo)
-            {
-                Mesh *pMesh = NULL;
-                if (pMeshInfo->m_nType & VERTEXT_BONE_INDEX_WEIGHT)
-                {
-                    char _dbgBuf[512];
-                    sprintf_s(_dbgBuf, "MeshLoader: SkinnedMesh AABB center=(%.2f,%.2f,%.2f) extents=(%.2f,%.2f,%.2f) bones=%d\n",
-                        pMeshInfo->m_xmf3AABBCenter.x, pMeshInfo->m_xmf3AABBCenter.y, pMeshInfo->m_xmf3AABBCenter.z,
-                        pMeshInfo->m_xmf3AABBExtents.x, pMeshInfo->m_xmf3AABBExtents.y, pMeshInfo->m_xmf3AABBExtents.z,
-                        (int)pMeshInfo->m_vBoneNames.size());
-                    OutputDebugStringA(_dbgBuf);
-                    // Print first 5 vertex positions to verify if mesh is upright or flat
-                    if (pMeshInfo->m_pxmf3Positions)
-                    {
-                        int nPrint = min(5, pMeshInfo->m_nVertices);
-                        for (int _vi = 0; _vi < nPrint; ++_vi)
-                        {
-                            sprintf_s(_dbgBuf, "  v[%d]=(%.3f, %.3f, %.3f)\n", _vi,
-                                pMeshInfo->m_pxmf3Positions[_vi].x,
-                                pMeshInfo->m_pxmf3Positions[_vi].y,
-                                pMeshInfo->m_pxmf3Positions[_vi].z);
-                            OutputDebugStringA(_dbgBuf);
-                        }
-                    }
-                    pMesh = new SkinnedMesh(pd3dDevice, pd3dCommandList, pMeshInfo);
-                }
-                else if (pMeshInfo->m_nType & VERTEXT_NORMAL)
-                {
-                    OutputDebugStringA("MeshLoader: Creating MeshIlluminatedFromFile (Static)\n");
-                    pMesh = new MeshIlluminatedFromFile(pd3dDevice, pd3dCommandList, pMeshInfo);
-                }
-                else
-                {
-                    OutputDebugStringA("MeshLoader: Creating MeshFromFile (Basic)\n");
-                    pMesh = new MeshFromFile(pd3dDevice, pd3dCommandList, pMeshInfo);
-                }
-                if (pMesh) pGameObject->SetMesh(pMesh);
-                delete pMeshInfo;
-            }
-        }
-        else if (!strcmp(pstrToken, "<Materials>:"))
+    if (const MeshLoadInfo* pMeshInfo = frameInfo.m_pMeshInfo.get())
+    {
+        Mesh *pMesh = NULL;
+        if (pMeshInfo->m_nType & VERTEXT_BONE_INDEX_WEIGHT)
         {
-            LoadMaterialsInfoFromFile(pd3dDevice, pd3dCommandList, pInFile, pGameObject, pScene, strMeshDir);
+            char _dbgBuf[512];
+            sprintf_s(_dbgBuf, "MeshLoader: SkinnedMesh AABB center=(%.2f,%.2f,%.2f) extents=(%.2f,%.2f,%.2f) bones=%d\n",
+                pMeshInfo->m_xmf3AABBCenter.x, pMeshInfo->m_xmf3AABBCenter.y, pMeshInfo->m_xmf3AABBCenter.z,
+                pMeshInfo->m_xmf3AABBExtents.x, pMeshInfo->m_xmf3AABBExtents.y, pMeshInfo->m_xmf3AABBExtents.z,
+                (int)pMeshInfo->m_vBoneNames.size());
+            OutputDebugStringA(_dbgBuf);
+            pMesh = new SkinnedMesh(pd3dDevice, pd3dCommandList, pMeshInfo);
         }
-        else if (!strcmp(pstrToken, "<Children>:"))
+        else if (pMeshInfo->m_nType & VERTEXT_NORMAL)
         {
-            int nChilds = ::ReadIntegerFromFile(pInFile);
-            if (nChilds > 0)
-            {
-                for (int i = 0; i < nChilds; i++)
-                {
-                    GameObject *pChild = MeshLoader::LoadFrameHierarchyFromFile(pScene, pd3dDevice, pd3dCommandList, pd3dGraphicsRootSignature, pInFile, strMeshDir);
-                    if (pGameObject && pChild)
-                    {
-                        pGameObject->SetChild(pChild);
-                    }
-                }
-            }
+            pMesh = new MeshIlluminatedFromFile(pd3dDevice, pd3dCommandList, pMeshInfo);
         }
-        else if (!strcmp(pstrToken, "</Frame>"))
+        else
         {
-            break;
+            pMesh = new MeshFromFile(pd3dDevice, pd3dCommandList, pMeshInfo);
         }
+        if (pMesh) pGameObject->SetMesh(pMesh);
     }
-    return(pGameObject);
-}
-
-MeshLoadInfo* MeshLoader::LoadMeshInfoFromFile(FILE* pInFile)
-{
-	char pstrToken[64] = { '\0' };
-	UINT nReads = 0;
-	int nPositions = 0, nColors = 0, nNormals = 0, nIndices = 0, nSubMeshes = 0, nSubIndices = 0;
-	MeshLoadInfo *pMeshInfo = new MeshLoadInfo;
-
-	pMeshInfo->m_nVertices = ::ReadIntegerFromFile(pInFile);
-	::ReadStringFromFile(pInFile, pMeshInfo->m_pstrMeshName, 64);
-
-	for ( ; ; )
-	{
-		if (::ReadStringFromFile(pInFile, pstrToken, 64) == 0) break;
-
-		if (!strcmp(pstrToken, "<Bounds>:"))
-		{
-			nReads = (UINT)::fread(&(pMeshInfo->m_xmf3AABBCenter), sizeof(XMFLOAT3), 1, pInFile);
-			nReads = (UINT)::fread(&(pMeshInfo->m_xmf3AABBExtents), sizeof(XMFLOAT3), 1, pInFile);
-		}
-		else if (!strcmp(pstrToken, "<Positions>:"))
-		{
-			nPositions = ::ReadIntegerFromFile(pInFile);
-			if (nPositions > 0)
-			{
-				pMeshInfo->m_nType |= VERTEXT_POSITION;
-				pMeshInfo->m_pxmf3Positions = new XMFLOAT3[nPositions];
-				nReads = (UINT)::fread(pMeshInfo->m_pxmf3Positions, sizeof(XMFLOAT3), nPositions, pInFile);
-			}
-		}
-		else if (!strcmp(pstrToken, "<Colors>:"))
-		{
-			nColors = ::ReadIntegerFromFile(pInFile);
-			if (nColors > 0)
-			{
-				pMeshInfo->m_nType |= VERTEXT_COLOR;
-				pMeshInfo->m_pxmf4Colors = new XMFLOAT4[nColors];
-				nReads = (UINT)::fread(pMeshInfo->m_pxmf4Colors, sizeof(XMFLOAT4), nColors, pInFile);
-			}
-		}
-		else if (!strcmp(pstrToken, "<Normals>:"))
-		{
-			nNormals = ::ReadIntegerFromFile(pInFile);
-			if (nNormals > 0)
-			{
-				pMeshInfo->m_nType |= VERTEXT_NORMAL;
-				pMeshInfo->m_pxmf3Normals = new XMFLOAT3[nNormals];
-				nReads = (UINT)::fread(pMeshInfo->m_pxmf3Normals, sizeof(XMFLOAT3), nNormals, pInFile);
-			}
-		}
-		else if (!strcmp(pstrToken, "<TexCoords>:"))
-		{
-			int nTextureCoords = ::ReadIntegerFromFile(pInFile);
-			if (nTextureCoords > 0)
-			{
-				pMeshInfo->m_nType |= VERTEXT_TEXTURE_COORD0;
-				pMeshInfo->m_pxmf2TextureCoords0 = new XMFLOAT2[nTextureCoords];
-				for (int i = 0; i < nTextureCoords; i++)
-				{
-					::fread(&pMeshInfo->m_pxmf2TextureCoords0[i], sizeof(XMFLOAT2), 1, pInFile);
-					pMeshInfo->m_pxmf2TextureCoords0[i].y = 1.0f - pMeshInfo->m_pxmf2TextureCoords0[i].y;
-				}
-			}
-		}
-		else if (!strcmp(pstrToken, "<BoneWeights>:"))
-		{
-			int nBoneWeights = ::ReadIntegerFromFile(pInFile);
-			if (nBoneWeights > 0)
-			{
-				pMeshInfo->m_nType |= 0x10; // VERTEXT_BONE_INDEX_WEIGHT
-				pMeshInfo->m_pxmn4BoneIndices = new XMINT4[nBoneWeights];
-				pMeshInfo->m_pxmf4BoneWeights = new XMFLOAT4[nBoneWeights];
-
-				for (int i = 0; i < nBoneWeights; i++)
-				{
-					int idx; float w;
-					fread(&idx, sizeof(int), 1, pInFile); fread(&w, sizeof(float), 1, pInFile);
-					pMeshInfo->m_pxmn4BoneIndices[i].x = idx; pMeshInfo->m_pxmf4BoneWeights[i].x = w;
 
-					fread(&idx, sizeof(int), 1, pInFile); fread(&w, sizeof(float), 1, pInFile);
-					pMeshInfo->m_pxmn4BoneIndices[i].y = idx; pMeshInfo->m_pxmf4BoneWeights[i].y = w;
+    ApplyMaterials(pd3dDevice, pd3dCommandList, frameInfo, pGameObject, pScene, strMeshDir);
 
-					fread(&idx, sizeof(int), 1, pInFile); fread(&w, sizeof(float), 1, pInFile);
-					pMeshInfo->m_pxmn4BoneIndices[i].z = idx; pMeshInfo->m_pxmf4BoneWeights[i].z = w;
-
-					fread(&idx, sizeof(int), 1, pInFile); fread(&w, sizeof(float), 1, pInFile);
-					pMeshInfo->m_pxmn4BoneIndices[i].w = idx; pMeshInfo->m_pxmf4BoneWeights[i].w = w;
-				}
-			}
-		}
-		else if (!strcmp(pstrToken, "<BindPoses>:"))
-		{
-			int nBindPoses = ::ReadIntegerFromFile(pInFile);
-			if (nBindPoses > 0)
-			{
-				for (int i = 0; i < nBindPoses; i++)
-				{
-					XMFLOAT4X4 mat;
-					fread(&mat, sizeof(float), 16, pInFile);
-					pMeshInfo->m_vBindPoses.push_back(mat);
-				}
-			}
-		}
-		else if (!strcmp(pstrToken, "<BoneNames>:"))
-		{
-			int nBoneNames = ::ReadIntegerFromFile(pInFile);
-			if (nBoneNames > 0)
-			{
-				char pstrBoneName[64] = { 0 };
-				for (int i = 0; i < nBoneNames; i++)
-				{
-					::ReadStringFromFile(pInFile, pstrBoneName, 64);
-					pMeshInfo->m_vBoneNames.push_back(pstrBoneName);
-				}
-			}
-		}
-		else if (!strcmp(pstrToken, "<Indices>:"))
-		{
-			nIndices = ::ReadIntegerFromFile(pInFile);
-			if (nIndices > 0)
-			{
-				pMeshInfo->m_pnIndices = new UINT[nIndices];
-				nReads = (UINT)::fread(pMeshInfo->m_pnIndices, sizeof(int), nIndices, pInFile);
-			}
-		}
-		else if (!strcmp(pstrToken, "<SubMeshes>:"))
-		{
-			pMeshInfo->m_nSubMeshes = ::ReadIntegerFromFile(pInFile);
-			if (pMeshInfo->m_nSubMeshes > 0)
-			{
-				pMeshInfo->m_pnSubSetIndices = new int[pMeshInfo->m_nSubMeshes];
-				pMeshInfo->m_ppnSubSetIndices = new UINT*[pMeshInfo->m_nSubMeshes];
-				for (int i = 0; i < pMeshInfo->m_nSubMeshes; i++)
-				{
-					pMeshInfo->m_ppnSubSetIndices[i] = NULL;
-					::ReadStringFromFile(pInFile, pstrToken, 64);
-					if (!strcmp(pstrToken, "<SubMesh>:"))
-					{
-						int nIndex = ::ReadIntegerFromFile(pInFile);
-						pMeshInfo->m_pnSubSetIndices[i] = ::ReadIntegerFromFile(pInFile);
-						if (pMeshInfo->m_pnSubSetIndices[i] > 0)
-						{
-							pMeshInfo->m_ppnSubSetIndices[i] = new UINT[pMeshInfo->m_pnSubSetIndices[i]];
-							nReads = (UINT)::fread(pMeshInfo->m_ppnSubSetIndices[i], sizeof(UINT), pMeshInfo->m_pnSubSetIndices[i], pInFile);
-						}
-
-					}
-				}
-			}
-		}
-		else if (!strcmp(pstrToken, "</Mesh>"))
-		{
-			break;
-		}
-	}
-	return(pMeshInfo);
-}
\ No newline at end of file
+    for (const MeshFrameInfo& childInfo : frameInfo.m_vChildren)
+    {
+        GameObject *pChild = MeshLoader::CreateFrameHierarchy(pScene, pd3dDevice, pd3dCommandList, childInfo, strMeshDir);
+        if (pChild) pGameObject->SetChild(pChild);
+    }
+    return(pGameObject);
+}
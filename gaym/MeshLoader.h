@@ -1,4 +1,3 @@
-
 #pragma once
 
 
@@ -7,69 +6,13 @@
 
 #include "Mesh.h"
 
+#include "MeshFileParser.h"
 
+#include <memory>
 
-class Scene; // Forward declaration
-
-
-
-class MeshLoadInfo
-
-{
-
-public:
-
-    MeshLoadInfo() { }
-
-    ~MeshLoadInfo();
-
-
-
-public:
-
-    char                            m_pstrMeshName[256] = { 0 };
-
-
-
-    UINT                            m_nType = 0x00;
-
-
-
-    XMFLOAT3                        m_xmf3AABBCenter = XMFLOAT3(0.0f, 0.0f, 0.0f);
-
-    XMFLOAT3                        m_xmf3AABBExtents = XMFLOAT3(0.0f, 0.0f, 0.0f);
 
 
-
-    int                             m_nVertices = 0;
-
-    XMFLOAT3* m_pxmf3Positions = NULL;
-
-    XMFLOAT4* m_pxmf4Colors = NULL;
-
-    XMFLOAT3* m_pxmf3Normals = NULL;
-
-    XMFLOAT2* m_pxmf2TextureCoords0 = NULL;
-
-    // Skinning Data
-    XMINT4* m_pxmn4BoneIndices = NULL;
-    XMFLOAT4* m_pxmf4BoneWeights = NULL;
-    std::vector<std::string> m_vBoneNames;
-    std::vector<XMFLOAT4X4> m_vBindPoses;
-
-    int                             m_nIndices = 0;
-
-    UINT* m_pnIndices = NULL;
-
-
-
-    int                             m_nSubMeshes = 0;
-
-    int* m_pnSubSetIndices = NULL;
-
-    UINT** m_ppnSubSetIndices = NULL;
-
-};
+class Scene; // Forward declaration
 
 
 
@@ -81,22 +24,23 @@ public:
 
     static GameObject* LoadGeometryFromFile(Scene* pScene, ID3D12Device* pd3dDevice, ID3D12GraphicsCommandList* pd3dCommandList, ID3D12RootSignature* pd3dGraphicsRootSignature, const char* pstrFileName);
 
+    // Parse files that are not cached yet on the WorkerPool, so later LoadGeometryFromFile calls only build GameObjects
+    static void PreloadFiles(const std::vector<std::string>& vFileNames);
 
+    // Reads the whole file once and parses it from memory (MeshFileParser.cpp, no device needed). nullptr if missing or malformed
+    static std::shared_ptr<const MeshFrameInfo> ParseFile(const char* pstrFileName) { return ParseMeshFile(pstrFileName); }
 
-private:
-
+    // Parsed files are kept up to this many bytes (least recently used dropped first). Default 16MB
+    static void SetParsedCacheBudget(size_t nBytes);
 
+    static size_t GetParsedCacheBytes();
 
-    static GameObject* LoadFrameHierarchyFromFile(Scene* pScene, ID3D12Device* pd3dDevice, ID3D12GraphicsCommandList* pd3dCommandList, ID3D12RootSignature* pd3dGraphicsRootSignature, FILE* pInFile, const std::string& strMeshDir);
 
 
+private:
 
-    static MeshLoadInfo* LoadMeshInfoFromFile(FILE* pInFile);
-
-
+    static GameObject* CreateFrameHierarchy(Scene* pScene, ID3D12Device* pd3dDevice, ID3D12GraphicsCommandList* pd3dCommandList, const MeshFrameInfo& frameInfo, const std::string& strMeshDir);
 
-    static void LoadMaterialsInfoFromFile(ID3D12Device* pd3dDevice, ID3D12GraphicsCommandList* pd3dCommandList, FILE* pInFile, GameObject* pGameObject, Scene* pScene, const std::string& strMeshDir);
+    static void ApplyMaterials(ID3D12Device* pd3dDevice, ID3D12GraphicsCommandList* pd3dCommandList, const MeshFrameInfo& frameInfo, GameObject* pGameObject, Scene* pScene, const std::string& strMeshDir);
 
 };
-
-
@@ -0,0 +1,118 @@
+#include "NetworkCommandQueue.h"
+#include <algorithm>
+
+// =============================================================================
+// NetworkNameTable
+// =============================================================================
+
+uint32 NetworkNameTable::Intern(const std::string& name)
+{
+    if (name.empty())
+        return 0;
+
+    auto it = m_mapIndex.find(name);
+    if (it != m_mapIndex.end())
+        return it->second;
+
+    const uint32 index = m_nCount.load(std::memory_order_relaxed);
+    if (index >= CAPACITY)
+        return 0;
+
+    // 슬롯을 다 쓴 뒤 count 를 올려야 소비자가 완성된 문자열만 본다
+    m_Names[index] = name;
+    m_nCount.store(index + 1, std::memory_order_release);
+    m_mapIndex.emplace(name, index);
+    return index;
+}
+
+const std::string& NetworkNameTable::Get(uint32 index) const
+{
+    if (index >= m_nCount.load(std::memory_order_acquire))
+        return m_Names[0];
+    return m_Names[index];
+}
+
+void NetworkNameTable::Clear()
+{
+    const uint32 count = m_nCount.load(std::memory_order_relaxed);
+    for (uint32 i = 1; i < count; ++i)
+        m_Names[i].clear();
+    m_nCount.store(1, std::memory_order_relaxed);
+    m_mapIndex.clear();
+}
+
+// =============================================================================
+// NetworkCommandQueue
+// =============================================================================
+
+void NetworkCommandQueue::PushOverflow(const NetworkCommandData& cmd)
+{
+    if (m_ePolicy.load(std::memory_order_relaxed) == NetworkOverflowPolicy::DropMoves &&
+        (cmd.type == NetworkCommand::Move || cmd.type == NetworkCommand::MonsterMove))
+    {
+        m_nDropped.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(m_spillMutex);
+    m_vSpill.push_back(cmd);
+    m_bSpilling.store(true, std::memory_order_release);
+    m_nPushed.fetch_add(1, std::memory_order_relaxed);
+    m_nSpilled.fetch_add(1, std::memory_order_relaxed);
+}
+
+void NetworkCommandQueue::DrainRing(std::vector<NetworkCommandData>& out)
+{
+    const uint32 write = m_nWritePos.load(std::memory_order_acquire);
+    const uint32 read = m_nReadPos.load(std::memory_order_relaxed);
+    if (write == read)
+        return;
+
+    // 링 끝을 넘어가면 두 번에 나눠 복사
+    const uint32 count = write - read;
+    const uint32 first = (std::min)(count, CAPACITY - (read & MASK));
+    out.insert(out.end(), m_Ring + (read & MASK), m_Ring + (read & MASK) + first);
+    out.insert(out.end(), m_Ring, m_Ring + (count - first));
+
+    m_nReadPos.store(write, std::memory_order_release);
+}
+
+void NetworkCommandQueue::Drain(std::vector<NetworkCommandData>& out)
+{
+    const size_t before = out.size();
+
+    DrainRing(out);
+
+    if (m_bSpilling.load(std::memory_order_acquire))
+    {
+        // 생산자는 보조 큐를 쓰기 시작한 뒤로 링에 쓰지 않는다.
+        // 위 DrainRing 이후 보조 큐 전환 전에 링에 들어온 명령을 먼저 꺼내야 순서가 맞다
+        std::lock_guard<std::mutex> lock(m_spillMutex);
+        DrainRing(out);
+        out.insert(out.end(), m_vSpill.begin(), m_vSpill.end());
+        m_vSpill.clear();
+        m_bSpilling.store(false, std::memory_order_release);
+    }
+
+    m_nMaxDrain = (std::max)(m_nMaxDrain, static_cast<uint32>(out.size() - before));
+}
+
+void NetworkCommandQueue::Clear()
+{
+    m_nWritePos.store(0, std::memory_order_relaxed);
+    m_nReadPos.store(0, std::memory_order_relaxed);
+
+    std::lock_guard<std::mutex> lock(m_spillMutex);
+    m_vSpill.clear();
+    m_bSpilling.store(false, std::memory_order_relaxed);
+}
+
+NetworkQueueStats NetworkCommandQueue::GetStats() const
+{
+    NetworkQueueStats stats;
+    stats.pushed = m_nPushed.load(std::memory_order_relaxed);
+    stats.spilled = m_nSpilled.load(std::memory_order_relaxed);
+    stats.dropped = m_nDropped.load(std::memory_order_relaxed);
+    stats.maxDrain = m_nMaxDrain;
+    return stats;
+}
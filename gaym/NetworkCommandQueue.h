@@ -0,0 +1,163 @@
+#pragma once
+#include "ServerCore/Types.h"
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+// ============================================================================
+// NetworkCommandQueue
+// 네트워크(IOCP Dispatch) 스레드 → 메인 스레드 명령 전달.
+//
+//  - 명령은 48바이트 POD (타입 태그 + union). 문자열은 NetworkNameTable 인덱스로만 들고 다님
+//  - 고정 크기 SPSC 링 — 평소 Push/Drain 은 잠금도 할당도 없다
+//  - 링이 가득 차면 정책에 따라 보조 큐(mutex)로 넘기거나 이동 명령을 버린다.
+//    보조 큐가 비어 있지 않은 동안은 순서를 지키기 위해 모든 명령이 보조 큐로 간다
+//
+// 생산자는 Dispatch 스레드 하나, 소비자는 NetworkManager::Update 하나라고 가정한다.
+// ============================================================================
+
+// 패킷 처리를 위한 명령 타입
+enum class NetworkCommand : uint8
+{
+    Spawn,
+    Despawn,
+    Move,
+    Skill,
+    SetLocalPlayerId,
+    RoomTransition,
+    MonsterSpawn,
+    MonsterMove,
+    MonsterDespawn,
+    MonsterAttack,
+    PlayerDamage,
+    MonsterDamage,
+    RoomCleared
+};
+
+// 네트워크 명령 구조체 — type 에 맞는 union 멤버만 유효
+struct NetworkCommandData
+{
+    struct PlayerSpawn   { uint64 playerId; uint32 nameIndex; int32 playerType; float x, y, z; };
+    struct PlayerId      { uint64 playerId; };
+    struct PlayerMove    { uint64 playerId; float x, y, z; float dirX, dirY, dirZ; };
+    struct PlayerSkill   { uint64 playerId; int32 skillType; float x, y, z; float dirX, dirY, dirZ; };
+    struct Room          { uint32 stageIndex; uint32 roomIndex; bool isBossRoom; };
+    struct MonsterSpawn  { uint64 monsterId; uint32 monsterType; float x, y, z, yaw, hp; bool isBoss; };
+    struct MonsterMove   { uint64 monsterId; float x, y, z, yaw; };
+    struct MonsterId     { uint64 monsterId; };
+    struct MonsterAttack { uint64 monsterId; uint64 targetPlayerId; uint32 attackType; float x, y, z, yaw, windupSec; };
+    struct PlayerDamage  { uint64 playerId; uint64 attackerMonsterId; float damage, currentHp; bool isDead; };
+    struct MonsterDamage { uint64 monsterId; uint64 attackerPlayerId; float damage, currentHp; int32 skillType; bool isDead; };
+
+    NetworkCommand type;
+    union
+    {
+        PlayerSpawn   spawn;            // Spawn
+        PlayerId      player;           // Despawn, SetLocalPlayerId
+        PlayerMove    move;             // Move
+        PlayerSkill   skill;            // Skill
+        Room          room;             // RoomTransition, RoomCleared
+        MonsterSpawn  monsterSpawn;     // MonsterSpawn
+        MonsterMove   monsterMove;      // MonsterMove
+        MonsterId     monster;          // MonsterDespawn
+        MonsterAttack monsterAttack;    // MonsterAttack
+        PlayerDamage  playerDamage;     // PlayerDamage
+        MonsterDamage monsterDamage;    // MonsterDamage
+    };
+};
+
+static_assert(std::is_trivially_copyable_v<NetworkCommandData>, "NetworkCommandData must stay POD");
+static_assert(sizeof(NetworkCommandData) <= 48, "NetworkCommandData grew past 48 bytes");
+
+// ============================================================================
+// NetworkNameTable
+// 플레이어 이름 인턴 테이블. 같은 이름은 한 번만 복사하고 명령에는 인덱스만 넣는다.
+// Intern 은 생산자 스레드 전용, Get 은 발행된 인덱스에 한해 어느 스레드든 읽을 수 있다
+// (슬롯은 발행 후 바뀌지 않음). 가득 차면 0 (빈 문자열).
+// ============================================================================
+class NetworkNameTable
+{
+public:
+    static constexpr uint32 CAPACITY = 1024;
+
+    uint32             Intern(const std::string& name);
+    const std::string& Get(uint32 index) const;
+
+    // 양쪽 스레드가 모두 멈춘 뒤에만 (Shutdown)
+    void Clear();
+
+private:
+    std::string                             m_Names[CAPACITY];  // 0번은 빈 문자열
+    std::atomic<uint32>                     m_nCount = 1;
+    std::unordered_map<std::string, uint32> m_mapIndex;         // 생산자 스레드 전용
+};
+
+// 링이 가득 찼을 때
+enum class NetworkOverflowPolicy : uint8
+{
+    Spill,      // 보조 큐로 넘김 (손실 없음)
+    DropMoves,  // Move/MonsterMove 는 버림 (곧 최신 위치가 다시 옴), 나머지는 보조 큐
+};
+
+struct NetworkQueueStats
+{
+    uint64 pushed = 0;
+    uint64 spilled = 0;     // 보조 큐로 간 명령
+    uint64 dropped = 0;     // DropMoves 로 버린 명령
+    uint32 maxDrain = 0;    // 한 번의 Drain 에서 꺼낸 최대 개수
+};
+
+class NetworkCommandQueue
+{
+public:
+    static constexpr uint32 CAPACITY = 16384;   // 2의 거듭제곱 — 프레임당 만 개 버스트를 링 안에서 소화
+    static constexpr uint32 MASK = CAPACITY - 1;
+
+    void SetOverflowPolicy(NetworkOverflowPolicy ePolicy) { m_ePolicy.store(ePolicy, std::memory_order_relaxed); }
+
+    // 생산자 (Dispatch 스레드)
+    void Push(const NetworkCommandData& cmd)
+    {
+        if (!m_bSpilling.load(std::memory_order_acquire))
+        {
+            const uint32 write = m_nWritePos.load(std::memory_order_relaxed);
+            if (write - m_nReadPos.load(std::memory_order_acquire) < CAPACITY)
+            {
+                m_Ring[write & MASK] = cmd;
+                m_nWritePos.store(write + 1, std::memory_order_release);
+                m_nPushed.fetch_add(1, std::memory_order_relaxed);
+                return;
+            }
+        }
+        PushOverflow(cmd);
+    }
+
+    // 소비자 (메인 스레드) — 쌓인 명령을 도착 순서대로 out 뒤에 붙인다
+    void Drain(std::vector<NetworkCommandData>& out);
+
+    // 양쪽 스레드가 모두 멈춘 뒤에만 (Shutdown)
+    void Clear();
+
+    NetworkQueueStats GetStats() const;
+
+private:
+    void PushOverflow(const NetworkCommandData& cmd);
+    void DrainRing(std::vector<NetworkCommandData>& out);
+
+private:
+    alignas(64) std::atomic<uint32> m_nWritePos = 0;   // 생산자만 씀
+    alignas(64) std::atomic<uint32> m_nReadPos = 0;    // 소비자만 씀
+    alignas(64) NetworkCommandData  m_Ring[CAPACITY];
+
+    // 보조 큐 — m_bSpilling 이 true 인 동안만 잠근다
+    alignas(64) std::atomic<bool>   m_bSpilling = false;
+    std::mutex                      m_spillMutex;
+    std::vector<NetworkCommandData> m_vSpill;
+
+    std::atomic<NetworkOverflowPolicy> m_ePolicy = NetworkOverflowPolicy::Spill;
+    std::atomic<uint64>                m_nPushed = 0;
+    std::atomic<uint64>                m_nSpilled = 0;
+    std::atomic<uint64>                m_nDropped = 0;
+    uint32                             m_nMaxDrain = 0;    // 소비자 전용
+};
@@ -86,9 +86,6 @@ NetworkManager::~NetworkManager()
 
 bool NetworkManager::Initialize()
 {
-    // ServerPacketHandler 초기화
-    ServerPacketHandler::Init();
-
     OutputDebugString(L"[Network] NetworkManager initialized\n");
     return true;
 }
@@ -119,14 +116,22 @@ void NetworkManager::Shutdown()
     // 원격 플레이어 맵 클리어 (GameObject는 Scene이 관리하므로 여기서 delete 하지 않음)
     m_mapRemotePlayers.clear();
 
-    // 큐 정리
-    {
-        std::lock_guard<std::mutex> lock(m_queueMutex);
-        m_vCommandQueue.clear();
-    }
+    // 큐 정리 (Dispatch 스레드가 조인된 뒤라 안전)
+    m_CommandQueue.Clear();
+    m_vCommands.clear();
     m_vPendingSpawns.clear();
+    m_NameTable.Clear();
     m_nLocalPlayerId.store(0);
 
+    // 스냅샷 baseline 정리 (재접속하면 서버가 full 스냅샷부터 다시 보냄)
+    m_SnapshotHistory.Clear();
+    m_bSnapshotResyncPending = false;
+    {
+        std::lock_guard<std::mutex> lock(m_snapshotMutex);
+        m_LatestSnapshot.entries.clear();
+        m_bLatestSnapshotDirty = false;
+    }
+
     OutputDebugString(L"[Network] NetworkManager shutdown complete\n");
 }
 
@@ -196,11 +201,19 @@ void NetworkManager::Update(Scene* pScene, ID3D12Device* pDevice, ID3D12Graphics
     if (!pScene || !pDevice || !pCommandList)
         return;
 
-    // 큐에 쌓인 명령들을 메인 스레드에서 처리
-    std::vector<NetworkCommandData> commands;
+    // 큐에 쌓인 명령들을 메인 스레드에서 처리 (링에서 꺼내기만 하고 네트워크 스레드를 막지 않음)
+    m_vCommands.clear();
+    m_CommandQueue.Drain(m_vCommands);
+    const std::vector<NetworkCommandData>& commands = m_vCommands;
+
+    const NetworkQueueStats queueStats = m_CommandQueue.GetStats();
+    if (queueStats.spilled != m_LastQueueStats.spilled || queueStats.dropped != m_LastQueueStats.dropped)
     {
-        std::lock_guard<std::mutex> lock(m_queueMutex);
-        commands.swap(m_vCommandQueue);
+        char buf[192];
+        sprintf_s(buf, "[Network] Command ring overflow: spilled=%llu dropped=%llu maxDrain=%u",
+                  queueStats.spilled, queueStats.dropped, queueStats.maxDrain);
+        WriteNetworkLog(buf);
+        m_LastQueueStats = queueStats;
     }
 
     // 1차: SetLocalPlayerId 명령을 먼저 처리 (Spawn보다 먼저 ID가 설정되어야 함)
@@ -209,10 +222,10 @@ void NetworkManager::Update(Scene* pScene, ID3D12Device* pDevice, ID3D12Graphics
     {
         if (cmd.type == NetworkCommand::SetLocalPlayerId)
         {
-            m_nLocalPlayerId.store(cmd.playerId);
+            m_nLocalPlayerId.store(cmd.player.playerId);
             localIdWasSet = true;
             wchar_t buf[128];
-            swprintf_s(buf, L"[Network] Local player ID set to: %llu\n", cmd.playerId);
+            swprintf_s(buf, L"[Network] Local player ID set to: %llu\n", cmd.player.playerId);
             OutputDebugString(buf);
         }
     }
@@ -224,8 +237,8 @@ void NetworkManager::Update(Scene* pScene, ID3D12Device* pDevice, ID3D12Graphics
         for (const auto& pending : m_vPendingSpawns)
         {
             ProcessSpawnPlayer(pScene, pDevice, pCommandList,
-                             pending.playerId, pending.name, pending.playerType,
-                             pending.x, pending.y, pending.z);
+                             pending.spawn.playerId, m_NameTable.Get(pending.spawn.nameIndex), pending.spawn.playerType,
+                             pending.spawn.x, pending.spawn.y, pending.spawn.z);
         }
         m_vPendingSpawns.clear();
     }
@@ -240,27 +253,29 @@ void NetworkManager::Update(Scene* pScene, ID3D12Device* pDevice, ID3D12Graphics
             if (m_nLocalPlayerId.load() == 0)
             {
                 wchar_t buf[128];
-                swprintf_s(buf, L"[Network] Spawn deferred (LocalPlayerId not set): PlayerId=%llu\n", cmd.playerId);
+                swprintf_s(buf, L"[Network] Spawn deferred (LocalPlayerId not set): PlayerId=%llu\n", cmd.spawn.playerId);
                 OutputDebugString(buf);
                 m_vPendingSpawns.push_back(cmd);
             }
             else
             {
                 ProcessSpawnPlayer(pScene, pDevice, pCommandList,
-                                 cmd.playerId, cmd.name, cmd.playerType, cmd.x, cmd.y, cmd.z);
+                                 cmd.spawn.playerId, m_NameTable.Get(cmd.spawn.nameIndex), cmd.spawn.playerType,
+                                 cmd.spawn.x, cmd.spawn.y, cmd.spawn.z);
             }
             break;
 
         case NetworkCommand::Despawn:
-            ProcessDespawnPlayer(pScene, cmd.playerId);
+            ProcessDespawnPlayer(pScene, cmd.player.playerId);
             break;
 
         case NetworkCommand::Move:
-            ProcessMovePlayer(cmd.playerId, cmd.x, cmd.y, cmd.z, cmd.dirX, cmd.dirY, cmd.dirZ);
+            ProcessMovePlayer(cmd.move.playerId, cmd.move.x, cmd.move.y, cmd.move.z, cmd.move.dirX, cmd.move.dirY, cmd.move.dirZ);
             break;
 
         case NetworkCommand::Skill:
-            ProcessSkill(pScene, cmd.playerId, cmd.skillType, cmd.x, cmd.y, cmd.z, cmd.dirX, cmd.dirY, cmd.dirZ);
+            ProcessSkill(pScene, cmd.skill.playerId, cmd.skill.skillType,
+                         cmd.skill.x, cmd.skill.y, cmd.skill.z, cmd.skill.dirX, cmd.skill.dirY, cmd.skill.dirZ);
             break;
 
         case NetworkCommand::SetLocalPlayerId:
@@ -268,40 +283,41 @@ void NetworkManager::Update(Scene* pScene, ID3D12Device* pDevice, ID3D12Graphics
             break;
 
         case NetworkCommand::RoomTransition:
-            ProcessRoomTransition(pScene, cmd.stageIndex, cmd.roomIndex, cmd.isBossRoom);
+            ProcessRoomTransition(pScene, cmd.room.stageIndex, cmd.room.roomIndex, cmd.room.isBossRoom);
             break;
 
         case NetworkCommand::MonsterSpawn:
             ProcessMonsterSpawn(pScene, pDevice, pCommandList,
-                                cmd.monsterId, cmd.monsterType,
-                                cmd.x, cmd.y, cmd.z, cmd.monsterYaw,
-                                cmd.monsterHp, cmd.monsterIsBoss);
+                                cmd.monsterSpawn.monsterId, cmd.monsterSpawn.monsterType,
+                                cmd.monsterSpawn.x, cmd.monsterSpawn.y, cmd.monsterSpawn.z, cmd.monsterSpawn.yaw,
+                                cmd.monsterSpawn.hp, cmd.monsterSpawn.isBoss);
             break;
 
         case NetworkCommand::MonsterMove:
-            ProcessMonsterMove(cmd.monsterId, cmd.x, cmd.y, cmd.z, cmd.monsterYaw);
+            ProcessMonsterMove(cmd.monsterMove.monsterId, cmd.monsterMove.x, cmd.monsterMove.y, cmd.monsterMove.z, cmd.monsterMove.yaw);
             break;
 
         case NetworkCommand::MonsterDespawn:
-            ProcessMonsterDespawn(pScene, cmd.monsterId);
+            ProcessMonsterDespawn(pScene, cmd.monster.monsterId);
             break;
 
         case NetworkCommand::MonsterAttack:
-            ProcessMonsterAttack(pScene, cmd.monsterId, cmd.attackType, cmd.windupSec,
-                                 cmd.targetPlayerId, cmd.x, cmd.y, cmd.z);
+            ProcessMonsterAttack(pScene, cmd.monsterAttack.monsterId, cmd.monsterAttack.attackType, cmd.monsterAttack.windupSec,
+                                 cmd.monsterAttack.targetPlayerId, cmd.monsterAttack.x, cmd.monsterAttack.y, cmd.monsterAttack.z);
             break;
 
         case NetworkCommand::PlayerDamage:
-            ProcessPlayerDamage(pScene, cmd.playerId, cmd.damage, cmd.currentHp, cmd.isDead, cmd.attackerMonsterId);
+            ProcessPlayerDamage(pScene, cmd.playerDamage.playerId, cmd.playerDamage.damage, cmd.playerDamage.currentHp,
+                                cmd.playerDamage.isDead, cmd.playerDamage.attackerMonsterId);
             break;
 
         case NetworkCommand::MonsterDamage:
-            ProcessMonsterDamage(pScene, cmd.monsterId, cmd.damage, cmd.currentHp, cmd.isDead,
-                                 cmd.attackerPlayerId, cmd.skillType);
+            ProcessMonsterDamage(pScene, cmd.monsterDamage.monsterId, cmd.monsterDamage.damage, cmd.monsterDamage.currentHp,
+                                 cmd.monsterDamage.isDead, cmd.monsterDamage.attackerPlayerId, cmd.monsterDamage.skillType);
             break;
 
         case NetworkCommand::RoomCleared:
-            ProcessRoomCleared(pScene, cmd.stageIndex, cmd.roomIndex);
+            ProcessRoomCleared(pScene, cmd.room.stageIndex, cmd.room.roomIndex);
             break;
         }
     }
@@ -406,80 +422,90 @@ void NetworkManager::SendPlayerAttack(int skillType,
 
 void NetworkManager::QueueRoomTransition(uint32 stageIndex, uint32 roomIndex, bool isBossRoom)
 {
-    std::lock_guard<std::mutex> lock(m_queueMutex);
-
-    NetworkCommandData cmd{};
+    NetworkCommandData cmd;
     cmd.type = NetworkCommand::RoomTransition;
-    cmd.stageIndex = stageIndex;
-    cmd.roomIndex = roomIndex;
-    cmd.isBossRoom = isBossRoom;
-
-    m_vCommandQueue.push_back(cmd);
+    cmd.room = { stageIndex, roomIndex, isBossRoom };
+    m_CommandQueue.Push(cmd);
 }
 
 void NetworkManager::QueueMonsterSpawn(uint64 monsterId, uint32 monsterType,
                                        float x, float y, float z, float yaw,
                                        float hp, bool isBoss)
 {
-    std::lock_guard<std::mutex> lock(m_queueMutex);
-    NetworkCommandData cmd{};
+    NetworkCommandData cmd;
     cmd.type = NetworkCommand::MonsterSpawn;
-    cmd.monsterId = monsterId;
-    cmd.monsterType = monsterType;
-    cmd.x = x; cmd.y = y; cmd.z = z;
-    cmd.monsterYaw = yaw;
-    cmd.monsterHp = hp;
-    cmd.monsterIsBoss = isBoss;
-    m_vCommandQueue.push_back(cmd);
+    cmd.monsterSpawn = { monsterId, monsterType, x, y, z, yaw, hp, isBoss };
+    m_CommandQueue.Push(cmd);
 }
 
 void NetworkManager::QueueMonsterMove(uint64 monsterId, float x, float y, float z, float yaw)
 {
-    std::lock_guard<std::mutex> lock(m_queueMutex);
-    NetworkCommandData cmd{};
+    NetworkCommandData cmd;
     cmd.type = NetworkCommand::MonsterMove;
-    cmd.monsterId = monsterId;
-    cmd.x = x; cmd.y = y; cmd.z = z;
-    cmd.monsterYaw = yaw;
-    m_vCommandQueue.push_back(cmd);
+    cmd.monsterMove = { monsterId, x, y, z, yaw };
+    m_CommandQueue.Push(cmd);
+}
+
+bool NetworkManager::OnMonsterSnapshot(PacketSessionRef& session, const BYTE* payload, int32 len)
+{
+    const MonsterSnapshot::DecodeResult result =
+        MonsterSnapshot::Decode(payload, len, m_SnapshotHistory, m_DecodedSnapshot);
+
+    if (result == MonsterSnapshot::DecodeResult::Malformed)
+    {
+        WriteNetworkLog("[Network] S_MONSTER_SNAPSHOT malformed");
+        return false;
+    }
+
+    if (result == MonsterSnapshot::DecodeResult::MissingBaseline)
+    {
+        // baseline을 잃었으면 full 스냅샷이 올 때까지 한 번만 요청
+        if (!m_bSnapshotResyncPending)
+        {
+            m_bSnapshotResyncPending = true;
+            session->Send(ServerPacketHandler::MakeMonsterResync());
+            WriteNetworkLog("[Network] S_MONSTER_SNAPSHOT baseline missing, resync requested");
+        }
+        return true;
+    }
+
+    m_bSnapshotResyncPending = false;
+    m_SnapshotHistory.Push(m_DecodedSnapshot);
+    session->Send(ServerPacketHandler::MakeMonsterSnapshotAck(m_DecodedSnapshot.sequence));
+
+    // 메인 스레드는 가장 최근 상태만 필요 — 아직 적용 안 된 이전 프레임은 덮어씀
+    {
+        std::lock_guard<std::mutex> lock(m_snapshotMutex);
+        std::swap(m_LatestSnapshot, m_DecodedSnapshot);
+        m_bLatestSnapshotDirty = true;
+    }
+    return true;
 }
 
 void NetworkManager::QueueMonsterDespawn(uint64 monsterId)
 {
-    std::lock_guard<std::mutex> lock(m_queueMutex);
-    NetworkCommandData cmd{};
+    NetworkCommandData cmd;
     cmd.type = NetworkCommand::MonsterDespawn;
-    cmd.monsterId = monsterId;
-    m_vCommandQueue.push_back(cmd);
+    cmd.monster = { monsterId };
+    m_CommandQueue.Push(cmd);
 }
 
 void NetworkManager::QueueMonsterAttack(uint64 monsterId, uint64 targetPlayerId, uint32 attackType,
                                         float x, float y, float z, float yaw, float windupSec)
 {
-    std::lock_guard<std::mutex> lock(m_queueMutex);
-    NetworkCommandData cmd{};
+    NetworkCommandData cmd;
     cmd.type = NetworkCommand::MonsterAttack;
-    cmd.monsterId = monsterId;
-    cmd.targetPlayerId = targetPlayerId;
-    cmd.attackType = attackType;
-    cmd.x = x; cmd.y = y; cmd.z = z;
-    cmd.monsterYaw = yaw;
-    cmd.windupSec = windupSec;
-    m_vCommandQueue.push_back(cmd);
+    cmd.monsterAttack = { monsterId, targetPlayerId, attackType, x, y, z, yaw, windupSec };
+    m_CommandQueue.Push(cmd);
 }
 
 void NetworkManager::QueuePlayerDamage(uint64 playerId, float damage, float currentHp,
                                         bool isDead, uint64 attackerMonsterId)
 {
-    std::lock_guard<std::mutex> lock(m_queueMutex);
-    NetworkCommandData cmd{};
+    NetworkCommandData cmd;
     cmd.type = NetworkCommand::PlayerDamage;
-    cmd.playerId = playerId;
-    cmd.damage = damage;
-    cmd.currentHp = currentHp;
-    cmd.isDead = isDead;
-    cmd.attackerMonsterId = attackerMonsterId;
-    m_vCommandQueue.push_back(cmd);
+    cmd.playerDamage = { playerId, attackerMonsterId, damage, currentHp, isDead };
+    m_CommandQueue.Push(cmd);
 }
 
 GameObject* NetworkManager::GetServerMonster(uint64 monsterId)
@@ -564,75 +590,42 @@ void NetworkManager::ProcessRoomTransition(Scene* pScene, uint32 stageIndex, uin
 
 void NetworkManager::QueueSpawnPlayer(uint64 playerId, const std::string& name, int playerType, float x, float y, float z)
 {
-    std::lock_guard<std::mutex> lock(m_queueMutex);
-
     NetworkCommandData cmd;
     cmd.type = NetworkCommand::Spawn;
-    cmd.playerId = playerId;
-    cmd.name = name;
-    cmd.playerType = playerType;
-    cmd.x = x;
-    cmd.y = y;
-    cmd.z = z;
-
-    m_vCommandQueue.push_back(cmd);
+    cmd.spawn = { playerId, m_NameTable.Intern(name), playerType, x, y, z };
+    m_CommandQueue.Push(cmd);
 }
 
 void NetworkManager::QueueDespawnPlayer(uint64 playerId)
 {
-    std::lock_guard<std::mutex> lock(m_queueMutex);
-
     NetworkCommandData cmd;
     cmd.type = NetworkCommand::Despawn;
-    cmd.playerId = playerId;
-
-    m_vCommandQueue.push_back(cmd);
+    cmd.player = { playerId };
+    m_CommandQueue.Push(cmd);
 }
 
 void NetworkManager::QueueMovePlayer(uint64 playerId, float x, float y, float z, float dirX, float dirY, float dirZ)
 {
-    std::lock_guard<std::mutex> lock(m_queueMutex);
-
     NetworkCommandData cmd;
     cmd.type = NetworkCommand::Move;
-    cmd.playerId = playerId;
-    cmd.x = x;
-    cmd.y = y;
-    cmd.z = z;
-    cmd.dirX = dirX;
-    cmd.dirY = dirY;
-    cmd.dirZ = dirZ;
-
-    m_vCommandQueue.push_back(cmd);
+    cmd.move = { playerId, x, y, z, dirX, dirY, dirZ };
+    m_CommandQueue.Push(cmd);
 }
 
 void NetworkManager::QueueSkill(uint64 playerId, int skillType, float x, float y, float z, float dirX, float dirY, float dirZ)
 {
-    std::lock_guard<std::mutex> lock(m_queueMutex);
-
     NetworkCommandData cmd;
     cmd.type = NetworkCommand::Skill;
-    cmd.playerId = playerId;
-    cmd.skillType = skillType;
-    cmd.x = x;
-    cmd.y = y;
-    cmd.z = z;
-    cmd.dirX = dirX;
-    cmd.dirY = dirY;
-    cmd.dirZ = dirZ;
-
-    m_vCommandQueue.push_back(cmd);
+    cmd.skill = { playerId, skillType, x, y, z, dirX, dirY, dirZ };
+    m_CommandQueue.Push(cmd);
 }
 
 void NetworkManager::QueueSetLocalPlayerId(uint64 playerId)
 {
-    std::lock_guard<std::mutex> lock(m_queueMutex);
-
     NetworkCommandData cmd;
     cmd.type = NetworkCommand::SetLocalPlayerId;
-    cmd.playerId = playerId;
-
-    m_vCommandQueue.push_back(cmd);
+    cmd.player = { playerId };
+    m_CommandQueue.Push(cmd);
 }
 
 GameObject* NetworkManager::GetRemotePlayer(uint64 playerId)
@@ -1645,30 +1638,18 @@ void NetworkManager::ProcessPlayerDamage(Scene* pScene, uint64 playerId, float d
 void NetworkManager::QueueMonsterDamage(uint64 monsterId, float damage, float currentHp, bool isDead,
                                         uint64 attackerPlayerId, int skillType)
 {
-    std::lock_guard<std::mutex> lock(m_queueMutex);
-
-    NetworkCommandData cmd{};
+    NetworkCommandData cmd;
     cmd.type = NetworkCommand::MonsterDamage;
-    cmd.monsterId = monsterId;
-    cmd.damage = damage;
-    cmd.currentHp = currentHp;
-    cmd.isDead = isDead;
-    cmd.attackerPlayerId = attackerPlayerId;
-    cmd.skillType = skillType;
-
-    m_vCommandQueue.push_back(cmd);
+    cmd.monsterDamage = { monsterId, attackerPlayerId, damage, currentHp, skillType, isDead };
+    m_CommandQueue.Push(cmd);
 }
 
 void NetworkManager::QueueRoomCleared(uint32 stageIndex, uint32 roomIndex)
 {
-    std::lock_guard<std::mutex> lock(m_queueMutex);
-
-    NetworkCommandData cmd{};
+    NetworkCommandData cmd;
     cmd.type = NetworkCommand::RoomCleared;
-    cmd.stageIndex = stageIndex;
-    cmd.roomIndex = roomIndex;
-
-    m_vCommandQueue.push_back(cmd);
+    cmd.room = { stageIndex, roomIndex, false };
+    m_CommandQueue.Push(cmd);
 }
 
 void NetworkManager::ProcessMonsterDamage(Scene* pScene, uint64 monsterId, float damage,
@@ -1775,8 +1756,35 @@ void NetworkManager::ProcessMonsterDespawn(Scene* pScene, uint64 monsterId)
     OutputDebugString(buf);
 }
 
+void NetworkManager::ApplyLatestMonsterSnapshot()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_snapshotMutex);
+        if (!m_bLatestSnapshotDirty)
+            return;
+        std::swap(m_AppliedSnapshot, m_LatestSnapshot);
+        m_bLatestSnapshotDirty = false;
+    }
+
+    // 스냅샷은 방 전체 상태 — 타겟과 달라진 몬스터만 MOVE 처리 (walk 전환/idle 타이머 리셋)
+    for (const MonsterSnapshot::Entry& e : m_AppliedSnapshot.entries)
+    {
+        float x, y, z, yaw;
+        MonsterSnapshot::Dequantize(e, x, y, z, yaw);
+
+        auto tIt = m_mapServerMonsterTarget.find(e.monsterId);
+        if (tIt != m_mapServerMonsterTarget.end() && tIt->second.hasTarget &&
+            tIt->second.px == x && tIt->second.py == y && tIt->second.pz == z && tIt->second.yaw == yaw)
+            continue;
+
+        ProcessMonsterMove(e.monsterId, x, y, z, yaw);
+    }
+}
+
 void NetworkManager::InterpolateServerMonsters(float deltaTime)
 {
+    ApplyLatestMonsterSnapshot();
+
     // 각 몬스터의 현재 transform을 타겟을 향해 exponential smoothing.
     // 서버 MOVE 패킷이 띄엄띄엄 와도 움직임은 부드럽게 이어짐.
     constexpr float POS_SMOOTH_RATE = 12.0f;  // 높을수록 빨리 따라감 (클 수록 덜 부드러움)
@@ -5,6 +5,8 @@
 #include "ServerCore/Service.h"
 #include "ServerCore/ThreadManager.h"
 #include "Protocol/ServerPacketHandler.h"
+#include "Protocol/MonsterSnapshot.h"
+#include "NetworkCommandQueue.h"
 
 #include <unordered_map>
 #include <unordered_set>
@@ -26,58 +28,6 @@ struct NetworkPlayerInfo
     float x, y, z;
 };
 
-// 패킷 처리를 위한 명령 타입
-enum class NetworkCommand
-{
-    Spawn,
-    Despawn,
-    Move,
-    Skill,
-    SetLocalPlayerId,
-    RoomTransition,
-    MonsterSpawn,
-    MonsterMove,
-    MonsterDespawn,
-    MonsterAttack,
-    PlayerDamage,
-    MonsterDamage,
-    RoomCleared
-};
-
-// 네트워크 명령 구조체
-struct NetworkCommandData
-{
-    NetworkCommand type;
-    uint64 playerId;
-    std::string name;
-    int playerType;
-    float x, y, z;
-    float dirX, dirY, dirZ;  // 방향 정보
-    int skillType;           // 스킬 타입 (Protocol::SkillType)
-
-    // Room transition fields
-    uint32 stageIndex;
-    uint32 roomIndex;
-    bool isBossRoom;
-
-    // Monster fields
-    uint64 monsterId;
-    uint32 monsterType;
-    float monsterYaw;
-    float monsterHp;
-    bool monsterIsBoss;
-
-    // Combat fields
-    uint32 attackType;
-    float windupSec;
-    uint64 targetPlayerId;
-    float damage;
-    float currentHp;
-    bool  isDead;
-    uint64 attackerMonsterId;
-    uint64 attackerPlayerId;
-};
-
 // =============================================================================
 // GameSession: 서버와의 세션을 관리하는 클래스
 // =============================================================================
@@ -164,6 +114,9 @@ public:
     void QueueMonsterMove(uint64 monsterId, float x, float y, float z, float yaw);
     void QueueMonsterDespawn(uint64 monsterId);
 
+    // S_MONSTER_SNAPSHOT 수신 (네트워크 스레드) — 디코드 + ACK/RESYNC 전송 후 최신 프레임만 메인 스레드로 넘김
+    bool OnMonsterSnapshot(PacketSessionRef& session, const BYTE* payload, int32 len);
+
     // 전투 큐잉 (S_MONSTER_ATTACK / S_PLAYER_DAMAGE)
     void QueueMonsterAttack(uint64 monsterId, uint64 targetPlayerId, uint32 attackType,
                             float x, float y, float z, float yaw, float windupSec);
@@ -199,9 +152,11 @@ private:
     // 원격 플레이어 관리 (메인 스레드에서만 접근)
     std::unordered_map<uint64, GameObject*> m_mapRemotePlayers;
 
-    // 네트워크 스레드에서 메인 스레드로 전달할 명령 큐
-    std::mutex m_queueMutex;
-    std::vector<NetworkCommandData> m_vCommandQueue;
+    // 네트워크 스레드에서 메인 스레드로 전달할 명령 큐 (SPSC 링 + 이름 인턴)
+    NetworkCommandQueue m_CommandQueue;
+    NetworkNameTable m_NameTable;
+    std::vector<NetworkCommandData> m_vCommands;   // Update에서 매 프레임 재사용
+    NetworkQueueStats m_LastQueueStats;            // 넘침 로그를 바뀔 때만 남기기 위함
 
     // LocalPlayerId가 설정되기 전에 도착한 Spawn 명령을 보류
     std::vector<NetworkCommandData> m_vPendingSpawns;
@@ -263,6 +218,17 @@ private:
     };
     std::unordered_map<uint64, ServerMonsterTarget> m_mapServerMonsterTarget;
 
+    // 몬스터 스냅샷 — 명령 큐를 거치지 않고 InterpolateServerMonsters가 최신 프레임을 바로 적용
+    MonsterSnapshot::History m_SnapshotHistory;             // 네트워크 스레드 전용 (디코드 baseline)
+    MonsterSnapshot::Frame   m_DecodedSnapshot;             // 네트워크 스레드 전용 (디코드 버퍼)
+    bool                     m_bSnapshotResyncPending = false;
+    std::mutex               m_snapshotMutex;
+    MonsterSnapshot::Frame   m_LatestSnapshot;              // m_snapshotMutex 보호
+    bool                     m_bLatestSnapshotDirty = false; // m_snapshotMutex 보호
+    MonsterSnapshot::Frame   m_AppliedSnapshot;             // 메인 스레드 전용
+
+    void ApplyLatestMonsterSnapshot();
+
 public:
     // 매 프레임 타겟을 향해 몬스터 transform 보간 (Dx12App 메인 루프에서 호출)
     void InterpolateServerMonsters(float deltaTime);
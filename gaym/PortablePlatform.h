@@ -0,0 +1,202 @@
+#pragma once
+
+// ============================================================================
+// PortablePlatform
+// 디바이스 없이 도는 데이터 모듈(Animation, MeshFileParser)이 stdafx.h 대신 포함하는 헤더.
+// 윈도우에서는 windows.h + DirectXMath 를 그대로 쓰고, 그 밖(리눅스 CI, gaym/Tests)에서는
+// 이 모듈들과 벤치가 쓰는 Win32 / DirectXMath 이름만 같은 뜻으로 채운다.
+// (ServerCore 의 CorePlatform.h 와 같은 역할. 수학은 스칼라 구현이라 SIMD 성능과는 다르다)
+// ============================================================================
+
+#ifdef _WIN32
+
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#include <DirectXMath.h>
+
+using namespace DirectX;
+
+#else
+
+#include <cerrno>
+#include <cmath>
+#include <cstdarg>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <cwchar>
+
+/*---------------
+	  Types
+---------------*/
+
+using UINT    = uint32_t;
+using BYTE    = uint8_t;
+using errno_t = int;
+
+/*---------------
+	   CRT
+---------------*/
+
+inline void OutputDebugStringA(const char*) { }
+inline void OutputDebugStringW(const wchar_t*) { }
+#define OutputDebugString OutputDebugStringW
+
+inline errno_t fopen_s(FILE** ppFile, const char* pstrFileName, const char* pstrMode)
+{
+	*ppFile = ::fopen(pstrFileName, pstrMode);
+	return *ppFile ? 0 : errno;
+}
+
+inline int sprintf_s(char* pBuffer, size_t nSize, const char* pstrFormat, ...)
+{
+	va_list args;
+	va_start(args, pstrFormat);
+	const int n = ::vsnprintf(pBuffer, nSize, pstrFormat, args);
+	va_end(args);
+	return n;
+}
+
+template <size_t N>
+inline int sprintf_s(char (&buffer)[N], const char* pstrFormat, ...)
+{
+	va_list args;
+	va_start(args, pstrFormat);
+	const int n = ::vsnprintf(buffer, N, pstrFormat, args);
+	va_end(args);
+	return n;
+}
+
+inline int swprintf_s(wchar_t* pBuffer, size_t nSize, const wchar_t* pstrFormat, ...)
+{
+	va_list args;
+	va_start(args, pstrFormat);
+	const int n = ::vswprintf(pBuffer, nSize, pstrFormat, args);
+	va_end(args);
+	return n;
+}
+
+/*---------------
+   DirectXMath
+---------------*/
+
+struct XMFLOAT2
+{
+	float x, y;
+	XMFLOAT2() = default;
+	constexpr XMFLOAT2(float _x, float _y) : x(_x), y(_y) { }
+};
+
+struct XMFLOAT3
+{
+	float x, y, z;
+	XMFLOAT3() = default;
+	constexpr XMFLOAT3(float _x, float _y, float _z) : x(_x), y(_y), z(_z) { }
+};
+
+struct XMFLOAT4
+{
+	float x, y, z, w;
+	XMFLOAT4() = default;
+	constexpr XMFLOAT4(float _x, float _y, float _z, float _w) : x(_x), y(_y), z(_z), w(_w) { }
+};
+
+struct XMINT4
+{
+	int32_t x, y, z, w;
+	XMINT4() = default;
+	constexpr XMINT4(int32_t _x, int32_t _y, int32_t _z, int32_t _w) : x(_x), y(_y), z(_z), w(_w) { }
+};
+
+struct XMFLOAT4X4
+{
+	float m[4][4];
+};
+
+struct XMVECTOR
+{
+	float v[4];
+};
+
+struct XMMATRIX
+{
+	XMVECTOR r[4];
+};
+
+inline XMVECTOR XMVectorZero() { return { { 0.0f, 0.0f, 0.0f, 0.0f } }; }
+inline XMVECTOR XMLoadFloat3(const XMFLOAT3* p) { return { { p->x, p->y, p->z, 0.0f } }; }
+inline XMVECTOR XMLoadFloat4(const XMFLOAT4* p) { return { { p->x, p->y, p->z, p->w } }; }
+inline void XMStoreFloat3(XMFLOAT3* p, const XMVECTOR& v) { *p = XMFLOAT3(v.v[0], v.v[1], v.v[2]); }
+inline void XMStoreFloat4(XMFLOAT4* p, const XMVECTOR& v) { *p = XMFLOAT4(v.v[0], v.v[1], v.v[2], v.v[3]); }
+
+inline void XMStoreFloat4x4(XMFLOAT4X4* p, const XMMATRIX& m)
+{
+	for (int r = 0; r < 4; ++r)
+		for (int c = 0; c < 4; ++c)
+			p->m[r][c] = m.r[r].v[c];
+}
+
+inline XMVECTOR XMVectorLerp(const XMVECTOR& a, const XMVECTOR& b, float t)
+{
+	XMVECTOR out;
+	for (int i = 0; i < 4; ++i)
+		out.v[i] = a.v[i] + (b.v[i] - a.v[i]) * t;
+	return out;
+}
+
+// DirectXMath 의 XMQuaternionSlerp 와 같은 분기 (짧은 호, 거의 같으면 선형)
+inline XMVECTOR XMQuaternionSlerp(const XMVECTOR& q0, const XMVECTOR& q1, float t)
+{
+	float fCos = q0.v[0] * q1.v[0] + q0.v[1] * q1.v[1] + q0.v[2] * q1.v[2] + q0.v[3] * q1.v[3];
+	const float fSign = fCos < 0.0f ? -1.0f : 1.0f;
+	fCos *= fSign;
+
+	float s0 = 1.0f - t, s1 = t;
+	if (fCos < 1.0f - 0.00001f)
+	{
+		const float fOmega = std::acos(fCos);
+		const float fInvSin = 1.0f / std::sin(fOmega);
+		s0 = std::sin(s0 * fOmega) * fInvSin;
+		s1 = std::sin(s1 * fOmega) * fInvSin;
+	}
+	s1 *= fSign;
+
+	XMVECTOR out;
+	for (int i = 0; i < 4; ++i)
+		out.v[i] = q0.v[i] * s0 + q1.v[i] * s1;
+	return out;
+}
+
+// 스케일 → (origin 기준) 회전 → 이동, 행 벡터 규약
+inline XMMATRIX XMMatrixAffineTransformation(const XMVECTOR& scale, const XMVECTOR& origin, const XMVECTOR& q, const XMVECTOR& t)
+{
+	const float x = q.v[0], y = q.v[1], z = q.v[2], w = q.v[3];
+	const float rot[3][3] =
+	{
+		{ 1.0f - 2.0f * (y * y + z * z), 2.0f * (x * y + z * w),        2.0f * (x * z - y * w) },
+		{ 2.0f * (x * y - z * w),        1.0f - 2.0f * (x * x + z * z), 2.0f * (y * z + x * w) },
+		{ 2.0f * (x * z + y * w),        2.0f * (y * z - x * w),        1.0f - 2.0f * (x * x + y * y) },
+	};
+
+	XMMATRIX m;
+	for (int r = 0; r < 3; ++r)
+	{
+		for (int c = 0; c < 3; ++c)
+			m.r[r].v[c] = rot[r][c] * scale.v[r];
+		m.r[r].v[3] = 0.0f;
+	}
+	for (int c = 0; c < 3; ++c)
+	{
+		float fRotatedOrigin = 0.0f;
+		for (int k = 0; k < 3; ++k)
+			fRotatedOrigin += origin.v[k] * rot[k][c];
+		m.r[3].v[c] = origin.v[c] - fRotatedOrigin + t.v[c];
+	}
+	m.r[3].v[3] = 1.0f;
+	return m;
+}
+
+#endif
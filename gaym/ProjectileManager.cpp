@@ -13,6 +13,7 @@
 #include "Mesh.h"
 #include "DescriptorHeap.h"
 #include "NetworkManager.h"
+#include "EnemySpatialIndex.h"
 #include <DirectXCollision.h>
 #include <random>
 
@@ -295,18 +296,18 @@ void ProjectileManager::Update(float deltaTime)
             CRoom* pRoom = m_pScene->GetCurrentRoom();
             if (pRoom)
             {
+                // 방의 오브젝트 전체 대신 살아 있는 적 컴포넌트만 훑는다 (다른 방의 적은 거른다)
                 float bestDist = FLT_MAX;
                 XMFLOAT3 bestPos = projectile.position;
-                for (const auto& obj : pRoom->GetGameObjects())
+                ComponentRegistry::ForEach<EnemyComponent>([&](EnemyComponent* pEnemy)
                 {
-                    if (!obj) continue;
-                    EnemyComponent* pEnemy = obj->GetComponent<EnemyComponent>();
-                    if (!pEnemy || pEnemy->IsDead()) continue;
-                    XMFLOAT3 ePos = obj->GetTransform()->GetPosition();
+                    GameObject* pObj = pEnemy->GetOwner();
+                    if (pObj->m_pOwnerRoom != pRoom || pEnemy->IsDead()) return;
+                    XMFLOAT3 ePos = pObj->GetTransform()->GetPosition();
                     XMVECTOR diff = XMLoadFloat3(&ePos) - XMLoadFloat3(&projectile.position);
                     float d = XMVectorGetX(XMVector3Length(diff));
                     if (d < bestDist) { bestDist = d; bestPos = ePos; }
-                }
+                });
                 if (bestDist < FLT_MAX)
                 {
                     XMVECTOR cur = XMLoadFloat3(&projectile.direction);
@@ -320,7 +321,8 @@ void ProjectileManager::Update(float deltaTime)
             }
         }
 
-        // Update position
+        // Update position (충돌은 이전 위치부터 스윕)
+        XMFLOAT3 prevPos = projectile.position;
         projectile.Update(deltaTime);
 
         // 투사체 소유 매니저 선택 (플레이어↔적 완전 분리)
@@ -342,7 +344,7 @@ void ProjectileManager::Update(float deltaTime)
         // Check collisions
         if (projectile.isActive)
         {
-            CheckProjectileCollisions(projectile);
+            CheckProjectileCollisions(projectile, prevPos);
         }
 
         // If projectile became inactive (hit something or expired), handle fluid VFX and spawn explosion
@@ -412,55 +414,48 @@ void ProjectileManager::Clear()
     m_Projectiles.clear();
 }
 
-void ProjectileManager::CheckProjectileCollisions(Projectile& projectile)
+void ProjectileManager::CheckProjectileCollisions(Projectile& projectile, const XMFLOAT3& prevPos)
 {
     if (!m_pScene) return;
 
-    BoundingSphere projSphere = projectile.GetBoundingSphere();
+    // 이번 프레임 이동 구간 위에서 처음 닿는 지점 (비관통 투사체는 여기서 멈춘다)
+    auto pointAt = [&](float t)
+    {
+        XMFLOAT3 p;
+        XMStoreFloat3(&p, XMVectorLerp(XMLoadFloat3(&prevPos), XMLoadFloat3(&projectile.position), t));
+        return p;
+    };
+    const float prev[3] = { prevPos.x, prevPos.y, prevPos.z };
+    const float cur[3]  = { projectile.position.x, projectile.position.y, projectile.position.z };
 
     if (projectile.isPlayerProjectile)
     {
-        // Player projectile: check against enemies in the room
+        // Player projectile: check against enemies in the room (방의 적 공간 색인으로 스윕)
         CRoom* pRoom = m_pScene->GetCurrentRoom();
         if (!pRoom) return;
 
-        const auto& gameObjects = pRoom->GetGameObjects();
-        for (const auto& obj : gameObjects)
+        pRoom->SweepEnemies(prevPos, projectile.position, projectile.radius, m_vSweepHits);
+        for (const auto& hit : m_vSweepHits)
         {
-            if (!obj) continue;
-
-            EnemyComponent* pEnemy = obj->GetComponent<EnemyComponent>();
-            if (!pEnemy || pEnemy->IsDead()) continue;
-
-            TransformComponent* pTransform = obj->GetTransform();
-            if (!pTransform) continue;
+            EnemyComponent* pEnemy = hit.first;
+            if (pEnemy->IsDead()) continue;   // 앞선 히트의 AoE 로 죽었을 수 있음
 
-            XMFLOAT3 enemyPos = pTransform->GetPosition();
-            XMFLOAT3 enemyScale = pTransform->GetScale();
+            if (!projectile.isPiercing)
+                projectile.position = pointAt(hit.second);
 
-            // Scale collision sphere based on enemy size (1.2 → 1.5 — 뚱뚱한 메시도 커버)
-            float maxScale = max(enemyScale.x, max(enemyScale.y, enemyScale.z));
-            float radius = max(1.5f, maxScale * 1.5f);
-
-            BoundingSphere enemySphere(enemyPos, radius);
-            enemySphere.Center.y += radius * 0.7f;
+            if (projectile.explosionRadius > 0.0f)
+                ApplyAoEDamage(projectile, projectile.position);
+            else
+                ApplyDamage(projectile, pEnemy);
 
-            if (projSphere.Intersects(enemySphere))
+            projectile.wasHit = true;
+            if (!projectile.isPiercing)
             {
-                if (projectile.explosionRadius > 0.0f)
-                    ApplyAoEDamage(projectile, projectile.position);
-                else
-                    ApplyDamage(projectile, pEnemy);
-
-                projectile.wasHit = true;
-                if (!projectile.isPiercing)
-                {
-                    projectile.isActive = false;
-                    return;
-                }
-                // 관통: 같은 적에 연속 히트 방지를 위해 잠깐 무적 처리 대신
-                // 단순히 충돌 구체를 통과한 뒤 다음 적을 노림 — 루프 계속
+                projectile.isActive = false;
+                return;
             }
+            // 관통: 같은 적에 연속 히트 방지를 위해 잠깐 무적 처리 대신
+            // 단순히 충돌 구체를 통과한 뒤 다음 적을 노림 — 루프 계속
         }
 
         // 네트워크 모드: 서버 몬스터 (EnemyComponent 없음, 로컬 Room 밖에 존재) 도 충돌 체크.
@@ -469,27 +464,25 @@ void ProjectileManager::CheckProjectileCollisions(Projectile& projectile)
         NetworkManager* pNetMgr = NetworkManager::GetInstance();
         if (pNetMgr && pNetMgr->IsConnected() && projectile.isActive)
         {
+            // 서버 몬스터는 색인 밖이라 직접 스윕. 가장 먼저 닿는 몬스터 (t 같으면 id 순 — map 순회 순서)
+            float bestT = FLT_MAX;
             for (const auto& kv : pNetMgr->GetServerMonsters())
             {
                 GameObject* netMonster = kv.second;
-                if (!netMonster) continue;
-                TransformComponent* pT = netMonster->GetTransform();
-                if (!pT) continue;
-
-                XMFLOAT3 mPos = pT->GetPosition();
-                XMFLOAT3 mScale = pT->GetScale();
-                float maxScale = max(mScale.x, max(mScale.y, mScale.z));
-                float radius = max(1.5f, maxScale * 1.5f);
-
-                BoundingSphere mSphere(mPos, radius);
-                mSphere.Center.y += radius * 0.7f;
+                if (!netMonster || !netMonster->GetTransform()) continue;
 
-                if (projSphere.Intersects(mSphere))
-                {
-                    projectile.wasHit = true;
-                    projectile.isActive = false;
-                    return;  // 관통 없음 — 첫 서버 몬스터 충돌 시 폭발
-                }
+                BoundingSphere mSphere = CRoom::GetEnemyHitSphere(netMonster);
+                const float c[3] = { mSphere.Center.x, mSphere.Center.y, mSphere.Center.z };
+                float t;
+                if (EnemySpatialIndex::SweepSphereSphere(prev, cur, projectile.radius, c, mSphere.Radius, t) && t < bestT)
+                    bestT = t;
+            }
+            if (bestT <= 1.0f)
+            {
+                projectile.position = pointAt(bestT);
+                projectile.wasHit = true;
+                projectile.isActive = false;
+                return;  // 관통 없음 — 첫 서버 몬스터 충돌 시 폭발
             }
         }
     }
@@ -503,12 +496,12 @@ void ProjectileManager::CheckProjectileCollisions(Projectile& projectile)
         if (!pPlayerTransform) return;
 
         XMFLOAT3 playerPos = pPlayerTransform->GetPosition();
+        const float playerCenter[3] = { playerPos.x, playerPos.y + 1.0f, playerPos.z };
 
-        BoundingSphere playerSphere(playerPos, 1.5f);
-        playerSphere.Center.y += 1.0f;
-
-        if (projSphere.Intersects(playerSphere))
+        float t;
+        if (EnemySpatialIndex::SweepSphereSphere(prev, cur, projectile.radius, playerCenter, 1.5f, t))
         {
+            projectile.position = pointAt(t);
             projectile.wasHit = true;
             projectile.isActive = false;
 
@@ -650,47 +643,34 @@ void ProjectileManager::ApplyAoEDamage(Projectile& projectile, const XMFLOAT3& i
     CRoom* pRoom = m_pScene->GetCurrentRoom();
     if (!pRoom) return;
 
-    BoundingSphere explosionSphere(impactPoint, projectile.explosionRadius);
+    // 폭발 구와 피격 구체가 겹치는 적 (방의 적 공간 색인)
+    pRoom->QueryEnemies(impactPoint, projectile.explosionRadius, m_vAoEHits);
 
-    const auto& gameObjects = pRoom->GetGameObjects();
-    for (const auto& obj : gameObjects)
+    for (EnemyComponent* pEnemy : m_vAoEHits)
     {
-        if (!obj) continue;
-
-        EnemyComponent* pEnemy = obj->GetComponent<EnemyComponent>();
-        if (!pEnemy || pEnemy->IsDead()) continue;
+        if (pEnemy->IsDead()) continue;
 
-        TransformComponent* pTransform = obj->GetTransform();
+        GameObject* pOwner = pEnemy->GetOwner();
+        TransformComponent* pTransform = pOwner ? pOwner->GetTransform() : nullptr;
         if (!pTransform) continue;
 
         XMFLOAT3 enemyPos = pTransform->GetPosition();
-        XMFLOAT3 enemyScale = pTransform->GetScale();
 
-        // Scale collision sphere based on enemy size (1.2 → 1.5)
-        float maxScale = max(enemyScale.x, max(enemyScale.y, enemyScale.z));
-        float radius = max(1.5f, maxScale * 1.5f);
+        // Calculate damage falloff based on distance (optional)
+        XMVECTOR impact = XMLoadFloat3(&impactPoint);
+        XMVECTOR enemy = XMLoadFloat3(&enemyPos);
+        float distance = XMVectorGetX(XMVector3Length(enemy - impact));
 
-        BoundingSphere enemySphere(enemyPos, radius);
-        enemySphere.Center.y += radius * 0.7f;
+        // Linear falloff: full damage at center, 50% at edge
+        float falloff = 1.0f - (distance / projectile.explosionRadius) * 0.5f;
+        falloff = max(0.5f, falloff);
 
-        if (explosionSphere.Intersects(enemySphere))
-        {
-            // Calculate damage falloff based on distance (optional)
-            XMVECTOR impact = XMLoadFloat3(&impactPoint);
-            XMVECTOR enemy = XMLoadFloat3(&enemyPos);
-            float distance = XMVectorGetX(XMVector3Length(enemy - impact));
-
-            // Linear falloff: full damage at center, 50% at edge
-            float falloff = 1.0f - (distance / projectile.explosionRadius) * 0.5f;
-            falloff = max(0.5f, falloff);
-
-            float finalDamage = projectile.damage * falloff;
-            pEnemy->TakeDamage(finalDamage);
+        float finalDamage = projectile.damage * falloff;
+        pEnemy->TakeDamage(finalDamage);
 
-            wchar_t buffer[128];
-            swprintf_s(buffer, 128, L"[ProjectileManager] AoE hit! Damage: %.0f (falloff: %.2f)\n", finalDamage, falloff);
-            OutputDebugString(buffer);
-        }
+        wchar_t buffer[128];
+        swprintf_s(buffer, 128, L"[ProjectileManager] AoE hit! Damage: %.0f (falloff: %.2f)\n", finalDamage, falloff);
+        OutputDebugString(buffer);
     }
 }
 
@@ -29,7 +29,7 @@ struct ProjectileConstants
     XMFLOAT4 m_cDiffuse;
     XMFLOAT4 m_cSpecular;
     XMFLOAT4 m_cEmissive;
-    XMFLOAT4X4 m_xmf4x4BoneTransforms[96];  // Not used, but needed for layout match
+    UINT m_nBoneOffset = 0;  // Not used (skinning palette), but needed for layout match
 };
 
 class ProjectileManager
@@ -86,8 +86,8 @@ public:
     void SpawnExplosionParticles(const XMFLOAT3& position, ElementType element);
 
 private:
-    // Check collisions for a single projectile
-    void CheckProjectileCollisions(Projectile& projectile);
+    // Check collisions for a single projectile (prevPos → position 구간 전체를 스윕)
+    void CheckProjectileCollisions(Projectile& projectile, const XMFLOAT3& prevPos);
 
     // Apply damage to enemy
     void ApplyDamage(Projectile& projectile, EnemyComponent* pEnemy);
@@ -103,6 +103,8 @@ private:
 
 private:
     std::vector<Projectile> m_Projectiles;
+    std::vector<std::pair<EnemyComponent*, float>> m_vSweepHits;   // CheckProjectileCollisions 재사용 버퍼
+    std::vector<EnemyComponent*> m_vAoEHits;                       // ApplyAoEDamage 재사용 버퍼
     Scene* m_pScene = nullptr;
     ParticleSystem* m_pParticleSystem = nullptr;
     FluidSkillVFXManager* m_pFluidVFXManager = nullptr;       // 플레이어 전용
@@ -0,0 +1,328 @@
+#include "MonsterSnapshot.h"
+#include <cmath>
+#include <cstring>
+
+namespace MonsterSnapshot
+{
+    namespace
+    {
+        // -------------------------------------------------------------------
+        // 바이트 쓰기/읽기 도우미
+        // -------------------------------------------------------------------
+        inline uint64 ZigZag(int64 v)    { return (static_cast<uint64>(v) << 1) ^ static_cast<uint64>(v >> 63); }
+        inline int64  UnZigZag(uint64 v) { return static_cast<int64>(v >> 1) ^ -static_cast<int64>(v & 1); }
+
+        inline void WriteVarint(std::vector<BYTE>& out, uint64 v)
+        {
+            while (v >= 0x80)
+            {
+                out.push_back(static_cast<BYTE>(v | 0x80));
+                v >>= 7;
+            }
+            out.push_back(static_cast<BYTE>(v));
+        }
+
+        template<typename T>
+        inline void WriteFixed(std::vector<BYTE>& out, T v)
+        {
+            const size_t pos = out.size();
+            out.resize(pos + sizeof(T));
+            ::memcpy(out.data() + pos, &v, sizeof(T));
+        }
+
+        template<typename T>
+        inline void PatchFixed(std::vector<BYTE>& out, size_t pos, T v)
+        {
+            ::memcpy(out.data() + pos, &v, sizeof(T));
+        }
+
+        struct Reader
+        {
+            const BYTE* cur;
+            const BYTE* end;
+            bool        ok = true;
+
+            uint64 Varint()
+            {
+                uint64 v = 0;
+                for (int shift = 0; shift < 64; shift += 7)
+                {
+                    if (cur >= end) { ok = false; return 0; }
+                    const BYTE b = *cur++;
+                    v |= static_cast<uint64>(b & 0x7F) << shift;
+                    if ((b & 0x80) == 0)
+                        return v;
+                }
+                ok = false;
+                return 0;
+            }
+
+            template<typename T>
+            T Fixed()
+            {
+                T v{};
+                if (end - cur < static_cast<ptrdiff_t>(sizeof(T))) { ok = false; return v; }
+                ::memcpy(&v, cur, sizeof(T));
+                cur += sizeof(T);
+                return v;
+            }
+        };
+
+        constexpr uint64 FLAG_POS = 1;
+        constexpr uint64 FLAG_YAW = 2;
+
+        // 디코드 중간 결과 (baseline과 합치기 전)
+        struct Change
+        {
+            uint64 monsterId;
+            uint64 flags;
+            int64  dx, dy, dz;
+            int16  dyaw;
+        };
+
+        Entry ApplyChange(const Entry& base, const Change& c)
+        {
+            Entry e = base;
+            e.monsterId = c.monsterId;
+            if (c.flags & FLAG_POS)
+            {
+                e.qx = static_cast<int32>(base.qx + c.dx);
+                e.qy = static_cast<int32>(base.qy + c.dy);
+                e.qz = static_cast<int32>(base.qz + c.dz);
+            }
+            if (c.flags & FLAG_YAW)
+                e.qyaw = static_cast<uint16>(base.qyaw + c.dyaw);
+            return e;
+        }
+    }
+
+    // =========================================================================
+    // 양자화
+    // =========================================================================
+
+    Entry Quantize(uint64 monsterId, float x, float y, float z, float yaw)
+    {
+        Entry e;
+        e.monsterId = monsterId;
+        e.qx = static_cast<int32>(std::lround(x * POS_SCALE));
+        e.qy = static_cast<int32>(std::lround(y * POS_SCALE));
+        e.qz = static_cast<int32>(std::lround(z * POS_SCALE));
+
+        // yaw는 360도 주기이므로 [0, 360) 으로 접은 뒤 16비트로 감는다
+        float wrapped = std::fmod(yaw, 360.0f);
+        if (wrapped < 0.0f) wrapped += 360.0f;
+        e.qyaw = static_cast<uint16>(static_cast<uint32>(std::lround(wrapped * YAW_SCALE)) & 0xFFFF);
+        return e;
+    }
+
+    void Dequantize(const Entry& e, float& x, float& y, float& z, float& yaw)
+    {
+        x   = static_cast<float>(e.qx) / POS_SCALE;
+        y   = static_cast<float>(e.qy) / POS_SCALE;
+        z   = static_cast<float>(e.qz) / POS_SCALE;
+        yaw = static_cast<float>(e.qyaw) / YAW_SCALE;
+    }
+
+    // =========================================================================
+    // History
+    // =========================================================================
+
+    void History::Push(const Frame& frame)
+    {
+        Frame& slot = m_Frames[frame.sequence % HISTORY_SIZE];
+        slot.sequence = frame.sequence;
+        slot.entries.assign(frame.entries.begin(), frame.entries.end());   // 슬롯 용량 재사용
+    }
+
+    const Frame* History::Find(uint32 sequence) const
+    {
+        if (sequence == 0)
+            return nullptr;
+
+        const Frame& slot = m_Frames[sequence % HISTORY_SIZE];
+        return (slot.sequence == sequence) ? &slot : nullptr;
+    }
+
+    void History::Clear()
+    {
+        for (Frame& f : m_Frames)
+        {
+            f.sequence = 0;
+            f.entries.clear();
+        }
+    }
+
+    // =========================================================================
+    // Encode
+    // =========================================================================
+
+    void Encode(const Frame& cur, const Frame* baseline, std::vector<BYTE>& out)
+    {
+        static const std::vector<Entry> s_Empty;
+        const std::vector<Entry>& base = baseline ? baseline->entries : s_Empty;
+
+        WriteFixed<uint32>(out, cur.sequence);
+        WriteFixed<uint32>(out, baseline ? baseline->sequence : 0);
+
+        const size_t countPos = out.size();
+        WriteFixed<uint16>(out, 0);
+
+        thread_local std::vector<uint64> removed;
+        removed.clear();
+
+        const Entry zero{};
+        uint16 entryCount = 0;
+        uint64 prevId = 0;
+        size_t j = 0;
+
+        for (const Entry& e : cur.entries)
+        {
+            while (j < base.size() && base[j].monsterId < e.monsterId)
+                removed.push_back(base[j++].monsterId);
+
+            const bool inBase = (j < base.size() && base[j].monsterId == e.monsterId);
+            const Entry& b = inBase ? base[j++] : zero;
+
+            uint64 flags = 0;
+            if (e.qx != b.qx || e.qy != b.qy || e.qz != b.qz) flags |= FLAG_POS;
+            if (e.qyaw != b.qyaw)                              flags |= FLAG_YAW;
+
+            // baseline에 있던 몬스터가 그대로면 생략. 새 몬스터는 값이 0이어도 존재를 알려야 하므로 기록
+            if (inBase && flags == 0)
+                continue;
+
+            WriteVarint(out, ((e.monsterId - prevId) << 2) | flags);
+            prevId = e.monsterId;
+
+            if (flags & FLAG_POS)
+            {
+                WriteVarint(out, ZigZag(static_cast<int64>(e.qx) - b.qx));
+                WriteVarint(out, ZigZag(static_cast<int64>(e.qy) - b.qy));
+                WriteVarint(out, ZigZag(static_cast<int64>(e.qz) - b.qz));
+            }
+            if (flags & FLAG_YAW)
+            {
+                // 16비트 감김 차이 → 가장 짧은 방향
+                WriteVarint(out, ZigZag(static_cast<int16>(static_cast<uint16>(e.qyaw - b.qyaw))));
+            }
+            ++entryCount;
+        }
+
+        while (j < base.size())
+            removed.push_back(base[j++].monsterId);
+
+        PatchFixed<uint16>(out, countPos, entryCount);
+
+        WriteFixed<uint16>(out, static_cast<uint16>(removed.size()));
+        prevId = 0;
+        for (uint64 id : removed)
+        {
+            WriteVarint(out, id - prevId);
+            prevId = id;
+        }
+    }
+
+    void EncodeForClient(const History& history, const Frame& cur, const ClientState& client, std::vector<BYTE>& out)
+    {
+        Encode(cur, history.Find(client.ackedSequence), out);
+    }
+
+    // =========================================================================
+    // Decode
+    // =========================================================================
+
+    DecodeResult Decode(const BYTE* data, int32 len, const History& history, Frame& out)
+    {
+        if (data == nullptr || len < 0)
+            return DecodeResult::Malformed;
+
+        Reader r{ data, data + len };
+
+        const uint32 sequence     = r.Fixed<uint32>();
+        const uint32 baselineSeq  = r.Fixed<uint32>();
+        const uint16 entryCount   = r.Fixed<uint16>();
+        if (!r.ok || sequence == 0)
+            return DecodeResult::Malformed;
+
+        const Frame* baseline = nullptr;
+        if (baselineSeq != 0)
+        {
+            baseline = history.Find(baselineSeq);
+            if (baseline == nullptr)
+                return DecodeResult::MissingBaseline;
+        }
+
+        thread_local std::vector<Change> changes;
+        thread_local std::vector<uint64> removed;
+        changes.clear();
+        removed.clear();
+
+        uint64 prevId = 0;
+        for (uint16 n = 0; n < entryCount; ++n)
+        {
+            const uint64 head = r.Varint();
+            Change c{};
+            c.monsterId = prevId + (head >> 2);
+            c.flags     = head & 3;
+            if (c.flags & FLAG_POS)
+            {
+                c.dx = UnZigZag(r.Varint());
+                c.dy = UnZigZag(r.Varint());
+                c.dz = UnZigZag(r.Varint());
+            }
+            if (c.flags & FLAG_YAW)
+                c.dyaw = static_cast<int16>(UnZigZag(r.Varint()));
+
+            // ID는 엄격히 오름차순 (첫 항목의 ID 0은 허용)
+            if (!r.ok || (n > 0 && c.monsterId <= prevId))
+                return DecodeResult::Malformed;
+
+            prevId = c.monsterId;
+            changes.push_back(c);
+        }
+
+        const uint16 removedCount = r.Fixed<uint16>();
+        prevId = 0;
+        for (uint16 n = 0; n < removedCount; ++n)
+        {
+            const uint64 id = prevId + r.Varint();
+            if (!r.ok || (n > 0 && id <= prevId))
+                return DecodeResult::Malformed;
+            prevId = id;
+            removed.push_back(id);
+        }
+
+        if (!r.ok || r.cur != r.end)
+            return DecodeResult::Malformed;
+
+        // baseline / changes / removed 세 개의 정렬된 목록을 합친다
+        static const std::vector<Entry> s_Empty;
+        const std::vector<Entry>& base = baseline ? baseline->entries : s_Empty;
+
+        out.sequence = sequence;
+        out.entries.clear();
+        out.entries.reserve(base.size() + changes.size());
+
+        const Entry zero{};
+        size_t i = 0, j = 0, k = 0;
+        while (i < base.size() || j < changes.size())
+        {
+            if (j < changes.size() && (i >= base.size() || changes[j].monsterId <= base[i].monsterId))
+            {
+                const bool inBase = (i < base.size() && changes[j].monsterId == base[i].monsterId);
+                out.entries.push_back(ApplyChange(inBase ? base[i] : zero, changes[j]));
+                if (inBase) ++i;
+                ++j;
+                continue;
+            }
+
+            const uint64 id = base[i].monsterId;
+            while (k < removed.size() && removed[k] < id) ++k;
+            if (k >= removed.size() || removed[k] != id)
+                out.entries.push_back(base[i]);
+            ++i;
+        }
+
+        return DecodeResult::Ok;
+    }
+}
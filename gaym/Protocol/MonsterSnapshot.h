@@ -0,0 +1,87 @@
+#pragma once
+#include "../ServerCore/Types.h"
+#include <vector>
+
+// =============================================================================
+// MonsterSnapshot: 방 단위 몬스터 위치/방향 스냅샷 (PKT_S_MONSTER_SNAPSHOT)
+//
+// 몬스터마다 S_MONSTER_MOVE (헤더 4B + protobuf 약 25B) 를 보내던 것을
+// 서버 틱마다 방 하나당 패킷 하나로 묶는다. 서버/클라가 같은 코덱을 쓴다.
+//  - 위치는 1/64m, yaw는 360도/65536 단위로 양자화
+//  - 클라가 마지막으로 ACK한 스냅샷(baseline)과의 차이만 zigzag varint로 기록.
+//    바뀌지 않은 몬스터는 생략하고, baseline에는 있는데 없어진 몬스터는 removed 목록으로 보낸다
+//  - baseline이 없으면 (첫 스냅샷, 너무 오래된 ACK, C_MONSTER_RESYNC 요청) baselineSequence=0 인 full 스냅샷
+//  - protobuf를 거치지 않는 raw 페이로드
+//
+// sequence는 서버 전체에서 단조 증가시키고 0은 쓰지 않는다 (방이 바뀌어도 이전 방 번호를 재사용하지 않도록).
+//
+// 페이로드 (PacketHeader 뒤, little endian):
+//   uint32 sequence
+//   uint32 baselineSequence        (0 = full)
+//   uint16 entryCount
+//   entryCount × { varint (idDelta << 2 | flags), [zz dx, zz dy, zz dz] (flags & 1), [zz dyaw] (flags & 2) }
+//   uint16 removedCount
+//   removedCount × varint idDelta
+// idDelta는 같은 목록 안의 직전 ID와의 차이 (ID 오름차순).
+// =============================================================================
+
+namespace MonsterSnapshot
+{
+    constexpr float  POS_SCALE    = 64.0f;               // 1 = 1/64m
+    constexpr float  YAW_SCALE    = 65536.0f / 360.0f;   // 1 = 360/65536도
+    constexpr uint32 HISTORY_SIZE = 32;                  // 보관하는 과거 스냅샷 수 (20Hz 기준 1.6초)
+
+    struct Entry
+    {
+        uint64 monsterId = 0;
+        int32  qx = 0, qy = 0, qz = 0;
+        uint16 qyaw = 0;
+    };
+
+    // 한 틱의 방 전체 상태. entries는 monsterId 오름차순이어야 한다
+    struct Frame
+    {
+        uint32             sequence = 0;
+        std::vector<Entry> entries;
+    };
+
+    enum class DecodeResult
+    {
+        Ok,
+        MissingBaseline,    // baseline을 잃어버림 → C_MONSTER_RESYNC 요청
+        Malformed
+    };
+
+    Entry Quantize(uint64 monsterId, float x, float y, float z, float yaw);
+    void  Dequantize(const Entry& e, float& x, float& y, float& z, float& yaw);
+
+    // 최근 HISTORY_SIZE개 스냅샷 (서버: 방마다 baseline용, 클라: 디코드한 결과)
+    class History
+    {
+    public:
+        void         Push(const Frame& frame);
+        const Frame* Find(uint32 sequence) const;
+        void         Clear();
+
+    private:
+        Frame m_Frames[HISTORY_SIZE];
+    };
+
+    // 서버: 클라이언트 하나의 ACK 상태
+    struct ClientState
+    {
+        uint32 ackedSequence = 0;   // 0 = 아직 없음 → full
+
+        void OnAck(uint32 sequence) { if (sequence > ackedSequence) ackedSequence = sequence; }
+        void RequestResync()        { ackedSequence = 0; }
+    };
+
+    // cur를 baseline 기준으로 인코딩해서 out 뒤에 붙인다 (baseline == nullptr 이면 full)
+    void Encode(const Frame& cur, const Frame* baseline, std::vector<BYTE>& out);
+
+    // 서버: 방 history와 클라 ACK 상태로 baseline을 골라 인코딩
+    void EncodeForClient(const History& history, const Frame& cur, const ClientState& client, std::vector<BYTE>& out);
+
+    // 페이로드를 history 안의 baseline에 적용해서 전체 상태를 out에 복원
+    DecodeResult Decode(const BYTE* data, int32 len, const History& history, Frame& out);
+}
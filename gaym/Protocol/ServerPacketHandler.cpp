@@ -11,8 +11,6 @@ void WriteNetworkLog(const std::string& msg)
     ofs << msg << std::endl;
 }
 
-PacketHandlerFunc GPacketHandler[UINT16_MAX];
-
 // 잘못된 패킷 처리
 bool Handle_INVALID(PacketSessionRef& session, BYTE* buffer, int32 len)
 {
@@ -230,6 +228,19 @@ bool Handle_S_MONSTER_MOVE(PacketSessionRef& session, Protocol::S_MONSTER_MOVE&
     return true;
 }
 
+// 몬스터 스냅샷 처리 (raw 페이로드 — 디코드/ACK는 NetworkManager가 담당)
+bool Handle_S_MONSTER_SNAPSHOT(PacketSessionRef& session, BYTE* buffer, int32 len)
+{
+    if (len < static_cast<int32>(sizeof(PacketHeader)))
+        return false;
+
+    NetworkManager* pNetMgr = NetworkManager::GetInstance();
+    if (!pNetMgr)
+        return true;
+
+    return pNetMgr->OnMonsterSnapshot(session, buffer + sizeof(PacketHeader), len - static_cast<int32>(sizeof(PacketHeader)));
+}
+
 // 몬스터 디스폰 처리
 bool Handle_S_MONSTER_DESPAWN(PacketSessionRef& session, Protocol::S_MONSTER_DESPAWN& pkt)
 {
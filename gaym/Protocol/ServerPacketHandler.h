@@ -1,8 +1,6 @@
 #pragma once
 #include "Protocol.pb.h"
-
-using PacketHandlerFunc = std::function<bool(PacketSessionRef&, BYTE*, int32)>;
-extern PacketHandlerFunc GPacketHandler[UINT16_MAX];
+#include <google/protobuf/io/zero_copy_stream_impl_lite.h>
 
 enum : uint16
 {
@@ -29,6 +27,11 @@ enum : uint16
 	PKT_C_PLAYER_ATTACK = 1020,
 	PKT_S_MONSTER_DAMAGE = 1021,
 	PKT_S_ROOM_CLEARED = 1022,
+
+	// raw 페이로드 패킷 (protobuf 아님, Protocol/MonsterSnapshot.h 참고)
+	PKT_S_MONSTER_SNAPSHOT = 1023,
+	PKT_C_MONSTER_SNAPSHOT_ACK = 1024,
+	PKT_C_MONSTER_RESYNC = 1025,
 };
 
 // Custom Handlers
@@ -48,36 +51,40 @@ bool Handle_S_MONSTER_ATTACK(PacketSessionRef& session, Protocol::S_MONSTER_ATTA
 bool Handle_S_PLAYER_DAMAGE(PacketSessionRef& session, Protocol::S_PLAYER_DAMAGE& pkt);
 bool Handle_S_MONSTER_DAMAGE(PacketSessionRef& session, Protocol::S_MONSTER_DAMAGE& pkt);
 bool Handle_S_ROOM_CLEARED(PacketSessionRef& session, Protocol::S_ROOM_CLEARED& pkt);
+bool Handle_S_MONSTER_SNAPSHOT(PacketSessionRef& session, BYTE* buffer, int32 len);
 
 class ServerPacketHandler
 {
 public:
-	static void Init()
-	{
-		for (int32 i = 0; i < UINT16_MAX; i++)
-			GPacketHandler[i] = Handle_INVALID;
-		GPacketHandler[PKT_S_LOGIN] = [](PacketSessionRef& session, BYTE* buffer, int32 len) { return HandlePacket<Protocol::S_LOGIN>(Handle_S_LOGIN, session, buffer, len); };
-		GPacketHandler[PKT_S_ENTER_GAME] = [](PacketSessionRef& session, BYTE* buffer, int32 len) { return HandlePacket<Protocol::S_ENTER_GAME>(Handle_S_ENTER_GAME, session, buffer, len); };
-		GPacketHandler[PKT_S_CHAT] = [](PacketSessionRef& session, BYTE* buffer, int32 len) { return HandlePacket<Protocol::S_CHAT>(Handle_S_CHAT, session, buffer, len); };
-		GPacketHandler[PKT_S_SPAWN] = [](PacketSessionRef& session, BYTE* buffer, int32 len) { return HandlePacket<Protocol::S_SPAWN>(Handle_S_SPAWN, session, buffer, len); };
-		GPacketHandler[PKT_S_DESPAWN] = [](PacketSessionRef& session, BYTE* buffer, int32 len) { return HandlePacket<Protocol::S_DESPAWN>(Handle_S_DESPAWN, session, buffer, len); };
-		GPacketHandler[PKT_S_MOVE] = [](PacketSessionRef& session, BYTE* buffer, int32 len) { return HandlePacket<Protocol::S_MOVE>(Handle_S_MOVE, session, buffer, len); };
-		GPacketHandler[PKT_S_SKILL] = [](PacketSessionRef& session, BYTE* buffer, int32 len) { return HandlePacket<Protocol::S_SKILL>(Handle_S_SKILL, session, buffer, len); };
-		GPacketHandler[PKT_S_ROOM_TRANSITION] = [](PacketSessionRef& session, BYTE* buffer, int32 len) { return HandlePacket<Protocol::S_ROOM_TRANSITION>(Handle_S_ROOM_TRANSITION, session, buffer, len); };
-		GPacketHandler[PKT_S_MONSTER_SPAWN] = [](PacketSessionRef& session, BYTE* buffer, int32 len) { return HandlePacket<Protocol::S_MONSTER_SPAWN>(Handle_S_MONSTER_SPAWN, session, buffer, len); };
-		GPacketHandler[PKT_S_MONSTER_MOVE] = [](PacketSessionRef& session, BYTE* buffer, int32 len) { return HandlePacket<Protocol::S_MONSTER_MOVE>(Handle_S_MONSTER_MOVE, session, buffer, len); };
-		GPacketHandler[PKT_S_MONSTER_DESPAWN] = [](PacketSessionRef& session, BYTE* buffer, int32 len) { return HandlePacket<Protocol::S_MONSTER_DESPAWN>(Handle_S_MONSTER_DESPAWN, session, buffer, len); };
-		GPacketHandler[PKT_S_MONSTER_ATTACK] = [](PacketSessionRef& session, BYTE* buffer, int32 len) { return HandlePacket<Protocol::S_MONSTER_ATTACK>(Handle_S_MONSTER_ATTACK, session, buffer, len); };
-		GPacketHandler[PKT_S_PLAYER_DAMAGE] = [](PacketSessionRef& session, BYTE* buffer, int32 len) { return HandlePacket<Protocol::S_PLAYER_DAMAGE>(Handle_S_PLAYER_DAMAGE, session, buffer, len); };
-		GPacketHandler[PKT_S_MONSTER_DAMAGE] = [](PacketSessionRef& session, BYTE* buffer, int32 len) { return HandlePacket<Protocol::S_MONSTER_DAMAGE>(Handle_S_MONSTER_DAMAGE, session, buffer, len); };
-		GPacketHandler[PKT_S_ROOM_CLEARED] = [](PacketSessionRef& session, BYTE* buffer, int32 len) { return HandlePacket<Protocol::S_ROOM_CLEARED>(Handle_S_ROOM_CLEARED, session, buffer, len); };
-	}
-
+	// 실제 ID 범위(1000~)에 대한 switch — 컴파일러가 작은 점프 테이블로 만든다
 	static bool HandlePacket(PacketSessionRef& session, BYTE* buffer, int32 len)
 	{
+		if (len < static_cast<int32>(sizeof(PacketHeader)))
+			return false;
+
 		PacketHeader* header = reinterpret_cast<PacketHeader*>(buffer);
-		return GPacketHandler[header->id](session, buffer, len);
+		switch (header->id)
+		{
+		case PKT_S_LOGIN: return HandlePacket<Protocol::S_LOGIN>(Handle_S_LOGIN, session, buffer, len);
+		case PKT_S_ENTER_GAME: return HandlePacket<Protocol::S_ENTER_GAME>(Handle_S_ENTER_GAME, session, buffer, len);
+		case PKT_S_CHAT: return HandlePacket<Protocol::S_CHAT>(Handle_S_CHAT, session, buffer, len);
+		case PKT_S_SPAWN: return HandlePacket<Protocol::S_SPAWN>(Handle_S_SPAWN, session, buffer, len);
+		case PKT_S_DESPAWN: return HandlePacket<Protocol::S_DESPAWN>(Handle_S_DESPAWN, session, buffer, len);
+		case PKT_S_MOVE: return HandlePacket<Protocol::S_MOVE>(Handle_S_MOVE, session, buffer, len);
+		case PKT_S_SKILL: return HandlePacket<Protocol::S_SKILL>(Handle_S_SKILL, session, buffer, len);
+		case PKT_S_ROOM_TRANSITION: return HandlePacket<Protocol::S_ROOM_TRANSITION>(Handle_S_ROOM_TRANSITION, session, buffer, len);
+		case PKT_S_MONSTER_SPAWN: return HandlePacket<Protocol::S_MONSTER_SPAWN>(Handle_S_MONSTER_SPAWN, session, buffer, len);
+		case PKT_S_MONSTER_MOVE: return HandlePacket<Protocol::S_MONSTER_MOVE>(Handle_S_MONSTER_MOVE, session, buffer, len);
+		case PKT_S_MONSTER_DESPAWN: return HandlePacket<Protocol::S_MONSTER_DESPAWN>(Handle_S_MONSTER_DESPAWN, session, buffer, len);
+		case PKT_S_MONSTER_ATTACK: return HandlePacket<Protocol::S_MONSTER_ATTACK>(Handle_S_MONSTER_ATTACK, session, buffer, len);
+		case PKT_S_PLAYER_DAMAGE: return HandlePacket<Protocol::S_PLAYER_DAMAGE>(Handle_S_PLAYER_DAMAGE, session, buffer, len);
+		case PKT_S_MONSTER_DAMAGE: return HandlePacket<Protocol::S_MONSTER_DAMAGE>(Handle_S_MONSTER_DAMAGE, session, buffer, len);
+		case PKT_S_ROOM_CLEARED: return HandlePacket<Protocol::S_ROOM_CLEARED>(Handle_S_ROOM_CLEARED, session, buffer, len);
+		case PKT_S_MONSTER_SNAPSHOT: return Handle_S_MONSTER_SNAPSHOT(session, buffer, len);
+		default: return Handle_INVALID(session, buffer, len);
+		}
 	}
+
 	static SendBufferRef MakeSendBuffer(Protocol::C_LOGIN& pkt) { return MakeSendBuffer(pkt, PKT_C_LOGIN); }
 	static SendBufferRef MakeSendBuffer(Protocol::C_ENTER_GAME& pkt) { return MakeSendBuffer(pkt, PKT_C_ENTER_GAME); }
 	static SendBufferRef MakeSendBuffer(Protocol::C_CHAT& pkt) { return MakeSendBuffer(pkt, PKT_C_CHAT); }
@@ -86,29 +93,71 @@ public:
 	static SendBufferRef MakeSendBuffer(Protocol::C_PORTAL_INTERACT& pkt) { return MakeSendBuffer(pkt, PKT_C_PORTAL_INTERACT); }
 	static SendBufferRef MakeSendBuffer(Protocol::C_TORCH_INTERACT& pkt) { return MakeSendBuffer(pkt, PKT_C_TORCH_INTERACT); }
 	static SendBufferRef MakeSendBuffer(Protocol::C_PLAYER_ATTACK& pkt) { return MakeSendBuffer(pkt, PKT_C_PLAYER_ATTACK); }
+	static SendBufferRef MakeMonsterSnapshotAck(uint32 sequence) { return MakeRawSendBuffer(&sequence, sizeof(sequence), PKT_C_MONSTER_SNAPSHOT_ACK); }
+	static SendBufferRef MakeMonsterResync() { return MakeRawSendBuffer(nullptr, 0, PKT_C_MONSTER_RESYNC); }
 
 private:
 	template<typename PacketType, typename ProcessFunc>
 	static bool HandlePacket(ProcessFunc func, PacketSessionRef& session, BYTE* buffer, int32 len)
 	{
-		PacketType pkt;
-		if (pkt.ParseFromArray(buffer + sizeof(PacketHeader), len - sizeof(PacketHeader)) == false)
+		// 쓰레드별로 메시지 객체를 재사용. Clear()는 string/repeated 필드 버퍼를 남겨 두므로
+		// 같은 타입 패킷을 다시 받을 때 힙 할당이 생기지 않는다 (핸들러는 pkt를 호출 밖으로 들고 나가지 않음)
+		thread_local PacketType pkt;
+		if (ParsePacket(pkt, buffer + sizeof(PacketHeader), len - static_cast<int32>(sizeof(PacketHeader))) == false)
 			return false;
 
 		return func(session, pkt);
 	}
 
+	// ParseFromArray 는 안에서 Clear() 를 부른다
+	template<typename PacketType>
+	static bool ParsePacket(PacketType& pkt, BYTE* data, int32 size) { return pkt.ParseFromArray(data, size); }
+
+	// 단일 하위 메시지 필드는 Clear()가 delete 해 버린다 — 하위 메시지만 비우고 Merge 로 읽어서 객체와 문자열 버퍼를 남긴다.
+	// (그래서 has_player()/has_monster() 는 한 번 받은 뒤로 항상 true, 핸들러는 값만 읽는다)
+	static bool ParsePacket(Protocol::S_SPAWN& pkt, BYTE* data, int32 size)
+	{
+		pkt.mutable_player()->Clear();
+		return MergePacket(pkt, data, size);
+	}
+
+	static bool ParsePacket(Protocol::S_MONSTER_SPAWN& pkt, BYTE* data, int32 size)
+	{
+		pkt.mutable_monster()->Clear();
+		return MergePacket(pkt, data, size);
+	}
+
+	static bool MergePacket(google::protobuf::MessageLite& pkt, BYTE* data, int32 size)
+	{
+		google::protobuf::io::ArrayInputStream input(data, size);
+		return pkt.MergeFromBoundedZeroCopyStream(&input, size);
+	}
+
 	template<typename T>
 	static SendBufferRef MakeSendBuffer(T& pkt, uint16 pktId)
 	{
-		const uint16 dataSize = static_cast<uint16>(pkt.ByteSizeLong());
-		const uint16 packetSize = dataSize + sizeof(PacketHeader);
-
-		SendBufferRef sendBuffer = GSendBufferManager->Open(packetSize);
-		PacketHeader* header = reinterpret_cast<PacketHeader*>(sendBuffer->Buffer());
-		header->size = packetSize;
-		header->id = pktId;
-		ASSERT_CRASH(pkt.SerializeToArray(&header[1], dataSize));
+		// 64KB를 넘으면 PacketSession::WriteHeader가 확장 헤더를 쓴다
+		const uint32 dataSize = static_cast<uint32>(pkt.ByteSizeLong());
+		const uint32 headerSize = PacketSession::HeaderSize(dataSize);
+
+		SendBufferRef sendBuffer = GSendBufferManager->Open(headerSize + dataSize);
+		BYTE* buffer = sendBuffer->Buffer();
+		const uint32 packetSize = PacketSession::WriteHeader(buffer, pktId, dataSize);
+		ASSERT_CRASH(pkt.SerializeToArray(buffer + headerSize, static_cast<int>(dataSize)));
+		sendBuffer->Close(packetSize);
+
+		return sendBuffer;
+	}
+
+	static SendBufferRef MakeRawSendBuffer(const void* data, uint32 dataSize, uint16 pktId)
+	{
+		const uint32 headerSize = PacketSession::HeaderSize(dataSize);
+
+		SendBufferRef sendBuffer = GSendBufferManager->Open(headerSize + dataSize);
+		BYTE* buffer = sendBuffer->Buffer();
+		const uint32 packetSize = PacketSession::WriteHeader(buffer, pktId, dataSize);
+		if (dataSize > 0)
+			::memcpy(buffer + headerSize, data, dataSize);
 		sendBuffer->Close(packetSize);
 
 		return sendBuffer;
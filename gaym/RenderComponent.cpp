@@ -4,15 +4,40 @@
 #include "TransformComponent.h"
 #include "Mesh.h"
 #include "Shader.h"
+#include <algorithm>
+
+std::vector<RenderComponent*> RenderComponent::s_vDirty;
+bool RenderComponent::s_bInvalidated = false;
 
 RenderComponent::RenderComponent(GameObject* pOwner) : Component(pOwner)
 {
+    MarkRenderListDirty();
 }
 
 RenderComponent::~RenderComponent()
 {
     if (m_pOwnerShader)
         m_pOwnerShader->RemoveRenderComponent(this);
+    if (m_bDirty)
+        s_vDirty.erase(std::find(s_vDirty.begin(), s_vDirty.end(), this));
+}
+
+void RenderComponent::MarkRenderListDirty()
+{
+    if (m_bDirty)
+        return;
+    m_bDirty = true;
+    s_vDirty.push_back(this);
+}
+
+uint64_t RenderComponent::GetSortKey() const
+{
+    if (GetRenderPass() == 1)
+        return uint64_t(1) << 62;
+
+    uint64_t nMaterial = m_pOwner->HasTexture() ? (m_pOwner->GetSrvDescriptorHandle().ptr & 0x3FFFFFFF) : 0;
+    uint64_t nMesh = reinterpret_cast<uintptr_t>(m_pMesh) & 0xFFFFFFFF;
+    return (uint64_t(GetRenderPass()) << 62) | (nMaterial << 32) | nMesh;
 }
 
 void RenderComponent::Init(ID3D12Device* pDevice, ID3D12GraphicsCommandList* pCommandList)
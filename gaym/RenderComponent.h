@@ -2,6 +2,8 @@
 #include "Component.h"
 #include "Mesh.h"
 #include <memory>
+#include <cstdint>
+#include <vector>
 
 class Shader;
 
@@ -15,25 +17,63 @@ public:
     virtual void Update(float deltaTime) override;
     virtual void Render(ID3D12GraphicsCommandList* pCommandList) override;
 
-    void SetMesh(Mesh* pMesh) { m_pMesh = pMesh; }
+    void SetMesh(Mesh* pMesh) { if (m_pMesh != pMesh) { m_pMesh = pMesh; MarkRenderListDirty(); } }
     Mesh* GetMesh() { return m_pMesh; }
 
     void SetCastsShadow(bool bCasts) { m_bCastsShadow = bCasts; }
     bool CastsShadow() const { return m_bCastsShadow; }
 
-    void SetTransparent(bool bTransparent) { m_bTransparent = bTransparent; }
+    void SetTransparent(bool bTransparent) { if (m_bTransparent != bTransparent) { m_bTransparent = bTransparent; MarkRenderListDirty(); } }
     bool IsTransparent() const { return m_bTransparent; }
 
     // UI/오버레이처럼 depth test 무시하고 항상 맨 위에 그리기 (공격 인디케이터 등)
-    void SetOverlay(bool bOverlay) { m_bOverlay = bOverlay; }
+    void SetOverlay(bool bOverlay) { if (m_bOverlay != bOverlay) { m_bOverlay = bOverlay; MarkRenderListDirty(); } }
     bool IsOverlay() const { return m_bOverlay; }
 
-    void SetOwnerShader(Shader* pShader) { m_pOwnerShader = pShader; }
+    // 등록된 Shader 와 등록 당시 정렬 키 (Shader 만 기록한다). nullptr 면 어느 리스트에도 없음
+    void SetListed(Shader* pShader, uint64_t nListedKey) { m_pOwnerShader = pShader; m_nListedKey = nListedKey; }
+    Shader* GetOwnerShader() const { return m_pOwnerShader; }
+    uint64_t GetListedKey() const { return m_nListedKey; }
+
+    // Scene 컬러 아이템 index (-1 = 없음). 리스트에서 빠질 때 Shader 가 반납한다
+    void SetCullItem(int nCullItem) { m_nCullItem = nCullItem; }
+    int GetCullItem() const { return m_nCullItem; }
+
+    // 이번 프레임 컬링 결과 (Scene::UpdateVisibility 가 기록). 범위를 모르는 메쉬는 항상 true
+    void SetCullResult(bool bInView, bool bInShadowView) { m_bInView = bInView; m_bInShadowView = bInShadowView; }
+    bool IsInView() const { return m_bInView; }
+    bool IsInShadowView() const { return m_bInShadowView; }
+
+    // 0 = 불투명, 1 = 투명(물), 2 = 오버레이 — Shader::Render 가 이 순서로 그린다
+    uint32_t GetRenderPass() const { return m_bOverlay ? 2 : (m_bTransparent ? 1 : 0); }
+
+    // Shader 정렬 키: [63:62] 패스 | [61:32] albedo SRV 하위 30비트 | [31:0] 메쉬 주소 하위 32비트.
+    // 같은 재질/메쉬를 붙여 놓기 위한 키라 하위 비트 충돌은 묶음만 조금 나빠질 뿐 결과에는 영향 없다.
+    // 투명 패스는 블렌딩 순서가 결과라 패스 비트만 준다 — SortedDrawList 가 넣은 순번을 붙인다
+    uint64_t GetSortKey() const;
+
+    // 생성/메쉬·패스 변경처럼 리스트 소속이나 정렬 위치가 바뀔 수 있을 때. 다음 Scene::UpdateRenderList 가
+    // 이 컴포넌트만 빼고 정렬 키 자리에 다시 넣는다
+    void MarkRenderListDirty();
+    static std::vector<RenderComponent*>& GetDirtyList() { return s_vDirty; }
+    void ClearDirtyFlag() { m_bDirty = false; }
+
+    // 리스트를 통째로 비웠을 때 (방 전환). 다음 UpdateRenderList 는 전체를 다시 모은다
+    static void InvalidateRenderLists() { s_bInvalidated = true; }
+    static bool ConsumeInvalidation() { bool b = s_bInvalidated; s_bInvalidated = false; return b; }
 
 private:
     Mesh* m_pMesh = nullptr;
     bool m_bCastsShadow = false;
     bool m_bTransparent = false;
     bool m_bOverlay = false;
+    bool m_bInView = true;
+    bool m_bInShadowView = true;
+    bool m_bDirty = false;
     Shader* m_pOwnerShader = nullptr;
+    uint64_t m_nListedKey = 0;
+    int m_nCullItem = -1;
+
+    static std::vector<RenderComponent*> s_vDirty;
+    static bool s_bInvalidated;
 };
\ No newline at end of file
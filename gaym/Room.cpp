@@ -52,11 +52,27 @@ void CRoom::Update(float deltaTime)
         CheckClearCondition();
     }
 
+    // 이웃 격자는 지난 프레임 끝 위치. 이번 이동 동안 한 적이 갈 수 있는 거리
+    // (추적 속도 + 이웃 하나만큼의 분리 밀림) 만큼 후보 반경을 넓힌다
+    float fMaxStepSpeed = 0.0f;
+    for (EnemyComponent* pEnemy : m_vEnemies)
+    {
+        if (pEnemy)
+            fMaxStepSpeed = max(fMaxStepSpeed, pEnemy->GetStats().m_fMoveSpeed + pEnemy->GetSeparationStrength());
+    }
+    m_fEnemyGridMargin = kEnemyGridMargin + fMaxStepSpeed * deltaTime;
+
     // Active 및 Cleared 상태 모두에서 오브젝트 업데이트 (드랍 아이템 등)
     for (auto& pGameObject : m_vGameObjects)
     {
         pGameObject->Update(deltaTime);
     }
+
+    // 적 이동이 끝난 위치로 색인과 격자 갱신. ProjectileManager(연쇄 번개) 와
+    // 다음 프레임 스킬(화염 궤적) 질의는 이동 뒤 위치를 그대로 본다
+    RefreshEnemyIndex();
+    RebuildEnemyGrid();
+    m_fEnemyGridMargin = kEnemyGridMargin;
 }
 
 void CRoom::Render(ID3D12GraphicsCommandList* pCommandList)
@@ -73,6 +89,7 @@ void CRoom::Render(ID3D12GraphicsCommandList* pCommandList)
 
 void CRoom::AddGameObject(std::unique_ptr<GameObject> pGameObject)
 {
+    pGameObject->m_pOwnerRoom = this;
     m_vGameObjects.push_back(std::move(pGameObject));
 }
 
@@ -87,8 +104,16 @@ void CRoom::RemoveGameObject(GameObject* pGameObject)
         auto it = std::find(m_vEnemies.begin(), m_vEnemies.end(), pEnemyComp);
         if (it != m_vEnemies.end())
         {
+            size_t nIndex = it - m_vEnemies.begin();
+            if (m_vEnemyHandles[nIndex] >= 0)
+                m_EnemyIndex.Remove(m_vEnemyHandles[nIndex]);
+            m_vEnemyHandles.erase(m_vEnemyHandles.begin() + nIndex);
             m_vEnemies.erase(it);
         }
+
+        auto itGrid = std::find(m_vGridEnemies.begin(), m_vGridEnemies.end(), pEnemyComp);
+        if (itGrid != m_vGridEnemies.end())
+            *itGrid = nullptr;
     }
 
     // Remove from game objects list
@@ -160,6 +185,8 @@ void CRoom::RegisterEnemy(EnemyComponent* pEnemy)
     if (!pEnemy) return;
 
     m_vEnemies.push_back(pEnemy);
+    m_vEnemyHandles.push_back(-1);     // 다음 RefreshEnemyIndex 에서 색인에 들어감
+    m_bEnemyGridDirty = true;          // 프레임 중 스폰도 다음 이웃 질의부터 보이도록
     m_nTotalEnemies++;
 
     wchar_t buffer[64];
@@ -167,6 +194,138 @@ void CRoom::RegisterEnemy(EnemyComponent* pEnemy)
     OutputDebugString(buffer);
 }
 
+BoundingSphere CRoom::GetEnemyHitSphere(GameObject* pObject)
+{
+    TransformComponent* pTransform = pObject->GetTransform();
+    XMFLOAT3 pos = pTransform->GetPosition();
+    XMFLOAT3 scale = pTransform->GetScale();
+
+    // Scale collision sphere based on enemy size (1.2 → 1.5 — 뚱뚱한 메시도 커버)
+    float maxScale = max(scale.x, max(scale.y, scale.z));
+    float radius = max(1.5f, maxScale * 1.5f);
+
+    BoundingSphere sphere(pos, radius);
+    sphere.Center.y += radius * 0.7f;
+    return sphere;
+}
+
+void CRoom::RefreshEnemyIndex()
+{
+    for (size_t i = 0; i < m_vEnemies.size(); ++i)
+    {
+        EnemyComponent* pEnemy = m_vEnemies[i];
+        int& nHandle = m_vEnemyHandles[i];
+
+        GameObject* pOwner = pEnemy ? pEnemy->GetOwner() : nullptr;
+        if (!pOwner || !pOwner->GetTransform() || pEnemy->IsDead())
+        {
+            // 죽은 적은 색인에서 빼서 질의 후보에도 안 나오게
+            if (nHandle >= 0)
+            {
+                m_EnemyIndex.Remove(nHandle);
+                nHandle = -1;
+            }
+            continue;
+        }
+
+        BoundingSphere sphere = GetEnemyHitSphere(pOwner);
+        const float center[3] = { sphere.Center.x, sphere.Center.y, sphere.Center.z };
+        if (nHandle < 0)
+        {
+            nHandle = m_EnemyIndex.Add(center, sphere.Radius);
+            if ((size_t)nHandle >= m_vHandleEnemies.size())
+                m_vHandleEnemies.resize(nHandle + 1, nullptr);
+            m_vHandleEnemies[nHandle] = pEnemy;
+        }
+        else
+        {
+            m_EnemyIndex.Move(nHandle, center, sphere.Radius);
+        }
+    }
+}
+
+void CRoom::SweepEnemies(const XMFLOAT3& p0, const XMFLOAT3& p1, float fRadius,
+                         std::vector<std::pair<EnemyComponent*, float>>& outHits) const
+{
+    outHits.clear();
+
+    static std::vector<EnemySweepHit> s_vHits;
+    const float a[3] = { p0.x, p0.y, p0.z };
+    const float b[3] = { p1.x, p1.y, p1.z };
+    m_EnemyIndex.SweepSphere(a, b, fRadius, s_vHits);
+
+    for (const EnemySweepHit& hit : s_vHits)
+    {
+        // 같은 프레임에 먼저 맞은 적이 죽었을 수 있다
+        EnemyComponent* pEnemy = m_vHandleEnemies[hit.nHandle];
+        if (pEnemy && !pEnemy->IsDead())
+            outHits.push_back({ pEnemy, hit.t });
+    }
+}
+
+void CRoom::QueryEnemies(const XMFLOAT3& center, float fRadius, std::vector<EnemyComponent*>& outEnemies) const
+{
+    outEnemies.clear();
+
+    static std::vector<int> s_vHandles;
+    const float c[3] = { center.x, center.y, center.z };
+    m_EnemyIndex.QuerySphere(c, fRadius, s_vHandles);
+
+    for (int nHandle : s_vHandles)
+    {
+        EnemyComponent* pEnemy = m_vHandleEnemies[nHandle];
+        if (pEnemy && !pEnemy->IsDead())
+            outEnemies.push_back(pEnemy);
+    }
+}
+
+void CRoom::RebuildEnemyGrid()
+{
+    m_vGridEnemies.clear();
+    m_vGridX.clear();
+    m_vGridZ.clear();
+
+    for (EnemyComponent* pEnemy : m_vEnemies)
+    {
+        GameObject* pOwner = pEnemy ? pEnemy->GetOwner() : nullptr;
+        if (!pOwner || !pOwner->GetTransform() || pEnemy->IsDead())
+            continue;
+
+        XMFLOAT3 pos = pOwner->GetTransform()->GetPosition();
+        m_vGridEnemies.push_back(pEnemy);
+        m_vGridX.push_back(pos.x);
+        m_vGridZ.push_back(pos.z);
+    }
+
+    m_EnemyGrid.Build(m_vGridX.data(), m_vGridZ.data(), (int)m_vGridEnemies.size());
+    m_bEnemyGridDirty = false;
+}
+
+void CRoom::QueryEnemiesInRadius2D(const XMFLOAT3& center, float fRadius, std::vector<EnemyComponent*>& outEnemies)
+{
+    outEnemies.clear();
+
+    if (m_bEnemyGridDirty)
+        RebuildEnemyGrid();
+
+    m_EnemyGrid.Query(center.x, center.z, fRadius + m_fEnemyGridMargin, m_vGridQueryItems);
+
+    const float r2 = fRadius * fRadius;
+    for (int nItem : m_vGridQueryItems)
+    {
+        EnemyComponent* pEnemy = m_vGridEnemies[nItem];
+        if (!pEnemy || pEnemy->IsDead())
+            continue;
+
+        // 격자를 만든 뒤 움직였을 수 있으므로 현재 위치로 다시 판정
+        XMFLOAT3 pos = pEnemy->GetOwner()->GetTransform()->GetPosition();
+        float dx = pos.x - center.x;
+        float dz = pos.z - center.z;
+        if (dx * dx + dz * dz <= r2)
+            outEnemies.push_back(pEnemy);
+    }
+}
+
 void CRoom::OnEnemyDeath(EnemyComponent* pEnemy)
 {
     m_nDeadEnemies++;
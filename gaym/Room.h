@@ -2,6 +2,8 @@
 #include "stdafx.h"
 #include "GameObject.h"
 #include "EnemySpawnData.h"
+#include "EnemySpatialIndex.h"
+#include "EnemyNeighborGrid.h"
 
 class EnemyComponent;
 class EnemySpawner;
@@ -58,6 +60,21 @@ public:
     int GetTotalEnemyCount() const { return m_nTotalEnemies; }
     const std::vector<EnemyComponent*>& GetEnemies() const { return m_vEnemies; }
 
+    // Enemy spatial index (투사체 충돌 / 범위 피해). Update 끝에서 살아 있는 적 위치로 갱신
+    static BoundingSphere GetEnemyHitSphere(GameObject* pObject);
+    void RefreshEnemyIndex();
+    // p0 → p1 로 움직인 구체에 닿는 살아 있는 적, 처음 닿는 순 (t 가 같으면 등록 순)
+    void SweepEnemies(const XMFLOAT3& p0, const XMFLOAT3& p1, float fRadius,
+                      std::vector<std::pair<EnemyComponent*, float>>& outHits) const;
+    // center 중심 fRadius 구와 피격 구체가 겹치는 살아 있는 적 (등록 순)
+    void QueryEnemies(const XMFLOAT3& center, float fRadius, std::vector<EnemyComponent*>& outEnemies) const;
+
+    // Enemy neighbor grid (분리 조향 등 "반경 r 안의 적"). Update 끝(적 이동 뒤)에 다시 만들고,
+    // 그 사이 적이 등록되면 다음 질의가 먼저 다시 만든다
+    void RebuildEnemyGrid();
+    // center 에서 평면(XZ) 거리 fRadius 이하인 살아 있는 적 (격자 순서). 격자로 후보를 찾고 현재 위치로 판정
+    void QueryEnemiesInRadius2D(const XMFLOAT3& center, float fRadius, std::vector<EnemyComponent*>& outEnemies);
+
     // Spawn enemies when room becomes active
     void SpawnEnemies();
     bool HasSpawnedEnemies() const { return m_bEnemiesSpawned; }
@@ -94,6 +111,19 @@ protected:
 
     // Enemy management
     std::vector<EnemyComponent*> m_vEnemies;  // Pointers to enemy components (not owned)
+    std::vector<int> m_vEnemyHandles;         // m_vEnemies 와 같은 순서, m_EnemyIndex 핸들 (-1 = 색인 밖)
+    std::vector<EnemyComponent*> m_vHandleEnemies;  // 핸들 → 적
+    EnemySpatialIndex m_EnemyIndex;
+
+    // 격자는 지난 Update 끝 위치. 적 이동 중에는 (추적 속도 + 분리 세기) 최대값 × dt 만큼 후보 반경을 더 넓힌다
+    // (kEnemyGridMargin 은 여러 이웃이 겹쳐 미는 경우 / 넉백 여유)
+    static constexpr float kEnemyGridMargin = 2.0f;
+    EnemyNeighborGrid m_EnemyGrid;
+    std::vector<EnemyComponent*> m_vGridEnemies;    // 격자 항목 번호 → 적 (RemoveGameObject 시 nullptr)
+    std::vector<float> m_vGridX, m_vGridZ;
+    std::vector<int> m_vGridQueryItems;             // QueryEnemiesInRadius2D 임시 버퍼
+    float m_fEnemyGridMargin = kEnemyGridMargin;
+    bool m_bEnemyGridDirty = true;
     int m_nTotalEnemies = 0;
     int m_nDeadEnemies = 0;
     RoomSpawnConfig m_SpawnConfig;
@@ -194,13 +194,12 @@ RuneRegistry::RuneRegistry()
                    EnemyComponent* pNearest = nullptr;
                    float nearestDist = 12.f;
                    XMVECTOR origin = XMLoadFloat3(&ctx.hitEnemyPos);
-                   for (const auto& obj : pRoom->GetGameObjects()) {
-                       if (!obj) continue;
-                       EnemyComponent* e = obj->GetComponent<EnemyComponent>();
-                       if (!e || e->IsDead() || e == pHitEnemy) continue;
-                       TransformComponent* t = obj->GetTransform();
-                       if (!t) continue;
-                       XMFLOAT3 ep = t->GetPosition();
+                   // 3D 거리 12 안이면 평면 거리도 12 안 — 이웃 격자로 후보만 훑는다
+                   std::vector<EnemyComponent*> vNear;
+                   pRoom->QueryEnemiesInRadius2D(ctx.hitEnemyPos, nearestDist, vNear);
+                   for (EnemyComponent* e : vNear) {
+                       if (e == pHitEnemy) continue;
+                       XMFLOAT3 ep = e->GetOwner()->GetTransform()->GetPosition();
                        float d = XMVectorGetX(XMVector3Length(XMLoadFloat3(&ep) - origin));
                        if (d < nearestDist) { nearestDist = d; pNearest = e; }
                    }
@@ -57,6 +57,7 @@ Scene::~Scene()
 #include "MeshLoader.h"
 #include "MapLoader.h"
 #include "Dx12App.h"
+#include "SimProfiler.h"
 
 void Scene::Init(ID3D12Device* pDevice, ID3D12GraphicsCommandList* pCommandList)
 {
@@ -430,12 +431,14 @@ void Scene::Init(ID3D12Device* pDevice, ID3D12GraphicsCommandList* pCommandList)
     // --------------------------------------------------------------------------
     // rooms.json manifest가 있으면 그 목록을 pool로 사용, 없으면 map.json 폴백
     {
-        JsonVal manifest = JsonVal::parseFile("Assets/MapData/rooms.json");
+        JsonDoc manifestDoc;
+        manifestDoc.parseFile("Assets/MapData/rooms.json");
+        const JsonVal& manifest = manifestDoc.root();
         if (!manifest.isNull() && manifest.has("rooms"))
         {
             const JsonVal& roomFiles = manifest["rooms"];
             for (size_t i = 0; i < roomFiles.size(); i++)
-                m_vMapPool.push_back(roomFiles[i].str);
+                m_vMapPool.emplace_back(roomFiles[i].str);
         }
         if (!manifest.isNull() && manifest.has("bossRoom"))
             m_strBossMap = manifest["bossRoom"].str;
@@ -1062,6 +1065,13 @@ void Scene::Update(float deltaTime, InputSystem* pInputSystem)
     XMMATRIX mViewProj = mView * mProjection;
     XMStoreFloat4x4(&m_pcbMappedPass->m_xmf4x4ViewProj, XMMatrixTranspose(mViewProj));
 
+    // 프레임당 한 번만 만드는 월드 공간 카메라 프러스텀 (렌더 컬링 + 애니메이션 LOD 공용)
+    {
+        XMFLOAT4X4 xmf4x4ViewProj;
+        XMStoreFloat4x4(&xmf4x4ViewProj, mViewProj);
+        m_ViewFrustum = CullFrustum::FromViewProj(&xmf4x4ViewProj.m[0][0]);
+    }
+
     // Set lighting parameters based on current theme
     XMVECTOR lightDir;
     switch (m_eCurrentTheme)
@@ -1118,6 +1128,11 @@ void Scene::Update(float deltaTime, InputSystem* pInputSystem)
 
         XMMATRIX mLightViewProj = mLightView * mLightProj;
         XMStoreFloat4x4(&m_pcbMappedPass->m_xmf4x4LightViewProj, XMMatrixTranspose(mLightViewProj));
+
+        // 그림자 맵 직교 볼륨 — 이 밖의 캐스터는 그려도 그림자 맵에 안 남는다
+        XMFLOAT4X4 xmf4x4LightViewProj;
+        XMStoreFloat4x4(&xmf4x4LightViewProj, mLightViewProj);
+        m_ShadowFrustum = CullFrustum::FromViewProj(&xmf4x4LightViewProj.m[0][0]);
     }
     m_pcbMappedPass->m_fPad0 = 0.0f; // Padding for directional light
 
@@ -1254,12 +1269,15 @@ void Scene::Update(float deltaTime, InputSystem* pInputSystem)
     // Update Projectile System
     if (m_pProjectileManager)
     {
+        SimProfileScope profile(SimSubsystem::Projectiles);
         m_pProjectileManager->Update(deltaTime);
     }
 
     // Update Particle System
     if (m_pParticleSystem)
     {
+        SimProfileScope profile(SimSubsystem::Particles);
+
         // Floating ambient particles follow player; theme-gated emission
         if (m_pPlayerGameObject)
         {
@@ -1321,22 +1339,26 @@ void Scene::Update(float deltaTime, InputSystem* pInputSystem)
     }
 
     // Update Fluid Particle System
-    if (m_pFluidParticleSystem)
     {
-        m_pFluidParticleSystem->Update(deltaTime);
-    }
+        SimProfileScope profile(SimSubsystem::Particles);
 
-    // Update Fluid Skill VFX Manager
-    if (m_pFluidVFXManager)
-        m_pFluidVFXManager->Update(deltaTime);
-    if (m_pEnemyFluidVFXManager)
-        m_pEnemyFluidVFXManager->Update(deltaTime);
+        if (m_pFluidParticleSystem)
+        {
+            m_pFluidParticleSystem->Update(deltaTime);
+        }
 
-    // Update Fluid Skill Effect (제어점을 플레이어 위치에 맞게 갱신)
-    if (m_pFluidSkillEffect && m_pPlayerGameObject)
-    {
-        m_pFluidSkillEffect->Update(deltaTime,
-            m_pPlayerGameObject->GetTransform()->GetPosition());
+        // Update Fluid Skill VFX Manager
+        if (m_pFluidVFXManager)
+            m_pFluidVFXManager->Update(deltaTime);
+        if (m_pEnemyFluidVFXManager)
+            m_pEnemyFluidVFXManager->Update(deltaTime);
+
+        // Update Fluid Skill Effect (제어점을 플레이어 위치에 맞게 갱신)
+        if (m_pFluidSkillEffect && m_pPlayerGameObject)
+        {
+            m_pFluidSkillEffect->Update(deltaTime,
+                m_pPlayerGameObject->GetTransform()->GetPosition());
+        }
     }
 
     // Update Torch System (flickering effect)
@@ -1349,6 +1371,8 @@ void Scene::Update(float deltaTime, InputSystem* pInputSystem)
     // 2. Check for collisions
     if (m_pCollisionManager)
     {
+        SimProfileScope profile(SimSubsystem::Collision);
+
         // Collect colliders from global objects
         std::vector<ColliderComponent*> globalColliders;
         for (auto& gameObject : m_vGameObjects)
@@ -1375,68 +1399,200 @@ void Scene::Update(float deltaTime, InputSystem* pInputSystem)
     ProcessPendingDeletions();
 }
 
+bool Scene::IsRenderListMember(RenderComponent* pRC) const
+{
+    // 전역 오브젝트와 현재 방 오브젝트만 그린다 (자식도 평면 리스트에 같이 들어 있다)
+    CRoom* pRoom = pRC->GetOwner()->m_pOwnerRoom;
+    return pRoom == nullptr || pRoom == m_pCurrentRoom;
+}
+
 void Scene::UpdateRenderList()
 {
-    // 1. Clear previous frame's render list from all shaders
-    for (auto& shader : m_vShaders)
+    Shader* pMainShader = m_vShaders[0].get();
+    std::vector<RenderComponent*>& vDirty = RenderComponent::GetDirtyList();
+
+    // 1. 방 전환 / 리스트 초기화: 전역 오브젝트 → 현재 방 오브젝트 순으로 전체를 모아 한 번 정렬
+    const bool bInvalidated = RenderComponent::ConsumeInvalidation();
+    if (!m_bRenderListBuilt || bInvalidated || m_pRenderListRoom != m_pCurrentRoom)
     {
-        shader->ClearRenderComponents();
+        m_vRenderListScratch.clear();
+        for (auto& gameObject : m_vGameObjects)
+        {
+            if (auto* pRC = gameObject->GetComponent<RenderComponent>())
+                m_vRenderListScratch.push_back(pRC);
+        }
+        if (m_pCurrentRoom)
+        {
+            for (const auto& obj : m_pCurrentRoom->GetGameObjects())
+            {
+                if (auto* pRC = obj->GetComponent<RenderComponent>())
+                    m_vRenderListScratch.push_back(pRC);
+            }
+        }
+
+        for (size_t i = 1; i < m_vShaders.size(); i++)
+            m_vShaders[i]->ClearRenderComponents();
+        pMainShader->SetRenderComponents(m_vRenderListScratch);
+        RenderComponent::ConsumeInvalidation();   // 위 ClearRenderComponents 가 다시 세운 플래그
+
+        for (RenderComponent* pRC : vDirty)
+            pRC->ClearDirtyFlag();
+        vDirty.clear();
+        m_vRenderListAdded.clear();
+
+        m_pRenderListRoom = m_pCurrentRoom;
+        m_bRenderListBuilt = true;
+        m_nRenderListBuildCount++;
+        return;
     }
 
-    // 2. Register Global Objects (Player, etc.)
-    Shader* pMainShader = m_vShaders[0].get();
+    // 2. 바뀐 컴포넌트만 빼고 정렬 키 자리에 다시 넣는다 (생성, 메쉬/패스 변경, AddRenderComponent)
+    for (RenderComponent* pRC : vDirty)
+    {
+        pRC->ClearDirtyFlag();
+        if (Shader* pShader = pRC->GetOwnerShader())
+            pShader->RemoveRenderComponent(pRC);
+        if (IsRenderListMember(pRC))
+        {
+            pMainShader->InsertRenderComponent(pRC);
+            m_vRenderListAdded.push_back(pRC);
+        }
+    }
+    vDirty.clear();
+}
 
-    // Helper vector for traversal to avoid recursion
-    std::vector<GameObject*> stack;
-    stack.reserve(64);
+void Scene::UpdateVisibility()
+{
+    auto worldBox = [](Mesh* pMesh, const XMFLOAT4X4& xmf4x4World)
+    {
+        BoundingBox xmBox;
+        pMesh->GetLocalBounds().Transform(xmBox, XMLoadFloat4x4(&xmf4x4World));
+        CullAABB box;
+        box.vMin[0] = xmBox.Center.x - xmBox.Extents.x;  box.vMax[0] = xmBox.Center.x + xmBox.Extents.x;
+        box.vMin[1] = xmBox.Center.y - xmBox.Extents.y;  box.vMax[1] = xmBox.Center.y + xmBox.Extents.y;
+        box.vMin[2] = xmBox.Center.z - xmBox.Extents.z;  box.vMax[2] = xmBox.Center.z + xmBox.Extents.z;
+        return box;
+    };
 
-    // Process Global Objects
-    for (auto& gameObject : m_vGameObjects)
+    ++m_nCullFrame;
+
+    // 1. 렌더 리스트를 전체 재구성했으면 아이템도 다시 만든다.
+    //    최근 kCullStaticFrames 안에 움직인 것만 동적 트리로, 나머지(방 지형 등)는 정적 BVH 로
+    if (m_nCullListBuildCount != m_nRenderListBuildCount)
     {
-        stack.push_back(gameObject.get());
-        while (!stack.empty())
+        m_nCullListBuildCount = m_nRenderListBuildCount;
+
+        std::unordered_map<RenderComponent*, uint32_t> mapLastMoved;
+        mapLastMoved.reserve(m_vCullComponents.size());
+        for (size_t i = 0; i < m_vCullComponents.size(); i++)
         {
-            GameObject* pObj = stack.back();
-            stack.pop_back();
+            if (m_vCullComponents[i])
+                mapLastMoved[m_vCullComponents[i]] = m_vCullLastMoved[i];
+        }
 
-            if (pObj->GetComponent<RenderComponent>())
-            {
-                pMainShader->AddRenderComponent(pObj->GetComponent<RenderComponent>());
-            }
+        m_vCullComponents.clear();
+        m_vCullWorlds.clear();
+        m_vCullLastMoved.clear();
 
-            if (pObj->m_pSibling) stack.push_back(pObj->m_pSibling);
-            if (pObj->m_pChild) stack.push_back(pObj->m_pChild);
+        std::vector<CullAABB> vBoxes;
+        std::vector<uint8_t> vDynamic;
+        for (RenderComponent* pRC : m_vShaders[0]->GetRenderComponents())
+        {
+            pRC->SetCullResult(true, true);
+
+            Mesh* pMesh = pRC->GetMesh();
+            if (!pMesh || !pMesh->HasLocalBounds())
+                continue;   // 범위를 모르면 항상 그린다
+
+            const XMFLOAT4X4& xmf4x4World = pRC->GetOwner()->GetTransform()->GetWorldMatrix();
+            auto it = mapLastMoved.find(pRC);
+            bool bRecentlyMoved = (it != mapLastMoved.end()) && (m_nCullFrame - it->second < kCullStaticFrames);
+
+            pRC->SetCullItem(static_cast<int>(m_vCullComponents.size()));
+            m_vCullComponents.push_back(pRC);
+            m_vCullWorlds.push_back(xmf4x4World);
+            m_vCullLastMoved.push_back(bRecentlyMoved ? it->second : 0);
+            vBoxes.push_back(worldBox(pMesh, xmf4x4World));
+            vDynamic.push_back(bRecentlyMoved ? 1 : 0);
         }
+        m_Culler.Build(vBoxes, vDynamic);
+        m_vShaders[0]->GetReleasedCullItems().clear();
+        m_vRenderListAdded.clear();
     }
-
-    // 3. Register Current Room Objects
-    if (m_pCurrentRoom)
+    else
     {
-        const auto& roomObjects = m_pCurrentRoom->GetGameObjects();
-        for (const auto& obj : roomObjects)
+        // 1b. 리스트에서 빠진 것은 컬러에서 지우고, 새로 들어온 것은 동적 트리에 넣는다
+        std::vector<int>& vReleased = m_vShaders[0]->GetReleasedCullItems();
+        for (int nItem : vReleased)
         {
-            stack.push_back(obj.get());
-            while (!stack.empty())
-            {
-                GameObject* pObj = stack.back();
-                stack.pop_back();
+            m_Culler.RemoveItem(nItem);
+            m_vCullComponents[nItem] = nullptr;
+        }
+        vReleased.clear();
 
-                if (pObj->GetComponent<RenderComponent>())
-                {
-                    pMainShader->AddRenderComponent(pObj->GetComponent<RenderComponent>());
-                }
+        for (RenderComponent* pRC : m_vRenderListAdded)
+        {
+            pRC->SetCullResult(true, true);
+
+            Mesh* pMesh = pRC->GetMesh();
+            if (!pMesh || !pMesh->HasLocalBounds())
+                continue;   // 범위를 모르면 항상 그린다
 
-                if (pObj->m_pSibling) stack.push_back(pObj->m_pSibling);
-                if (pObj->m_pChild) stack.push_back(pObj->m_pChild);
+            const XMFLOAT4X4& xmf4x4World = pRC->GetOwner()->GetTransform()->GetWorldMatrix();
+            const int nItem = m_Culler.AddItem(worldBox(pMesh, xmf4x4World));
+            if (nItem >= static_cast<int>(m_vCullComponents.size()))
+            {
+                m_vCullComponents.resize(nItem + 1, nullptr);
+                m_vCullWorlds.resize(nItem + 1);
+                m_vCullLastMoved.resize(nItem + 1, 0);
             }
+            m_vCullComponents[nItem] = pRC;
+            m_vCullWorlds[nItem] = xmf4x4World;
+            m_vCullLastMoved[nItem] = m_nCullFrame;
+            pRC->SetCullItem(nItem);
         }
     }
+    m_vRenderListAdded.clear();
+
+    // 2. 월드 행렬이 바뀐 아이템만 트리 갱신
+    for (size_t i = 0; i < m_vCullComponents.size(); i++)
+    {
+        RenderComponent* pRC = m_vCullComponents[i];
+        if (!pRC)
+            continue;   // 지운 번호
+        const XMFLOAT4X4& xmf4x4World = pRC->GetOwner()->GetTransform()->GetWorldMatrix();
+        if (memcmp(&xmf4x4World, &m_vCullWorlds[i], sizeof(XMFLOAT4X4)) == 0)
+            continue;
+
+        m_vCullWorlds[i] = xmf4x4World;
+        m_vCullLastMoved[i] = m_nCullFrame;
+        m_Culler.MoveItem(static_cast<int>(i), worldBox(pRC->GetMesh(), xmf4x4World));
+    }
+
+    // 3. 카메라 프러스텀 / 그림자 볼륨 각각 한 번씩 질의
+    for (RenderComponent* pRC : m_vCullComponents)
+    {
+        if (pRC)
+            pRC->SetCullResult(false, false);
+    }
+
+    m_Culler.Query(m_ViewFrustum, m_vCullVisible);
+    for (int nItem : m_vCullVisible)
+        m_vCullComponents[nItem]->SetCullResult(true, false);
+
+    m_Culler.Query(m_ShadowFrustum, m_vCullVisible);
+    for (int nItem : m_vCullVisible)
+    {
+        RenderComponent* pRC = m_vCullComponents[nItem];
+        pRC->SetCullResult(pRC->IsInView(), true);
+    }
 }
 
 void Scene::RenderShadowPass(ID3D12GraphicsCommandList* pCommandList)
 {
     // Update render list before shadow pass (ensures correct objects are rendered)
     UpdateRenderList();
+    UpdateVisibility();
 
     // Set the descriptor heap
     ID3D12DescriptorHeap* ppHeaps[] = { m_pDescriptorHeap->GetHeap() };
@@ -2129,6 +2285,8 @@ void Scene::TransitionToNextRoom()
     // ── 2. 기존 룸 전체 파기 (룸 오브젝트, 적, 맵 메시 등)
     m_vRooms.clear();
     m_pCurrentRoom = nullptr;
+    // 파기된 방의 몬스터만 쓰던 애니메이션 세트 해제 (다른 곳에서 쓰는 세트는 남는다)
+    AnimationSetCache::ReleaseUnused();
 
     // ── 2b. 디스크립터 인덱스를 워터마크로 리셋 (맵 슬롯 재활용)
     m_nNextDescriptorIndex = m_nPersistentDescriptorEnd;
@@ -2241,6 +2399,8 @@ void Scene::TransitionToRoomByIndex(int index)
 
     m_vRooms.clear();
     m_pCurrentRoom = nullptr;
+    // 파기된 방의 몬스터만 쓰던 애니메이션 세트 해제 (다른 곳에서 쓰는 세트는 남는다)
+    AnimationSetCache::ReleaseUnused();
 
     m_nNextDescriptorIndex = m_nPersistentDescriptorEnd;
     // 이전 스테이지의 CBV 리소스 재사용 캐시 클리어 — 스테이지별 슬롯 타입 패턴이
@@ -2331,6 +2491,8 @@ void Scene::TransitionToBossRoom()
     // ── 2. 기존 룸 전체 파기
     m_vRooms.clear();
     m_pCurrentRoom = nullptr;
+    // 파기된 방의 몬스터만 쓰던 애니메이션 세트 해제 (다른 곳에서 쓰는 세트는 남는다)
+    AnimationSetCache::ReleaseUnused();
 
     // ── 3. 디스크립터 인덱스를 워터마크로 리셋
     m_nNextDescriptorIndex = m_nPersistentDescriptorEnd;
@@ -2612,6 +2774,8 @@ void Scene::TransitionToWaterStage()
     // ── 3. 기존 룸 전체 파기
     m_vRooms.clear();
     m_pCurrentRoom = nullptr;
+    // 파기된 방의 몬스터만 쓰던 애니메이션 세트 해제 (다른 곳에서 쓰는 세트는 남는다)
+    AnimationSetCache::ReleaseUnused();
 
     // ── 4. 디스크립터 인덱스를 워터마크로 리셋
     m_nNextDescriptorIndex = m_nPersistentDescriptorEnd;
@@ -2997,6 +3161,8 @@ void Scene::TransitionToWaterBossRoom()
     // ── 3. 기존 룸 전체 파기
     m_vRooms.clear();
     m_pCurrentRoom = nullptr;
+    // 파기된 방의 몬스터만 쓰던 애니메이션 세트 해제 (다른 곳에서 쓰는 세트는 남는다)
+    AnimationSetCache::ReleaseUnused();
 
     // ── 4. 디스크립터 인덱스를 워터마크로 리셋
     m_nNextDescriptorIndex = m_nPersistentDescriptorEnd;
@@ -3237,6 +3403,8 @@ void Scene::TransitionToEarthStage()
     ProcessPendingDeletions();
     m_vRooms.clear();
     m_pCurrentRoom = nullptr;
+    // 파기된 방의 몬스터만 쓰던 애니메이션 세트 해제 (다른 곳에서 쓰는 세트는 남는다)
+    AnimationSetCache::ReleaseUnused();
     m_nNextDescriptorIndex = m_nPersistentDescriptorEnd;
     // 이전 스테이지의 CBV 리소스 재사용 캐시 클리어 — 스테이지별 슬롯 타입 패턴이
     // 달라 SRV가 CBV 슬롯을 덮어쓰는 충돌 방지. 뷰는 항상 새로 생성한다.
@@ -3308,6 +3476,8 @@ void Scene::TransitionToGrassStage()
     ProcessPendingDeletions();
     m_vRooms.clear();
     m_pCurrentRoom = nullptr;
+    // 파기된 방의 몬스터만 쓰던 애니메이션 세트 해제 (다른 곳에서 쓰는 세트는 남는다)
+    AnimationSetCache::ReleaseUnused();
     m_nNextDescriptorIndex = m_nPersistentDescriptorEnd;
     // 이전 스테이지의 CBV 리소스 재사용 캐시 클리어 — 스테이지별 슬롯 타입 패턴이
     // 달라 SRV가 CBV 슬롯을 덮어쓰는 충돌 방지. 뷰는 항상 새로 생성한다.
@@ -3372,6 +3542,8 @@ void Scene::TransitionToEarthBossRoom()
     ProcessPendingDeletions();
     m_vRooms.clear();
     m_pCurrentRoom = nullptr;
+    // 파기된 방의 몬스터만 쓰던 애니메이션 세트 해제 (다른 곳에서 쓰는 세트는 남는다)
+    AnimationSetCache::ReleaseUnused();
     m_nNextDescriptorIndex = m_nPersistentDescriptorEnd;
     // 이전 스테이지의 CBV 리소스 재사용 캐시 클리어 — 스테이지별 슬롯 타입 패턴이
     // 달라 SRV가 CBV 슬롯을 덮어쓰는 충돌 방지. 뷰는 항상 새로 생성한다.
@@ -3456,6 +3628,8 @@ void Scene::TransitionToGrassBossRoom()
     ProcessPendingDeletions();
     m_vRooms.clear();
     m_pCurrentRoom = nullptr;
+    // 파기된 방의 몬스터만 쓰던 애니메이션 세트 해제 (다른 곳에서 쓰는 세트는 남는다)
+    AnimationSetCache::ReleaseUnused();
     m_nNextDescriptorIndex = m_nPersistentDescriptorEnd;
     // 이전 스테이지의 CBV 리소스 재사용 캐시 클리어 — 스테이지별 슬롯 타입 패턴이
     // 달라 SRV가 CBV 슬롯을 덮어쓰는 충돌 방지. 뷰는 항상 새로 생성한다.
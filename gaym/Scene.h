@@ -10,6 +10,7 @@
 #include "DescriptorHeap.h"
 #include "InputSystem.h"
 #include "Camera.h"
+#include "CullingBVH.h"
 #include "Room.h" // Added Room.h include
 #include "CollisionManager.h" // Added CollisionManager include
 #include "EnemySpawner.h" // Added EnemySpawner include
@@ -117,6 +118,7 @@ public:
     void OnResizeSSF(UINT width, UINT height);
 
     CCamera* GetCamera() const { return m_pCamera.get(); } // Added getter for CCamera
+    const CullFrustum& GetViewFrustum() const { return m_ViewFrustum; } // 이번 프레임 월드 공간 카메라 프러스텀
     CRoom* GetCurrentRoom() const { return m_pCurrentRoom; } // Added getter for current room
     void SetCurrentRoom(CRoom* pRoom) { m_pCurrentRoom = pRoom; }
     ProjectileManager* GetProjectileManager() { return m_pProjectileManager.get(); }
@@ -358,5 +360,26 @@ private:
     void PrintHierarchy(GameObject* pGameObject, int nDepth);
     void CollectColliders(GameObject* pGameObject, std::vector<ColliderComponent*>& outColliders);
     void ProcessPendingDeletions();
-    void UpdateRenderList();  // Update RenderComponent list for current frame
+    void UpdateRenderList();  // Re-insert only the RenderComponents marked dirty since last frame (full rebuild on room change)
+    bool IsRenderListMember(RenderComponent* pRC) const;
+
+    // Render list cache (방이 바뀌거나 리스트를 통째로 비웠을 때만 전체 재구성)
+    bool m_bRenderListBuilt = false;
+    CRoom* m_pRenderListRoom = nullptr;
+    std::vector<RenderComponent*> m_vRenderListScratch;
+    std::vector<RenderComponent*> m_vRenderListAdded;   // 이번 프레임 리스트에 새로 들어간 것 (UpdateVisibility 가 컬러에 넣는다)
+    uint32_t m_nRenderListBuildCount = 0;
+
+    // Visibility culling — 카메라/그림자 볼륨은 Update 에서 프레임당 한 번 만든다
+    void UpdateVisibility();  // 렌더 리스트 아이템을 정적 BVH/동적 트리로 관리하고 IsInView/IsInShadowView 기록
+    static constexpr uint32_t kCullStaticFrames = 120;  // 이 프레임 수 동안 안 움직이면 다음 재구성 때 정적 BVH 로
+    CullFrustum m_ViewFrustum;
+    CullFrustum m_ShadowFrustum;
+    VisibilityCuller m_Culler;
+    uint32_t m_nCullFrame = 0;
+    uint32_t m_nCullListBuildCount = UINT32_MAX;
+    std::vector<RenderComponent*> m_vCullComponents;   // 컬러 아이템 index → RenderComponent
+    std::vector<XMFLOAT4X4> m_vCullWorlds;             // 마지막으로 트리에 반영한 월드 행렬
+    std::vector<uint32_t> m_vCullLastMoved;            // 마지막으로 움직인 m_nCullFrame
+    std::vector<int> m_vCullVisible;
 };
\ No newline at end of file
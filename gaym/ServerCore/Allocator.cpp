@@ -20,6 +20,8 @@ void BaseAllocator::Release(void* ptr)
 	StompAllocator
 -------------------*/
 
+#ifdef _WIN32
+
 void* StompAllocator::Alloc(int32 size)
 {
 	const int64 pageCount = (size + PAGE_SIZE - 1) / PAGE_SIZE;
@@ -35,6 +37,32 @@ void StompAllocator::Release(void* ptr)
 	::VirtualFree(reinterpret_cast<void*>(baseAddress), 0, MEM_RELEASE);
 }
 
+#else
+
+// munmap ũ⸦ ˾ƾ ϹǷ տ       д
+// [pageCount][....][Data]
+void* StompAllocator::Alloc(int32 size)
+{
+	const int64 pageCount = (size + PAGE_SIZE - 1) / PAGE_SIZE;
+	const int64 dataOffset = pageCount * PAGE_SIZE - size;
+	void* mapAddress = ::mmap(nullptr, (pageCount + 1) * PAGE_SIZE, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+	if (mapAddress == MAP_FAILED)
+		return nullptr;
+
+	*static_cast<int64*>(mapAddress) = pageCount;
+	return static_cast<void*>(static_cast<int8*>(mapAddress) + PAGE_SIZE + dataOffset);
+}
+
+void StompAllocator::Release(void* ptr)
+{
+	const int64 address = reinterpret_cast<int64>(ptr);
+	const int64 baseAddress = address - (address % PAGE_SIZE);
+	int64* mapAddress = reinterpret_cast<int64*>(baseAddress - PAGE_SIZE);
+	::munmap(mapAddress, (*mapAddress + 1) * PAGE_SIZE);
+}
+
+#endif
+
 /*-------------------
 	PoolAllocator
 -------------------*/
@@ -3,8 +3,10 @@
 
 ConsoleLog::ConsoleLog()
 {
+#ifdef _WIN32
 	_stdOut = ::GetStdHandle(STD_OUTPUT_HANDLE);
 	_stdErr = ::GetStdHandle(STD_ERROR_HANDLE);
+#endif
 }
 
 ConsoleLog::~ConsoleLog()
@@ -39,17 +41,40 @@ void ConsoleLog::WriteStdErr(Color color, const WCHAR* format, ...)
 
 	va_list ap;
 	va_start(ap, format);
+#ifdef _WIN32
 	::vswprintf_s(buffer, BUFFER_SIZE, format, ap);
+#else
+	::vswprintf(buffer, BUFFER_SIZE, format, ap);
+#endif
 	va_end(ap);
 
+#ifdef _WIN32
 	::fwprintf_s(stderr, buffer);
+#else
+	::fputws(buffer, stderr);
+#endif
 	fflush(stderr);
 
 	SetColor(false, Color::WHITE);
 }
 
+void ConsoleLog::Write(bool stdOut, Color color, const WCHAR* str)
+{
+	if (str == nullptr)
+		return;
+
+	FILE* stream = stdOut ? stdout : stderr;
+
+	SetColor(stdOut, color);
+	::fputws(str, stream);
+	SetColor(stdOut, Color::WHITE);
+
+	fflush(stream);
+}
+
 void ConsoleLog::SetColor(bool stdOut, Color color)
 {
+#ifdef _WIN32
 	static WORD SColors[]
 	{
 		0,
@@ -61,4 +86,13 @@ void ConsoleLog::SetColor(bool stdOut, Color color)
 	};
 
 	::SetConsoleTextAttribute(stdOut ? _stdOut : _stdErr, SColors[static_cast<int32>(color)]);
+#else
+	// ANSI  ڵ (BLACK, WHITE, RED, GREEN, BLUE, YELLOW)
+	static const int32 SColors[]
+	{
+		30, 0, 91, 92, 94, 93
+	};
+
+	::fwprintf(stdOut ? stdout : stderr, L"\033[%dm", SColors[static_cast<int32>(color)]);
+#endif
 }
\ No newline at end of file
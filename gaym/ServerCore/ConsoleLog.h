@@ -25,11 +25,15 @@ public:
 public:
 	void		WriteStdOut(Color color, const WCHAR* str, ...);
 	void		WriteStdErr(Color color, const WCHAR* str, ...);
+	// ̹ ˵ ڿ (Logger ¿)
+	void		Write(bool stdOut, Color color, const WCHAR* str);
 
 protected:
 	void		SetColor(bool stdOut, Color color);
 
+#ifdef _WIN32
 private:
 	HANDLE		_stdOut;
 	HANDLE		_stdErr;
+#endif
 };
\ No newline at end of file
@@ -8,6 +8,7 @@
 #include "GlobalQueue.h"
 #include "JobTimer.h"
 #include "ConsoleLog.h"
+#include "Logger.h"
 
 ThreadManager*		GThreadManager = nullptr;
 Memory*				GMemory = nullptr;
@@ -17,6 +18,7 @@ JobTimer*           GJobTimer = nullptr;
 
 DeadLockProfiler*	GDeadLockProfiler = nullptr;
 ConsoleLog*         GConsoleLogger = nullptr;
+Logger*             GLogger = nullptr;
 
 class CoreGlobal
 {
@@ -30,18 +32,24 @@ public:
 		GJobTimer = new JobTimer();
 		GDeadLockProfiler = new DeadLockProfiler();
 		GConsoleLogger = new ConsoleLog();
+		GLogger = new Logger();
 		SocketUtils::Init();
 	}
 
 	~CoreGlobal()
 	{
 		delete GThreadManager;
-		delete GMemory;
 		delete GSendBufferManager;
+		GSendBufferManager = nullptr;
 		delete GGlobalQueue;
 		delete GJobTimer;
 		delete GDeadLockProfiler;
+		//  α׸   ܼ ݴ´
+		delete GLogger;
+		GLogger = nullptr;
 		delete GConsoleLogger;
 		SocketUtils::Clear();
+		//  ü Ǯ ޸𸮸 ݳϹǷ   
+		delete GMemory;
 	}
 } GCoreGlobal;
\ No newline at end of file
@@ -7,4 +7,5 @@ extern class GlobalQueue*       GGlobalQueue;
 extern class JobTimer*          GJobTimer;
 
 extern class DeadLockProfiler*	GDeadLockProfiler;
-extern class ConsoleLog*        GConsoleLogger;
\ No newline at end of file
+extern class ConsoleLog*        GConsoleLogger;
+extern class Logger*            GLogger;
\ No newline at end of file
@@ -1,19 +1,28 @@
 #pragma once
 
+#ifndef _WIN32
+#include "CorePlatform.h"
+#endif
+
 #include "Types.h"
 #include "CoreMacro.h"
 #include "CoreTLS.h"
 #include "CoreGlobal.h"
 #include "Container.h"
 
+#ifdef _WIN32
 #include <windows.h>
+#endif
 #include <iostream>
+#include <thread>
 using namespace std;
 
+#ifdef _WIN32
 #include <winsock2.h>
 #include <mswsock.h>
 #include <ws2tcpip.h>
 #pragma comment(lib, "ws2_32.lib")
+#endif
 
 #include "Lock.h"
 #include "ObjectPool.h"
@@ -22,4 +31,5 @@ using namespace std;
 #include "SendBuffer.h"
 #include "Session.h"
 #include "JobQueue.h"
-#include "ConsoleLog.h"
\ No newline at end of file
+#include "ConsoleLog.h"
+#include "Logger.h"
\ No newline at end of file
@@ -0,0 +1,149 @@
+#pragma once
+
+/*------------------
+	CorePlatform
+-------------------*/
+
+// Windows ̿(Linux/epoll) 忡 ServerCore  Win32 ̸ ִ .
+// CorePch.h _WIN32 ƴ  Եȴ.
+
+#include <sys/epoll.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/uio.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <arpa/inet.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <errno.h>
+#include <climits>
+#include <csignal>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <cstdarg>
+#include <cwchar>
+#include <chrono>
+#include <mutex>
+#include <new>
+
+/*---------------
+	 Keywords
+---------------*/
+
+#define abstract				= 0
+#define sealed					final
+#define __analysis_assume(expr)	((void)0)
+#define DECLSPEC_ALIGN(x)		// GCC struct    ϹǷ SLIST_ENTRY ʿ 
+
+#define INFINITE				0xFFFFFFFF
+
+/*---------------
+	  Types
+---------------*/
+
+using HANDLE		= void*;
+using SOCKET		= int;
+using WCHAR			= wchar_t;
+using WORD			= uint16_t;
+using DWORD			= uint32_t;
+using ULONG_PTR		= uintptr_t;
+using SOCKADDR		= sockaddr;
+using SOCKADDR_IN	= sockaddr_in;
+using IN_ADDR		= in_addr;
+using LINGER		= linger;
+
+/*---------------
+	 Socket
+---------------*/
+
+#define INVALID_SOCKET			(-1)
+#define SOCKET_ERROR			(-1)
+#define WSAECONNRESET			ECONNRESET
+#define WSAECONNABORTED			ECONNABORTED
+
+inline int WSAGetLastError() { return errno; }
+inline int closesocket(SOCKET socket) { return ::close(socket); }
+
+/*---------------
+	  Time
+---------------*/
+
+inline uint64_t GetTickCount64()
+{
+	using namespace std::chrono;
+	return static_cast<uint64_t>(duration_cast<milliseconds>(steady_clock::now().time_since_epoch()).count());
+}
+
+/*---------------
+	OVERLAPPED
+---------------*/
+
+// epoll Ϸ  ƴ϶ غ    ,
+// IocpEvent ״ ϵǵ ʵ 縸 д
+struct OVERLAPPED
+{
+	ULONG_PTR	Internal;
+	ULONG_PTR	InternalHigh;
+	DWORD		Offset;
+	DWORD		OffsetHigh;
+	HANDLE		hEvent;
+};
+
+/*---------------
+	   SList
+---------------*/
+
+// Interlocked SList . 128Ʈ CAS  ABA Ϸ ª  Ѵ
+struct alignas(16) SLIST_ENTRY
+{
+	SLIST_ENTRY* Next;
+};
+using PSLIST_ENTRY = SLIST_ENTRY*;
+
+struct SLIST_HEADER
+{
+	SLIST_ENTRY*	head = nullptr;
+	std::mutex		lock;
+};
+
+inline void InitializeSListHead(SLIST_HEADER* header)
+{
+	header->head = nullptr;
+}
+
+inline PSLIST_ENTRY InterlockedPushEntrySList(SLIST_HEADER* header, PSLIST_ENTRY entry)
+{
+	std::lock_guard<std::mutex> guard(header->lock);
+	PSLIST_ENTRY prev = header->head;
+	entry->Next = prev;
+	header->head = entry;
+	return prev;
+}
+
+inline PSLIST_ENTRY InterlockedPopEntrySList(SLIST_HEADER* header)
+{
+	std::lock_guard<std::mutex> guard(header->lock);
+	PSLIST_ENTRY entry = header->head;
+	if (entry != nullptr)
+		header->head = entry->Next;
+	return entry;
+}
+
+/*---------------
+	  Memory
+---------------*/
+
+inline void* _aligned_malloc(size_t size, size_t alignment)
+{
+	void* ptr = nullptr;
+	if (::posix_memalign(&ptr, alignment, size) != 0)
+		return nullptr;
+	return ptr;
+}
+
+inline void _aligned_free(void* ptr)
+{
+	::free(ptr);
+}
@@ -4,5 +4,5 @@
 thread_local uint32             LThreadId = 0;
 thread_local uint64             LEndTickCount = 0;
 thread_local std::stack<int32>	LLockStack;
-thread_local SendBufferChunkRef	LSendBufferChunk;
+thread_local SendBufferChunkRef	LSendBufferChunk[2];
 thread_local JobQueue*          LCurrentJobQueue = nullptr;
\ No newline at end of file
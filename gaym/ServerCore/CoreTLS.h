@@ -5,5 +5,5 @@ extern thread_local uint32				LThreadId;
 extern thread_local uint64              LEndTickCount;
 
 extern thread_local std::stack<int32>	LLockStack;
-extern thread_local SendBufferChunkRef	LSendBufferChunk;
+extern thread_local SendBufferChunkRef	LSendBufferChunk[2]; // SendBufferClass::Small, Medium
 extern thread_local class JobQueue*     LCurrentJobQueue;
\ No newline at end of file
@@ -271,9 +271,7 @@ void DBConnection::HandleError(SQLRETURN ret)
 		if (errorRet != SQL_SUCCESS && errorRet != SQL_SUCCESS_WITH_INFO)
 			break;
 
-		// TODO : Log
-		wcout.imbue(locale("kor"));
-		wcout << errMsg << endl;
+		LOG_ERROR(L"[DB] %s", errMsg);
 
 		index++;
 	}
@@ -108,12 +108,12 @@ void DeadLockProfiler::Dfs(int32 here)
 		//  ƴϰ, Dfs(there)   ʾҴٸ, there here ̴. ( )
 		if (_finished[there] == false)
 		{
-			printf("%s -> %s\n", _idToName[here], _idToName[there]);
+			LOG_FATAL(L"%s -> %s", _idToName[here], _idToName[there]);
 
 			int32 now = here;
 			while (true)
 			{
-				printf("%s -> %s\n", _idToName[_parent[now]], _idToName[now]);
+				LOG_FATAL(L"%s -> %s", _idToName[_parent[now]], _idToName[now]);
 				now = _parent[now];
 				if (now == there)
 					break;
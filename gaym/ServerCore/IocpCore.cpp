@@ -6,6 +6,8 @@
 	IocpCore
 ---------------*/
 
+#ifdef _WIN32
+
 IocpCore::IocpCore()
 {
 	_iocpHandle = ::CreateIoCompletionPort(INVALID_HANDLE_VALUE, 0, 0, 0);
@@ -50,3 +52,90 @@ bool IocpCore::Dispatch(uint32 timeoutMs)
 
 	return true;
 }
+
+#else
+
+IocpCore::IocpCore()
+{
+	_epollFd = ::epoll_create1(EPOLL_CLOEXEC);
+	ASSERT_CRASH(_epollFd != -1);
+	_iocpHandle = reinterpret_cast<HANDLE>(static_cast<intptr_t>(_epollFd));
+}
+
+IocpCore::~IocpCore()
+{
+	::close(_epollFd);
+}
+
+bool IocpCore::Register(IocpObjectRef iocpObject)
+{
+	IocpObject* key = iocpObject.get();
+	{
+		WRITE_LOCK;
+		_objects[key] = iocpObject;
+	}
+
+	//  Ʈ : غ ° ٲ    ǹǷ ޴ ʿ EAGAIN  Ѵ
+	epoll_event ev = {};
+	ev.events = EPOLLIN | EPOLLOUT | EPOLLRDHUP | EPOLLET;
+	ev.data.ptr = key;
+
+	const int32 fd = static_cast<int32>(reinterpret_cast<intptr_t>(iocpObject->GetHandle()));
+	if (::epoll_ctl(_epollFd, EPOLL_CTL_ADD, fd, &ev) == -1)
+	{
+		WRITE_LOCK;
+		_objects.erase(key);
+		return false;
+	}
+
+	return true;
+}
+
+void IocpCore::Unregister(IocpObjectRef iocpObject)
+{
+	const int32 fd = static_cast<int32>(reinterpret_cast<intptr_t>(iocpObject->GetHandle()));
+	::epoll_ctl(_epollFd, EPOLL_CTL_DEL, fd, nullptr);
+
+	//    ȿ Ǯ ʵ   ´
+	IocpObjectRef released;
+	{
+		WRITE_LOCK;
+		auto findIt = _objects.find(iocpObject.get());
+		if (findIt == _objects.end())
+			return;
+
+		released = std::move(findIt->second);
+		_objects.erase(findIt);
+	}
+}
+
+bool IocpCore::Dispatch(uint32 timeoutMs)
+{
+	epoll_event events[MAX_EVENTS];
+
+	const int32 timeout = (timeoutMs == INFINITE) ? -1 : static_cast<int32>(timeoutMs);
+	const int32 count = ::epoll_wait(_epollFd, events, MAX_EVENTS, timeout);
+	if (count <= 0)
+		return false;
+
+	for (int32 i = 0; i < count; i++)
+	{
+		IocpObjectRef iocpObject;
+		{
+			READ_LOCK;
+			auto findIt = _objects.find(static_cast<IocpObject*>(events[i].data.ptr));
+			if (findIt != _objects.end())
+				iocpObject = findIt->second;
+		}
+
+		// ̹   ü
+		if (iocpObject == nullptr)
+			continue;
+
+		iocpObject->DispatchReady(events[i].events);
+	}
+
+	return true;
+}
+
+#endif
@@ -9,6 +9,10 @@ class IocpObject : public enable_shared_from_this<IocpObject>
 public:
 	virtual HANDLE GetHandle() abstract;
 	virtual void Dispatch(class IocpEvent* iocpEvent, int32 numOfBytes = 0) abstract;
+#ifndef _WIN32
+	// epoll Ϸ ̺Ʈ  غ (EPOLLIN/EPOLLOUT...) ˷ش
+	virtual void DispatchReady(uint32 readyEvents) abstract;
+#endif
 };
 
 /*--------------
@@ -25,7 +29,19 @@ public:
 
 	bool		Register(IocpObjectRef iocpObject);
 	bool		Dispatch(uint32 timeoutMs = INFINITE);
+#ifndef _WIN32
+	void		Unregister(IocpObjectRef iocpObject);
+#endif
 
 private:
 	HANDLE		_iocpHandle;
+
+#ifndef _WIN32
+	enum { MAX_EVENTS = 64 };
+
+	// epoll ͸  Ƿ ϵ ü  ⼭ Ѵ
+	USE_LOCK;
+	int32							_epollFd = -1;
+	HashMap<IocpObject*, IocpObjectRef>	_objects;
+#endif
 };
\ No newline at end of file
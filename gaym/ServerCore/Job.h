@@ -1,5 +1,6 @@
 #pragma once
 #include <functional>
+#include "MpscQueue.h"
 
 /*------------
      Job
@@ -7,8 +8,10 @@
 
 using CallbackType = std::function<void()>;
 
-class Job
+class Job : public MpscNode
 {
+    friend class JobQueue;
+
 public:
     Job(CallbackType&& callback) : _callback(std::move(callback))
     {
@@ -30,5 +33,7 @@ public:
 
 private:
     CallbackType _callback;
+    shared_ptr<Job> _queuedRef; // JobQueue  ִ  ڱ ڽ  д
+    uint32 _epoch = 0; // Push  JobQueue::_clearEpoch
 };
 
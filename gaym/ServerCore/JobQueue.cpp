@@ -6,10 +6,22 @@
      JobQueue
 -----------------*/
 
+JobQueue::~JobQueue()
+{
+    // 소멸 중에는 Push하는 쓰레드가 없으므로 (참조 0) Pop이 nullptr이면 정말 빈 것이다
+    while (JobRef job = Pop())
+    {
+    }
+}
+
 void JobQueue::Push(JobRef job, bool pushOnly)
 {
     const int32 prevCount = _jobCount.fetch_add(1); // 항상 카운트를 증가시킨 후에 잡을 푸쉬를 하고 실행한 다음에
-    _jobs.Push(job); // WRITE_LOCK
+
+    Job* node = job.get();
+    node->_queuedRef = std::move(job);
+    node->_epoch = _clearEpoch.load();
+    _jobs.Push(node); // lock-free
 
     // 첫번째 Job을 넣은 쓰레드가 실행까지 담당
     if (prevCount == 0)
@@ -35,12 +47,22 @@ void JobQueue::Execute()
 
     while (true)
     {
-        Vector<JobRef> jobs;
-        _jobs.PopAll(OUT jobs);
+        // 이번 라운드 시작 시점에 들어와 있던 만큼만 실행 (실행 중 DoAsync로 쌓인 일감은 다음 라운드)
+        const int32 budget = _jobCount.load();
 
-        const int32 jobCount = static_cast<int32>(jobs.size());
-        for (int32 i = 0; i < jobCount; i++)
-            jobs[i]->Execute();
+        int32 jobCount = 0;
+        while (jobCount < budget)
+        {
+            // 다른 쓰레드가 Push 도중이면 잠깐 비어 보일 수 있다 -> 다음 라운드에서 다시 확인
+            JobRef job = Pop();
+            if (job == nullptr)
+                break;
+
+            // ClearJobs 이전에 들어온 일감은 실행하지 않고 버린다 (카운트는 똑같이 뺀다)
+            if (job->_epoch == _clearEpoch.load())
+                job->Execute();
+            jobCount++;
+        }
 
         // 남은 일감이 0개라면 종료
         if (_jobCount.fetch_sub(jobCount) == jobCount) // 다 한후 잡 카운트를 빼줘야한다.
@@ -59,3 +81,12 @@ void JobQueue::Execute()
         }
     } 
 }
+
+JobRef JobQueue::Pop()
+{
+    Job* node = static_cast<Job*>(_jobs.Pop());
+    if (node == nullptr)
+        return nullptr;
+
+    return std::move(node->_queuedRef);
+}
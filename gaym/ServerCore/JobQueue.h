@@ -1,6 +1,6 @@
 #pragma once
 #include "Job.h"
-#include "LockQueue.h"
+#include "MpscQueue.h"
 #include "JobTimer.h"
 
 /*----------------
@@ -10,6 +10,9 @@
 class JobQueue : public enable_shared_from_this<JobQueue>
 {
 public:
+    //  ϰ  ϰ _queuedRef ڱ ڽ  Ƿ  Ǯ ش
+    ~JobQueue();
+
     void DoAsync(CallbackType&& callback)
     {
         Push(ObjectPool<Job>::MakeShared(std::move(callback)));
@@ -22,28 +25,39 @@ public:
         Push(ObjectPool<Job>::MakeShared(owner, memFunc, std::forward<Args>(args)...));
     }
 
-    void DoTimer(uint64 tickAfter, CallbackType&& callback)
+    TimerHandle DoTimer(uint64 tickAfter, CallbackType&& callback)
     {
         JobRef job = ObjectPool<Job>::MakeShared(std::move(callback));
-        GJobTimer->Reserve(tickAfter, shared_from_this(), job);
+        return GJobTimer->Reserve(tickAfter, shared_from_this(), job);
     }
 
     template<typename T, typename Ret, typename... Args>
-    void DoTimer(uint64 tickAfter, Ret(T::* memFunc)(Args...), Args... args)
+    TimerHandle DoTimer(uint64 tickAfter, Ret(T::* memFunc)(Args...), Args... args)
     {
         shared_ptr<T> owner = static_pointer_cast<T>(shared_from_this());
         JobRef job = ObjectPool<Job>::MakeShared(owner, memFunc, std::forward<Args>(args)...);
-        GJobTimer->Reserve(tickAfter, shared_from_this(), job);
+        return GJobTimer->Reserve(tickAfter, shared_from_this(), job);
     }
 
-    void               ClearJobs() { _jobs.Clear(); }
+    bool CancelTimer(const TimerHandle& handle)
+    {
+        return GJobTimer->Cancel(handle);
+    }
+
+    // Pop   常   Ƿ ť   ʰ 븸 ø
+    // ->  뿡  ϰ Execute 鼭  ʰ 
+    void               ClearJobs() { _clearEpoch.fetch_add(1); }
 
 public:
     void               Push(JobRef job, bool pushOnly = false);
     void               Execute();
 
+private:
+    JobRef             Pop();
+
 protected:
-    LockQueue<JobRef>  _jobs;
+    MpscQueue          _jobs;
     Atomic<int32>      _jobCount = 0;
+    Atomic<uint32>     _clearEpoch = 0;
 };
 
@@ -2,61 +2,250 @@
 #include "JobTimer.h"
 #include "JobQueue.h"
 
-/*--------------
-    JobTimer
----------------*/
+/*----------------
+    TimerWheel
+-----------------*/
 
-void JobTimer::Reserve(uint64 tickAfter, weak_ptr<JobQueue> owner, JobRef job)
+TimerWheel::TimerWheel()
 {
-    const uint64 executeTick = ::GetTickCount64() + tickAfter;
-    JobData* jobData = ObjectPool<JobData>::Pop(owner, job);
+    for (uint32& bucket : _buckets)
+        bucket = INVALID_INDEX;
+
+    _currentTick = ::GetTickCount64();
+}
+
+uint32 TimerWheel::Reserve(uint64 executeTick, weak_ptr<JobQueue> owner, JobRef job, OUT uint32& generation)
+{
+    WRITE_LOCK;
+
+    uint32 index = _freeIndex;
+    if (index != INVALID_INDEX)
+    {
+        _freeIndex = _entries[index].next;
+    }
+    else
+    {
+        index = static_cast<uint32>(_entries.size());
+        _entries.emplace_back();
+    }
+
+    Entry& entry = _entries[index];
+    entry.executeTick = executeTick;
+    entry.owner = std::move(owner);
+    entry.job = std::move(job);
+    Link(index, 1);
+
+    _count++;
+    generation = entry.generation;
+    return index;
+}
 
+bool TimerWheel::Cancel(uint32 index, uint32 generation)
+{
     WRITE_LOCK;
 
-    _items.push(TimerItem{ executeTick, jobData });
+    if (index >= _entries.size())
+        return false;
+
+    // 이미 실행됐거나 취소돼서 재사용된 칸
+    Entry& entry = _entries[index];
+    if (entry.generation != generation || entry.bucket == INVALID_INDEX)
+        return false;
+
+    Unlink(index);
+    Release(index);
+    return true;
 }
 
-void JobTimer::Distribute(uint64 now)
+bool TimerWheel::Distribute(uint64 now, OUT Vector<JobData>& jobs)
 {
     // 한 번에 한 쓰레드만 통과
     if (_distributing.exchange(true) == true)
-        return;
+        return false;
 
-    Vector<TimerItem> items;
     {
         WRITE_LOCK;
 
-        while (_items.empty() == false)
+        while (_currentTick < now)
         {
-            const TimerItem& timerItem = _items.top();
-            if (now < timerItem.executeTick)
+            // 예약이 하나도 없으면 빈 칸을 하나씩 넘길 필요가 없다
+            if (_count == 0)
+            {
+                _currentTick = now;
                 break;
+            }
 
-            items.push_back(timerItem);
-            _items.pop();
-        }
-    }
+            _currentTick++;
 
-    for (TimerItem& item : items)
-    {
-        if (JobQueueRef owner = item.jobData->owner.lock())
-            owner->Push(item.jobData->job);
+            // 아래 단이 한 바퀴 돌 때마다 위 단의 칸을 한 칸씩 풀어서 다시 넣는다
+            for (uint32 level = 1; level < LEVEL_COUNT; level++)
+            {
+                const uint64 lowerMask = (1ull << (SLOT_BITS * level)) - 1;
+                if ((_currentTick & lowerMask) != 0)
+                    break;
+
+                Cascade(level);
+            }
 
-        ObjectPool<JobData>::Push(item.jobData);
+            Expire(OUT jobs);
+        }
     }
 
     // 끝났으면 풀어준다
     _distributing.store(false);
+    return true;
 }
 
-void JobTimer::Clear()
+void TimerWheel::Clear()
 {
     WRITE_LOCK;
 
-    while (_items.empty() == false)
+    for (uint32 bucket = 0; bucket < BUCKET_COUNT; bucket++)
+    {
+        uint32 index = _buckets[bucket];
+        _buckets[bucket] = INVALID_INDEX;
+
+        while (index != INVALID_INDEX)
+        {
+            const uint32 next = _entries[index].next;
+            Release(index);
+            index = next;
+        }
+    }
+}
+
+void TimerWheel::Link(uint32 index, uint64 minDelta)
+{
+    Entry& entry = _entries[index];
+
+    // 예약: _currentTick 칸은 이미 처리했으므로 지난 시각이면 다음 tick으로 당겨준다 (minDelta = 1)
+    // Cascade: 이 tick의 Expire 전이므로 delta 0 이면 지금 처리할 칸에 넣는다 (minDelta = 0)
+    const uint64 maxDelta = (1ull << (SLOT_BITS * LEVEL_COUNT)) - 1;
+    uint64 delta = (entry.executeTick > _currentTick + minDelta) ? entry.executeTick - _currentTick : minDelta;
+    if (delta > maxDelta)
+        delta = maxDelta;
+
+    uint32 level = 0;
+    while (level < LEVEL_COUNT - 1 && delta >= (1ull << (SLOT_BITS * (level + 1))))
+        level++;
+
+    const uint64 slotTick = _currentTick + delta;
+    const uint32 bucket = level * SLOT_COUNT + static_cast<uint32>((slotTick >> (SLOT_BITS * level)) & SLOT_MASK);
+
+    entry.bucket = bucket;
+    entry.prev = INVALID_INDEX;
+    entry.next = _buckets[bucket];
+    if (entry.next != INVALID_INDEX)
+        _entries[entry.next].prev = index;
+    _buckets[bucket] = index;
+}
+
+void TimerWheel::Unlink(uint32 index)
+{
+    Entry& entry = _entries[index];
+
+    if (entry.prev != INVALID_INDEX)
+        _entries[entry.prev].next = entry.next;
+    else
+        _buckets[entry.bucket] = entry.next;
+
+    if (entry.next != INVALID_INDEX)
+        _entries[entry.next].prev = entry.prev;
+
+    entry.bucket = INVALID_INDEX;
+}
+
+void TimerWheel::Release(uint32 index)
+{
+    Entry& entry = _entries[index];
+    entry.owner.reset();
+    entry.job = nullptr;
+    entry.bucket = INVALID_INDEX;
+
+    // 0은 '무효 핸들'로 쓰므로 건너뛴다
+    if (++entry.generation == 0)
+        entry.generation = 1;
+
+    entry.prev = INVALID_INDEX;
+    entry.next = _freeIndex;
+    _freeIndex = index;
+    _count--;
+}
+
+void TimerWheel::Cascade(uint32 level)
+{
+    const uint32 bucket = level * SLOT_COUNT + static_cast<uint32>((_currentTick >> (SLOT_BITS * level)) & SLOT_MASK);
+
+    uint32 index = _buckets[bucket];
+    _buckets[bucket] = INVALID_INDEX;
+
+    while (index != INVALID_INDEX)
+    {
+        const uint32 next = _entries[index].next;
+        Link(index, 0);
+        index = next;
+    }
+}
+
+void TimerWheel::Expire(OUT Vector<JobData>& jobs)
+{
+    const uint32 bucket = static_cast<uint32>(_currentTick & SLOT_MASK);
+
+    uint32 index = _buckets[bucket];
+    _buckets[bucket] = INVALID_INDEX;
+
+    while (index != INVALID_INDEX)
+    {
+        Entry& entry = _entries[index];
+        const uint32 next = entry.next;
+
+        jobs.push_back(JobData(std::move(entry.owner), std::move(entry.job)));
+        Release(index);
+        index = next;
+    }
+}
+
+/*--------------
+    JobTimer
+---------------*/
+
+TimerHandle JobTimer::Reserve(uint64 tickAfter, weak_ptr<JobQueue> owner, JobRef job)
+{
+    const uint64 executeTick = ::GetTickCount64() + tickAfter;
+
+    TimerHandle handle;
+    handle.shard = LThreadId % SHARD_COUNT;
+    handle.index = _shards[handle.shard].Reserve(executeTick, std::move(owner), std::move(job), OUT handle.generation);
+    return handle;
+}
+
+bool JobTimer::Cancel(const TimerHandle& handle)
+{
+    if (handle.IsValid() == false || handle.shard >= SHARD_COUNT)
+        return false;
+
+    return _shards[handle.shard].Cancel(handle.index, handle.generation);
+}
+
+void JobTimer::Distribute(uint64 now)
+{
+    Vector<JobData> jobs;
+
+    // 자기 샤드부터 돌고, 예약만 하고 Distribute를 안 하는 쓰레드의 샤드도 누군가는 돌려준다
+    const uint32 start = LThreadId % SHARD_COUNT;
+    for (uint32 i = 0; i < SHARD_COUNT; i++)
+        _shards[(start + i) % SHARD_COUNT].Distribute(now, OUT jobs);
+
+    const bool pushOnly = (_mode.load() == TimerDispatchMode::Enqueue);
+    for (JobData& data : jobs)
     {
-        const TimerItem& timerItem = _items.top();
-        ObjectPool<JobData>::Push(timerItem.jobData);
-        _items.pop();
+        if (JobQueueRef owner = data.owner.lock())
+            owner->Push(std::move(data.job), pushOnly);
     }
 }
+
+void JobTimer::Clear()
+{
+    for (TimerWheel& shard : _shards)
+        shard.Clear();
+}
@@ -2,7 +2,7 @@
 
 struct JobData
 {
-    JobData(weak_ptr<JobQueue> owner, JobRef job) : owner(owner), job(job)
+    JobData(weak_ptr<JobQueue> owner, JobRef job) : owner(std::move(owner)), job(std::move(job))
     {
 
     }
@@ -11,31 +11,99 @@ struct JobData
     JobRef             job;
 };
 
-struct TimerItem
+/*----------------
+    TimerHandle
+-----------------*/
+
+// Reserve ִ ҿ ڵ.  Ǹ generation ٲ ڵ ȿ ȴ
+struct TimerHandle
 {
-    bool operator<(const TimerItem& other) const
+    bool IsValid() const { return generation != 0; }
+
+    uint32 shard = 0;
+    uint32 index = 0;
+    uint32 generation = 0;
+};
+
+enum class TimerDispatchMode : uint8
+{
+    Execute,    // owner->Push(job) : ť  ־ٸ Distribute 尡  ڸ 
+    Enqueue,    // owner->Push(job, true) :  JobQueue ֱ⸸ ϰ  GGlobalQueue  Ŀ
+};
+
+/*----------------
+    TimerWheel
+-----------------*/
+
+// 4  Ÿ̹  (1 tick = 1ms, ܸ 64ĭ ->  4.6ð, ׺    ܿ ٽ ´)
+// /Ҵ O(1),    tick  
+class TimerWheel
+{
+    enum : uint32
     {
-        return executeTick > other.executeTick;
-    }
+        SLOT_BITS = 6,
+        SLOT_COUNT = 1 << SLOT_BITS,
+        SLOT_MASK = SLOT_COUNT - 1,
+        LEVEL_COUNT = 4,
+        BUCKET_COUNT = SLOT_COUNT * LEVEL_COUNT,
+        INVALID_INDEX = 0xFFFFFFFF,
+    };
 
-    uint64 executeTick = 0;
-    JobData* jobData = nullptr;
+    struct Entry
+    {
+        uint64             executeTick = 0;
+        weak_ptr<JobQueue> owner;
+        JobRef             job;
+        uint32             prev = INVALID_INDEX;
+        uint32             next = INVALID_INDEX;
+        uint32             bucket = INVALID_INDEX; // level * SLOT_COUNT + slot ( ĭ̸ INVALID)
+        uint32             generation = 1;
+    };
+
+public:
+    TimerWheel();
+
+    uint32   Reserve(uint64 executeTick, weak_ptr<JobQueue> owner, JobRef job, OUT uint32& generation);
+    bool     Cancel(uint32 index, uint32 generation);
+    bool     Distribute(uint64 now, OUT Vector<JobData>& jobs);
+    void     Clear();
+
+private:
+    void     Link(uint32 index, uint64 minDelta);
+    void     Unlink(uint32 index);
+    void     Release(uint32 index);
+    void     Cascade(uint32 level);
+    void     Expire(OUT Vector<JobData>& jobs);
+
+private:
+    USE_LOCK;
+    Vector<Entry>  _entries;
+    uint32         _buckets[BUCKET_COUNT];
+    uint32         _freeIndex = INVALID_INDEX;
+    uint32         _count = 0;
+    uint64         _currentTick = 0;
+    Atomic<bool>   _distributing = false;
 };
 
 /*--------------
     JobTimer
 ---------------*/
 
+// 帶 ڱ 忡 ϹǷ Reserve   ΰ  ʴ´.
+// Distribute ڱ  ؼ ٸ 尡   ƴ 带  
 class JobTimer
 {
+    enum { SHARD_COUNT = 8 };
+
 public:
-    void     Reserve(uint64 tickAfter, weak_ptr<JobQueue> owner, JobRef job);
-    void     Distribute(uint64 now);
-    void     Clear();
+    TimerHandle Reserve(uint64 tickAfter, weak_ptr<JobQueue> owner, JobRef job);
+    bool        Cancel(const TimerHandle& handle);
+    void        Distribute(uint64 now);
+    void        Clear();
+
+    void        SetDispatchMode(TimerDispatchMode mode) { _mode.store(mode); }
 
 private:
-    USE_LOCK;
-    PriorityQueue<TimerItem>   _items;
-    Atomic<bool>               _distributing = false;
+    TimerWheel                 _shards[SHARD_COUNT];
+    Atomic<TimerDispatchMode>  _mode = TimerDispatchMode::Execute;
 };
-
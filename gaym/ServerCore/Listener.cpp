@@ -46,6 +46,7 @@ bool Listener::StartAccept(ServerServiceRef service)
 	if (SocketUtils::Listen(_socket) == false)
 		return false;
 
+#ifdef _WIN32
 	const int32 acceptCount = _service->GetMaxSessionCount();
 	for (int32 i = 0; i < acceptCount; i++)
 	{
@@ -54,6 +55,9 @@ bool Listener::StartAccept(ServerServiceRef service)
 		_acceptEvents.push_back(acceptEvent);
 		RegisterAccept(acceptEvent);
 	}
+#else
+	// epoll Accept ̸ ɾ ʰ,   б  ´
+#endif
 
 	return true;
 }
@@ -70,11 +74,40 @@ HANDLE Listener::GetHandle()
 
 void Listener::Dispatch(IocpEvent* iocpEvent, int32 numOfBytes)
 {
+#ifdef _WIN32
 	ASSERT_CRASH(iocpEvent->eventType == EventType::Accept);
 	AcceptEvent* acceptEvent = static_cast<AcceptEvent*>(iocpEvent);
 	ProcessAccept(acceptEvent);
+#endif
 }
 
+#ifndef _WIN32
+void Listener::DispatchReady(uint32 readyEvents)
+{
+	if ((readyEvents & EPOLLIN) == 0)
+		return;
+
+	//  Ʈ̹Ƿ     
+	while (true)
+	{
+		SOCKADDR_IN sockAddress;
+		socklen_t sizeOfSockAddr = sizeof(sockAddress);
+		SOCKET clientSocket = ::accept4(_socket, OUT reinterpret_cast<SOCKADDR*>(&sockAddress), &sizeOfSockAddr, SOCK_NONBLOCK | SOCK_CLOEXEC);
+		if (clientSocket == INVALID_SOCKET)
+		{
+			if (errno == EINTR || errno == ECONNABORTED)
+				continue;
+
+			// EAGAIN :  ̻    
+			break;
+		}
+
+		ProcessAccept(clientSocket, sockAddress);
+	}
+}
+#endif
+
+#ifdef _WIN32
 void Listener::RegisterAccept(AcceptEvent* acceptEvent)
 {
 	SessionRef session = _service->CreateSession(); // Register IOCP
@@ -115,4 +148,27 @@ void Listener::ProcessAccept(AcceptEvent* acceptEvent)
 	session->SetNetAddress(NetAddress(sockAddress));
 	session->ProcessConnect();
 	RegisterAccept(acceptEvent);
-}
\ No newline at end of file
+}
+
+#else
+
+void Listener::ProcessAccept(SOCKET clientSocket, SOCKADDR_IN sockAddress)
+{
+	SessionRef session = _service->CreateSession();
+	if (session == nullptr)
+	{
+		SocketUtils::Close(clientSocket);
+		return;
+	}
+
+	//  ̸    accept  
+	SocketUtils::Close(session->_socket);
+	session->_socket = clientSocket;
+
+	if (_service->GetIocpCore()->Register(session) == false)
+		return;
+
+	session->SetNetAddress(NetAddress(sockAddress));
+	session->ProcessConnect();
+}
+#endif
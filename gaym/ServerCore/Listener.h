@@ -24,11 +24,18 @@ public:
 	/* ̽  */
 	virtual HANDLE GetHandle() override;
 	virtual void Dispatch(class IocpEvent* iocpEvent, int32 numOfBytes = 0) override;
+#ifndef _WIN32
+	virtual void DispatchReady(uint32 readyEvents) override;
+#endif
 
 private:
 	/*   */
+#ifdef _WIN32
 	void RegisterAccept(AcceptEvent* acceptEvent);
 	void ProcessAccept(AcceptEvent* acceptEvent);
+#else
+	void ProcessAccept(SOCKET clientSocket, SOCKADDR_IN sockAddress);
+#endif
 
 protected:
 	SOCKET _socket = INVALID_SOCKET;
@@ -0,0 +1,509 @@
+#include "pch.h"
+#include "Logger.h"
+#include "ConsoleLog.h"
+#include <algorithm>
+#include <ctime>
+
+/*--------------
+	LogRingGuard
+---------------*/
+
+static thread_local LogRing* LLogRing = nullptr;
+
+//     ݴ´ (  Flush 尡   )
+struct LogRingGuard
+{
+	~LogRingGuard()
+	{
+		if (LLogRing != nullptr)
+			LLogRing->closed.store(true, std::memory_order_release);
+
+		LLogRing = nullptr;
+	}
+
+	void Touch() { }
+};
+
+static thread_local LogRingGuard LLogRingGuard;
+
+/*--------------
+	Logger
+---------------*/
+
+Logger::Logger()
+{
+	_flushThread = std::thread([this]() { FlushLoop(); });
+}
+
+Logger::~Logger()
+{
+	{
+		LockGuard guard(_wakeLock);
+		_stop = true;
+	}
+	_wakeCv.notify_one();
+
+	if (_flushThread.joinable())
+		_flushThread.join();
+
+	//  ϱ  
+	Flush();
+	CloseFile();
+
+	LockGuard guard(_ringsLock);
+	for (LogRing* ring : _rings)
+		delete ring;
+	_rings.clear();
+}
+
+bool Logger::OpenFile(const char* path)
+{
+	LockGuard guard(_flushLock);
+
+	if (_file != nullptr)
+		::fclose(_file);
+
+	_file = ::fopen(path, "ab");
+	return _file != nullptr;
+}
+
+void Logger::CloseFile()
+{
+	LockGuard guard(_flushLock);
+
+	if (_file != nullptr)
+		::fclose(_file);
+
+	_file = nullptr;
+}
+
+bool Logger::ShouldLog(LogSite* site)
+{
+	if (site->level < _level.load(std::memory_order_relaxed))
+		return false;
+
+	if (site->sampleEvery > 1 && site->hitCount.fetch_add(1, std::memory_order_relaxed) % site->sampleEvery != 0)
+		return false;
+
+	// ȣ  ʴ   . Fatal    ׻ 
+	const int32 rateLimit = _rateLimit.load(std::memory_order_relaxed);
+	if (rateLimit <= 0 || site->level == LogLevel::Fatal || site->rateLimited == false)
+		return true;
+
+	const uint64 now = ::GetTickCount64() / 1000;
+	uint64 window = site->window.load(std::memory_order_relaxed);
+	if (window != now && site->window.compare_exchange_strong(window, now, std::memory_order_relaxed))
+		site->windowCount.store(0, std::memory_order_relaxed);
+
+	if (site->windowCount.fetch_add(1, std::memory_order_relaxed) >= rateLimit)
+	{
+		site->suppressedCount.fetch_add(1, std::memory_order_relaxed);
+		return false;
+	}
+
+	return true;
+}
+
+void Logger::Flush()
+{
+	LockGuard guard(_flushLock);
+
+	vector<LogRing*> rings;
+	{
+		LockGuard ringsGuard(_ringsLock);
+		rings = _rings;
+	}
+
+	for (LogRing* ring : rings)
+		DrainRing(ring);
+
+	// 庰   оǷ ð ģ
+	std::stable_sort(_pending.begin(), _pending.end(), [](const PendingLine& a, const PendingLine& b) { return a.timestamp < b.timestamp; });
+	for (const PendingLine& line : _pending)
+		Output(line.level, line.text.c_str());
+	_pending.clear();
+
+	if (_file != nullptr)
+		::fflush(_file);
+
+	//     
+	LockGuard ringsGuard(_ringsLock);
+	for (auto it = _rings.begin(); it != _rings.end();)
+	{
+		LogRing* ring = *it;
+		if (ring->closed.load(std::memory_order_acquire) && ring->readPos.load() == ring->writePos.load(std::memory_order_acquire))
+		{
+			delete ring;
+			it = _rings.erase(it);
+		}
+		else
+		{
+			++it;
+		}
+	}
+}
+
+const WCHAR* Logger::GetLevelName(LogLevel level)
+{
+	switch (level)
+	{
+	case LogLevel::Trace:	return L"TRACE";
+	case LogLevel::Debug:	return L"DEBUG";
+	case LogLevel::Info:	return L"INFO";
+	case LogLevel::Warn:	return L"WARN";
+	case LogLevel::Error:	return L"ERROR";
+	case LogLevel::Fatal:	return L"FATAL";
+	default:				return L"?";
+	}
+}
+
+LogRing* Logger::LocalRing()
+{
+	if (LLogRing != nullptr)
+		return LLogRing;
+
+	LLogRingGuard.Touch();
+	LLogRing = new LogRing(LThreadId);
+
+	LockGuard guard(_ringsLock);
+	_rings.push_back(LLogRing);
+	return LLogRing;
+}
+
+BYTE* Logger::Reserve(LogRing* ring, uint32 size)
+{
+	const uint64 writePos = ring->writePos.load(std::memory_order_relaxed);
+	const uint64 readPos = ring->readPos.load(std::memory_order_acquire);
+
+	const uint32 offset = static_cast<uint32>(writePos % LogRing::CAPACITY);
+	const uint32 tailSpace = LogRing::CAPACITY - offset;
+
+	//      ǳʶٰ ó 
+	const uint64 needed = (tailSpace < size) ? tailSpace + size : size;
+	if (writePos + needed - readPos > LogRing::CAPACITY)
+		return nullptr;
+
+	if (tailSpace < size)
+	{
+		//     д ʵ ˾Ƽ ǳʶڴ
+		if (tailSpace >= sizeof(LogRecord))
+		{
+			LogRecord* skip = reinterpret_cast<LogRecord*>(&ring->buffer[offset]);
+			skip->size = tailSpace;
+			skip->site = nullptr;
+		}
+
+		ring->writePos.store(writePos + tailSpace, std::memory_order_release);
+		return &ring->buffer[0];
+	}
+
+	return &ring->buffer[offset];
+}
+
+void Logger::Commit(LogRing* ring, uint32 size)
+{
+	ring->writePos.store(ring->writePos.load(std::memory_order_relaxed) + size, std::memory_order_release);
+}
+
+void Logger::FlushLoop()
+{
+	while (true)
+	{
+		{
+			UniqueLock lock(_wakeLock);
+			_wakeCv.wait_for(lock, std::chrono::milliseconds(FLUSH_INTERVAL_MS), [this]() { return _stop; });
+			if (_stop)
+				return;
+		}
+
+		Flush();
+	}
+}
+
+void Logger::DrainRing(LogRing* ring)
+{
+	const int64 dropped = ring->droppedCount.exchange(0, std::memory_order_relaxed);
+	if (dropped > 0)
+	{
+		WCHAR line[128];
+		::swprintf(line, 128, L"[Logger] T%u : ring full, dropped %lld records\n", ring->threadId, static_cast<long long>(dropped));
+		const int64 now = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+		_pending.push_back(PendingLine{ now, LogLevel::Warn, line });
+	}
+
+	uint64 readPos = ring->readPos.load(std::memory_order_relaxed);
+	const uint64 writePos = ring->writePos.load(std::memory_order_acquire);
+
+	while (readPos < writePos)
+	{
+		const uint32 offset = static_cast<uint32>(readPos % LogRing::CAPACITY);
+		const uint32 tailSpace = LogRing::CAPACITY - offset;
+		if (tailSpace < sizeof(LogRecord))
+		{
+			readPos += tailSpace;
+			continue;
+		}
+
+		const LogRecord* record = reinterpret_cast<const LogRecord*>(&ring->buffer[offset]);
+		if (record->site != nullptr)
+			FormatRecord(record, reinterpret_cast<const BYTE*>(&record[1]), reinterpret_cast<const BYTE*>(record) + record->size);
+
+		readPos += record->size;
+	}
+
+	ring->readPos.store(readPos, std::memory_order_release);
+}
+
+// char ڿ UTF-8 (protobuf / XML / /utf-8 ͷ). 쿡 UTF-8 ƴϸ ANSI ڵ  (CP949 ͷ)
+static void WidenString(const char* str, uint32 bytes, wstring& out)
+{
+	if (bytes == 0)
+		return;
+
+#ifdef _WIN32
+	UINT codePage = CP_UTF8;
+	int32 length = ::MultiByteToWideChar(CP_UTF8, MB_ERR_INVALID_CHARS, str, static_cast<int32>(bytes), nullptr, 0);
+	if (length == 0)
+	{
+		codePage = CP_ACP;
+		length = ::MultiByteToWideChar(CP_ACP, 0, str, static_cast<int32>(bytes), nullptr, 0);
+	}
+
+	const size_t base = out.size();
+	out.resize(base + length);
+	::MultiByteToWideChar(codePage, 0, str, static_cast<int32>(bytes), &out[base], length);
+#else
+	// WCHAR UTF-32. ߸ Ʈ U+FFFD ϳ
+	const BYTE* p = reinterpret_cast<const BYTE*>(str);
+	const BYTE* end = p + bytes;
+	while (p < end)
+	{
+		uint32 code = *p++;
+		if (code < 0x80)
+		{
+			out += static_cast<WCHAR>(code);
+			continue;
+		}
+
+		int32 extra = 0;
+		uint32 minCode = 0;
+		if ((code & 0xE0) == 0xC0)		{ extra = 1; code &= 0x1F; minCode = 0x80; }
+		else if ((code & 0xF0) == 0xE0)	{ extra = 2; code &= 0x0F; minCode = 0x800; }
+		else if ((code & 0xF8) == 0xF0)	{ extra = 3; code &= 0x07; minCode = 0x10000; }
+		else
+		{
+			out += static_cast<WCHAR>(0xFFFD);
+			continue;
+		}
+
+		int32 i = 0;
+		for (; i < extra && p < end && (*p & 0xC0) == 0x80; i++)
+			code = (code << 6) | (*p++ & 0x3F);
+
+		if (i < extra || code < minCode || code > 0x10FFFF || (code >= 0xD800 && code <= 0xDFFF))
+			code = 0xFFFD;
+
+		out += static_cast<WCHAR>(code);
+	}
+#endif
+}
+
+//  ϳ printf ȯ (spec,  ľ )  δ
+static const BYTE* AppendArg(wstring& out, const wstring& spec, WCHAR conversion, const BYTE* args, const BYTE* argsEnd)
+{
+	WCHAR buffer[512];
+	wstring format = spec;
+
+	if (args >= argsEnd)
+	{
+		out += L"<?>";
+		return args;
+	}
+
+	const LogArgType type = static_cast<LogArgType>(*args++);
+	if (type == LogArgType::String || type == LogArgType::WString)
+	{
+		uint32 bytes = 0;
+		::memcpy(&bytes, args, sizeof(bytes));
+		args += sizeof(bytes);
+
+		wstring str;
+		if (type == LogArgType::String)
+			WidenString(reinterpret_cast<const char*>(args), bytes, str);
+		else
+			str.assign(reinterpret_cast<const WCHAR*>(args), bytes / sizeof(WCHAR));
+
+		if (spec.size() == 1)
+		{
+			out += str;
+		}
+		else
+		{
+			format += L"ls";
+			::swprintf(buffer, 512, format.c_str(), str.c_str());
+			out += buffer;
+		}
+
+		return args + bytes;
+	}
+
+	uint64 bits = 0;
+	::memcpy(&bits, args, sizeof(bits));
+	args += sizeof(bits);
+
+	switch (type)
+	{
+	case LogArgType::Float:
+	{
+		double value = 0;
+		::memcpy(&value, &bits, sizeof(value));
+		format += (::wcschr(L"eEfFgGaA", conversion) != nullptr) ? conversion : L'f';
+		::swprintf(buffer, 512, format.c_str(), value);
+		break;
+	}
+	case LogArgType::Pointer:
+		format += L'p';
+		::swprintf(buffer, 512, format.c_str(), reinterpret_cast<void*>(bits));
+		break;
+	default:
+	{
+		//  ũ  64Ʈ ´
+		const bool unsignedConversion = (::wcschr(L"uxXo", conversion) != nullptr);
+		const bool charConversion = (conversion == L'c');
+		if (charConversion)
+		{
+			format += L"lc";
+			::swprintf(buffer, 512, format.c_str(), static_cast<wint_t>(bits));
+		}
+		else if (unsignedConversion || type == LogArgType::UInt)
+		{
+			format += L"ll";
+			format += unsignedConversion ? conversion : L'u';
+			::swprintf(buffer, 512, format.c_str(), static_cast<unsigned long long>(bits));
+		}
+		else
+		{
+			format += L"lld";
+			::swprintf(buffer, 512, format.c_str(), static_cast<long long>(bits));
+		}
+		break;
+	}
+	}
+
+	out += buffer;
+	return args;
+}
+
+void Logger::FormatRecord(const LogRecord* record, const BYTE* args, const BYTE* argsEnd)
+{
+	const LogSite* site = record->site;
+
+	// [2026-01-01 12:34:56.789][INFO][T3] message
+	const time_t seconds = static_cast<time_t>(record->timestamp / 1000000);
+	tm localTime = {};
+#ifdef _WIN32
+	::localtime_s(&localTime, &seconds);
+#else
+	::localtime_r(&seconds, &localTime);
+#endif
+
+	WCHAR prefix[96];
+	::swprintf(prefix, 96, L"[%04d-%02d-%02d %02d:%02d:%02d.%03d][%ls][T%u] ",
+		localTime.tm_year + 1900, localTime.tm_mon + 1, localTime.tm_mday,
+		localTime.tm_hour, localTime.tm_min, localTime.tm_sec,
+		static_cast<int32>((record->timestamp / 1000) % 1000),
+		GetLevelName(site->level), record->threadId);
+
+	wstring text = prefix;
+	for (const WCHAR* p = site->format; *p != L'\0'; p++)
+	{
+		if (*p != L'%')
+		{
+			text += *p;
+			continue;
+		}
+
+		if (p[1] == L'%')
+		{
+			text += L'%';
+			p++;
+			continue;
+		}
+
+		// %[flags][width][.precision][length]conversion
+		wstring spec = L"%";
+		const WCHAR* q = p + 1;
+		while (*q != L'\0' && ::wcschr(L"-+ #0123456789.*", *q) != nullptr)
+			spec += *q++;
+		while (*q != L'\0' && ::wcschr(L"hlLqjztI64", *q) != nullptr)
+			q++;
+
+		if (*q == L'\0')
+			break;
+
+		args = AppendArg(text, spec, *q, args, argsEnd);
+		p = q;
+	}
+
+	if (record->suppressed > 0)
+		text += L" (suppressed " + to_wstring(record->suppressed) + L")";
+
+	if (text.empty() || text.back() != L'\n')
+		text += L'\n';
+
+	_pending.push_back(PendingLine{ record->timestamp, site->level, std::move(text) });
+}
+
+void Logger::Output(LogLevel level, const WCHAR* line)
+{
+	if (_console.load(std::memory_order_relaxed) && GConsoleLogger != nullptr)
+	{
+		Color color = Color::WHITE;
+		if (level >= LogLevel::Error)
+			color = Color::RED;
+		else if (level == LogLevel::Warn)
+			color = Color::YELLOW;
+
+		GConsoleLogger->Write(level < LogLevel::Error, color, line);
+	}
+
+	if (_file != nullptr)
+	{
+		//  UTF-8
+		string utf8;
+		for (const WCHAR* p = line; *p != L'\0'; p++)
+		{
+			uint32 code = static_cast<uint32>(*p);
+			if (sizeof(WCHAR) == 2 && code >= 0xD800 && code <= 0xDBFF && p[1] >= 0xDC00 && p[1] <= 0xDFFF)
+			{
+				code = 0x10000 + ((code - 0xD800) << 10) + (static_cast<uint32>(p[1]) - 0xDC00);
+				p++;
+			}
+
+			if (code < 0x80)
+			{
+				utf8 += static_cast<char>(code);
+			}
+			else if (code < 0x800)
+			{
+				utf8 += static_cast<char>(0xC0 | (code >> 6));
+				utf8 += static_cast<char>(0x80 | (code & 0x3F));
+			}
+			else if (code < 0x10000)
+			{
+				utf8 += static_cast<char>(0xE0 | (code >> 12));
+				utf8 += static_cast<char>(0x80 | ((code >> 6) & 0x3F));
+				utf8 += static_cast<char>(0x80 | (code & 0x3F));
+			}
+			else
+			{
+				utf8 += static_cast<char>(0xF0 | (code >> 18));
+				utf8 += static_cast<char>(0x80 | ((code >> 12) & 0x3F));
+				utf8 += static_cast<char>(0x80 | ((code >> 6) & 0x3F));
+				utf8 += static_cast<char>(0x80 | (code & 0x3F));
+			}
+		}
+
+		::fwrite(utf8.data(), 1, utf8.size(), _file);
+	}
+}
@@ -0,0 +1,301 @@
+#pragma once
+
+/*--------------
+	LogLevel
+---------------*/
+
+enum class LogLevel : uint8
+{
+	Trace,
+	Debug,
+	Info,
+	Warn,
+	Error,
+	Fatal,	//   ٷ Flush (CRASH  뵵)
+};
+
+/*--------------
+	LogSite
+---------------*/
+
+// α ȣ  ϳ (LOG_* ũ  static).  ڿ ͷ̾ Ѵ
+struct LogSite
+{
+	LogSite(LogLevel level, const WCHAR* format, const char* file, int32 line, int32 sampleEvery = 1, bool rateLimited = true)
+		: level(level), format(format), file(file), line(line), sampleEvery(sampleEvery), rateLimited(rateLimited) { }
+
+	LogLevel		level;
+	const WCHAR*	format;
+	const char*		file;
+	int32			line;
+	int32			sampleEvery;	// N  1 
+	bool			rateLimited;	// false = ʴ    
+
+	Atomic<int64>	hitCount = 0;
+	Atomic<uint64>	window = 0;			// ӵ   ()
+	Atomic<int32>	windowCount = 0;
+	Atomic<int32>	suppressedCount = 0;	// ӵ    ( Ͽ δ)
+};
+
+/*--------------
+	LogArg
+---------------*/
+
+// ڴ ȣ 忡 ̳ʸθ ϰ, ڿ  Flush 忡 Ѵ
+enum class LogArgType : uint8
+{
+	Int,		// int64
+	UInt,		// uint64
+	Float,		// double
+	Pointer,	// const void*
+	String,		// char ڿ (uint32  + Ʈ)
+	WString,	// WCHAR ڿ (uint32  + WCHAR)
+};
+
+namespace LogArgs
+{
+	template<typename T>
+	inline uint32 Size(const T& value)
+	{
+		if constexpr (std::is_convertible_v<T, const char*>)
+			return 1 + sizeof(uint32) + static_cast<uint32>(value ? ::strlen(value) : 0);
+		else if constexpr (std::is_convertible_v<T, const WCHAR*>)
+			return 1 + sizeof(uint32) + static_cast<uint32>((value ? ::wcslen(value) : 0) * sizeof(WCHAR));
+		else if constexpr (std::is_same_v<T, string>)
+			return 1 + sizeof(uint32) + static_cast<uint32>(value.size());
+		else if constexpr (std::is_same_v<T, wstring>)
+			return 1 + sizeof(uint32) + static_cast<uint32>(value.size() * sizeof(WCHAR));
+		else
+			return 1 + sizeof(uint64);
+	}
+
+	inline BYTE* WriteString(BYTE* dest, LogArgType type, const void* data, uint32 bytes)
+	{
+		*dest++ = static_cast<BYTE>(type);
+		::memcpy(dest, &bytes, sizeof(bytes));
+		dest += sizeof(bytes);
+		if (bytes > 0)
+			::memcpy(dest, data, bytes);
+		return dest + bytes;
+	}
+
+	template<typename T>
+	inline BYTE* Write(BYTE* dest, const T& value)
+	{
+		if constexpr (std::is_convertible_v<T, const char*>)
+		{
+			const char* str = value;
+			return WriteString(dest, LogArgType::String, str, static_cast<uint32>(str ? ::strlen(str) : 0));
+		}
+		else if constexpr (std::is_convertible_v<T, const WCHAR*>)
+		{
+			const WCHAR* str = value;
+			return WriteString(dest, LogArgType::WString, str, static_cast<uint32>((str ? ::wcslen(str) : 0) * sizeof(WCHAR)));
+		}
+		else if constexpr (std::is_same_v<T, string>)
+			return WriteString(dest, LogArgType::String, value.data(), static_cast<uint32>(value.size()));
+		else if constexpr (std::is_same_v<T, wstring>)
+			return WriteString(dest, LogArgType::WString, value.data(), static_cast<uint32>(value.size() * sizeof(WCHAR)));
+		else
+		{
+			LogArgType type;
+			uint64 bits = 0;
+			if constexpr (std::is_floating_point_v<T>)
+			{
+				type = LogArgType::Float;
+				const double v = static_cast<double>(value);
+				::memcpy(&bits, &v, sizeof(v));
+			}
+			else if constexpr (std::is_pointer_v<T>)
+			{
+				type = LogArgType::Pointer;
+				bits = reinterpret_cast<uint64>(value);
+			}
+			else if constexpr (std::is_enum_v<T>)
+			{
+				type = LogArgType::Int;
+				bits = static_cast<uint64>(static_cast<int64>(value));
+			}
+			else if constexpr (std::is_signed_v<T>)
+			{
+				type = LogArgType::Int;
+				bits = static_cast<uint64>(static_cast<int64>(value));
+			}
+			else
+			{
+				static_assert(std::is_integral_v<T>, "unsupported log argument type");
+				type = LogArgType::UInt;
+				bits = static_cast<uint64>(value);
+			}
+
+			*dest++ = static_cast<BYTE>(type);
+			::memcpy(dest, &bits, sizeof(bits));
+			return dest + sizeof(bits);
+		}
+	}
+}
+
+/*--------------
+	LogRing
+---------------*/
+
+//  ϳ  Flush  ϳ д Ʈ  (SPSC,  ).
+//   ȣ 带  ʰ  (droppedCount)
+struct LogRing
+{
+	enum : uint32
+	{
+		CAPACITY = 0x40000,	// 256KB
+	};
+
+	LogRing(uint32 threadId) : threadId(threadId) { }
+
+	alignas(64) Atomic<uint64>	writePos = 0;	//  常 
+	alignas(64) Atomic<uint64>	readPos = 0;	// Flush 常 
+	alignas(64) Atomic<int64>	droppedCount = 0;
+	Atomic<bool>				closed = false;	//   ( а  )
+	uint32						threadId;
+	BYTE						buffer[CAPACITY];
+};
+
+// [LogRecord][arg][arg]...  8Ʈ 
+struct LogRecord
+{
+	uint32			size;			//  
+	uint32			threadId;
+	const LogSite*	site;			// nullptr =   ǳʶٱ
+	int64			timestamp;		// system_clock, us
+	int32			suppressed;
+	int32			reserved;
+};
+
+/*--------------
+	Logger
+---------------*/
+
+class Logger
+{
+	enum
+	{
+		FLUSH_INTERVAL_MS = 10,
+		LINE_SIZE = 4096,
+	};
+
+public:
+	Logger();
+	~Logger();
+
+	void			SetLevel(LogLevel level) { _level.store(level); }
+	void			SetRateLimit(int32 perSitePerSecond) { _rateLimit.store(perSitePerSecond); }	// 0 =  
+	void			SetConsole(bool enable) { _console.store(enable); }
+	bool			OpenFile(const char* path);
+	void			CloseFile();
+
+	//  / ø / ӵ  Ȯ
+	bool			ShouldLog(LogSite* site);
+
+	template<typename... Args>
+	void			Write(LogSite* site, const Args&... args);
+
+	// ȣ 忡    (Fatal,  )
+	void			Flush();
+
+	static const WCHAR*	GetLevelName(LogLevel level);
+
+private:
+	LogRing*		LocalRing();
+	BYTE*			Reserve(LogRing* ring, uint32 size);
+	void			Commit(LogRing* ring, uint32 size);
+
+	void			FlushLoop();
+	void			DrainRing(LogRing* ring);
+	void			FormatRecord(const LogRecord* record, const BYTE* args, const BYTE* argsEnd);
+	void			Output(LogLevel level, const WCHAR* line);
+
+private:
+	Atomic<LogLevel>	_level = LogLevel::Info;
+	Atomic<int32>		_rateLimit = 100;
+	Atomic<bool>		_console = true;
+
+	Mutex				_ringsLock;
+	vector<LogRing*>	_rings;
+
+	Mutex				_flushLock;		//  д  ׻ ϳ
+	FILE*				_file = nullptr;
+	struct PendingLine
+	{
+		int64			timestamp;
+		LogLevel		level;
+		wstring			text;
+	};
+	vector<PendingLine>	_pending;		// ̹ Flush   (ð   )
+
+	Mutex				_wakeLock;
+	CondVar				_wakeCv;
+	bool				_stop = false;
+	std::thread			_flushThread;
+};
+
+template<typename... Args>
+void Logger::Write(LogSite* site, const Args&... args)
+{
+	uint32 argSize = 0;
+	((argSize += LogArgs::Size(args)), ...);
+
+	const uint32 size = (sizeof(LogRecord) + argSize + 7) & ~7u;
+
+	LogRing* ring = LocalRing();
+	BYTE* dest = Reserve(ring, size);
+	if (dest == nullptr)
+	{
+		ring->droppedCount.fetch_add(1, std::memory_order_relaxed);
+		return;
+	}
+
+	LogRecord* record = reinterpret_cast<LogRecord*>(dest);
+	record->size = size;
+	record->threadId = ring->threadId;
+	record->site = site;
+	record->timestamp = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+	record->suppressed = site->suppressedCount.exchange(0, std::memory_order_relaxed);
+	record->reserved = 0;
+
+	if constexpr (sizeof...(args) > 0)
+	{
+		BYTE* argDest = dest + sizeof(LogRecord);
+		((argDest = LogArgs::Write(argDest, args)), ...);
+	}
+
+	Commit(ring, size);
+
+	if (site->level == LogLevel::Fatal)
+		Flush();
+}
+
+/*--------------
+	LOG macros
+---------------*/
+
+// %d %u %x %f %s %p  printf .  ũ , %s  char/WCHAR ڿ  ޴´
+#define LOG_SITE_EX(level, sampleEvery, rateLimited, format, ...)									\
+	do																								\
+	{																								\
+		static LogSite __logSite(level, format, __FILE__, __LINE__, sampleEvery, rateLimited);		\
+		if (GLogger != nullptr && GLogger->ShouldLog(&__logSite))									\
+			GLogger->Write(&__logSite, ##__VA_ARGS__);												\
+	} while (false)
+
+#define LOG_SITE(level, sampleEvery, format, ...)	LOG_SITE_EX(level, sampleEvery, true, format, ##__VA_ARGS__)
+
+#define LOG_TRACE(format, ...)	LOG_SITE(LogLevel::Trace, 1, format, ##__VA_ARGS__)
+#define LOG_DEBUG(format, ...)	LOG_SITE(LogLevel::Debug, 1, format, ##__VA_ARGS__)
+#define LOG_INFO(format, ...)	LOG_SITE(LogLevel::Info, 1, format, ##__VA_ARGS__)
+#define LOG_WARN(format, ...)	LOG_SITE(LogLevel::Warn, 1, format, ##__VA_ARGS__)
+#define LOG_ERROR(format, ...)	LOG_SITE(LogLevel::Error, 1, format, ##__VA_ARGS__)
+#define LOG_FATAL(format, ...)	LOG_SITE(LogLevel::Fatal, 1, format, ##__VA_ARGS__)
+
+// N ȣ  1 
+#define LOG_SAMPLED(level, sampleEvery, format, ...)	LOG_SITE(level, sampleEvery, format, ##__VA_ARGS__)
+
+// ʴ     (Ű ó   Ƽ  α)
+#define LOG_UNLIMITED(level, format, ...)	LOG_SITE_EX(level, 1, false, format, ##__VA_ARGS__)
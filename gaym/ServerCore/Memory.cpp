@@ -11,7 +11,7 @@ Memory::Memory()
 	int32 size = 0;
 	int32 tableIndex = 0;
 
-	for (size = 32; size <= 1024; size += 32)
+	for (size = 32; size < 1024; size += 32)
 	{
 		MemoryPool* pool = new MemoryPool(size);
 		_pools.push_back(pool);
@@ -23,7 +23,7 @@ Memory::Memory()
 		}
 	}
 
-	for (; size <= 2048; size += 128)
+	for (; size < 2048; size += 128)
 	{
 		MemoryPool* pool = new MemoryPool(size);
 		_pools.push_back(pool);
@@ -1,47 +1,517 @@
 #include "pch.h"
 #include "MemoryPool.h"
+#include <algorithm>
+
+/*-----------------
+	MagazineCache
+------------------*/
+
+// 帶 Ǯ Ű  (loaded, previous)  ִٰ
+//   ų  á  â ° ȯѴ (Bonwick )
+struct MagazineCache
+{
+	void Flush()
+	{
+		if (owner == nullptr)
+			return;
+
+		owner->AddCounts(allocCount, freeCount, hitCount);
+		allocCount = 0;
+		freeCount = 0;
+		hitCount = 0;
+
+		for (Magazine* magazine : { loaded, previous })
+		{
+			if (magazine == nullptr)
+				continue;
+
+			if (magazine->IsEmpty())
+				owner->PushEmptyMagazine(magazine);
+			else if (magazine->IsFull())
+				owner->PushFullMagazine(magazine);
+			else
+			{
+				owner->FreeMagazineBlocks(magazine);
+				owner->PushEmptyMagazine(magazine);
+			}
+		}
+
+		loaded = nullptr;
+		previous = nullptr;
+	}
+
+	MemoryPool*	owner;
+	Magazine*	loaded;
+	Magazine*	previous;
+	int32		allocCount;
+	int32		freeCount;
+	int32		hitCount;
+};
+
+// 尡   ȿϵ ڸ Ҹڸ 
+struct MagazineCacheTable
+{
+	void Flush()
+	{
+		for (MagazineCache& cache : caches)
+			cache.Flush();
+
+		flushed = true;
+	}
+
+	bool			flushed;
+	MagazineCache	caches[MemoryPool::MAX_CACHED_POOLS];
+};
+
+static thread_local MagazineCacheTable LMagazineCaches;
+
+//    ĳø Ǯ ش
+struct MagazineCacheGuard
+{
+	~MagazineCacheGuard() { LMagazineCaches.Flush(); }
+	void Touch() { }
+};
+
+static thread_local MagazineCacheGuard LMagazineCacheGuard;
 
 /*-----------------
 	MemoryPool
 ------------------*/
 
+static Mutex& PoolRegistryLock()
+{
+	static Mutex lock;
+	return lock;
+}
+
+static vector<MemoryPool*>& PoolRegistry()
+{
+	static vector<MemoryPool*> pools;
+	return pools;
+}
+
 MemoryPool::MemoryPool(int32 allocSize) : _allocSize(allocSize)
 {
-	::InitializeSListHead(&_header);
+	static Atomic<int32> SPoolId = 0;
+	_poolId = SPoolId.fetch_add(1);
+
+	LockGuard guard(PoolRegistryLock());
+	PoolRegistry().push_back(this);
 }
 
 MemoryPool::~MemoryPool()
 {
-	while (MemoryHeader* memory = static_cast<MemoryHeader*>(::InterlockedPopEntrySList(&_header)))
-		::_aligned_free(memory);
+	{
+		LockGuard guard(PoolRegistryLock());
+		vector<MemoryPool*>& pools = PoolRegistry();
+		pools.erase(std::remove(pools.begin(), pools.end(), this), pools.end());
+	}
+
+	//   ĳð  ִ ϵ Բ 
+	if (MagazineCache* cache = LocalCache())
+	{
+		cache->Flush();
+		cache->owner = nullptr;
+	}
+
+	while (Magazine* magazine = _fullMagazines)
+	{
+		_fullMagazines = magazine->next;
+		FreeMagazineBlocks(magazine);
+		delete magazine;
+	}
+
+	while (Magazine* magazine = _emptyMagazines)
+	{
+		_emptyMagazines = magazine->next;
+		delete magazine;
+	}
+
+	if (_sharedMagazine != nullptr)
+	{
+		FreeMagazineBlocks(_sharedMagazine);
+		delete _sharedMagazine;
+	}
 }
 
 void MemoryPool::Push(MemoryHeader* ptr)
 {
 	ptr->allocSize = 0;
 
-	::InterlockedPushEntrySList(&_header, static_cast<PSLIST_ENTRY>(ptr));
+	MagazineCache* cache = LocalCache();
+	if (cache == nullptr)
+	{
+		PushShared(ptr);
+		return;
+	}
+
+	cache->freeCount++;
+
+	if (cache->loaded != nullptr && cache->loaded->IsFull() == false)
+	{
+		cache->loaded->blocks[cache->loaded->count++] = ptr;
+		return;
+	}
+
+	if (cache->previous != nullptr && cache->previous->IsFull() == false)
+	{
+		swap(cache->loaded, cache->previous);
+		cache->loaded->blocks[cache->loaded->count++] = ptr;
+		return;
+	}
+
+	//    á ϳ â ѱ  Ű ޾ƿ´
+	AddCounts(cache->allocCount, cache->freeCount, cache->hitCount);
+	cache->allocCount = 0;
+	cache->freeCount = 0;
+	cache->hitCount = 0;
+
+	if (cache->previous != nullptr)
+		PushFullMagazine(cache->previous);
 
-	_useCount.fetch_sub(1);
-	_reserveCount.fetch_add(1);
+	cache->previous = cache->loaded;
+	cache->loaded = PopEmptyMagazine();
+	cache->loaded->blocks[cache->loaded->count++] = ptr;
 }
 
 MemoryHeader* MemoryPool::Pop()
 {
-	MemoryHeader* memory = static_cast<MemoryHeader*>(::InterlockedPopEntrySList(&_header));
+	MemoryHeader* memory = nullptr;
 
-	//   
-	if (memory == nullptr)
+	MagazineCache* cache = LocalCache();
+	if (cache == nullptr)
+		return PopShared();
+
+	cache->allocCount++;
+
+	if (cache->loaded != nullptr && cache->loaded->IsEmpty() == false)
+	{
+		memory = cache->loaded->blocks[--cache->loaded->count];
+	}
+	else if (cache->previous != nullptr && cache->previous->IsEmpty() == false)
 	{
-		memory = reinterpret_cast<MemoryHeader*>(::_aligned_malloc(_allocSize, SLIST_ALIGNMENT));
+		swap(cache->loaded, cache->previous);
+		memory = cache->loaded->blocks[--cache->loaded->count];
 	}
 	else
 	{
-		ASSERT_CRASH(memory->allocSize == 0);
-		_reserveCount.fetch_sub(1);
+		//    â   Ű ޾ƿ´
+		AddCounts(cache->allocCount, cache->freeCount, cache->hitCount);
+		cache->allocCount = 0;
+		cache->freeCount = 0;
+		cache->hitCount = 0;
+
+		if (Magazine* full = PopFullMagazine())
+		{
+			if (cache->previous != nullptr)
+				PushEmptyMagazine(cache->previous);
+
+			cache->previous = cache->loaded;
+			cache->loaded = full;
+			memory = cache->loaded->blocks[--cache->loaded->count];
+		}
+	}
+
+	//   
+	if (memory == nullptr)
+		return AllocateBlock();
+
+	cache->hitCount++;
+	ASSERT_CRASH(memory->allocSize == 0);
+	return memory;
+}
+
+int64 MemoryPool::Trim()
+{
+	Magazine* released = nullptr;
+	{
+		LockGuard guard(_depotLock);
+
+		//  Trim ķ  â  ִ ŭ  ʴ ޸
+		for (int32 i = 0; i < _minFullCount && _fullMagazines != nullptr; i++)
+		{
+			Magazine* magazine = _fullMagazines;
+			_fullMagazines = magazine->next;
+			_fullCount--;
+
+			magazine->next = released;
+			released = magazine;
+		}
+
+		_minFullCount = _fullCount;
+	}
+
+	int64 releasedBytes = 0;
+	while (Magazine* magazine = released)
+	{
+		released = magazine->next;
+		releasedBytes += static_cast<int64>(magazine->count) * _allocSize;
+		FreeMagazineBlocks(magazine);
+		PushEmptyMagazine(magazine);
+	}
+
+	return releasedBytes;
+}
+
+MemoryPoolStats MemoryPool::GetStats()
+{
+	MemoryPoolStats stats;
+	stats.allocSize = _allocSize;
+
+	int64 allocCount = _allocCount.load();
+	int64 freeCount = _freeCount.load();
+	stats.hits = _hitCount.load();
+	{
+		LockGuard guard(_depotLock);
+		allocCount += _sharedAllocCount;
+		freeCount += _sharedFreeCount;
+		stats.hits += _sharedHitCount;
+	}
+
+	stats.live = allocCount - freeCount;
+	stats.peak = _peakLive.load();
+	stats.misses = _missCount.load();
+	stats.bytes = _reservedBlocks.load() * _allocSize;
+	return stats;
+}
+
+void MemoryPool::FlushThreadCache()
+{
+	LMagazineCaches.Flush();
+}
+
+int64 MemoryPool::TrimAll()
+{
+	LockGuard guard(PoolRegistryLock());
+
+	int64 releasedBytes = 0;
+	for (MemoryPool* pool : PoolRegistry())
+		releasedBytes += pool->Trim();
+
+	return releasedBytes;
+}
+
+void MemoryPool::DumpAllStats()
+{
+	LockGuard guard(PoolRegistryLock());
+
+	LOG_INFO(L"[MemoryPool] size       live       peak       hits     misses      bytes");
+	for (MemoryPool* pool : PoolRegistry())
+	{
+		const MemoryPoolStats stats = pool->GetStats();
+		if (stats.hits == 0 && stats.misses == 0)
+			continue;
+
+		LOG_INFO(L"[MemoryPool] %4d %10lld %10lld %10lld %10lld %10lld",
+			stats.allocSize, stats.live, stats.peak, stats.hits, stats.misses, stats.bytes);
 	}
+}
 
-	_useCount.fetch_add(1);
+MagazineCache* MemoryPool::LocalCache()
+{
+	if (_poolId >= MAX_CACHED_POOLS || LMagazineCaches.flushed)
+		return nullptr;
 
+	MagazineCache* cache = &LMagazineCaches.caches[_poolId];
+	if (cache->owner == nullptr)
+	{
+		LMagazineCacheGuard.Touch();
+		cache->owner = this;
+	}
+
+	return cache;
+}
+
+// â  ȿ  Ű ϳ    (  Ǯ  ).
+//   â ѱ,  â   Ű ٲ۴
+void MemoryPool::PushShared(MemoryHeader* ptr)
+{
+	int32 allocCount = 0, freeCount = 0, hitCount = 0;
+	{
+		LockGuard guard(_depotLock);
+
+		if (_sharedMagazine != nullptr && _sharedMagazine->IsFull())
+		{
+			if (_fullCount < MAX_DEPOT_MAGAZINES)
+			{
+				_sharedMagazine->next = _fullMagazines;
+				_fullMagazines = _sharedMagazine;
+				_fullCount++;
+				_sharedMagazine = nullptr;
+			}
+			else
+			{
+				// â  á OS ְ  Ű ٽ 
+				FreeMagazineBlocks(_sharedMagazine);
+			}
+		}
+
+		if (_sharedMagazine == nullptr)
+		{
+			if (Magazine* magazine = _emptyMagazines)
+			{
+				_emptyMagazines = magazine->next;
+				magazine->next = nullptr;
+				_sharedMagazine = magazine;
+			}
+			else
+			{
+				_sharedMagazine = new Magazine();
+			}
+		}
+
+		_sharedMagazine->blocks[_sharedMagazine->count++] = ptr;
+
+		_sharedFreeCount++;
+		TakeSharedCounts(allocCount, freeCount, hitCount);
+	}
+
+	AddCounts(allocCount, freeCount, hitCount);
+}
+
+MemoryHeader* MemoryPool::PopShared()
+{
+	MemoryHeader* memory = nullptr;
+	int32 allocCount = 0, freeCount = 0, hitCount = 0;
+	{
+		LockGuard guard(_depotLock);
+
+		if ((_sharedMagazine == nullptr || _sharedMagazine->IsEmpty()) && _fullMagazines != nullptr)
+		{
+			if (_sharedMagazine != nullptr)
+			{
+				_sharedMagazine->next = _emptyMagazines;
+				_emptyMagazines = _sharedMagazine;
+			}
+
+			_sharedMagazine = _fullMagazines;
+			_fullMagazines = _sharedMagazine->next;
+			_sharedMagazine->next = nullptr;
+			_fullCount--;
+			_minFullCount = min(_minFullCount, _fullCount);
+		}
+
+		if (_sharedMagazine != nullptr && _sharedMagazine->IsEmpty() == false)
+			memory = _sharedMagazine->blocks[--_sharedMagazine->count];
+
+		_sharedAllocCount++;
+		_sharedHitCount += memory != nullptr ? 1 : 0;
+		TakeSharedCounts(allocCount, freeCount, hitCount);
+	}
+
+	AddCounts(allocCount, freeCount, hitCount);
+	if (memory == nullptr)
+		return AllocateBlock();
+
+	ASSERT_CRASH(memory->allocSize == 0);
 	return memory;
 }
+
+// _depotLock ȿ.  ĳó Ű ϳ з ̸  īͷ ű
+void MemoryPool::TakeSharedCounts(int32& outAllocCount, int32& outFreeCount, int32& outHitCount)
+{
+	if (_sharedAllocCount + _sharedFreeCount < Magazine::CAPACITY)
+		return;
+
+	outAllocCount = _sharedAllocCount;
+	outFreeCount = _sharedFreeCount;
+	outHitCount = _sharedHitCount;
+	_sharedAllocCount = 0;
+	_sharedFreeCount = 0;
+	_sharedHitCount = 0;
+}
+
+MemoryHeader* MemoryPool::AllocateBlock()
+{
+	_missCount.fetch_add(1);
+	_reservedBlocks.fetch_add(1);
+	return reinterpret_cast<MemoryHeader*>(::_aligned_malloc(_allocSize, SLIST_ALIGNMENT));
+}
+
+void MemoryPool::FreeBlock(MemoryHeader* block)
+{
+	_reservedBlocks.fetch_sub(1);
+	::_aligned_free(block);
+}
+
+Magazine* MemoryPool::PopFullMagazine()
+{
+	LockGuard guard(_depotLock);
+
+	Magazine* magazine = _fullMagazines;
+	if (magazine == nullptr)
+		return nullptr;
+
+	_fullMagazines = magazine->next;
+	_fullCount--;
+	_minFullCount = min(_minFullCount, _fullCount);
+	return magazine;
+}
+
+void MemoryPool::PushFullMagazine(Magazine* magazine)
+{
+	{
+		LockGuard guard(_depotLock);
+
+		if (_fullCount < MAX_DEPOT_MAGAZINES)
+		{
+			magazine->next = _fullMagazines;
+			_fullMagazines = magazine;
+			_fullCount++;
+			return;
+		}
+	}
+
+	// â  á OS ش
+	FreeMagazineBlocks(magazine);
+	PushEmptyMagazine(magazine);
+}
+
+Magazine* MemoryPool::PopEmptyMagazine()
+{
+	{
+		LockGuard guard(_depotLock);
+
+		if (Magazine* magazine = _emptyMagazines)
+		{
+			_emptyMagazines = magazine->next;
+			magazine->next = nullptr;
+			return magazine;
+		}
+	}
+
+	return new Magazine();
+}
+
+void MemoryPool::PushEmptyMagazine(Magazine* magazine)
+{
+	ASSERT_CRASH(magazine->IsEmpty());
+
+	LockGuard guard(_depotLock);
+	magazine->next = _emptyMagazines;
+	_emptyMagazines = magazine;
+}
+
+void MemoryPool::FreeMagazineBlocks(Magazine* magazine)
+{
+	while (magazine->IsEmpty() == false)
+		FreeBlock(magazine->blocks[--magazine->count]);
+}
+
+void MemoryPool::AddCounts(int64 allocCount, int64 freeCount, int64 hitCount)
+{
+	if (allocCount == 0 && freeCount == 0 && hitCount == 0)
+		return;
+
+	if (hitCount != 0)
+		_hitCount.fetch_add(hitCount);
+
+	const int64 allocTotal = _allocCount.fetch_add(allocCount) + allocCount;
+	const int64 freeTotal = _freeCount.fetch_add(freeCount) + freeCount;
+
+	const int64 live = allocTotal - freeTotal;
+	int64 peak = _peakLive.load();
+	while (live > peak && _peakLive.compare_exchange_weak(peak, live) == false)
+	{
+	}
+}
@@ -31,13 +31,56 @@ struct MemoryHeader : public SLIST_ENTRY
 	// TODO : ʿ ߰ 
 };
 
+/*-----------------
+	  Magazine
+------------------*/
+
+// 庰 ĳÿ  â(depot) ̿ ° ְ޴  
+struct Magazine
+{
+	enum { CAPACITY = 32 };
+
+	bool			IsEmpty() const { return count == 0; }
+	bool			IsFull() const { return count == CAPACITY; }
+
+	int32			count = 0;
+	MemoryHeader*	blocks[CAPACITY];
+	Magazine*		next = nullptr;
+};
+
+/*-----------------
+   MemoryPoolStats
+------------------*/
+
+//  ĳ Ҵ/ Ƚ Ű ȯ  ջǹǷ ణ ʰ ݿȴ
+struct MemoryPoolStats
+{
+	int32	allocSize = 0;
+	int64	live = 0;		//    
+	int64	peak = 0;		// live ִ
+	int64	hits = 0;		// ĳ/â  Ƚ (   Ƿ   ʴ´)
+	int64	misses = 0;		// OS  Ҵ Ƚ
+	int64	bytes = 0;		// OS Ƶ ü Ʈ (  + ĳ)
+};
+
 /*-----------------
 	MemoryPool
 ------------------*/
 
+struct MagazineCache;
+
 DECLSPEC_ALIGN(SLIST_ALIGNMENT)
 class MemoryPool
 {
+	enum
+	{
+		MAX_CACHED_POOLS = 128,		//  ĳø   ִ Ǯ 
+		MAX_DEPOT_MAGAZINES = 16,	// â ׾Ƶ   Ű 
+	};
+
+	friend struct MagazineCache;
+	friend struct MagazineCacheTable;
+
 public:
 	MemoryPool(int32 allocSize);
 	~MemoryPool();
@@ -45,10 +88,52 @@ public:
 	void			Push(MemoryHeader* ptr);
 	MemoryHeader*	Pop();
 
+	//  Trim      â Ű OS ش
+	int64			Trim();
+	MemoryPoolStats	GetStats();
+
+public:
+	static void		FlushThreadCache();
+	static int64	TrimAll();
+	static void		DumpAllStats();
+
+private:
+	MagazineCache*	LocalCache();
+	void			PushShared(MemoryHeader* ptr);
+	MemoryHeader*	PopShared();
+	void			TakeSharedCounts(int32& outAllocCount, int32& outFreeCount, int32& outHitCount);
+	MemoryHeader*	AllocateBlock();
+	void			FreeBlock(MemoryHeader* block);
+
+	Magazine*		PopFullMagazine();
+	void			PushFullMagazine(Magazine* magazine);
+	Magazine*		PopEmptyMagazine();
+	void			PushEmptyMagazine(Magazine* magazine);
+	void			FreeMagazineBlocks(Magazine* magazine);
+
+	void			AddCounts(int64 allocCount, int64 freeCount, int64 hitCount = 0);
+
 private:
-	SLIST_HEADER	_header;
 	int32			_allocSize = 0;
-	atomic<int32>	_useCount = 0;
-	atomic<int32>	_reserveCount = 0;
-};
+	int32			_poolId = 0;
+
+	/*  â */
+	Mutex			_depotLock;
+	Magazine*		_fullMagazines = nullptr;
+	Magazine*		_emptyMagazines = nullptr;
+	int32			_fullCount = 0;
+	int32			_minFullCount = 0;	//  Trim  â    Ű 
+	//  ĳø    (Ǯ id >= MAX_CACHED_POOLS, ĳø    )      Ű
+	Magazine*		_sharedMagazine = nullptr;
+	int32			_sharedAllocCount = 0;	//  Ű ο  ջ  Ƚ (Ű ϳ з ջ)
+	int32			_sharedFreeCount = 0;
+	int32			_sharedHitCount = 0;
 
+	/*  */
+	Atomic<int64>	_allocCount = 0;
+	Atomic<int64>	_freeCount = 0;
+	Atomic<int64>	_missCount = 0;
+	Atomic<int64>	_hitCount = 0;
+	Atomic<int64>	_peakLive = 0;
+	Atomic<int64>	_reservedBlocks = 0;
+};
@@ -0,0 +1,80 @@
+#pragma once
+
+/*--------------
+	MpscNode
+---------------*/
+
+// ť  ü ؼ ũ   ִ´ (Push/Pop Ҵ )
+struct MpscNode
+{
+	Atomic<MpscNode*> mpscNext = nullptr;
+};
+
+/*--------------
+	MpscQueue
+---------------*/
+
+// Vyukov  ħ Multi-Producer / Single-Consumer ť
+// Push  忡 , Pop    (Һ) ȣؾ Ѵ
+class MpscQueue
+{
+	enum { CACHE_LINE_SIZE = 64 };
+
+public:
+	MpscQueue() : _head(&_stub), _tail(&_stub) { }
+
+	MpscQueue(const MpscQueue&) = delete;
+	MpscQueue& operator=(const MpscQueue&) = delete;
+
+	void Push(MpscNode* node)
+	{
+		node->mpscNext.store(nullptr, std::memory_order_relaxed);
+		MpscNode* prev = _head.exchange(node, std::memory_order_acq_rel);
+		prev->mpscNext.store(node, std::memory_order_release);
+	}
+
+	//  ְų, ٸ 尡 Push (exchange ũ )̸ nullptr
+	MpscNode* Pop()
+	{
+		MpscNode* tail = _tail;
+		MpscNode* next = tail->mpscNext.load(std::memory_order_acquire);
+
+		if (tail == &_stub)
+		{
+			if (next == nullptr)
+				return nullptr;
+
+			_tail = next;
+			tail = next;
+			next = next->mpscNext.load(std::memory_order_acquire);
+		}
+
+		if (next != nullptr)
+		{
+			_tail = next;
+			return tail;
+		}
+
+		if (tail != _head.load(std::memory_order_acquire))
+			return nullptr;
+
+		//  带  stub ڿ ٿ tail Ѱ Ѵ
+		Push(&_stub);
+
+		next = tail->mpscNext.load(std::memory_order_acquire);
+		if (next != nullptr)
+		{
+			_tail = next;
+			return tail;
+		}
+
+		return nullptr;
+	}
+
+private:
+	// (_head) Һ(_tail)  ĳ  ΰ  ʵ ߸
+	Atomic<MpscNode*>	_head;
+	BYTE				_headPadding[CACHE_LINE_SIZE - sizeof(Atomic<MpscNode*>)];
+	MpscNode*			_tail;
+	MpscNode			_stub;
+};
@@ -19,14 +19,26 @@ NetAddress::NetAddress(wstring ip, uint16 port)
 
 wstring NetAddress::GetIpAddress()
 {
+#ifdef _WIN32
 	WCHAR buffer[100];
 	::InetNtopW(AF_INET, &_sockAddr.sin_addr, buffer, len32(buffer));
 	return wstring(buffer);
+#else
+	char buffer[INET_ADDRSTRLEN];
+	::inet_ntop(AF_INET, &_sockAddr.sin_addr, buffer, len32(buffer));
+	return wstring(buffer, buffer + ::strlen(buffer));
+#endif
 }
 
 IN_ADDR NetAddress::Ip2Address(const WCHAR* ip)
 {
 	IN_ADDR address;
+#ifdef _WIN32
 	::InetPtonW(AF_INET, ip, &address);
+#else
+	// IPv4 ڿ ASCII̶ ״  ȴ
+	const string narrowIp(ip, ip + ::wcslen(ip));
+	::inet_pton(AF_INET, narrowIp.c_str(), &address);
+#endif
 	return address;
 }
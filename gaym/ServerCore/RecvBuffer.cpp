@@ -51,4 +51,23 @@ bool RecvBuffer::OnWrite(int32 numOfBytes)
 
 	_writePos += numOfBytes;
 	return true;
+}
+
+void RecvBuffer::Reserve(int32 packetSize)
+{
+	// б Ŀ packetSize    ״
+	if (_capacity - _readPos >= packetSize)
+		return;
+
+	int32 dataSize = DataSize();
+	::memmove(&_buffer[0], &_buffer[_readPos], dataSize);
+	_readPos = 0;
+	_writePos = dataSize;
+
+	// ׷ ڶ Ű (  Ű ۴    )
+	if (_capacity < packetSize)
+	{
+		_capacity = ((packetSize + _bufferSize - 1) / _bufferSize) * _bufferSize;
+		_buffer.resize(_capacity);
+	}
 }
\ No newline at end of file
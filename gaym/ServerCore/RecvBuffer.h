@@ -15,6 +15,7 @@ public:
 	void			Clean();
 	bool			OnRead(int32 numOfBytes);
 	bool			OnWrite(int32 numOfBytes);
+	void			Reserve(int32 packetSize);
 
 	BYTE*			ReadPos() { return &_buffer[_readPos]; }
 	BYTE*			WritePos() { return &_buffer[_writePos]; }
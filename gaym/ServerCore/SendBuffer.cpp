@@ -25,8 +25,9 @@ void SendBuffer::Close(uint32 writeSize)
 	SendBufferChunk
 --------------------*/
 
-SendBufferChunk::SendBufferChunk()
+SendBufferChunk::SendBufferChunk(SendBufferClass sizeClass, uint32 capacity) : _class(sizeClass)
 {
+	_buffer.resize(capacity);
 }
 
 SendBufferChunk::~SendBufferChunk()
@@ -41,7 +42,7 @@ void SendBufferChunk::Reset()
 
 SendBufferRef SendBufferChunk::Open(uint32 allocSize)
 {
-	ASSERT_CRASH(allocSize <= SEND_BUFFER_CHUNK_SIZE);
+	ASSERT_CRASH(allocSize <= Capacity());
 	ASSERT_CRASH(_open == false);
 
 	if (allocSize > FreeSize())
@@ -58,54 +59,317 @@ void SendBufferChunk::Close(uint32 writeSize)
 	_usedSize += writeSize;
 }
 
+SendBufferClass SendBufferChunk::ClassOf(uint32 allocSize)
+{
+	if (allocSize <= SMALL_ALLOC_MAX)
+		return SendBufferClass::Small;
+
+	if (allocSize <= MEDIUM_ALLOC_MAX)
+		return SendBufferClass::Medium;
+
+	return SendBufferClass::Large;
+}
+
+uint32 SendBufferChunk::ChunkSizeOf(SendBufferClass sizeClass, uint32 allocSize)
+{
+	switch (sizeClass)
+	{
+	case SendBufferClass::Small:
+		return SMALL_CHUNK_SIZE;
+	case SendBufferClass::Medium:
+		return MEDIUM_CHUNK_SIZE;
+	default:
+		break;
+	}
+
+	// Large 2 ŵ ÷  ũⳢ ǰ Ѵ
+	uint32 chunkSize = LARGE_CHUNK_MIN;
+	while (chunkSize < allocSize)
+		chunkSize <<= 1;
+
+	return chunkSize;
+}
+
+/*-------------------------
+	SendBufferChunkCache
+--------------------------*/
+
+// 尡   ȿϵ ڸ Ҹڸ 
+struct SendBufferChunkCache
+{
+	void Flush()
+	{
+		for (int32 i = 0; i < static_cast<int32>(SendBufferClass::Count); i++)
+		{
+			if (GSendBufferManager != nullptr)
+			{
+				GSendBufferManager->PushDepot(chunks[i], counts[i]);
+			}
+			else
+			{
+				for (int32 j = 0; j < counts[i]; j++)
+					xdelete(chunks[i][j]);
+			}
+
+			counts[i] = 0;
+		}
+
+		flushed = true;
+	}
+
+	bool				flushed;
+	int32				counts[static_cast<int32>(SendBufferClass::Count)];
+	SendBufferChunk*	chunks[static_cast<int32>(SendBufferClass::Count)][SendBufferManager::LOCAL_CACHE_MAX];
+};
+
+static thread_local SendBufferChunkCache LSendBufferChunkCache;
+
+//    ĳø â ش
+struct SendBufferChunkCacheGuard
+{
+	~SendBufferChunkCacheGuard() { LSendBufferChunkCache.Flush(); }
+	void Touch() { }
+};
+
+static thread_local SendBufferChunkCacheGuard LSendBufferChunkCacheGuard;
+
 /*---------------------
 	SendBufferManager
 ----------------------*/
 
-SendBufferRef SendBufferManager::Open(uint32 size)
+SendBufferManager::~SendBufferManager()
 {
-	if (LSendBufferChunk == nullptr)
+	for (Vector<SendBufferChunk*>& depot : _depot)
 	{
-		LSendBufferChunk = Pop(); // WRITE_LOCK
-		LSendBufferChunk->Reset();
-	}		
+		for (SendBufferChunk* chunk : depot)
+			xdelete(chunk);
+
+		depot.clear();
+	}
+
+	for (uint64& bytes : _depotBytes)
+		bytes = 0;
+}
 
-	ASSERT_CRASH(LSendBufferChunk->IsOpen() == false);
+SendBufferRef SendBufferManager::Open(uint32 size)
+{
+	ASSERT_CRASH(size <= SendBufferChunk::MAX_SEND_BUFFER_SIZE);
+
+	const SendBufferClass sizeClass = SendBufferChunk::ClassOf(size);
+	const uint32 chunkSize = SendBufferChunk::ChunkSizeOf(sizeClass, size);
+
+	// ū Ŷ  ûũ , SendBuffer Ǹ ûũ ٷ ƿ´
+	if (sizeClass == SendBufferClass::Large)
+		return Pop(sizeClass, chunkSize)->Open(size);
+
+	SendBufferChunkRef& chunk = LSendBufferChunk[static_cast<int32>(sizeClass)];
+	ASSERT_CRASH(chunk == nullptr || chunk->IsOpen() == false);
 
 	//    ŷ ü
-	if (LSendBufferChunk->FreeSize() < size)
+	if (chunk == nullptr || chunk->FreeSize() < size)
+		chunk = Pop(sizeClass, chunkSize);
+
+	return chunk->Open(size);
+}
+
+uint64 SendBufferManager::GetDepotBytes(SendBufferClass sizeClass)
+{
+	LockGuard guard(_depotLock);
+	return _depotBytes[static_cast<int32>(sizeClass)];
+}
+
+SendBufferChunkRef SendBufferManager::Pop(SendBufferClass sizeClass, uint32 chunkSize)
+{
+	SendBufferChunkCache& cache = LSendBufferChunkCache;
+	SendBufferChunk* chunk = nullptr;
+
+	if (cache.flushed)
+	{
+		// ĳð  (  ) â ٷ 
+		PopDepot(sizeClass, chunkSize, &chunk, 1);
+	}
+	else
+	{
+		LSendBufferChunkCacheGuard.Touch();
+
+		const int32 classIndex = static_cast<int32>(sizeClass);
+		SendBufferChunk** chunks = cache.chunks[classIndex];
+		int32& count = cache.counts[classIndex];
+
+		// Large  ũ⸸ 
+		for (int32 i = count - 1; i >= 0; i--)
+		{
+			if (chunks[i]->Capacity() == chunkSize)
+			{
+				chunk = chunks[i];
+				chunks[i] = chunks[--count];
+				break;
+			}
+		}
+
+		//  â ĳ ݸŭ ޾ƿ´
+		if (chunk == nullptr)
+		{
+			count += PopDepot(sizeClass, chunkSize, &chunks[count], LocalCacheMax(sizeClass) / 2);
+			if (count > 0 && chunks[count - 1]->Capacity() == chunkSize)
+				chunk = chunks[--count];
+		}
+	}
+
+	//   
+	if (chunk == nullptr)
+		chunk = xnew<SendBufferChunk>(sizeClass, chunkSize);
+
+	chunk->Reset();
+
+	//  ϵ Ǯ ޴´
+	return SendBufferChunkRef(chunk, PushGlobal, StlAllocator<SendBufferChunk>());
+}
+
+void SendBufferManager::Push(SendBufferChunk* chunk)
+{
+	if (chunk->GetClass() == SendBufferClass::Large && chunk->Capacity() > SendBufferChunk::LARGE_CACHE_MAX)
 	{
-		LSendBufferChunk = Pop(); // WRITE_LOCK
-		LSendBufferChunk->Reset();
+		xdelete(chunk);
+		return;
 	}
 
-	return LSendBufferChunk->Open(size);
+	SendBufferChunkCache& cache = LSendBufferChunkCache;
+	if (cache.flushed)
+	{
+		PushDepot(&chunk, 1);
+		return;
+	}
+
+	LSendBufferChunkCacheGuard.Touch();
+
+	const int32 classIndex = static_cast<int32>(chunk->GetClass());
+	const int32 maxCount = LocalCacheMax(chunk->GetClass());
+	SendBufferChunk** chunks = cache.chunks[classIndex];
+	int32& count = cache.counts[classIndex];
+
+	//  á  â ѱ
+	if (count == maxCount)
+	{
+		const int32 moveCount = maxCount / 2;
+		count -= moveCount;
+		PushDepot(&chunks[count], moveCount);
+	}
+
+	chunks[count++] = chunk;
 }
 
-SendBufferChunkRef SendBufferManager::Pop()
+int32 SendBufferManager::PopDepot(SendBufferClass sizeClass, uint32 chunkSize, SendBufferChunk** chunks, int32 maxCount)
 {
+	LockGuard guard(_depotLock);
+	const int32 classIndex = static_cast<int32>(sizeClass);
+	Vector<SendBufferChunk*>& depot = _depot[classIndex];
+
+	// Large û ũ ϳ (  ͺ ؼ PushDepot տ о)
+	if (sizeClass == SendBufferClass::Large)
 	{
-		WRITE_LOCK;
-		if (_sendBufferChunks.empty() == false)
+		for (size_t i = depot.size(); i-- > 0; )
 		{
-			SendBufferChunkRef sendBufferChunk = _sendBufferChunks.back();
-			_sendBufferChunks.pop_back();
-			return sendBufferChunk;
+			if (depot[i]->Capacity() != chunkSize)
+				continue;
+
+			chunks[0] = depot[i];
+			depot.erase(depot.begin() + i);
+			_depotBytes[classIndex] -= chunkSize;
+			return 1;
 		}
+
+		return 0;
 	}
 
-	return SendBufferChunkRef(xnew<SendBufferChunk>(), PushGlobal);
+	int32 count = 0;
+	while (count < maxCount && depot.empty() == false)
+	{
+		chunks[count] = depot.back();
+		_depotBytes[classIndex] -= chunks[count]->Capacity();
+		count++;
+		depot.pop_back();
+	}
+
+	return count;
+}
+
+void SendBufferManager::PushDepot(SendBufferChunk** chunks, int32 count)
+{
+	if (count == 0)
+		return;
+
+	ASSERT_CRASH(count <= LOCAL_CACHE_MAX);
+
+	// ѵ ѱ Small/Medium  ûũ, Large   ûũ Ѵ
+	// ( ̴ ũⰡ ).   ۿ
+	SendBufferChunk* freed[LOCAL_CACHE_MAX];
+	int32 freedCount = 0;
+	Vector<SendBufferChunk*> evicted;
+	{
+		LockGuard guard(_depotLock);
+		for (int32 i = 0; i < count; i++)
+		{
+			SendBufferChunk* chunk = chunks[i];
+			const SendBufferClass sizeClass = chunk->GetClass();
+			const int32 classIndex = static_cast<int32>(sizeClass);
+			const uint64 bytesMax = DepotBytesMax(sizeClass);
+			Vector<SendBufferChunk*>& depot = _depot[classIndex];
+			uint64& bytes = _depotBytes[classIndex];
+
+			if (sizeClass == SendBufferClass::Large)
+			{
+				size_t evictCount = 0;
+				while (evictCount < depot.size() && bytes + chunk->Capacity() > bytesMax)
+					bytes -= depot[evictCount++]->Capacity();
+
+				evicted.insert(evicted.end(), depot.begin(), depot.begin() + evictCount);
+				depot.erase(depot.begin(), depot.begin() + evictCount);
+			}
+
+			if (bytes + chunk->Capacity() > bytesMax)
+			{
+				freed[freedCount++] = chunk;
+				continue;
+			}
+
+			depot.push_back(chunk);
+			bytes += chunk->Capacity();
+		}
+	}
+
+	for (int32 i = 0; i < freedCount; i++)
+		xdelete(freed[i]);
+
+	for (SendBufferChunk* chunk : evicted)
+		xdelete(chunk);
+}
+
+int32 SendBufferManager::LocalCacheMax(SendBufferClass sizeClass)
+{
+	return sizeClass == SendBufferClass::Large ? LARGE_LOCAL_CACHE_MAX : LOCAL_CACHE_MAX;
 }
 
-void SendBufferManager::Push(SendBufferChunkRef buffer)
+uint64 SendBufferManager::DepotBytesMax(SendBufferClass sizeClass)
 {
-	WRITE_LOCK;
-	_sendBufferChunks.push_back(buffer);
+	switch (sizeClass)
+	{
+	case SendBufferClass::Small:
+		return DEPOT_SMALL_BYTES_MAX;
+	case SendBufferClass::Medium:
+		return DEPOT_MEDIUM_BYTES_MAX;
+	default:
+		return DEPOT_LARGE_BYTES_MAX;
+	}
 }
 
-void SendBufferManager::PushGlobal(SendBufferChunk* buffer)
+void SendBufferManager::PushGlobal(SendBufferChunk* chunk)
 {
-	cout << "PushGlobal SENDBUFFERCHUNK" << endl;
+	if (GSendBufferManager == nullptr)
+	{
+		xdelete(chunk);
+		return;
+	}
 
-	GSendBufferManager->Push(SendBufferChunkRef(buffer, PushGlobal));
-}
\ No newline at end of file
+	GSendBufferManager->Push(chunk);
+}
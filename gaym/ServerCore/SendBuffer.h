@@ -28,15 +28,31 @@ private:
 	SendBufferChunk
 --------------------*/
 
+// Small/Medium ûũ  Ŷ    , Large ûũ Ŷ ϳ ° 
+enum class SendBufferClass : uint8
+{
+	Small,		// ~2KB Ŷ, 8KB ûũ
+	Medium,		// ~16KB Ŷ, 64KB ûũ
+	Large,		//  ̻, 2 ŵ ũ  ûũ (128KB ~ MAX_SEND_BUFFER_SIZE)
+	Count
+};
+
 class SendBufferChunk : public enable_shared_from_this<SendBufferChunk>
 {
-	enum
+public:
+	enum : uint32
 	{
-		SEND_BUFFER_CHUNK_SIZE = 6000
+		SMALL_CHUNK_SIZE = 0x2000,			// 8KB
+		SMALL_ALLOC_MAX = 0x800,			// 2KB
+		MEDIUM_CHUNK_SIZE = 0x10000,		// 64KB
+		MEDIUM_ALLOC_MAX = 0x4000,			// 16KB
+		LARGE_CHUNK_MIN = 0x20000,			// 128KB
+		LARGE_CACHE_MAX = 0x100000,			// 1MB Ѵ Large ûũ  ʰ ٷ 
+		MAX_SEND_BUFFER_SIZE = 0x1000000,	// 16MB
 	};
 
 public:
-	SendBufferChunk();
+	SendBufferChunk(SendBufferClass sizeClass, uint32 capacity);
 	~SendBufferChunk();
 
 	void				Reset();
@@ -45,30 +61,67 @@ public:
 
 	bool				IsOpen() { return _open; }
 	BYTE*				Buffer() { return &_buffer[_usedSize]; }
-	uint32				FreeSize() { return static_cast<uint32>(_buffer.size()) - _usedSize; }
+	uint32				FreeSize() { return Capacity() - _usedSize; }
+	uint32				Capacity() { return static_cast<uint32>(_buffer.size()); }
+	SendBufferClass		GetClass() { return _class; }
+
+	static SendBufferClass	ClassOf(uint32 allocSize);
+	static uint32			ChunkSizeOf(SendBufferClass sizeClass, uint32 allocSize);
 
 private:
-	Array<BYTE, SEND_BUFFER_CHUNK_SIZE>		_buffer = {};
-	bool									_open = false;
-	uint32									_usedSize = 0;
+	Vector<BYTE>		_buffer;
+	SendBufferClass		_class;
+	bool				_open = false;
+	uint32				_usedSize = 0;
 };
 
 /*---------------------
 	SendBufferManager
 ----------------------*/
 
+// 帶 ޺ ûũ ĳø ΰ, ĳð ų  á 
+// â(depot) ĳ ݾ ְ޴´ (MemoryPool Ű  ).
+// ûũ  SendBuffer   ĳ÷ ư
 class SendBufferManager
 {
+	friend struct SendBufferChunkCache;
+
 public:
+	enum
+	{
+		LOCAL_CACHE_MAX = 16,		// /޺  ִ ûũ 
+		LARGE_LOCAL_CACHE_MAX = 4,
+	};
+
+	// ޺ â Ʈ ѵ.   1MB Large ûũ   ̹Ƿ ũ 
+	enum : uint32
+	{
+		DEPOT_SMALL_BYTES_MAX = 0x200000,	// 2MB (8KB ûũ 256 )
+		DEPOT_MEDIUM_BYTES_MAX = 0x400000,	// 4MB (64KB ûũ 64 )
+		DEPOT_LARGE_BYTES_MAX = 0x800000,	// 8MB (1MB ûũ 8  ~ 128KB ûũ 64 )
+	};
+
+public:
+	~SendBufferManager();
+
 	SendBufferRef		Open(uint32 size);
 
+	uint64				GetDepotBytes(SendBufferClass sizeClass);
+
 private:
-	SendBufferChunkRef	Pop();
-	void				Push(SendBufferChunkRef buffer);
+	SendBufferChunkRef	Pop(SendBufferClass sizeClass, uint32 chunkSize);
+	void				Push(SendBufferChunk* chunk);
+
+	int32				PopDepot(SendBufferClass sizeClass, uint32 chunkSize, SendBufferChunk** chunks, int32 maxCount);
+	void				PushDepot(SendBufferChunk** chunks, int32 count);
+
+	static int32		LocalCacheMax(SendBufferClass sizeClass);
+	static uint64		DepotBytesMax(SendBufferClass sizeClass);
 
-	static void			PushGlobal(SendBufferChunk* buffer);
+	static void			PushGlobal(SendBufferChunk* chunk);
 
 private:
-	USE_LOCK;
-	Vector<SendBufferChunkRef> _sendBufferChunks;
+	Mutex						_depotLock;
+	Vector<SendBufferChunk*>	_depot[static_cast<int32>(SendBufferClass::Count)];
+	uint64						_depotBytes[static_cast<int32>(SendBufferClass::Count)] = {};
 };
@@ -36,8 +36,12 @@ SessionRef Service::CreateSession()
 	SessionRef session = _sessionFactory();
 	session->SetService(shared_from_this());
 
+#ifdef _WIN32
 	if (_iocpCore->Register(session) == false)
 		return nullptr;
+#else
+	// epoll  ξ ڿ Ѵ (Listener / Session::RegisterConnect)
+#endif
 
 	return session;
 }
@@ -7,6 +7,52 @@
 	Session
 ---------------*/
 
+// ӵ  ۵  SendBuffer ϳ ؼ ģ. ȯ:   
+static int32 CoalesceSendBuffers(Vector<SendBufferRef>& sendBuffers, int32 coalesceSize)
+{
+	if (coalesceSize <= 0)
+		return 0;
+
+	int32 coalescedCount = 0;
+	size_t writeIndex = 0;
+	size_t i = 0;
+	while (i < sendBuffers.size())
+	{
+		// [i, j) :     ( ûũ  ũ)
+		size_t j = i;
+		uint32 runSize = 0;
+		while (j < sendBuffers.size()
+			&& sendBuffers[j]->WriteSize() < static_cast<uint32>(coalesceSize)
+			&& runSize + sendBuffers[j]->WriteSize() <= SendBufferChunk::MEDIUM_ALLOC_MAX)
+		{
+			runSize += sendBuffers[j]->WriteSize();
+			j++;
+		}
+
+		if (j - i < 2)
+		{
+			sendBuffers[writeIndex++] = std::move(sendBuffers[i++]);
+			continue;
+		}
+
+		SendBufferRef coalesced = GSendBufferManager->Open(runSize);
+		BYTE* dest = coalesced->Buffer();
+		for (size_t k = i; k < j; k++)
+		{
+			::memcpy(dest, sendBuffers[k]->Buffer(), sendBuffers[k]->WriteSize());
+			dest += sendBuffers[k]->WriteSize();
+		}
+		coalesced->Close(runSize);
+
+		sendBuffers[writeIndex++] = coalesced;
+		coalescedCount += static_cast<int32>(j - i);
+		i = j;
+	}
+
+	sendBuffers.resize(writeIndex);
+	return coalescedCount;
+}
+
 Session::Session() : _recvBuffer(BUFFER_SIZE)
 {
 	_socket = SocketUtils::CreateSocket();
@@ -23,21 +69,93 @@ void Session::Send(SendBufferRef sendBuffer)
 		return;
 
 	bool registerSend = false;
+	bool overflowDisconnect = false;
 
 	//  RegisterSend ɸ  ¶, ɾش
 	{
 		WRITE_LOCK;
 
-		_sendQueue.push(sendBuffer);
+		const int64 writeSize = sendBuffer->WriteSize();
 
-		if (_sendRegistered.exchange(true) == false)
-			registerSend = true;
+		//   : ͸ũ  å  ų, ġų, ´
+		if (_sendQueueBytes + writeSize > _sendConfig.highWaterBytes || static_cast<int32>(_sendQueue.size()) >= _sendConfig.highWaterCount)
+		{
+			_overflowCount++;
+
+			SendOverflowAction action = OnSendOverflow(sendBuffer);
+			if (action == SendOverflowAction::Merge)
+				MergeSendQueue();
+
+			if (action != SendOverflowAction::Drop && _sendQueueBytes + writeSize > _sendConfig.hardLimitBytes)
+				action = SendOverflowAction::Disconnect;
+
+			if (action == SendOverflowAction::Drop || action == SendOverflowAction::Disconnect)
+			{
+				_droppedBuffers++;
+				_droppedBytes += writeSize;
+			}
+
+			if (action == SendOverflowAction::Drop)
+				return;
+
+			if (action == SendOverflowAction::Disconnect)
+			{
+				//  (ûũ) ٷ Ǯش
+				_droppedBuffers += _sendQueue.size();
+				_droppedBytes += _sendQueueBytes;
+				_sendQueue = {};
+				_sendQueueBytes = 0;
+				overflowDisconnect = true;
+			}
+		}
+
+		if (overflowDisconnect == false)
+		{
+			_sendQueue.push(sendBuffer);
+			_sendQueueBytes += writeSize;
+			_peakQueuedBytes = max(_peakQueuedBytes, _sendQueueBytes);
+
+			if (_sendRegistered.exchange(true) == false)
+				registerSend = true;
+		}
+	}
+
+	if (overflowDisconnect)
+	{
+		Disconnect(L"Send Overflow");
+		return;
 	}
 	
 	if (registerSend)
 		RegisterSend();
 }
 
+void Session::SetSendConfig(const SendConfig& config)
+{
+	WRITE_LOCK;
+	_sendConfig = config;
+}
+
+SendStats Session::GetSendStats()
+{
+	SendStats stats;
+	{
+		WRITE_LOCK;
+		stats.queuedBytes = _sendQueueBytes;
+		stats.queuedCount = static_cast<int64>(_sendQueue.size());
+		stats.peakQueuedBytes = _peakQueuedBytes;
+		stats.droppedBuffers = _droppedBuffers;
+		stats.droppedBytes = _droppedBytes;
+		stats.overflowCount = _overflowCount;
+	}
+
+	stats.sentBytes = _sentBytes.load();
+	stats.sentBuffers = _sentBuffers.load();
+	stats.sendCalls = _sendCalls.load();
+	stats.coalescedBuffers = _coalescedBuffers.load();
+	return stats;
+}
+
 bool Session::Connect()
 {
 	return RegisterConnect();
@@ -48,8 +166,7 @@ void Session::Disconnect(const WCHAR* cause)
 	if (_connected.exchange(false) == false)
 		return;
 
-	// TEMP
-	wcout << "Disconnect : " << cause << endl;
+	LOG_INFO(L"Disconnect : %s", cause);
 
 	RegisterDisconnect();
 }
@@ -80,6 +197,8 @@ void Session::Dispatch(IocpEvent* iocpEvent, int32 numOfBytes)
 	}
 }
 
+#ifdef _WIN32
+
 bool Session::RegisterConnect()
 {
 	if (IsConnected())
@@ -164,20 +283,10 @@ void Session::RegisterSend()
 	_sendEvent.owner = shared_from_this(); // ADD_REF
 
 	//  ͸ sendEvent 
+	if (GatherSendBuffers() < 0)
 	{
-		WRITE_LOCK;
-
-		int32 writeSize = 0;
-		while (_sendQueue.empty() == false)
-		{
-			SendBufferRef sendBuffer = _sendQueue.front();
-
-			writeSize += sendBuffer->WriteSize();
-			// TODO :  üũ
-
-			_sendQueue.pop();
-			_sendEvent.sendBuffers.push_back(sendBuffer);
-		}
+		_sendEvent.owner = nullptr; // RELEASE_REF
+		return;
 	}
 
 	// Scatter-Gather ( ִ ͵ Ƽ  濡 )
@@ -191,6 +300,8 @@ void Session::RegisterSend()
 		wsaBufs.push_back(wsaBuf);
 	}
 
+	_sendCalls.fetch_add(1);
+
 	DWORD numOfBytes = 0;
 	if (SOCKET_ERROR == ::WSASend(_socket, wsaBufs.data(), static_cast<DWORD>(wsaBufs.size()), OUT &numOfBytes, 0, &_sendEvent, nullptr))
 	{
@@ -205,6 +316,207 @@ void Session::RegisterSend()
 	}
 }
 
+#else
+
+void Session::DispatchReady(uint32 readyEvents)
+{
+	// ŷ connect Ϸ
+	if ((readyEvents & (EPOLLOUT | EPOLLERR | EPOLLHUP)) && _connectPending.exchange(false))
+	{
+		int32 errorCode = 0;
+		socklen_t len = sizeof(errorCode);
+		::getsockopt(_socket, SOL_SOCKET, SO_ERROR, OUT &errorCode, &len);
+		if (errorCode != 0)
+		{
+			GetService()->GetIocpCore()->Unregister(shared_from_this());
+			HandleError(errorCode);
+			return;
+		}
+
+		ProcessConnect();
+		return;
+	}
+
+	if (readyEvents & (EPOLLIN | EPOLLRDHUP | EPOLLHUP | EPOLLERR))
+		RegisterRecv();
+
+	if ((readyEvents & EPOLLOUT) && _sendRegistered.load())
+		RegisterSend();
+}
+
+bool Session::RegisterConnect()
+{
+	if (IsConnected())
+		return false;
+
+	if (GetService()->GetServiceType() != ServiceType::Client)
+		return false;
+
+	if (SocketUtils::SetReuseAddress(_socket, true) == false)
+		return false;
+
+	if (SocketUtils::BindAnyAddress(_socket, 0/*°*/) == false)
+		return false;
+
+	SOCKADDR_IN sockAddr = GetService()->GetNetAddress().GetSockAddr();
+	if (SOCKET_ERROR == ::connect(_socket, reinterpret_cast<SOCKADDR*>(&sockAddr), sizeof(sockAddr)))
+	{
+		if (errno != EINPROGRESS)
+			return false;
+	}
+
+	//  õ Ŀ ؾ ̿  EPOLLHUP  ʴ´
+	_connectPending.store(true);
+	if (GetService()->GetIocpCore()->Register(shared_from_this()) == false)
+	{
+		_connectPending.store(false);
+		return false;
+	}
+
+	return true;
+}
+
+bool Session::RegisterDisconnect()
+{
+	// DisconnectEx Ƿ   ٷ Ѵ
+	SessionRef self = GetSessionRef();
+
+	::shutdown(_socket, SHUT_RDWR);
+	GetService()->GetIocpCore()->Unregister(self);
+
+	ProcessDisconnect();
+	return true;
+}
+
+void Session::RegisterRecv()
+{
+	if (IsConnected() == false)
+		return;
+
+	if (_recvSignals.fetch_add(1) != 0)
+		return;
+
+	int32 ownedSignals = 1;
+	while (true)
+	{
+		//  Ʈ : EAGAIN   д´
+		while (IsConnected())
+		{
+			const ssize_t numOfBytes = ::recv(_socket, reinterpret_cast<char*>(_recvBuffer.WritePos()), _recvBuffer.FreeSize(), 0);
+			if (numOfBytes >= 0)
+			{
+				ProcessRecv(static_cast<int32>(numOfBytes));
+				continue;
+			}
+
+			if (errno == EINTR)
+				continue;
+
+			if (errno != EAGAIN && errno != EWOULDBLOCK)
+				HandleError(errno);
+			break;
+		}
+
+		// д        
+		const int32 prevSignals = _recvSignals.fetch_sub(ownedSignals);
+		if (prevSignals == ownedSignals)
+			break;
+
+		ownedSignals = prevSignals - ownedSignals;
+	}
+}
+
+void Session::RegisterSend()
+{
+	if (IsConnected() == false)
+		return;
+
+	if (_sendSignals.fetch_add(1) != 0)
+		return;
+
+	int32 ownedSignals = 1;
+	while (true)
+	{
+		FlushSend();
+
+		const int32 prevSignals = _sendSignals.fetch_sub(ownedSignals);
+		if (prevSignals == ownedSignals)
+			break;
+
+		ownedSignals = prevSignals - ownedSignals;
+	}
+}
+
+void Session::FlushSend()
+{
+	enum { MAX_SEND_IOV = 1024 };
+
+	while (IsConnected())
+	{
+		//  ͸ sendEvent 
+		if (_sendEvent.sendBuffers.empty())
+		{
+			const int32 gatherSize = GatherSendBuffers();
+			if (gatherSize < 0)
+				return;
+
+			_sendTotalSize = gatherSize;
+			_sendWrittenSize = 0;
+		}
+
+		// Scatter-Gather :  Ϻθ   ̾ 
+		iovec iovs[MAX_SEND_IOV];
+		int32 iovCount = 0;
+		int32 skipSize = _sendWrittenSize;
+		for (SendBufferRef& sendBuffer : _sendEvent.sendBuffers)
+		{
+			const int32 writeSize = static_cast<int32>(sendBuffer->WriteSize());
+			if (skipSize >= writeSize)
+			{
+				skipSize -= writeSize;
+				continue;
+			}
+
+			iovs[iovCount].iov_base = sendBuffer->Buffer() + skipSize;
+			iovs[iovCount].iov_len = writeSize - skipSize;
+			skipSize = 0;
+
+			if (++iovCount == MAX_SEND_IOV)
+				break;
+		}
+
+		msghdr msg = {};
+		msg.msg_iov = iovs;
+		msg.msg_iovlen = iovCount;
+
+		_sendCalls.fetch_add(1);
+
+		const ssize_t numOfBytes = ::sendmsg(_socket, &msg, MSG_NOSIGNAL);
+		if (numOfBytes < 0)
+		{
+			if (errno == EINTR)
+				continue;
+
+			//  ۰   : EPOLLOUT  ̾ 
+			if (errno == EAGAIN || errno == EWOULDBLOCK)
+				return;
+
+			HandleError(errno);
+			_sendEvent.sendBuffers.clear(); // RELEASE_REF
+			_sendRegistered.store(false);
+			return;
+		}
+
+		_sendWrittenSize += static_cast<int32>(numOfBytes);
+		if (_sendWrittenSize < _sendTotalSize)
+			continue;
+
+		ProcessSend(_sendWrittenSize);
+	}
+}
+
+#endif
+
 void Session::ProcessConnect()
 {
 	_connectEvent.owner = nullptr; // RELEASE_REF
@@ -256,8 +568,17 @@ void Session::ProcessRecv(int32 numOfBytes)
 	// Ŀ 
 	_recvBuffer.Clean();
 
-	//  
+	// ۺ ū Ŷ ޴ ̸    ڸ 
+	if (_recvReserveSize > 0)
+	{
+		_recvBuffer.Reserve(_recvReserveSize);
+		_recvReserveSize = 0;
+	}
+
+#ifdef _WIN32
+	//   (epoll RegisterRecv  ̾ д´)
 	RegisterRecv();
+#endif
 }
 
 void Session::ProcessSend(int32 numOfBytes)
@@ -271,14 +592,80 @@ void Session::ProcessSend(int32 numOfBytes)
 		return;
 	}
 
+	_sentBytes.fetch_add(numOfBytes);
+
 	//  ڵ忡 
 	OnSend(numOfBytes);
 
+#ifdef _WIN32
 	WRITE_LOCK;
 	if (_sendQueue.empty())
 		_sendRegistered.store(false);
 	else
 		RegisterSend();
+#endif
+	// epoll FlushSend   ť ̾ 
+}
+
+// ť ̹ ۽ź  sendEvent ´ (maxGatherBytes/Count,  ۴ ħ).
+// ť   ۽  Ǯ -1 ȯ
+int32 Session::GatherSendBuffers()
+{
+	Vector<SendBufferRef>& sendBuffers = _sendEvent.sendBuffers;
+	int32 gatherSize = 0;
+	{
+		WRITE_LOCK;
+
+		if (_sendQueue.empty())
+		{
+			_sendRegistered.store(false);
+			return -1;
+		}
+
+		while (_sendQueue.empty() == false)
+		{
+			const int32 writeSize = static_cast<int32>(_sendQueue.front()->WriteSize());
+
+			// ù ۴ ũ  
+			if (sendBuffers.empty() == false
+				&& (gatherSize + writeSize > _sendConfig.maxGatherBytes || static_cast<int32>(sendBuffers.size()) >= _sendConfig.maxGatherCount))
+				break;
+
+			gatherSize += writeSize;
+			sendBuffers.push_back(std::move(_sendQueue.front()));
+			_sendQueue.pop();
+		}
+
+		_sendQueueBytes -= gatherSize;
+	}
+
+	_sentBuffers.fetch_add(static_cast<int64>(sendBuffers.size()));
+	_coalescedBuffers.fetch_add(CoalesceSendBuffers(sendBuffers, _sendConfig.coalesceSize));
+
+	return gatherSize;
+}
+
+// WRITE_LOCK ȿ ȣ. ť  ۵ ļ,  Ŷ ϳ ûũ ü   ʰ Ѵ
+void Session::MergeSendQueue()
+{
+	//  Merge   谡 ̱  ٽ ġ ʴ´ (͸ũ  Send ť ü  ʵ)
+	if (_sendQueue.size() < _mergedQueueCount * 2)
+		return;
+
+	Vector<SendBufferRef> sendBuffers;
+	sendBuffers.reserve(_sendQueue.size());
+	while (_sendQueue.empty() == false)
+	{
+		sendBuffers.push_back(std::move(_sendQueue.front()));
+		_sendQueue.pop();
+	}
+
+	_coalescedBuffers.fetch_add(CoalesceSendBuffers(sendBuffers, max(_sendConfig.coalesceSize, static_cast<int32>(SendBufferChunk::SMALL_ALLOC_MAX))));
+
+	for (SendBufferRef& sendBuffer : sendBuffers)
+		_sendQueue.push(std::move(sendBuffer));
+
+	_mergedQueueCount = _sendQueue.size();
 }
 
 void Session::HandleError(int32 errorCode)
@@ -287,11 +674,13 @@ void Session::HandleError(int32 errorCode)
 	{
 	case WSAECONNRESET:
 	case WSAECONNABORTED:
+#ifndef _WIN32
+	case EPIPE:
+#endif
 		Disconnect(L"HandleError");
 		break;
 	default:
-		// TODO : Log
-		cout << "Handle Error : " << errorCode << endl;
+		LOG_ERROR(L"Handle Error : %d", errorCode);
 		break;
 	}
 }
@@ -308,7 +697,38 @@ PacketSession::~PacketSession()
 {
 }
 
+uint32 PacketSession::HeaderSize(uint32 dataSize)
+{
+	if (dataSize + sizeof(PacketHeader) > UINT16_MAX)
+		return sizeof(PacketHeaderEx);
+
+	return sizeof(PacketHeader);
+}
+
+uint32 PacketSession::WriteHeader(BYTE* buffer, uint16 id, uint32 dataSize)
+{
+	const uint32 packetSize = HeaderSize(dataSize) + dataSize;
+	ASSERT_CRASH(packetSize <= MAX_PACKET_SIZE);
+
+	if (packetSize > UINT16_MAX)
+	{
+		PacketHeaderEx* header = reinterpret_cast<PacketHeaderEx*>(buffer);
+		header->marker = 0;
+		header->id = id;
+		header->size = packetSize;
+	}
+	else
+	{
+		PacketHeader* header = reinterpret_cast<PacketHeader*>(buffer);
+		header->size = static_cast<uint16>(packetSize);
+		header->id = id;
+	}
+
+	return packetSize;
+}
+
 // [size(2)][id(2)][data....][size(2)][id(2)][data....]
+// [0(2)][id(2)][totalSize(4)][data....]
 int32 PacketSession::OnRecv(BYTE* buffer, int32 len)
 {
 	int32 processLen = 0;
@@ -321,6 +741,38 @@ int32 PacketSession::OnRecv(BYTE* buffer, int32 len)
 			break;
 
 		PacketHeader header = *(reinterpret_cast<PacketHeader*>(&buffer[processLen]));
+		if (header.size == 0)
+		{
+			// Ȯ 
+			if (dataSize < static_cast<int32>(sizeof(PacketHeaderEx)))
+				break;
+
+			PacketHeaderEx headerEx = *(reinterpret_cast<PacketHeaderEx*>(&buffer[processLen]));
+			if (headerEx.size < sizeof(PacketHeaderEx) || headerEx.size > MAX_PACKET_SIZE)
+				return -1;
+
+			if (dataSize < static_cast<int32>(headerEx.size))
+			{
+				ReserveRecv(static_cast<int32>(headerEx.size));
+				break;
+			}
+
+			// data ٷ  4Ʈ Ϲ  {0, id}   ѱ (ũ len Ǵ)
+			const int32 skip = sizeof(PacketHeaderEx) - sizeof(PacketHeader);
+			PacketHeader* packet = reinterpret_cast<PacketHeader*>(&buffer[processLen + skip]);
+			packet->size = 0;
+			packet->id = headerEx.id;
+
+			OnRecvPacket(reinterpret_cast<BYTE*>(packet), static_cast<int32>(headerEx.size) - skip);
+
+			processLen += headerEx.size;
+			continue;
+		}
+
+		//   ũ ߸ Ŷ
+		if (header.size < sizeof(PacketHeader))
+			return -1;
+
 		//  ϵ Ŷ ũ⸦ Ľ  ־ Ѵ
 		if (dataSize < header.size)
 			break;
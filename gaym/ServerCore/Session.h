@@ -6,6 +6,45 @@
 
 class Service;
 
+/*--------------
+	SendConfig
+---------------*/
+
+// ۽ ť ͸ũ Ѿ  ó (Session::OnSendOverflow)
+enum class SendOverflowAction : uint8
+{
+	Queue,		// ׷ ״´ (hardLimitBytes  Disconnect)
+	Drop,		// ̹ ۸ 
+	Merge,		// ť  ۵  ûũ Ǯ  ״´
+	Disconnect,	//   ´
+};
+
+struct SendConfig
+{
+	int32				highWaterBytes = 0x400000;	// 4MB, ť  Ʈ  OnSendOverflow
+	int32				highWaterCount = 8192;		// ť     OnSendOverflow
+	int32				hardLimitBytes = 0x1000000;	// 16MB, Queue/Merge Ŀ  ´
+	int32				maxGatherBytes = 0x40000;	// 256KB, ۽ 1ȸ  ִ Ʈ
+	int32				maxGatherCount = 512;		// ۽ 1ȸ  ִ   (ġ )
+	int32				coalesceSize = 512;			// ̺  ۰ ޾  ؼ ϳ  (0 = )
+	SendOverflowAction	overflowAction = SendOverflowAction::Disconnect;
+};
+
+// Ǻ ۽  (GetSendStats)
+struct SendStats
+{
+	int64	queuedBytes = 0;		//  ť  Ʈ
+	int64	queuedCount = 0;		//  ť   
+	int64	peakQueuedBytes = 0;
+	int64	sentBytes = 0;
+	int64	sentBuffers = 0;
+	int64	sendCalls = 0;			// WSASend / sendmsg Ƚ
+	int64	coalescedBuffers = 0;	// ۽/Merge  ٸ ۿ  
+	int64	droppedBuffers = 0;
+	int64	droppedBytes = 0;
+	int64	overflowCount = 0;		// ͸ũ  Ƚ
+};
+
 /*--------------
 	Session
 ---------------*/
@@ -34,6 +73,9 @@ public:
 	shared_ptr<Service>	GetService() { return _service.lock(); }
 	void				SetService(shared_ptr<Service> service) { _service = service; }
 
+	void				SetSendConfig(const SendConfig& config);
+	SendStats			GetSendStats();
+
 public:
 						/*   */
 	void				SetNetAddress(NetAddress address) { _netAddress = address; }
@@ -46,6 +88,9 @@ private:
 						/* ̽  */
 	virtual HANDLE		GetHandle() override;
 	virtual void		Dispatch(class IocpEvent* iocpEvent, int32 numOfBytes = 0) override;
+#ifndef _WIN32
+	virtual void		DispatchReady(uint32 readyEvents) override;
+#endif
 
 private:
 						/*   */
@@ -53,6 +98,8 @@ private:
 	bool				RegisterDisconnect();
 	void				RegisterRecv();
 	void				RegisterSend();
+	int32				GatherSendBuffers();
+	void				MergeSendQueue();
 
 	void				ProcessConnect();
 	void				ProcessDisconnect();
@@ -60,6 +107,9 @@ private:
 	void				ProcessSend(int32 numOfBytes);
 
 	void				HandleError(int32 errorCode);
+#ifndef _WIN32
+	void				FlushSend();
+#endif
 
 protected:
 						/*  ڵ忡  */
@@ -67,6 +117,11 @@ protected:
 	virtual int32		OnRecv(BYTE* buffer, int32 len) { return len; }
 	virtual void		OnSend(int32 len) { }
 	virtual void		OnDisconnected() { }
+	// ۽ ť ͸ũ Ѿ .   ȿ ҸǷ Send ȣϸ  ȴ
+	virtual SendOverflowAction OnSendOverflow(const SendBufferRef& sendBuffer) { return _sendConfig.overflowAction; }
+
+						/* OnRecv    Ŷ ũ⸦ ˷ָ  ۸ ׸ŭ ø */
+	void				ReserveRecv(int32 packetSize) { _recvReserveSize = packetSize; }
 
 private:
 	weak_ptr<Service>	_service;
@@ -79,10 +134,32 @@ private:
 
 							/*   */
 	RecvBuffer				_recvBuffer;
+	int32					_recvReserveSize = 0;
 
 							/* ۽  */
 	Queue<SendBufferRef>	_sendQueue;
 	Atomic<bool>			_sendRegistered = false;
+	SendConfig				_sendConfig;
+	int64					_sendQueueBytes = 0;	// WRITE_LOCK
+	int64					_peakQueuedBytes = 0;	// WRITE_LOCK
+	int64					_droppedBuffers = 0;	// WRITE_LOCK
+	int64					_droppedBytes = 0;		// WRITE_LOCK
+	int64					_overflowCount = 0;		// WRITE_LOCK
+	size_t					_mergedQueueCount = 0;	// WRITE_LOCK,  MergeSendQueue  ť 
+	Atomic<int64>			_sentBytes = 0;
+	Atomic<int64>			_sentBuffers = 0;
+	Atomic<int64>			_sendCalls = 0;
+	Atomic<int64>			_coalescedBuffers = 0;
+
+#ifndef _WIN32
+							/* epoll  */
+	// غ    ÿ   ־,  ø 尡  
+	Atomic<int32>			_recvSignals = 0;
+	Atomic<int32>			_sendSignals = 0;
+	Atomic<bool>			_connectPending = false;
+	int32					_sendTotalSize = 0;
+	int32					_sendWrittenSize = 0;
+#endif
 
 private:
 						/* IocpEvent  */
@@ -102,14 +179,33 @@ struct PacketHeader
 	uint16 id; // ID (ex. 1=α, 2=̵û)
 };
 
+// 64KB Ѵ Ŷ: size=0  ǥϰ ڿ uint32 ü ũ⸦ δ
+// [size(2)=0][id(2)][totalSize(4)][data....]
+struct PacketHeaderEx
+{
+	uint16 marker; // ׻ 0
+	uint16 id;
+	uint32 size;
+};
+
 class PacketSession : public Session
 {
+public:
+	enum
+	{
+		MAX_PACKET_SIZE = 0x1000000, // 16MB,   ´
+	};
+
 public:
 	PacketSession();
 	virtual ~PacketSession();
 
 	PacketSessionRef	GetPacketSessionRef() { return static_pointer_cast<PacketSession>(shared_from_this()); }
 
+	// ۽  : dataSize ´  ũ / buffer   Ŷ ü ũ ȯ
+	static uint32		HeaderSize(uint32 dataSize);
+	static uint32		WriteHeader(BYTE* buffer, uint16 id, uint32 dataSize);
+
 protected:
 	virtual int32		OnRecv(BYTE* buffer, int32 len) sealed;
 	virtual void		OnRecvPacket(BYTE* buffer, int32 len) abstract;
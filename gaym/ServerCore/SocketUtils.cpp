@@ -5,6 +5,8 @@
 	SocketUtils
 -----------------*/
 
+#ifdef _WIN32
+
 LPFN_CONNECTEX		SocketUtils::ConnectEx = nullptr;
 LPFN_DISCONNECTEX	SocketUtils::DisconnectEx = nullptr;
 LPFN_ACCEPTEX		SocketUtils::AcceptEx = nullptr;
@@ -38,6 +40,26 @@ SOCKET SocketUtils::CreateSocket()
 	return ::WSASocket(AF_INET, SOCK_STREAM, IPPROTO_TCP, NULL, 0, WSA_FLAG_OVERLAPPED);
 }
 
+#else
+
+void SocketUtils::Init()
+{
+	//  Ͽ   SIGPIPE μ  ʵ
+	::signal(SIGPIPE, SIG_IGN);
+}
+
+void SocketUtils::Clear()
+{
+}
+
+SOCKET SocketUtils::CreateSocket()
+{
+	// epoll  ƮŴ ŷ   Ѵ
+	return ::socket(AF_INET, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, IPPROTO_TCP);
+}
+
+#endif
+
 bool SocketUtils::SetLinger(SOCKET socket, uint16 onoff, uint16 linger)
 {
 	LINGER option;
@@ -48,7 +70,7 @@ bool SocketUtils::SetLinger(SOCKET socket, uint16 onoff, uint16 linger)
 
 bool SocketUtils::SetReuseAddress(SOCKET socket, bool flag)
 {
-	return SetSockOpt(socket, SOL_SOCKET, SO_REUSEADDR, flag);
+	return SetSockOpt(socket, SOL_SOCKET, SO_REUSEADDR, static_cast<int32>(flag));
 }
 
 bool SocketUtils::SetRecvBufferSize(SOCKET socket, int32 size)
@@ -63,14 +85,16 @@ bool SocketUtils::SetSendBufferSize(SOCKET socket, int32 size)
 
 bool SocketUtils::SetTcpNoDelay(SOCKET socket, bool flag)
 {
-	return SetSockOpt(socket, SOL_SOCKET, TCP_NODELAY, flag);
+	return SetSockOpt(socket, IPPROTO_TCP, TCP_NODELAY, static_cast<int32>(flag));
 }
 
+#ifdef _WIN32
 // ListenSocket Ư ClientSocket ״ 
 bool SocketUtils::SetUpdateAcceptSocket(SOCKET socket, SOCKET listenSocket)
 {
 	return SetSockOpt(socket, SOL_SOCKET, SO_UPDATE_ACCEPT_CONTEXT, listenSocket);
 }
+#endif
 
 bool SocketUtils::Bind(SOCKET socket, NetAddress netAddr)
 {
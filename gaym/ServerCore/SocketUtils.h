@@ -7,16 +7,20 @@
 
 class SocketUtils
 {
+#ifdef _WIN32
 public:
 	static LPFN_CONNECTEX		ConnectEx;
 	static LPFN_DISCONNECTEX	DisconnectEx;
 	static LPFN_ACCEPTEX		AcceptEx;
+#endif
 
 public:
 	static void Init();
 	static void Clear();
 
+#ifdef _WIN32
 	static bool BindWindowsFunction(SOCKET socket, GUID guid, LPVOID* fn);
+#endif
 	static SOCKET CreateSocket();
 
 	static bool SetLinger(SOCKET socket, uint16 onoff, uint16 linger);
@@ -24,7 +28,9 @@ public:
 	static bool SetRecvBufferSize(SOCKET socket, int32 size);
 	static bool SetSendBufferSize(SOCKET socket, int32 size);
 	static bool SetTcpNoDelay(SOCKET socket, bool flag);
+#ifdef _WIN32
 	static bool SetUpdateAcceptSocket(SOCKET socket, SOCKET listenSocket);
+#endif
 
 	static bool Bind(SOCKET socket, NetAddress netAddr);
 	static bool BindAnyAddress(SOCKET socket, uint16 port);
@@ -50,7 +50,8 @@ void ThreadManager::InitTLS()
 
 void ThreadManager::DestroyTLS()
 {
-
+	//  ĳÿ  ޸  Ǯ ش
+	MemoryPool::FlushThreadCache();
 }
 
 void ThreadManager::DoGlobalQueueWork()
@@ -74,4 +75,10 @@ void ThreadManager::DistributeReservedJobs()
 	const uint64 now = ::GetTickCount64();
 
 	GJobTimer->Distribute(now);
+
+	//  ֱ  常  ʴ Ǯ ޸𸮸 OS ش
+	static Atomic<uint64> SNextTrimTick = 0;
+	uint64 nextTrimTick = SNextTrimTick.load();
+	if (now >= nextTrimTick && SNextTrimTick.compare_exchange_strong(nextTrimTick, now + MEMORY_TRIM_TICK))
+		MemoryPool::TrimAll();
 }
@@ -9,6 +9,8 @@
 
 class ThreadManager
 {
+	enum { MEMORY_TRIM_TICK = 10000 };
+
 public:
 	ThreadManager();
 	~ThreadManager();
@@ -86,8 +86,8 @@ template<typename From, typename To>
 class Conversion
 {
 private:
-	using Small = __int8;
-	using Big = __int32;
+	using Small = int8;
+	using Big = int32;
 
 	static Small Test(const To&) { return 0; }
 	static Big Test(...) { return 0; }
@@ -1,8 +1,12 @@
 #pragma once
 #include <mutex>
 #include <atomic>
+#include <memory>
+#include <condition_variable>
+#include <cstdint>
 
 using BYTE = unsigned char;
+#ifdef _WIN32
 using int8 = __int8;
 using int16 = __int16;
 using int32 = __int32;
@@ -11,6 +15,16 @@ using uint8 = unsigned __int8;
 using uint16 = unsigned __int16;
 using uint32 = unsigned __int32;
 using uint64 = unsigned __int64;
+#else
+using int8 = int8_t;
+using int16 = int16_t;
+using int32 = int32_t;
+using int64 = int64_t;
+using uint8 = uint8_t;
+using uint16 = uint16_t;
+using uint32 = uint32_t;
+using uint64 = uint64_t;
+#endif
 
 template<typename T>
 using Atomic = std::atomic<T>;
@@ -40,4 +54,7 @@ USING_SHARED_PTR(JobQueue);
 #define len16(arr)		static_cast<int16>(sizeof(arr)/sizeof(arr[0]))
 #define len32(arr)		static_cast<int32>(sizeof(arr)/sizeof(arr[0]))
 
-#define _STOMP
\ No newline at end of file
+//  忡   Ҵ ޸  ,  ܿ ޸ Ǯ 
+#ifdef _DEBUG
+#define _STOMP
+#endif
\ No newline at end of file
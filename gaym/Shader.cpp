@@ -1,6 +1,7 @@
 ﻿#include "stdafx.h"
 #include "Shader.h"
 #include "RenderComponent.h"
+#include "BonePalette.h"
 #include <algorithm>
 
 Shader::Shader()
@@ -13,15 +14,64 @@ Shader::~Shader()
 
 void Shader::AddRenderComponent(RenderComponent* pRenderComponent)
 {
-    m_vRenderComponents.push_back(pRenderComponent);
-    pRenderComponent->SetOwnerShader(this);
+    pRenderComponent->MarkRenderListDirty();
+}
+
+void Shader::InsertRenderComponent(RenderComponent* pRenderComponent)
+{
+    const uint64_t nKey = m_DrawList.Insert(pRenderComponent->GetSortKey(), pRenderComponent);
+    pRenderComponent->SetListed(this, nKey);
 }
 
 void Shader::RemoveRenderComponent(RenderComponent* pRenderComponent)
 {
-    m_vRenderComponents.erase(
-        std::remove(m_vRenderComponents.begin(), m_vRenderComponents.end(), pRenderComponent),
-        m_vRenderComponents.end());
+    if (pRenderComponent->GetOwnerShader() != this)
+        return;
+
+    // 등록 당시 키로 찾는다 (그 뒤 텍스처 등이 바뀌어도 위치는 그대로)
+    m_DrawList.Remove(pRenderComponent->GetListedKey(), pRenderComponent);
+    pRenderComponent->SetListed(nullptr, 0);
+
+    if (pRenderComponent->GetCullItem() >= 0)
+    {
+        m_vReleasedCullItems.push_back(pRenderComponent->GetCullItem());
+        pRenderComponent->SetCullItem(-1);
+    }
+}
+
+void Shader::ClearRenderComponents()
+{
+    UnlistAll();
+    m_DrawList.Clear();
+    RenderComponent::InvalidateRenderLists();
+}
+
+void Shader::SetRenderComponents(const std::vector<RenderComponent*>& vRenderComponents)
+{
+    UnlistAll();
+
+    // 키를 한 번만 계산해 두고 정렬. 같은 키끼리와 투명 패스는 모은 순서를 유지
+    m_vSortKeys.clear();
+    m_vSortKeys.reserve(vRenderComponents.size());
+    for (RenderComponent* pRenderComp : vRenderComponents)
+        m_vSortKeys.emplace_back(pRenderComp->GetSortKey(), pRenderComp);
+    m_DrawList.Assign(m_vSortKeys);
+
+    const std::vector<RenderComponent*>& vItems = m_DrawList.GetItems();
+    const std::vector<uint64_t>& vKeys = m_DrawList.GetKeys();
+    for (size_t i = 0; i < vItems.size(); i++)
+        vItems[i]->SetListed(this, vKeys[i]);
+}
+
+void Shader::UnlistAll()
+{
+    // 컬러 아이템도 같이 무효 — 이 뒤에는 Scene 이 컬러를 다시 빌드한다
+    for (RenderComponent* pRenderComp : m_DrawList.GetItems())
+    {
+        pRenderComp->SetListed(nullptr, 0);
+        pRenderComp->SetCullItem(-1);
+    }
+    m_vReleasedCullItems.clear();
 }
 
 void Shader::Render(ID3D12GraphicsCommandList* pCommandList, D3D12_GPU_VIRTUAL_ADDRESS d3dPassCBVAddress, D3D12_GPU_DESCRIPTOR_HANDLE shadowSrvHandle,
@@ -36,12 +86,16 @@ void Shader::Render(ID3D12GraphicsCommandList* pCommandList, D3D12_GPU_VIRTUAL_A
     // Set the shadow map SRV for root parameter 3
     pCommandList->SetGraphicsRootDescriptorTable(3, shadowSrvHandle);
 
+    // Skinning palette (t11) for root parameter 13
+    pCommandList->SetGraphicsRootShaderResourceView(13, BonePalette::Get().GetGpuVirtualAddress());
+
     // 1. Render opaque objects first (인디케이터/투명 제외)
     pCommandList->SetPipelineState(m_pd3dPipelineState.Get());
-    for (auto& pRenderComp : m_vRenderComponents)
+    const std::vector<RenderComponent*>& vItems = m_DrawList.GetItems();
+    for (size_t i = m_DrawList.GetPassBegin(0); i < m_DrawList.GetPassEnd(0); i++)
     {
-        if (!pRenderComp->IsTransparent() && !pRenderComp->IsOverlay())
-            pRenderComp->Render(pCommandList);
+        if (vItems[i]->IsInView())
+            vItems[i]->Render(pCommandList);
     }
 
     // 2. Render transparent objects (water) with alpha blending PSO
@@ -57,19 +111,19 @@ void Shader::Render(ID3D12GraphicsCommandList* pCommandList, D3D12_GPU_VIRTUAL_A
     if (foamDiffuseHandle.ptr != 0)
         pCommandList->SetGraphicsRootDescriptorTable(12, foamDiffuseHandle);   // t10
 
-    for (auto& pRenderComp : m_vRenderComponents)
+    for (size_t i = m_DrawList.GetPassBegin(1); i < m_DrawList.GetPassEnd(1); i++)
     {
-        if (pRenderComp->IsTransparent())
-            pRenderComp->Render(pCommandList);
+        if (vItems[i]->IsInView())
+            vItems[i]->Render(pCommandList);
     }
 
     // 3. Render overlay objects (공격 인디케이터) — depth=ALWAYS, depth 미기록
     //    물/벽 뒤에 있어도 항상 맨 위에 그려져 UI 처럼 느낌
     pCommandList->SetPipelineState(m_pd3dIndicatorPSO.Get());
-    for (auto& pRenderComp : m_vRenderComponents)
+    for (size_t i = m_DrawList.GetPassBegin(2); i < m_DrawList.GetPassEnd(2); i++)
     {
-        if (pRenderComp->IsOverlay())
-            pRenderComp->Render(pCommandList);
+        if (vItems[i]->IsInView())
+            vItems[i]->Render(pCommandList);
     }
 }
 
@@ -81,10 +135,13 @@ void Shader::RenderShadowPass(ID3D12GraphicsCommandList* pCommandList, D3D12_GPU
     // Set the pass constant buffer view for root parameter 1
     pCommandList->SetGraphicsRootConstantBufferView(1, d3dPassCBVAddress);
 
-    for (auto& pRenderComp : m_vRenderComponents)
+    // Skinning palette (t11) for root parameter 13
+    pCommandList->SetGraphicsRootShaderResourceView(13, BonePalette::Get().GetGpuVirtualAddress());
+
+    for (RenderComponent* pRenderComp : m_DrawList.GetItems())
     {
-        // Only render objects that cast shadows
-        if (pRenderComp->CastsShadow())
+        // Only render objects that cast shadows (and overlap the light volume)
+        if (pRenderComp->CastsShadow() && pRenderComp->IsInShadowView())
         {
             pRenderComp->Render(pCommandList);
         }
@@ -94,7 +151,7 @@ void Shader::RenderShadowPass(ID3D12GraphicsCommandList* pCommandList, D3D12_GPU
 void Shader::Build(ID3D12Device* pDevice)
 {
     // Create a root signature with 9 parameters: Object CBV, Pass CBV, Albedo SRV(t0), Shadow SRV(t1), Normal SRV(t2), Height SRV(t3), Emissive SRV(t4), AO SRV(t5), Roughness SRV(t6)
-    D3D12_ROOT_PARAMETER d3dRootParameters[13];  // 9 + 4 (t7~t10)
+    D3D12_ROOT_PARAMETER d3dRootParameters[14];  // 9 + 4 (t7~t10) + 1 (t11)
 
     // Parameter 0: Descriptor table for the per-object constant buffer (b0)
     D3D12_DESCRIPTOR_RANGE d3dDescriptorRange;
@@ -291,8 +348,14 @@ void Shader::Build(ID3D12Device* pDevice)
     d3dRootParameters[12].DescriptorTable.pDescriptorRanges = &d3dFoamDiffuseRange;
     d3dRootParameters[12].ShaderVisibility = D3D12_SHADER_VISIBILITY_ALL;  // VS에서도 사용 (water_height_02 displacement)
 
+    // Parameter 13: Root SRV for the skinning palette (t11) - BonePalette
+    d3dRootParameters[13].ParameterType = D3D12_ROOT_PARAMETER_TYPE_SRV;
+    d3dRootParameters[13].Descriptor.ShaderRegister = 11; // t11
+    d3dRootParameters[13].Descriptor.RegisterSpace = 0;
+    d3dRootParameters[13].ShaderVisibility = D3D12_SHADER_VISIBILITY_VERTEX;
+
     D3D12_ROOT_SIGNATURE_DESC d3dRootSignatureDesc;
-    d3dRootSignatureDesc.NumParameters = 13;  // 9 -> 13
+    d3dRootSignatureDesc.NumParameters = 14;  // 9 -> 13 -> 14
     d3dRootSignatureDesc.pParameters = d3dRootParameters;
     d3dRootSignatureDesc.NumStaticSamplers = 2;
     d3dRootSignatureDesc.pStaticSamplers = samplers;
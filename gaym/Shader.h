@@ -1,6 +1,7 @@
 ﻿#pragma once
 
 #include "stdafx.h"
+#include "SortedDrawList.h"
 
 class RenderComponent;
 
@@ -15,9 +16,20 @@ public:
                 D3D12_GPU_DESCRIPTOR_HANDLE foamOpacityHandle = {}, D3D12_GPU_DESCRIPTOR_HANDLE foamDiffuseHandle = {});
     void RenderShadowPass(ID3D12GraphicsCommandList* pCommandList, D3D12_GPU_VIRTUAL_ADDRESS d3dPassCBVAddress);
 
+    // 소속 판단은 Scene 이 한다 — 여기서는 dirty 로만 표시하고 다음 UpdateRenderList 가 정렬 위치에 넣는다
     void AddRenderComponent(RenderComponent* pRenderComponent);
     void RemoveRenderComponent(RenderComponent* pRenderComponent);
-    void ClearRenderComponents() { m_vRenderComponents.clear(); }
+    void ClearRenderComponents();
+
+    // 정렬 키 자리에 하나만 끼워 넣는다 (같은 키끼리와 투명 패스는 나중에 넣은 것이 뒤)
+    void InsertRenderComponent(RenderComponent* pRenderComponent);
+
+    // Scene 이 전체를 다시 모았을 때 통째로 교체하고 한 번 정렬
+    void SetRenderComponents(const std::vector<RenderComponent*>& vRenderComponents);
+    const std::vector<RenderComponent*>& GetRenderComponents() const { return m_DrawList.GetItems(); }
+
+    // 리스트에서 빠진 컴포넌트가 쓰던 컬러 아이템. Scene 이 가져가서 컬러에서 지운다
+    std::vector<int>& GetReleasedCullItems() { return m_vReleasedCullItems; }
 
     virtual void Build(ID3D12Device* pDevice);
 
@@ -30,5 +42,10 @@ private:
     ComPtr<ID3D12PipelineState> m_pd3dWaterPSO;      // Water PSO (alpha blending)
     ComPtr<ID3D12PipelineState> m_pd3dIndicatorPSO;  // Overlay PSO (depth=ALWAYS, no depth write) — UI 느낌 인디케이터
 
-    std::vector<RenderComponent*> m_vRenderComponents;
+    void UnlistAll();
+
+    // 패스 > 재질 > 메쉬 키로 항상 정렬된 상태 (패스 0 불투명, 1 투명, 2 오버레이가 각각 연속 구간, 투명은 넣은 순서)
+    SortedDrawList<RenderComponent*> m_DrawList;
+    std::vector<std::pair<uint64_t, RenderComponent*>> m_vSortKeys;  // SetRenderComponents 임시 버퍼
+    std::vector<int> m_vReleasedCullItems;
 };
\ No newline at end of file
@@ -0,0 +1,109 @@
+#include "SimProfiler.h"
+#include <algorithm>
+#include <cstdio>
+
+namespace
+{
+    int64_t NowNs()
+    {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    struct Summary
+    {
+        double avg = 0.0, p50 = 0.0, p99 = 0.0, max = 0.0, total = 0.0;
+    };
+
+    Summary Summarize(std::vector<int64_t> samples)
+    {
+        Summary s;
+        if (samples.empty())
+            return s;
+
+        std::sort(samples.begin(), samples.end());
+
+        int64_t sum = 0;
+        for (int64_t v : samples) sum += v;
+
+        const size_t n = samples.size();
+        s.total = sum / 1e6;
+        s.avg   = s.total / static_cast<double>(n);
+        s.p50   = samples[n / 2] / 1e6;
+        s.p99   = samples[(std::min)(n - 1, (n * 99) / 100)] / 1e6;
+        s.max   = samples.back() / 1e6;
+        return s;
+    }
+}
+
+SimProfiler& SimProfiler::Get()
+{
+    static SimProfiler s_Profiler;
+    return s_Profiler;
+}
+
+const char* SimProfiler::GetName(SimSubsystem eSubsystem)
+{
+    switch (eSubsystem)
+    {
+    case SimSubsystem::Collision:   return "Collision";
+    case SimSubsystem::AI:          return "AI";
+    case SimSubsystem::Animation:   return "Animation";
+    case SimSubsystem::Projectiles: return "Projectiles";
+    case SimSubsystem::Particles:   return "Particles";
+    default:                        return "?";
+    }
+}
+
+void SimProfiler::BeginFrame()
+{
+    if (!m_bEnabled) return;
+
+    for (int64_t& v : m_nCurrent) v = 0;
+    m_nFrameStart = NowNs();
+}
+
+void SimProfiler::EndFrame()
+{
+    if (!m_bEnabled) return;
+
+    m_vFrameSamples.push_back(NowNs() - m_nFrameStart);
+    for (int i = 0; i < SUBSYSTEM_COUNT; ++i)
+    {
+        m_vSamples[i].push_back(m_nCurrent[i]);
+        m_nCurrent[i] = 0;
+    }
+}
+
+void SimProfiler::Reset()
+{
+    for (auto& v : m_vSamples) v.clear();
+    m_vFrameSamples.clear();
+    for (int64_t& v : m_nCurrent) v = 0;
+}
+
+std::string SimProfiler::BuildReport() const
+{
+    std::string report;
+    char line[256];
+
+    snprintf(line, sizeof(line), "frames: %zu\n", m_vFrameSamples.size());
+    report += line;
+    snprintf(line, sizeof(line), "%-12s %10s %10s %10s %10s %12s\n",
+        "subsystem", "avg(ms)", "p50(ms)", "p99(ms)", "max(ms)", "total(ms)");
+    report += line;
+
+    auto appendRow = [&](const char* name, const std::vector<int64_t>& samples)
+    {
+        const Summary s = Summarize(samples);
+        snprintf(line, sizeof(line), "%-12s %10.4f %10.4f %10.4f %10.4f %12.2f\n",
+            name, s.avg, s.p50, s.p99, s.max, s.total);
+        report += line;
+    };
+
+    for (int i = 0; i < SUBSYSTEM_COUNT; ++i)
+        appendRow(GetName(static_cast<SimSubsystem>(i)), m_vSamples[i]);
+
+    appendRow("Frame", m_vFrameSamples);
+    return report;
+}
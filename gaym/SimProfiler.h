@@ -0,0 +1,86 @@
+#pragma once
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// ============================================================================
+// SimProfiler
+// 게임플레이 서브시스템별 프레임 시간 측정 (헤드리스 실행 -headless 에서 사용).
+// 꺼져 있으면 SimProfileScope는 플래그 하나만 확인하고 끝난다.
+//
+//   SimProfileScope scope(SimSubsystem::Collision);   // 스코프 시간을 이번 프레임에 누적
+//
+// 같은 서브시스템 스코프는 중첩하지 않는다 (중첩하면 두 번 더해짐).
+// ============================================================================
+
+enum class SimSubsystem : uint8_t
+{
+    Collision,
+    AI,
+    Animation,
+    Projectiles,
+    Particles,
+    Count
+};
+
+class SimProfiler
+{
+public:
+    static SimProfiler& Get();
+
+    void SetEnabled(bool bEnabled) { m_bEnabled = bEnabled; }
+    bool IsEnabled() const { return m_bEnabled; }
+
+    // 프레임 경계 — EndFrame이 이번 프레임 누적값을 기록하고 0으로 되돌린다
+    void BeginFrame();
+    void EndFrame();
+
+    void Add(SimSubsystem eSubsystem, int64_t nNanoseconds) { m_nCurrent[static_cast<int>(eSubsystem)] += nNanoseconds; }
+
+    // 서브시스템별 평균/p50/p99/최대 (ms/frame) 표
+    std::string BuildReport() const;
+    void        Reset();
+
+    static const char* GetName(SimSubsystem eSubsystem);
+
+private:
+    SimProfiler() = default;
+
+    static constexpr int SUBSYSTEM_COUNT = static_cast<int>(SimSubsystem::Count);
+
+    bool    m_bEnabled = false;
+    int64_t m_nCurrent[SUBSYSTEM_COUNT] = {};
+    int64_t m_nFrameStart = 0;
+
+    std::vector<int64_t> m_vSamples[SUBSYSTEM_COUNT];   // 프레임별 ns
+    std::vector<int64_t> m_vFrameSamples;                // BeginFrame~EndFrame 전체 ns
+};
+
+class SimProfileScope
+{
+public:
+    explicit SimProfileScope(SimSubsystem eSubsystem)
+        : m_eSubsystem(eSubsystem), m_bActive(SimProfiler::Get().IsEnabled())
+    {
+        if (m_bActive)
+            m_Start = std::chrono::steady_clock::now();
+    }
+
+    ~SimProfileScope()
+    {
+        if (m_bActive)
+        {
+            const auto elapsed = std::chrono::steady_clock::now() - m_Start;
+            SimProfiler::Get().Add(m_eSubsystem, std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+        }
+    }
+
+    SimProfileScope(const SimProfileScope&) = delete;
+    SimProfileScope& operator=(const SimProfileScope&) = delete;
+
+private:
+    SimSubsystem                          m_eSubsystem;
+    bool                                  m_bActive;
+    std::chrono::steady_clock::time_point m_Start;
+};
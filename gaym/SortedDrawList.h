@@ -0,0 +1,100 @@
+#pragma once
+#include <algorithm>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+// 정렬 키 순으로 항상 정렬된 상태를 유지하는 그리기 목록. DirectX 타입에 의존하지 않아 CPU 만으로 검증할 수 있다.
+//   - 키 최상위 2비트가 패스 (0 = 불투명, 1 = 투명, 2 = 오버레이) → 패스마다 연속 구간이 된다
+//   - 투명 패스는 알파 블렌딩이라 순서가 결과를 바꾼다. 하위 62비트를 넣은 순번으로 바꿔서 넣은 순서대로 그린다
+//   - Insert/Remove 는 그 항목 하나만 키 자리에 넣고 뺀다 (이분 탐색 + 배열 이동)
+//   - Assign 은 전체 재구성 때 한 번 정렬
+template<typename T>
+class SortedDrawList
+{
+public:
+    static constexpr uint32_t kPassCount = 3;
+    static constexpr uint32_t kOrderedPass = 1;
+    static uint32_t GetPass(uint64_t nKey) { return static_cast<uint32_t>(nKey >> 62); }
+
+    // 같은 키끼리는 나중에 넣은 것이 뒤. 실제로 넣은 키를 돌려준다 (투명 패스면 순번 키) — Remove 에 그대로 넘긴다
+    uint64_t Insert(uint64_t nKey, T item)
+    {
+        nKey = ToListKey(nKey);
+        const size_t nPos = std::upper_bound(m_vKeys.begin(), m_vKeys.end(), nKey) - m_vKeys.begin();
+        m_vKeys.insert(m_vKeys.begin() + nPos, nKey);
+        m_vItems.insert(m_vItems.begin() + nPos, item);
+        for (uint32_t nPass = GetPass(nKey) + 1; nPass < kPassCount; nPass++)
+            m_nPassBegin[nPass]++;
+        return nKey;
+    }
+
+    // 넣을 때의 키로 찾는다. 없으면 false
+    bool Remove(uint64_t nKey, T item)
+    {
+        size_t i = std::lower_bound(m_vKeys.begin(), m_vKeys.end(), nKey) - m_vKeys.begin();
+        while (i < m_vKeys.size() && m_vKeys[i] == nKey && m_vItems[i] != item)
+            i++;
+        if (i == m_vKeys.size() || m_vKeys[i] != nKey)
+            return false;
+
+        m_vKeys.erase(m_vKeys.begin() + i);
+        m_vItems.erase(m_vItems.begin() + i);
+        for (uint32_t nPass = GetPass(nKey) + 1; nPass < kPassCount; nPass++)
+            m_nPassBegin[nPass]--;
+        return true;
+    }
+
+    // 통째로 교체. vKeyed 는 정렬되며 같은 키끼리는 원래 순서를 유지한다 (투명 패스는 vKeyed 순서 그대로)
+    void Assign(std::vector<std::pair<uint64_t, T>>& vKeyed)
+    {
+        for (auto& keyed : vKeyed)
+            keyed.first = ToListKey(keyed.first);
+        std::stable_sort(vKeyed.begin(), vKeyed.end(),
+            [](const auto& a, const auto& b) { return a.first < b.first; });
+
+        m_vKeys.resize(vKeyed.size());
+        m_vItems.resize(vKeyed.size());
+        for (size_t i = 0; i < vKeyed.size(); i++)
+        {
+            m_vKeys[i] = vKeyed[i].first;
+            m_vItems[i] = vKeyed[i].second;
+        }
+
+        for (uint32_t nPass = 1; nPass < kPassCount; nPass++)
+        {
+            m_nPassBegin[nPass] = std::partition_point(m_vKeys.begin(), m_vKeys.end(),
+                [nPass](uint64_t nKey) { return GetPass(nKey) < nPass; }) - m_vKeys.begin();
+        }
+    }
+
+    void Clear()
+    {
+        m_vKeys.clear();
+        m_vItems.clear();
+        for (size_t& nBegin : m_nPassBegin)
+            nBegin = 0;
+        m_nNextOrder = 0;
+    }
+
+    size_t Size() const { return m_vItems.size(); }
+    const std::vector<T>& GetItems() const { return m_vItems; }
+    const std::vector<uint64_t>& GetKeys() const { return m_vKeys; }
+
+    // 패스 nPass 구간 [GetPassBegin(nPass), GetPassEnd(nPass))
+    size_t GetPassBegin(uint32_t nPass) const { return m_nPassBegin[nPass]; }
+    size_t GetPassEnd(uint32_t nPass) const { return nPass + 1 < kPassCount ? m_nPassBegin[nPass + 1] : m_vItems.size(); }
+
+private:
+    uint64_t ToListKey(uint64_t nKey)
+    {
+        if (GetPass(nKey) != kOrderedPass)
+            return nKey;
+        return (uint64_t(kOrderedPass) << 62) | (m_nNextOrder++ & 0x3FFFFFFFFFFFFFFFull);
+    }
+
+    std::vector<uint64_t> m_vKeys;
+    std::vector<T>        m_vItems;
+    size_t                m_nPassBegin[kPassCount] = {};   // [0] 은 항상 0
+    uint64_t              m_nNextOrder = 0;                // 투명 패스 다음 순번
+};
@@ -2,7 +2,7 @@
 #undef min
 #undef max
 #include "Terrain.h"
-#include "MapLoader.h"       // JsonVal
+#include "JsonDoc.h"
 #include "WICTextureLoader12.h"
 #include "D3dx12.h"
 #include "Dx12App.h"
@@ -59,8 +59,8 @@ bool Terrain::Load(ID3D12Device* pDevice, ID3D12GraphicsCommandList* pCommandLis
 // ================================================================
 bool Terrain::ParseConfig(const char* configPath, const std::string& baseDir)
 {
-    JsonVal root = JsonVal::parseFile(configPath);
-    if (root.isNull())
+    JsonDoc doc;
+    if (!doc.parseFile(configPath))
     {
         char msg[256];
         sprintf_s(msg, "[Terrain] Cannot open config: %s\n", configPath);
@@ -68,6 +68,8 @@ bool Terrain::ParseConfig(const char* configPath, const std::string& baseDir)
         return false;
     }
 
+    const JsonVal& root = doc.root();
+
     // ── terrain 기본 정보 ──
     const JsonVal& t = root["terrain"];
     m_xmf3TerrainPos  = { t["posX"].f(),  t["posY"].f(),  t["posZ"].f()  };
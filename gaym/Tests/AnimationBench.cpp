@@ -0,0 +1,186 @@
+#include "Animation.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <filesystem>
+#include <memory>
+
+// Assets 의 모든 *_Anim.bin 에 대해
+//  1) 압축 리포트 — 원본 키 대비 크기 / 키 수 / 원본 모든 프레임에서 다시 샘플링한 최대 오차
+//  2) 스키닝 캐릭터 100 명 샘플링 벤치 — AnimationComponent::Update 와 같은 루프
+//     (현재 clip 샘플 + 절반은 이전 clip 포즈와 크로스페이드), 본 계층/스키닝 행렬은 제외
+// 리눅스에서는 PortablePlatform.h 의 스칼라 수학으로 빌드된다 (샘플링 시간은 윈도우 SIMD 와 다름). 에셋 경로가 상대 경로라 gaym/ 에서 실행
+namespace
+{
+    constexpr int   kCharacterCount = 100;
+    constexpr int   kFrameCount = 600;
+    constexpr float kDeltaTime = 1.0f / 60.0f;
+
+    struct BonePose
+    {
+        XMFLOAT3 xmf3Position;
+        XMFLOAT4 xmf4Rotation;
+        XMFLOAT3 xmf3Scale;
+        uint32_t nStamp = 0;
+    };
+
+    struct Character
+    {
+        const AnimationSet*  pSet = nullptr;
+        const AnimationClip* pClip = nullptr;
+        const AnimationClip* pPreviousClip = nullptr;   // nullptr 이면 블렌드 없음
+        float fTime = 0.0f;
+        float fPreviousTime = 0.0f;
+        std::vector<BonePose> vPreviousPose;
+        std::vector<XMFLOAT4X4> vLocal;                  // 스켈레톤 인덱스별 결과 (TransformComponent 대신)
+        uint32_t nPoseStamp = 0;
+    };
+
+    // AnimationComponent::Update 와 같은 프레임 계산: 마지막 프레임에서는 다음 프레임 = 자신
+    float SampleFrame(const AnimationClip& clip, float fTime, int& outFrame, int& outNextFrame)
+    {
+        const float fFrame = fTime * clip.m_fFrameRate;
+        outFrame = static_cast<int>(fFrame);
+        outNextFrame = outFrame + 1;
+        if (outFrame >= clip.m_nTotalFrames - 1)
+        {
+            outFrame = outNextFrame = (std::max)(clip.m_nTotalFrames - 1, 0);
+            return static_cast<float>(outFrame);
+        }
+        return fFrame;
+    }
+
+    void Animate(Character& c, float dt)
+    {
+        c.fTime = fmod(c.fTime + dt, c.pClip->m_fDuration);
+        int nFrame, nNextFrame;
+        const float fFrame = SampleFrame(*c.pClip, c.fTime, nFrame, nNextFrame);
+
+        const bool bBlend = c.pPreviousClip != nullptr;
+        if (bBlend)
+        {
+            c.fPreviousTime = fmod(c.fPreviousTime + dt, c.pPreviousClip->m_fDuration);
+            int nPrevFrame, nPrevNextFrame;
+            const float fPrevFrame = SampleFrame(*c.pPreviousClip, c.fPreviousTime, nPrevFrame, nPrevNextFrame);
+
+            ++c.nPoseStamp;
+            for (const auto& track : c.pPreviousClip->m_vTracks)
+            {
+                if (nPrevFrame >= track.m_nFrameCount || nPrevNextFrame >= track.m_nFrameCount)
+                    continue;
+
+                XMVECTOR pos, rot, scale;
+                track.Sample(fPrevFrame, pos, rot, scale);
+                BonePose& pose = c.vPreviousPose[track.m_nBoneIndex];
+                XMStoreFloat3(&pose.xmf3Position, pos);
+                XMStoreFloat4(&pose.xmf4Rotation, rot);
+                XMStoreFloat3(&pose.xmf3Scale, scale);
+                pose.nStamp = c.nPoseStamp;
+            }
+        }
+
+        for (const auto& track : c.pClip->m_vTracks)
+        {
+            if (nFrame >= track.m_nFrameCount || nNextFrame >= track.m_nFrameCount)
+                continue;
+
+            XMVECTOR pos, rot, scale;
+            track.Sample(fFrame, pos, rot, scale);
+
+            if (bBlend)
+            {
+                const BonePose& pose = c.vPreviousPose[track.m_nBoneIndex];
+                if (pose.nStamp == c.nPoseStamp)
+                {
+                    pos = XMVectorLerp(XMLoadFloat3(&pose.xmf3Position), pos, 0.5f);
+                    rot = XMQuaternionSlerp(XMLoadFloat4(&pose.xmf4Rotation), rot, 0.5f);
+                    scale = XMVectorLerp(XMLoadFloat3(&pose.xmf3Scale), scale, 0.5f);
+                }
+            }
+
+            XMStoreFloat4x4(&c.vLocal[track.m_nBoneIndex], XMMatrixAffineTransformation(scale, XMVectorZero(), rot, pos));
+        }
+    }
+}
+
+int main()
+{
+    std::vector<std::string> vPaths;
+    for (const auto& entry : std::filesystem::recursive_directory_iterator("Assets"))
+    {
+        const std::string strPath = entry.path().generic_string();
+        if (entry.is_regular_file() && strPath.size() > 9 && strPath.compare(strPath.size() - 9, 9, "_Anim.bin") == 0)
+            vPaths.push_back(strPath);
+    }
+    std::sort(vPaths.begin(), vPaths.end());
+
+    // 1) 정확도 대 크기
+    std::vector<std::unique_ptr<AnimationSet>> vSets;
+    AnimationCompressionReport total;
+    for (const std::string& strPath : vPaths)
+    {
+        auto pSet = std::make_unique<AnimationSet>();
+        if (!pSet->LoadAnimationFromFile(strPath.c_str()) || pSet->m_vClips.empty())
+        {
+            fprintf(stderr, "[AnimBench] failed to load %s\n", strPath.c_str());
+            return 1;
+        }
+        printf("[AnimBench] %s: %zu clips, %s", strPath.c_str(), pSet->m_vClips.size(),
+               pSet->BuildCompressionReport().c_str());
+
+        const AnimationCompressionReport& r = pSet->GetCompressionReport();
+        total.nRawBytes += r.nRawBytes;
+        total.nCompressedBytes += r.nCompressedBytes;
+        total.nRawKeys += r.nRawKeys;
+        total.nKeptKeys += r.nKeptKeys;
+        total.fMaxPositionError = (std::max)(total.fMaxPositionError, r.fMaxPositionError);
+        total.fMaxRotationError = (std::max)(total.fMaxRotationError, r.fMaxRotationError);
+        total.fMaxScaleError = (std::max)(total.fMaxScaleError, r.fMaxScaleError);
+        vSets.push_back(std::move(pSet));
+    }
+    if (vSets.empty())
+    {
+        fprintf(stderr, "[AnimBench] no *_Anim.bin under Assets (run from gaym/)\n");
+        return 1;
+    }
+    printf("[AnimBench] total: %.1fKB -> %.1fKB (%.1f%%), keys %zu -> %zu, max err pos=%.5f rot=%.5f scale=%.5f\n",
+           total.nRawBytes / 1024.0, total.nCompressedBytes / 1024.0,
+           total.nRawBytes ? 100.0 * total.nCompressedBytes / total.nRawBytes : 0.0,
+           total.nRawKeys, total.nKeptKeys,
+           total.fMaxPositionError, total.fMaxRotationError, total.fMaxScaleError);
+
+    // 2) 캐릭터 100 명: 세트를 돌아가며 배정, 짝수 번째는 다른 clip 에서 크로스페이드 중
+    std::vector<Character> vCharacters(kCharacterCount);
+    size_t nTracks = 0;
+    for (int i = 0; i < kCharacterCount; ++i)
+    {
+        Character& c = vCharacters[i];
+        c.pSet = vSets[i % vSets.size()].get();
+        const int nClips = static_cast<int>(c.pSet->m_vClips.size());
+        c.pClip = c.pSet->GetClip(i % nClips);
+        if (i % 2 == 0 && nClips > 1)
+            c.pPreviousClip = c.pSet->GetClip((i + 1) % nClips);
+        c.fTime = 0.37f * i;
+        c.fPreviousTime = 0.21f * i;
+        c.vPreviousPose.resize(c.pSet->GetBoneCount());
+        c.vLocal.resize(c.pSet->GetBoneCount());
+        nTracks += c.pClip->m_vTracks.size() + (c.pPreviousClip ? c.pPreviousClip->m_vTracks.size() : 0);
+    }
+
+    for (Character& c : vCharacters)   // 워밍업
+        Animate(c, kDeltaTime);
+
+    const auto t0 = std::chrono::steady_clock::now();
+    for (int frame = 0; frame < kFrameCount; ++frame)
+    {
+        for (Character& c : vCharacters)
+            Animate(c, kDeltaTime);
+    }
+    const double fMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t0).count();
+
+    printf("[AnimBench] %d characters x %d frames: %.3f ms/frame, %.1f ns/track sample (%zu tracks/frame)\n",
+           kCharacterCount, kFrameCount, fMs / kFrameCount,
+           fMs * 1.0e6 / (static_cast<double>(nTracks) * kFrameCount), nTracks);
+    return 0;
+}
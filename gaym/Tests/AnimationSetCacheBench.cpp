@@ -0,0 +1,112 @@
+#include "Animation.h"
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <vector>
+
+// 같은 종류의 적 N 마리 스폰: AnimationComponent::LoadAnimation 이
+//  1) 예전처럼 인스턴스마다 AnimationSet 을 만들어 LoadAnimationFromFile
+//  2) AnimationSetCache::Acquire 로 세트 공유
+// 할 때의 파싱 횟수 / 시간 / 상주 메모리. 캐시는 N 과 무관하게 1 번만 파싱해야 한다.
+// 에셋 경로가 상대 경로라 gaym/ 에서 실행
+namespace
+{
+    // EnemySpawner 프리셋의 m_strAnimationPath 중 저장소에 있는 것만 쓴다
+    const char* const kEnemyAnimations[] =
+    {
+        "Assets/Enemies/Elementals/AirElemental_Bl/AirElemental_Bl_Anim.bin",
+        "Assets/Enemies/Elementals/FireGolem_Rd/FireGolem_Rd_Anim.bin",
+        "Assets/Enemies/Elementals/EarthElemental_Gn/EarthElemental_Gn_Anim.bin",
+        "Assets/Enemies/Elementals/StormElemental_Bl/StormElemental_Bl_Anim.bin",
+        "Assets/Enemies/Dragon/Red_Anim.bin",
+        "Assets/Enemies/Kraken/KRAKEN_Anim.bin",
+        "Assets/Enemies/Golem/Golem01_Generic_prefab_Anim.bin",
+        "Assets/Enemies/demon/Demon_Anim.bin",
+        "Assets/Enemies/Dragon_blue/Blue_Anim.bin",
+    };
+    const int kSpawnCounts[] = { 1, 10, 30, 100 };
+
+    bool Check(bool condition, const char* what)
+    {
+        if (!condition)
+            fprintf(stderr, "[AnimCacheBench] FAILED: %s\n", what);
+        return condition;
+    }
+
+    double ElapsedMs(std::chrono::steady_clock::time_point t0)
+    {
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t0).count();
+    }
+
+    bool RunSpawn(const std::string& strPath, int nCount)
+    {
+        bool bOk = true;
+
+        // 1) 인스턴스마다 파싱
+        std::vector<std::shared_ptr<AnimationSet>> vOwned;
+        vOwned.reserve(nCount);
+        size_t nOwnedBytes = 0;
+        auto t0 = std::chrono::steady_clock::now();
+        for (int i = 0; i < nCount; ++i)
+        {
+            auto pSet = std::make_shared<AnimationSet>();
+            bOk &= Check(pSet->LoadAnimationFromFile(strPath.c_str()), "uncached load");
+            vOwned.push_back(std::move(pSet));
+        }
+        const double fOwnedMs = ElapsedMs(t0);
+        for (const auto& pSet : vOwned)
+            nOwnedBytes += pSet->GetResidentBytes();
+        vOwned.clear();
+
+        // 2) 캐시 공유 (방 전환처럼 시작 전에 비워 둔다)
+        AnimationSetCache::ReleaseUnused();
+        const AnimationSetCache::Stats s0 = AnimationSetCache::GetStats();
+        std::vector<std::shared_ptr<const AnimationSet>> vShared;
+        vShared.reserve(nCount);
+        t0 = std::chrono::steady_clock::now();
+        for (int i = 0; i < nCount; ++i)
+            vShared.push_back(AnimationSetCache::Acquire(strPath));
+        const double fSharedMs = ElapsedMs(t0);
+        const AnimationSetCache::Stats s1 = AnimationSetCache::GetStats();
+
+        const size_t nParses = s1.nMisses - s0.nMisses;
+        bool bSameSet = vShared[0] != nullptr;
+        for (const auto& pSet : vShared)
+            bSameSet &= pSet == vShared[0];
+
+        printf("[AnimCacheBench] %-55s x%3d: per-instance %3d parses %8.2f ms %8.1f KB | cache %zu parse %7.2f ms %7.1f KB (%zu hits)\n",
+               strPath.c_str(), nCount, nCount, fOwnedMs, nOwnedBytes / 1024.0,
+               nParses, fSharedMs, s1.nResidentBytes / 1024.0, s1.nHits - s0.nHits);
+
+        bOk &= Check(nParses == 1, "the cache parses each file once");
+        bOk &= Check(s1.nHits - s0.nHits == static_cast<size_t>(nCount - 1), "every later spawn is a hit");
+        bOk &= Check(bSameSet, "all spawns share one set");
+
+        vShared.clear();
+        bOk &= Check(AnimationSetCache::ReleaseUnused() == 1 && AnimationSetCache::GetStats().nSets == 0,
+                     "the set is released once no spawn holds it");
+        return bOk;
+    }
+}
+
+int main()
+{
+    bool bOk = true;
+    int nTypes = 0;
+    for (const char* pstrPath : kEnemyAnimations)
+    {
+        if (!std::filesystem::exists(pstrPath))
+            continue;
+        nTypes++;
+        for (int nCount : kSpawnCounts)
+            bOk = RunSpawn(pstrPath, nCount) && bOk;
+    }
+    if (nTypes == 0)
+    {
+        fprintf(stderr, "[AnimCacheBench] no enemy *_Anim.bin under Assets (run from gaym/)\n");
+        return 1;
+    }
+    return bOk ? 0 : 1;
+}
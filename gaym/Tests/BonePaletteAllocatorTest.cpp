@@ -0,0 +1,193 @@
+#include "BonePaletteAllocator.h"
+#include "JsonDoc.h"
+#include <cstdio>
+#include <random>
+#include <vector>
+
+// BonePaletteAllocator 단위 테스트
+//  1) 정해진 순서: First-fit, 앞/뒤/양쪽 합치기, 부족하면 InvalidOffset → Grow 뒤 성공, Reset
+//  2) 무작위 Allocate/Free 20 만 번: 행렬 단위 소유 표로 겹침이 없는지, 통계가 실제와 같은지,
+//     전부 돌려준 뒤 빈 구간이 하나로 합쳐지는지
+//  3) 방 하나 (room_Room3.json 의 맵 오브젝트 + 적 스폰) 의 오브젝트 상수 업로드 바이트 — 이전 / 이후
+// 3) 은 에셋 경로가 상대 경로라 gaym/ 에서 실행
+namespace
+{
+    bool Check(bool condition, const char* what)
+    {
+        if (!condition)
+            fprintf(stderr, "[BonePalette] FAILED: %s\n", what);
+        return condition;
+    }
+
+    bool TestFixedSequence()
+    {
+        bool bOk = true;
+        BonePaletteAllocator allocator(100);
+
+        const uint32_t a = allocator.Allocate(30);
+        const uint32_t b = allocator.Allocate(20);
+        const uint32_t c = allocator.Allocate(40);
+        bOk &= Check(a == 0 && b == 30 && c == 50, "ranges are handed out front to back");
+        bOk &= Check(allocator.Allocate(0) == BonePaletteAllocator::InvalidOffset, "zero-sized allocation is rejected");
+        bOk &= Check(allocator.Allocate(11) == BonePaletteAllocator::InvalidOffset, "allocation larger than the free tail fails");
+
+        BonePaletteStats stats = allocator.GetStats();
+        bOk &= Check(stats.used == 90 && stats.allocations == 3 && stats.largestFree == 10, "stats after three allocations");
+
+        // b 를 풀면 20 짜리 구멍 — First-fit 이라 15 는 구멍 앞에 들어간다
+        allocator.Free(b, 20);
+        const uint32_t d = allocator.Allocate(15);
+        bOk &= Check(d == 30, "first fit reuses the earliest hole");
+        allocator.Free(d, 15);
+
+        // a 와 b 구멍이 앞뒤로 붙는다
+        allocator.Free(a, 30);
+        stats = allocator.GetStats();
+        bOk &= Check(stats.largestFree == 50 && stats.allocations == 1, "freeing next to a hole merges forward");
+
+        // c 를 풀면 앞 구멍 (0~50) 과 뒤 꼬리 (90~100) 양쪽과 합쳐진다
+        allocator.Free(c, 40);
+        stats = allocator.GetStats();
+        bOk &= Check(stats.used == 0 && stats.allocations == 0 && stats.largestFree == 100, "freeing between two holes merges both");
+        bOk &= Check(stats.peakUsed == 90, "peak usage is kept");
+
+        // 꽉 찬 상태에서 Grow: 새 구간이 생기고, 끝이 비어 있으면 그 구간을 늘린다
+        const uint32_t e = allocator.Allocate(100);
+        bOk &= Check(e == 0 && allocator.Allocate(1) == BonePaletteAllocator::InvalidOffset, "full allocator rejects more");
+        allocator.Grow(150);
+        const uint32_t f = allocator.Allocate(20);
+        bOk &= Check(f == 100, "grow appends a free range at the old end");
+        allocator.Grow(200);
+        bOk &= Check(allocator.GetStats().largestFree == 80, "grow extends a trailing free range");
+        allocator.Grow(120);
+        bOk &= Check(allocator.GetCapacity() == 200, "grow never shrinks");
+
+        allocator.Reset();
+        stats = allocator.GetStats();
+        bOk &= Check(stats.capacity == 200 && stats.used == 0 && stats.allocations == 0 && stats.peakUsed == 0
+                     && stats.largestFree == 200, "reset keeps capacity and clears the rest");
+        return bOk;
+    }
+
+    bool TestRandom()
+    {
+        struct Range { uint32_t nOffset, nCount; };
+
+        BonePaletteAllocator allocator(4096);
+        std::mt19937 rng(1);
+        std::vector<Range> vLive;
+        std::vector<uint8_t> vOwned(4096, 0);
+        uint32_t nGrows = 0, nLiveMatrices = 0;
+
+        for (int nStep = 0; nStep < 200000; ++nStep)
+        {
+            if (vLive.empty() || (vLive.size() < 3000 && rng() % 2))
+            {
+                // 스킨드 메쉬 본 수 정도 (1~80)
+                const uint32_t nCount = 1 + rng() % 80;
+                uint32_t nOffset = allocator.Allocate(nCount);
+                if (nOffset == BonePaletteAllocator::InvalidOffset)
+                {
+                    // BonePalette 처럼 두 배로
+                    allocator.Grow(allocator.GetCapacity() * 2);
+                    vOwned.resize(allocator.GetCapacity(), 0);
+                    nGrows++;
+                    nOffset = allocator.Allocate(nCount);
+                }
+                if (!Check(nOffset != BonePaletteAllocator::InvalidOffset, "allocation succeeds after Grow"))
+                    return false;
+                if (!Check(nOffset + nCount <= allocator.GetCapacity(), "range stays inside the capacity"))
+                    return false;
+
+                for (uint32_t i = nOffset; i < nOffset + nCount; ++i)
+                {
+                    if (vOwned[i])
+                    {
+                        fprintf(stderr, "[BonePalette] FAILED: step %d: matrix %u handed out twice\n", nStep, i);
+                        return false;
+                    }
+                    vOwned[i] = 1;
+                }
+                vLive.push_back({ nOffset, nCount });
+                nLiveMatrices += nCount;
+            }
+            else
+            {
+                const size_t k = rng() % vLive.size();
+                const Range range = vLive[k];
+                vLive[k] = vLive.back();
+                vLive.pop_back();
+                for (uint32_t i = range.nOffset; i < range.nOffset + range.nCount; ++i)
+                    vOwned[i] = 0;
+                allocator.Free(range.nOffset, range.nCount);
+                nLiveMatrices -= range.nCount;
+            }
+
+            if (nStep % 1000 == 0)
+            {
+                const BonePaletteStats stats = allocator.GetStats();
+                if (!Check(stats.used == nLiveMatrices && stats.allocations == vLive.size(), "stats match the live ranges"))
+                    return false;
+            }
+        }
+
+        const BonePaletteStats busy = allocator.GetStats();
+        for (const Range& range : vLive)
+            allocator.Free(range.nOffset, range.nCount);
+        const BonePaletteStats stats = allocator.GetStats();
+
+        printf("[BonePalette] 200000 random ops: %u grows, capacity %u, peak %u (%.0f%%), live at end %u in %u ranges\n",
+               nGrows, stats.capacity, stats.peakUsed, 100.0 * stats.peakUsed / stats.capacity, busy.used, busy.allocations);
+        return Check(stats.used == 0 && stats.allocations == 0 && stats.largestFree == stats.capacity,
+                     "everything coalesces back into one free range");
+    }
+
+    // GameObject.h 의 ObjectConstants (HLSL 패킹과 같음): World(64) + 플래그 8 개(32) + MATERIAL(64)
+    constexpr uint32_t kMatrixBytes = 64;
+    constexpr uint32_t kObjectConstantsBytes = kMatrixBytes + 32 + 64 + 4;           // + m_nBoneOffset
+    constexpr uint32_t kOldObjectConstantsBytes = kMatrixBytes + 32 + 64 + 128 * kMatrixBytes;
+    constexpr uint32_t kBonesPerEnemy = 48;   // 적 스켈레톤 한 벌 정도
+
+    bool ReportRoom(const char* pstrRoomPath)
+    {
+        JsonDoc doc;
+        if (!Check(doc.parseFile(pstrRoomPath), "room json loads (run from gaym/)"))
+            return false;
+
+        const uint32_t nMapObjects = static_cast<uint32_t>(doc.root()["mapObjects"].size());
+        uint32_t nEnemies = 0;
+        const JsonVal& spawns = doc.root()["enemySpawns"];
+        for (size_t i = 0; i < spawns.size(); ++i)
+            nEnemies += static_cast<uint32_t>(spawns[i]["count"].i());
+
+        // 스킨드 메쉬마다 실제 본 수만큼 팔레트 구간
+        BonePaletteAllocator allocator(256);
+        for (uint32_t i = 0; i < nEnemies; ++i)
+        {
+            if (allocator.Allocate(kBonesPerEnemy) == BonePaletteAllocator::InvalidOffset)
+            {
+                allocator.Grow(allocator.GetCapacity() * 2);
+                allocator.Allocate(kBonesPerEnemy);
+            }
+        }
+        const BonePaletteStats palette = allocator.GetStats();
+
+        // 오브젝트마다 매 갱신 상수 버퍼 전체를 복사. 이후에는 본 행렬이 팔레트로 따로 올라간다
+        const uint64_t nObjects = nMapObjects + nEnemies;
+        const uint64_t nBefore = nObjects * kOldObjectConstantsBytes;
+        const uint64_t nAfter = nObjects * kObjectConstantsBytes + uint64_t(palette.used) * kMatrixBytes;
+        printf("[BonePalette] %s: %u map objects + %u enemies, upload per frame %.1f KB -> %.1f KB "
+               "(constants %u -> %u B, palette %u matrices)\n",
+               pstrRoomPath, nMapObjects, nEnemies, nBefore / 1024.0, nAfter / 1024.0,
+               kOldObjectConstantsBytes, kObjectConstantsBytes, palette.used);
+        return Check(nEnemies > 0 && palette.used == nEnemies * kBonesPerEnemy, "every enemy gets its palette range");
+    }
+}
+
+int main()
+{
+    bool bOk = TestFixedSequence();
+    bOk = TestRandom() && bOk;
+    bOk = ReportRoom("Assets/MapData/room_Room3.json") && bOk;
+    return bOk ? 0 : 1;
+}
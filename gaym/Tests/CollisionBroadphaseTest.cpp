@@ -0,0 +1,283 @@
+#include "CollisionBroadphase.h"
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <set>
+#include <unordered_set>
+#include <vector>
+
+// CollisionBroadphase 로 걸러낸 후보 쌍과 전체 쌍 (i < j) 검사가 같은 Enter/Stay/Exit 열을 내는지 비교한다.
+// CollisionManager::Update 와 같은 규칙: 후보를 (i, j) 순으로 좁은 판정 → 지난 프레임 집합과 비교해 Exit.
+// 좁은 판정은 축 정렬 상자 겹침 (OBB 회전 없음 = AABB 그대로) 이라 D3D 없이 돈다.
+namespace
+{
+    struct Collider
+    {
+        uint32_t id = 0;
+        bool bEnabled = true;
+        CollisionLayer layer = CollisionLayer::None;
+        CollisionLayer mask = CollisionLayer::All;
+        float center[3] = {};
+        float extents[3] = {};
+        float velocity[3] = {};
+    };
+
+    enum class EventType : uint8_t { Enter, Stay, Exit };
+
+    struct Event
+    {
+        EventType type;
+        uint32_t id1, id2;
+        bool operator==(const Event& o) const { return type == o.type && id1 == o.id1 && id2 == o.id2; }
+    };
+
+    using PairSet = std::set<std::pair<uint32_t, uint32_t>>;
+
+    bool Overlaps(const Collider& a, const Collider& b)
+    {
+        for (int axis = 0; axis < 3; ++axis)
+        {
+            if (fabsf(a.center[axis] - b.center[axis]) > a.extents[axis] + b.extents[axis])
+                return false;
+        }
+        return true;
+    }
+
+    bool ShouldCollide(const Collider& a, const Collider& b)
+    {
+        return HasLayer(a.mask, b.layer) && HasLayer(b.mask, a.layer);
+    }
+
+    // CollisionManager::CheckCollision 과 같은 판정 + 이벤트 기록
+    void CheckPair(const Collider& a, const Collider& b, const PairSet& previous, PairSet& current,
+                   std::vector<Event>& outEvents)
+    {
+        if (!a.bEnabled || !b.bEnabled || !ShouldCollide(a, b) || !Overlaps(a, b))
+            return;
+
+        const std::pair<uint32_t, uint32_t> pair(std::min(a.id, b.id), std::max(a.id, b.id));
+        current.insert(pair);
+        const EventType type = previous.count(pair) ? EventType::Stay : EventType::Enter;
+        outEvents.push_back({ type, pair.first, pair.second });
+    }
+
+    void EmitExits(const std::vector<Collider>& colliders, const PairSet& previous, const PairSet& current,
+                   std::vector<Event>& outEvents)
+    {
+        std::set<uint32_t> present;
+        for (const Collider& c : colliders)
+            present.insert(c.id);
+
+        for (const auto& pair : previous)
+        {
+            if (!current.count(pair) && present.count(pair.first) && present.count(pair.second))
+                outEvents.push_back({ EventType::Exit, pair.first, pair.second });
+        }
+    }
+
+    // 기준: 전체 쌍
+    class BruteForce
+    {
+    public:
+        void Update(const std::vector<Collider>& colliders, std::vector<Event>& outEvents)
+        {
+            m_previous = std::move(m_current);
+            m_current.clear();
+            for (size_t i = 0; i < colliders.size(); ++i)
+                for (size_t j = i + 1; j < colliders.size(); ++j)
+                    CheckPair(colliders[i], colliders[j], m_previous, m_current, outEvents);
+            EmitExits(colliders, m_previous, m_current, outEvents);
+        }
+
+    private:
+        PairSet m_previous, m_current;
+    };
+
+    // CollisionManager 와 같은 흐름 (프록시는 매 프레임 제출, 경계는 처음 활성일 때와 움직였을 때만 갱신)
+    class Broadphase
+    {
+    public:
+        void Update(const std::vector<Collider>& colliders, const std::vector<bool>& vMoved,
+                    std::vector<Event>& outEvents)
+        {
+            m_previous = std::move(m_current);
+            m_current.clear();
+
+            m_broadphase.BeginFrame();
+            for (uint32_t i = 0; i < static_cast<uint32_t>(colliders.size()); ++i)
+            {
+                const Collider& c = colliders[i];
+                bool bNew = false;
+                const uint32_t slot = m_broadphase.Submit(c.id, i, c.bEnabled, c.layer, c.mask, bNew);
+                if (slot == CollisionBroadphase::InvalidSlot || !c.bEnabled)
+                    continue;
+                // ProxyCache::bHasBounds 와 같음: 비활성으로 생긴 프록시는 처음 활성화될 때 경계를 만든다
+                if (m_bounded.insert(c.id).second || vMoved[i])
+                    m_broadphase.SetBounds(slot, c.center, c.extents);
+            }
+            m_broadphase.EndFrame();
+
+            m_broadphase.FindCandidatePairs(m_candidates);
+            m_nCandidates += m_candidates.size();
+            for (const auto& candidate : m_candidates)
+                CheckPair(colliders[candidate.first], colliders[candidate.second], m_previous, m_current, outEvents);
+            EmitExits(colliders, m_previous, m_current, outEvents);
+        }
+
+        uint64_t GetCandidateCount() const { return m_nCandidates; }
+
+    private:
+        CollisionBroadphase m_broadphase;
+        std::vector<std::pair<uint32_t, uint32_t>> m_candidates;
+        std::unordered_set<uint32_t> m_bounded;   // ID 는 재사용되지 않으므로 지우지 않는다
+        PairSet m_previous, m_current;
+        uint64_t m_nCandidates = 0;
+    };
+
+    struct LayerSpec
+    {
+        CollisionLayer layer;
+        CollisionLayer mask;
+        float fExtent;
+        float fSpeed;
+    };
+
+    // 보스 방 구성을 흉내: 적/탄/벽/파편(적 탄)/트리거
+    const LayerSpec kSpecs[] =
+    {
+        { CollisionLayer::Player,       CollisionMask::Player,       0.5f, 6.0f },
+        { CollisionLayer::Enemy,        CollisionMask::Enemy,        0.8f, 4.0f },
+        { CollisionLayer::Enemy,        CollisionMask::Enemy,        0.8f, 4.0f },
+        { CollisionLayer::PlayerBullet, CollisionMask::PlayerBullet, 0.2f, 30.0f },
+        { CollisionLayer::EnemyBullet,  CollisionMask::EnemyBullet,  0.3f, 15.0f },
+        { CollisionLayer::EnemyBullet,  CollisionMask::EnemyBullet,  0.3f, 15.0f },
+        { CollisionLayer::Wall,         CollisionMask::Wall,         2.0f, 0.0f },
+        { CollisionLayer::Pickup,       CollisionMask::Pickup,       0.4f, 0.0f },
+        { CollisionLayer::Trigger,      CollisionMask::Trigger,      3.0f, 0.0f },
+    };
+
+    class Scenario
+    {
+    public:
+        Scenario(int nColliders, float fArenaHalf, uint32_t nSeed)
+            : m_rng(nSeed), m_fArenaHalf(fArenaHalf)
+        {
+            for (int i = 0; i < nColliders; ++i)
+                m_vColliders.push_back(Spawn());
+        }
+
+        // 이동 + 일부 비활성 토글 + 일부 제거/생성 (ID 재사용 없음)
+        void Step(float dt)
+        {
+            std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+            m_vMoved.assign(m_vColliders.size(), false);
+
+            for (size_t i = 0; i < m_vColliders.size(); ++i)
+            {
+                Collider& c = m_vColliders[i];
+                if (unit(m_rng) < 0.01f)
+                {
+                    c = Spawn();   // 새 ID → 기존 프록시는 축출, 새 프록시 생성
+                    m_vMoved[i] = true;
+                    continue;
+                }
+                if (unit(m_rng) < 0.02f)
+                    c.bEnabled = !c.bEnabled;
+
+                bool bMoved = false;
+                for (int axis = 0; axis < 3; axis += 2)
+                {
+                    if (c.velocity[axis] == 0.0f)
+                        continue;
+                    c.center[axis] += c.velocity[axis] * dt;
+                    if (fabsf(c.center[axis]) > m_fArenaHalf)
+                        c.velocity[axis] = -c.velocity[axis];
+                    bMoved = true;
+                }
+                m_vMoved[i] = bMoved;
+            }
+        }
+
+        const std::vector<Collider>& GetColliders() const { return m_vColliders; }
+        const std::vector<bool>& GetMoved() const { return m_vMoved; }
+
+    private:
+        Collider Spawn()
+        {
+            std::uniform_real_distribution<float> pos(-m_fArenaHalf, m_fArenaHalf);
+            std::uniform_real_distribution<float> dir(-1.0f, 1.0f);
+            std::uniform_int_distribution<size_t> pick(0, sizeof(kSpecs) / sizeof(kSpecs[0]) - 1);
+
+            const LayerSpec& spec = kSpecs[pick(m_rng)];
+            Collider c;
+            c.id = m_nNextID++;
+            c.layer = spec.layer;
+            c.mask = spec.mask;
+            c.center[0] = pos(m_rng);
+            c.center[1] = 1.0f;
+            c.center[2] = pos(m_rng);
+            for (float& e : c.extents)
+                e = spec.fExtent;
+            c.velocity[0] = dir(m_rng) * spec.fSpeed;
+            c.velocity[2] = dir(m_rng) * spec.fSpeed;
+            return c;
+        }
+
+        std::mt19937 m_rng;
+        float m_fArenaHalf;
+        uint32_t m_nNextID = 1;
+        std::vector<Collider> m_vColliders;
+        std::vector<bool> m_vMoved;
+    };
+
+    // 같은 장면을 두 방식으로 돌려 이벤트 열이 완전히 같은지 확인
+    bool RunCase(int nColliders, float fArenaHalf, int nFrames)
+    {
+        Scenario scenario(nColliders, fArenaHalf, 1234u + nColliders);
+        BruteForce brute;
+        Broadphase broad;
+        std::vector<Event> bruteEvents, broadEvents;
+        double fBruteMs = 0.0, fBroadMs = 0.0;
+        uint64_t nEvents = 0;
+
+        for (int frame = 0; frame < nFrames; ++frame)
+        {
+            scenario.Step(1.0f / 60.0f);
+            bruteEvents.clear();
+            broadEvents.clear();
+
+            auto t0 = std::chrono::steady_clock::now();
+            brute.Update(scenario.GetColliders(), bruteEvents);
+            auto t1 = std::chrono::steady_clock::now();
+            broad.Update(scenario.GetColliders(), scenario.GetMoved(), broadEvents);
+            auto t2 = std::chrono::steady_clock::now();
+            fBruteMs += std::chrono::duration<double, std::milli>(t1 - t0).count();
+            fBroadMs += std::chrono::duration<double, std::milli>(t2 - t1).count();
+
+            if (bruteEvents != broadEvents)
+            {
+                fprintf(stderr, "[Broadphase] %d colliders: event stream differs at frame %d (%zu vs %zu events)\n",
+                        nColliders, frame, bruteEvents.size(), broadEvents.size());
+                return false;
+            }
+            nEvents += bruteEvents.size();
+        }
+
+        const double fAllPairs = 0.5 * nColliders * (nColliders - 1);
+        printf("[Broadphase] %5d colliders x %d frames: %llu events identical, "
+               "candidates %.1f/frame (all pairs %.0f), all-pairs %.3f ms/frame, SAP %.3f ms/frame\n",
+               nColliders, nFrames, static_cast<unsigned long long>(nEvents),
+               static_cast<double>(broad.GetCandidateCount()) / nFrames, fAllPairs,
+               fBruteMs / nFrames, fBroadMs / nFrames);
+        return nEvents > 0;
+    }
+}
+
+int main()
+{
+    // 1x 와 10x (같은 밀도가 되도록 경기장 넓이도 10 배)
+    bool bOk = RunCase(120, 20.0f, 600);
+    bOk = RunCase(1200, 20.0f * sqrtf(10.0f), 600) && bOk;
+    return bOk ? 0 : 1;
+}
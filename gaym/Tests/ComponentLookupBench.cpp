@@ -0,0 +1,191 @@
+#include "Component.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <memory>
+#include <random>
+#include <utility>
+#include <vector>
+
+// GameObject.inl 의 GetComponent / AddComponent 를 디바이스 없는 최소 GameObject 로 그대로 빌드해서
+//  1) AddComponent 없이 조회만 한 타입 (ID 가 MAX_COMPONENT_TYPES 를 넘는 것 포함) 은 nullptr
+//  2) ComponentRegistry: 무작위 삭제 뒤에도 ForEach 가 살아 있는 컴포넌트를 한 번씩만 돌고 Count 가 맞다
+//  3) 오브젝트 5k (컴포넌트 4 ~ 5 개, 조회 타입은 1/4 만 가짐): 예전 dynamic_cast 순회 대 슬롯 조회 대 ForEach
+class TransformComponent;
+
+// 렌더/디바이스 멤버를 뺀 GameObject (컴포넌트 관련 멤버와 템플릿 선언은 GameObject.h 와 같다)
+class GameObject
+{
+public:
+    template<typename T>
+    T* GetComponent();
+
+    template<typename T, typename... TArgs>
+    T* AddComponent(TArgs&&... args);
+
+    // user-009 이전의 GetComponent
+    template<typename T>
+    T* GetComponentByCast()
+    {
+        for (const auto& component : m_vComponents)
+        {
+            if (T* pComponent = dynamic_cast<T*>(component.get()))
+                return pComponent;
+        }
+        return nullptr;
+    }
+
+private:
+    std::vector<std::unique_ptr<Component>> m_vComponents;
+    Component* m_pComponentSlots[MAX_COMPONENT_TYPES] = {};
+    TransformComponent* m_pTransform = nullptr;
+};
+
+#include "GameObject.inl"
+
+namespace
+{
+    constexpr int kObjectCount = 5000;
+    constexpr int kRounds = 200;
+
+    template<int N>
+    class DummyComponent : public Component
+    {
+    public:
+        DummyComponent(GameObject* pOwner) : Component(pOwner) {}
+        int m_nValue = N;
+    };
+
+    // 게임의 컴포넌트 구성 흉내: 모두 Transform/Render, 대부분 Collider, 일부 Animation, 1/4 만 Enemy
+    using Transform = DummyComponent<0>;
+    using Render = DummyComponent<1>;
+    using Collider = DummyComponent<2>;
+    using Animation = DummyComponent<3>;
+    using Interactable = DummyComponent<4>;
+    using Enemy = DummyComponent<5>;
+
+    bool Check(bool condition, const char* what)
+    {
+        if (!condition)
+            fprintf(stderr, "[ComponentBench] FAILED: %s\n", what);
+        return condition;
+    }
+
+    double ElapsedMs(std::chrono::steady_clock::time_point t0)
+    {
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t0).count();
+    }
+
+    template<int... Ns>
+    void TouchIds(std::integer_sequence<int, Ns...>)
+    {
+        (ComponentTypeIds::Get<DummyComponent<100 + Ns>>(), ...);
+    }
+
+    bool TestUnslottedTypes()
+    {
+        GameObject object;
+        object.AddComponent<Transform>();
+
+        // 조회만 해도 ID 가 하나씩 부여되므로 40 개를 건드리면 슬롯 범위를 넘는다
+        TouchIds(std::make_integer_sequence<int, 40>());
+        const ComponentTypeId lastId = ComponentTypeIds::Get<DummyComponent<139>>();
+
+        bool bOk = Check(lastId >= MAX_COMPONENT_TYPES, "the probe type lands past the slot table");
+        bOk &= Check(object.GetComponent<DummyComponent<139>>() == nullptr, "a type past the slot table is never found");
+        bOk &= Check(object.GetComponent<DummyComponent<100>>() == nullptr, "a type that was never added is not found");
+        bOk &= Check(object.GetComponent<Transform>() != nullptr, "an added type is found");
+        printf("[ComponentBench] lookup of type id %u (slots %u): %s\n", lastId, MAX_COMPONENT_TYPES,
+               bOk ? "nullptr" : "out of range");
+        return bOk;
+    }
+
+    bool TestRegistry()
+    {
+        std::mt19937 rng(5);
+        std::vector<std::unique_ptr<GameObject>> vObjects(2000);
+        for (auto& pObject : vObjects)
+        {
+            pObject = std::make_unique<GameObject>();
+            pObject->AddComponent<Render>();
+            if (rng() % 2)
+                pObject->AddComponent<Enemy>();
+        }
+
+        // 무작위로 절반 삭제 (swap-remove 가 다른 칸을 옮긴다)
+        std::shuffle(vObjects.begin(), vObjects.end(), rng);
+        vObjects.resize(vObjects.size() / 2);
+
+        size_t nExpected = 0;
+        for (auto& pObject : vObjects)
+            nExpected += pObject->GetComponent<Enemy>() ? 1 : 0;
+
+        size_t nVisited = 0;
+        bool bOwned = true;
+        ComponentRegistry::ForEach<Enemy>([&](Enemy* pEnemy)
+        {
+            nVisited++;
+            bOwned &= pEnemy->GetOwner()->GetComponent<Enemy>() == pEnemy;
+        });
+
+        bool bOk = Check(ComponentRegistry::Count<Enemy>() == nExpected, "Count matches the live components");
+        bOk &= Check(nVisited == nExpected && bOwned, "ForEach visits each live component once");
+
+        vObjects.clear();
+        bOk &= Check(ComponentRegistry::Count<Enemy>() == 0 && ComponentRegistry::Count<Render>() == 0,
+                     "destroyed components leave the registry");
+        return bOk;
+    }
+
+    void BenchLookups()
+    {
+        std::mt19937 rng(9);
+        std::vector<std::unique_ptr<GameObject>> vObjects(kObjectCount);
+        for (int i = 0; i < kObjectCount; ++i)
+        {
+            auto& pObject = vObjects[i];
+            pObject = std::make_unique<GameObject>();
+            pObject->AddComponent<Transform>();
+            pObject->AddComponent<Render>();
+            pObject->AddComponent<Collider>();
+            if (rng() % 2)
+                pObject->AddComponent<Animation>();
+            if (i % 4 == 0)
+                pObject->AddComponent<Enemy>();
+            else
+                pObject->AddComponent<Interactable>();
+        }
+
+        // 결과가 버려지지 않도록 값을 더한다
+        long long nSum = 0;
+        auto t0 = std::chrono::steady_clock::now();
+        for (int r = 0; r < kRounds; ++r)
+            for (auto& pObject : vObjects)
+                if (Enemy* pEnemy = pObject->GetComponentByCast<Enemy>())
+                    nSum += pEnemy->m_nValue;
+        const double fCastMs = ElapsedMs(t0) / kRounds;
+
+        t0 = std::chrono::steady_clock::now();
+        for (int r = 0; r < kRounds; ++r)
+            for (auto& pObject : vObjects)
+                if (Enemy* pEnemy = pObject->GetComponent<Enemy>())
+                    nSum += pEnemy->m_nValue;
+        const double fSlotMs = ElapsedMs(t0) / kRounds;
+
+        t0 = std::chrono::steady_clock::now();
+        for (int r = 0; r < kRounds; ++r)
+            ComponentRegistry::ForEach<Enemy>([&](Enemy* pEnemy) { nSum += pEnemy->m_nValue; });
+        const double fForEachMs = ElapsedMs(t0) / kRounds;
+
+        printf("[ComponentBench] %d objects, 1/4 with the queried type: dynamic_cast scan %.4f ms, slot lookup %.4f ms, ForEach %.4f ms (checksum %lld)\n",
+               kObjectCount, fCastMs, fSlotMs, fForEachMs, nSum);
+    }
+}
+
+int main()
+{
+    bool bOk = TestRegistry();
+    BenchLookups();
+    bOk = TestUnslottedTypes() && bOk;
+    return bOk ? 0 : 1;
+}
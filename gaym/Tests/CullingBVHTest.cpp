@@ -0,0 +1,245 @@
+#include "CullingBVH.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <random>
+
+// VisibilityCuller (정적 BVH + 동적 AABB 트리) 를 전체 박스 검사와 비교한다.
+// 아이템 20k, 5% 는 처음부터 움직이고 가끔 정적 아이템도 움직이기 시작한다 (동적 트리로 이동).
+// 프레임마다 몇 개를 AddItem / RemoveItem 으로 넣고 빼서 빈 번호 재사용까지 확인.
+// 카메라 원근 프러스텀과 그림자용 직교 프러스텀 모두 검사하고, 프레임당 질의 비용을 출력한다
+namespace
+{
+    constexpr int kItemCount = 20000;
+    constexpr int kFrameCount = 300;
+    constexpr float kWorldHalf = 400.0f;
+
+    void Multiply(const float a[16], const float b[16], float out[16])
+    {
+        for (int r = 0; r < 4; ++r)
+        {
+            for (int c = 0; c < 4; ++c)
+            {
+                float fSum = 0.0f;
+                for (int k = 0; k < 4; ++k)
+                    fSum += a[r * 4 + k] * b[k * 4 + c];
+                out[r * 4 + c] = fSum;
+            }
+        }
+    }
+
+    void Normalize(float v[3])
+    {
+        const float fLen = std::sqrt(v[0] * v[0] + v[1] * v[1] + v[2] * v[2]);
+        for (int i = 0; i < 3; ++i)
+            v[i] /= fLen;
+    }
+
+    void Cross(const float a[3], const float b[3], float out[3])
+    {
+        out[0] = a[1] * b[2] - a[2] * b[1];
+        out[1] = a[2] * b[0] - a[0] * b[2];
+        out[2] = a[0] * b[1] - a[1] * b[0];
+    }
+
+    // XMMatrixLookAtLH * XMMatrixPerspectiveFovLH (행 벡터 규약)
+    void BuildViewProj(const float eye[3], const float at[3], float fFovY, float fAspect, float fNear, float fFar, float out[16])
+    {
+        const float up[3] = { 0.0f, 1.0f, 0.0f };
+        float z[3] = { at[0] - eye[0], at[1] - eye[1], at[2] - eye[2] };
+        Normalize(z);
+        float x[3];
+        Cross(up, z, x);
+        Normalize(x);
+        float y[3];
+        Cross(z, x, y);
+
+        const float view[16] =
+        {
+            x[0], y[0], z[0], 0.0f,
+            x[1], y[1], z[1], 0.0f,
+            x[2], y[2], z[2], 0.0f,
+            -(x[0] * eye[0] + x[1] * eye[1] + x[2] * eye[2]),
+            -(y[0] * eye[0] + y[1] * eye[1] + y[2] * eye[2]),
+            -(z[0] * eye[0] + z[1] * eye[1] + z[2] * eye[2]), 1.0f,
+        };
+
+        const float h = 1.0f / std::tan(fFovY * 0.5f);
+        const float w = h / fAspect;
+        const float r = fFar / (fFar - fNear);
+        const float proj[16] =
+        {
+            w, 0.0f, 0.0f, 0.0f,
+            0.0f, h, 0.0f, 0.0f,
+            0.0f, 0.0f, r, 1.0f,
+            0.0f, 0.0f, -r * fNear, 0.0f,
+        };
+        Multiply(view, proj, out);
+    }
+
+    CullAABB RandomBox(std::mt19937& rng)
+    {
+        std::uniform_real_distribution<float> pos(-kWorldHalf, kWorldHalf);
+        std::uniform_real_distribution<float> extent(0.2f, 4.0f);
+        CullAABB box;
+        for (int axis = 0; axis < 3; ++axis)
+        {
+            float fCenter = pos(rng);
+            if (axis == 1)
+                fCenter = std::fabs(fCenter) * 0.1f;   // 바닥 근처
+            const float fExtent = extent(rng);
+            box.vMin[axis] = fCenter - fExtent;
+            box.vMax[axis] = fCenter + fExtent;
+        }
+        return box;
+    }
+
+    double ElapsedUs(std::chrono::steady_clock::time_point t0)
+    {
+        return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - t0).count();
+    }
+
+    // 살아 있는 아이템 전체 박스 검사
+    void BruteForce(const CullFrustum& frustum, const std::vector<CullAABB>& vBoxes, const std::vector<uint8_t>& vAlive,
+                    std::vector<int>& outItems)
+    {
+        outItems.clear();
+        for (int i = 0; i < static_cast<int>(vBoxes.size()); ++i)
+        {
+            if (vAlive[i] && frustum.TestAABB(vBoxes[i]))
+                outItems.push_back(i);
+        }
+    }
+
+    // 순서 없음, 중복 없음 → 정렬해서 그대로 비교
+    bool SameVisibleSet(std::vector<int>& vCulled, const std::vector<int>& vReference)
+    {
+        std::sort(vCulled.begin(), vCulled.end());
+        return std::adjacent_find(vCulled.begin(), vCulled.end()) == vCulled.end() && vCulled == vReference;
+    }
+}
+
+int main()
+{
+    std::mt19937 rng(11);
+    std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+
+    std::vector<CullAABB> vBoxes(kItemCount);
+    std::vector<uint8_t> vDynamic(kItemCount), vAlive(kItemCount, 1);
+    for (int i = 0; i < kItemCount; ++i)
+    {
+        vBoxes[i] = RandomBox(rng);
+        vDynamic[i] = (i % 20 == 0);
+    }
+
+    VisibilityCuller culler;
+    auto t0 = std::chrono::steady_clock::now();
+    culler.Build(vBoxes, vDynamic);
+    printf("[CullingBVH] build %d items: %.2f ms (%d dynamic)\n", kItemCount, ElapsedUs(t0) / 1000.0, culler.GetDynamicCount());
+
+    std::vector<int> vVisible, vReference;
+    double fQueryUs = 0.0, fBruteUs = 0.0, fMoveUs = 0.0;
+    size_t nVisibleSum = 0;
+    int nMismatches = 0, nAdded = 0, nRemoved = 0, nReused = 0;
+
+    for (int nFrame = 0; nFrame < kFrameCount; ++nFrame)
+    {
+        // 움직이는 것 + 가끔 정적 아이템이 움직이기 시작
+        t0 = std::chrono::steady_clock::now();
+        for (int i = 0; i < static_cast<int>(vBoxes.size()); ++i)
+        {
+            if (!vAlive[i] || !(vDynamic[i] || rng() % 2000 == 0))
+                continue;
+            vDynamic[i] = 1;
+            const float delta[3] = { unit(rng) * 0.5f, 0.0f, unit(rng) * 0.5f };
+            for (int axis = 0; axis < 3; ++axis)
+            {
+                vBoxes[i].vMin[axis] += delta[axis];
+                vBoxes[i].vMax[axis] += delta[axis];
+            }
+            culler.MoveItem(i, vBoxes[i]);
+        }
+        fMoveUs += ElapsedUs(t0);
+
+        // 생성/삭제 (탄, 파편). 지운 번호는 AddItem 이 다시 쓴다
+        for (int k = 0; k < 4; ++k)
+        {
+            const int nVictim = static_cast<int>(rng() % vBoxes.size());
+            if (vAlive[nVictim])
+            {
+                culler.RemoveItem(nVictim);
+                vAlive[nVictim] = 0;
+                nRemoved++;
+            }
+        }
+        for (int k = 0; k < 3; ++k)
+        {
+            const CullAABB box = RandomBox(rng);
+            const int nItem = culler.AddItem(box);
+            if (nItem < static_cast<int>(vBoxes.size()))
+            {
+                if (vAlive[nItem])
+                {
+                    fprintf(stderr, "[CullingBVH] AddItem returned live item %d\n", nItem);
+                    return 1;
+                }
+                nReused++;
+            }
+            else
+            {
+                vBoxes.resize(nItem + 1);
+                vAlive.resize(nItem + 1, 0);
+                vDynamic.resize(nItem + 1, 0);
+            }
+            vBoxes[nItem] = box;
+            vAlive[nItem] = 1;
+            vDynamic[nItem] = 1;
+            nAdded++;
+        }
+
+        const float eye[3] = { unit(rng) * 300.0f, 60.0f + unit(rng) * 30.0f, unit(rng) * 300.0f };
+        const float at[3] = { eye[0] + unit(rng) * 100.0f, 0.0f, eye[2] + unit(rng) * 100.0f };
+        float viewProj[16];
+        BuildViewProj(eye, at, 0.9f, 16.0f / 9.0f, 0.1f, 400.0f, viewProj);
+        const CullFrustum frustum = CullFrustum::FromViewProj(viewProj);
+
+        t0 = std::chrono::steady_clock::now();
+        culler.Query(frustum, vVisible);
+        fQueryUs += ElapsedUs(t0);
+
+        t0 = std::chrono::steady_clock::now();
+        BruteForce(frustum, vBoxes, vAlive, vReference);
+        fBruteUs += ElapsedUs(t0);
+
+        if (!SameVisibleSet(vVisible, vReference))
+        {
+            fprintf(stderr, "[CullingBVH] frame %d: %zu culled vs %zu brute force\n", nFrame, vVisible.size(), vReference.size());
+            nMismatches++;
+        }
+        nVisibleSum += vReference.size();
+    }
+
+    // 그림자 패스: 직교 프러스텀 (XMMatrixOrthographicLH 160 x 160, 0.1 ~ 150)
+    const float ortho[16] =
+    {
+        2.0f / 160.0f, 0.0f, 0.0f, 0.0f,
+        0.0f, 2.0f / 160.0f, 0.0f, 0.0f,
+        0.0f, 0.0f, 1.0f / 149.9f, 0.0f,
+        0.0f, 0.0f, -0.1f / 149.9f, 1.0f,
+    };
+    const CullFrustum light = CullFrustum::FromViewProj(ortho);
+    culler.Query(light, vVisible);
+    BruteForce(light, vBoxes, vAlive, vReference);
+    if (!SameVisibleSet(vVisible, vReference))
+    {
+        fprintf(stderr, "[CullingBVH] orthographic: %zu culled vs %zu brute force\n", vVisible.size(), vReference.size());
+        nMismatches++;
+    }
+
+    printf("[CullingBVH] %d frames: %d mismatches, avg %zu visible, %d dynamic, added %d (%d reused) removed %d\n",
+           kFrameCount, nMismatches, nVisibleSum / kFrameCount, culler.GetDynamicCount(), nAdded, nReused, nRemoved);
+    printf("[CullingBVH] per frame: tree query %.1f us, brute force %.1f us, mover updates %.1f us\n",
+           fQueryUs / kFrameCount, fBruteUs / kFrameCount, fMoveUs / kFrameCount);
+    return nMismatches == 0 && nReused > 0 ? 0 : 1;
+}
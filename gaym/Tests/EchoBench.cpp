@@ -0,0 +1,213 @@
+#include "pch.h"
+#include "Service.h"
+#include "ThreadManager.h"
+#include "SendBuffer.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <unistd.h>
+
+// 루프백 에코: ClientService 세션 N 개가 ServerService (Listener / PacketSession) 에 패킷을 보내고
+// 되돌아온 에코마다 하나씩 다시 보낸다 (세션당 kInFlight 개가 항상 왕복 중).
+// echo_bench <sessions> [packetBytes]
+//  - 1초 동안 왕복 수 / 처리량 (양방향 바이트) / 왕복 지연 p50 p99 max
+//  - 모든 세션이 연결되어 에코를 받았고, 끊기거나 깨진 패킷이 없어야 한다
+// 리눅스 epoll 빌드 전용 (서버/클라이언트 모두 같은 IocpCore 를 디스패치 스레드들이 돌린다)
+namespace
+{
+    constexpr uint16 kEchoId = 7;
+    constexpr int32 kInFlight = 4;
+    constexpr int32 kMaxLatencyUs = 100000;     // 히스토그램 1us 칸, 넘으면 마지막 칸
+
+    int32 GPacketSize = 64;
+    Atomic<bool> GStop = false;
+    Atomic<bool> GRecording = false;
+    Atomic<int32> GConnected = 0;
+    Atomic<int32> GDisconnected = 0;
+    Atomic<int32> GBadPackets = 0;
+    Atomic<int64> GEchoes = 0;
+    Atomic<uint64> GLatency[kMaxLatencyUs + 1] = {};
+
+    int64 NowNs()
+    {
+        return chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    class EchoServerSession : public PacketSession
+    {
+    protected:
+        virtual void OnRecvPacket(BYTE* buffer, int32 len) override
+        {
+            SendBufferRef sendBuffer = GSendBufferManager->Open(len);
+            ::memcpy(sendBuffer->Buffer(), buffer, len);
+            sendBuffer->Close(len);
+            Send(sendBuffer);
+        }
+    };
+
+    class EchoClientSession : public PacketSession
+    {
+    public:
+        int64 Echoes() const { return _echoes; }
+
+    protected:
+        virtual void OnConnected() override
+        {
+            GConnected.fetch_add(1);
+            for (int32 i = 0; i < kInFlight; ++i)
+                SendStamped();
+        }
+
+        virtual void OnDisconnected() override
+        {
+            GDisconnected.fetch_add(1);
+        }
+
+        virtual void OnRecvPacket(BYTE* buffer, int32 len) override
+        {
+            const PacketHeader* header = reinterpret_cast<const PacketHeader*>(buffer);
+            if (len != GPacketSize || header->id != kEchoId)
+            {
+                GBadPackets.fetch_add(1);
+                return;
+            }
+
+            int64 sentNs;
+            ::memcpy(&sentNs, buffer + sizeof(PacketHeader), sizeof(sentNs));
+            if (GRecording.load(memory_order_relaxed))
+            {
+                const int64 us = (NowNs() - sentNs) / 1000;
+                GLatency[std::min<int64>(std::max<int64>(us, 0), kMaxLatencyUs)].fetch_add(1, memory_order_relaxed);
+                GEchoes.fetch_add(1, memory_order_relaxed);
+            }
+            _echoes++;
+
+            if (GStop.load(memory_order_relaxed) == false)
+                SendStamped();
+        }
+
+    private:
+        void SendStamped()
+        {
+            SendBufferRef sendBuffer = GSendBufferManager->Open(GPacketSize);
+            PacketHeader* header = reinterpret_cast<PacketHeader*>(sendBuffer->Buffer());
+            header->size = static_cast<uint16>(GPacketSize);
+            header->id = kEchoId;
+            const int64 now = NowNs();
+            ::memcpy(sendBuffer->Buffer() + sizeof(PacketHeader), &now, sizeof(now));
+            sendBuffer->Close(GPacketSize);
+            Send(sendBuffer);
+        }
+
+        // 수신 처리는 세션당 한 스레드씩이라 원자적일 필요는 없다
+        int64 _echoes = 0;
+    };
+
+    int32 Percentile(const vector<uint64>& histogram, uint64 total, double fraction)
+    {
+        const uint64 target = static_cast<uint64>(total * fraction);
+        uint64 seen = 0;
+        for (int32 us = 0; us <= kMaxLatencyUs; ++us)
+        {
+            seen += histogram[us];
+            if (seen > target)
+                return us;
+        }
+        return kMaxLatencyUs;
+    }
+
+    bool Check(bool condition, const char* what)
+    {
+        if (!condition)
+            fprintf(stderr, "[EchoBench] FAILED: %s\n", what);
+        return condition;
+    }
+}
+
+int main(int argc, char** argv)
+{
+    const int32 sessionCount = argc > 1 ? ::atoi(argv[1]) : 0;
+    if (argc > 2)
+        GPacketSize = ::atoi(argv[2]);
+    if (sessionCount <= 0 || GPacketSize < static_cast<int32>(sizeof(PacketHeader) + sizeof(int64)) || GPacketSize > 0xFFFF)
+    {
+        fprintf(stderr, "usage: echo_bench <sessions> [packetBytes 12..65535]\n");
+        return 2;
+    }
+    const uint16 port = static_cast<uint16>(27900 + sessionCount % 1000);
+
+    auto core = MakeShared<IocpCore>();
+    auto server = MakeShared<ServerService>(NetAddress(L"127.0.0.1", port), core, MakeShared<EchoServerSession>, sessionCount);
+    ASSERT_CRASH(server->Start());
+
+    const int32 threadCount = std::max<int32>(2, static_cast<int32>(thread::hardware_concurrency()));
+    for (int32 i = 0; i < threadCount; ++i)
+        GThreadManager->Launch([&]() { while (!GStop) core->Dispatch(10); });
+
+    Vector<SessionRef> clients;
+    Mutex clientLock;
+    auto client = MakeShared<ClientService>(NetAddress(L"127.0.0.1", port), core, [&]()
+    {
+        auto session = MakeShared<EchoClientSession>();
+        LockGuard guard(clientLock);
+        clients.push_back(session);
+        return session;
+    }, sessionCount);
+    ASSERT_CRASH(client->Start());
+
+    const auto connectStart = chrono::steady_clock::now();
+    while (GConnected < sessionCount && chrono::steady_clock::now() - connectStart < chrono::seconds(5))
+        this_thread::sleep_for(chrono::milliseconds(10));
+
+    // 워밍업 뒤 1초 측정
+    this_thread::sleep_for(chrono::milliseconds(200));
+    GRecording = true;
+    const auto measureStart = chrono::steady_clock::now();
+    this_thread::sleep_for(chrono::seconds(1));
+    GRecording = false;
+    const double seconds = chrono::duration<double>(chrono::steady_clock::now() - measureStart).count();
+
+    vector<uint64> histogram(kMaxLatencyUs + 1);
+    uint64 total = 0;
+    for (int32 us = 0; us <= kMaxLatencyUs; ++us)
+    {
+        histogram[us] = GLatency[us].load();
+        total += histogram[us];
+    }
+    int32 maxUs = 0;
+    for (int32 us = kMaxLatencyUs; us >= 0; --us)
+    {
+        if (histogram[us] != 0)
+        {
+            maxUs = us;
+            break;
+        }
+    }
+
+    int32 silentSessions = 0;
+    {
+        LockGuard guard(clientLock);
+        for (const SessionRef& session : clients)
+            silentSessions += static_cast<EchoClientSession*>(session.get())->Echoes() == 0 ? 1 : 0;
+    }
+
+    const double echoesPerSec = GEchoes.load() / seconds;
+    printf("[EchoBench] %d sessions x %d in flight, %dB packets, %d threads: %.0f echoes/s, %.1f MB/s both ways, "
+           "rtt p50 %dus p99 %dus max %dus%s\n",
+           sessionCount, kInFlight, GPacketSize, threadCount, echoesPerSec,
+           echoesPerSec * GPacketSize * 2 / (1024.0 * 1024.0),
+           Percentile(histogram, total, 0.5), Percentile(histogram, total, 0.99), maxUs,
+           maxUs >= kMaxLatencyUs ? "+" : "");
+
+    bool bOk = Check(GConnected == sessionCount, "every client session connects");
+    bOk &= Check(total > 0 && silentSessions == 0, "every session gets echoes");
+    bOk &= Check(GDisconnected == 0, "no session disconnects");
+    bOk &= Check(GBadPackets == 0, "echoes come back intact");
+
+    // 서비스/스레드 정리 대신 바로 종료 (테스트 전용)
+    fflush(stdout);
+    fflush(stderr);
+    _exit(bOk ? 0 : 1);
+}
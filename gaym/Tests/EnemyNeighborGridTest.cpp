@@ -0,0 +1,269 @@
+#include "EnemyNeighborGrid.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+// EnemyNeighborGrid (분리 조향 이웃 질의) 검증
+//  1) Query 결과가 전체 순회와 같은 집합인지 (멀리 떨어진 적 하나로 셀을 키운 경우 포함)
+//  2) 분리 조향: 같은 상태에서 한 걸음 — 격자 후보로 더한 힘과 전체 순회의 차이가 반올림 수준인지,
+//     CRoom 처럼 이동 전에 만든 격자 + dt 여유로 프레임 내내 반경 안의 이웃을 놓치지 않는지
+//  3) 적 20 ~ 1000: 전체 순회 vs 격자 (Build 포함) 프레임당 비용
+namespace
+{
+    // EnemyComponent 기본값
+    constexpr float kSeparationRadius = 8.0f;
+    constexpr float kSeparationStrength = 14.0f;
+    constexpr float kMoveSpeed = 6.0f;
+    constexpr float kGridMargin = 2.0f;     // CRoom::kEnemyGridMargin
+    constexpr float kDt = 1.0f / 60.0f;
+
+    struct Enemy
+    {
+        float x, z;
+    };
+
+    bool Check(bool condition, const char* what)
+    {
+        if (!condition)
+            fprintf(stderr, "[NeighborGrid] FAILED: %s\n", what);
+        return condition;
+    }
+
+    double ElapsedUs(std::chrono::steady_clock::time_point t0)
+    {
+        return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - t0).count();
+    }
+
+    std::vector<Enemy> Scatter(int nCount, uint32_t nSeed)
+    {
+        // 아레나 방 스폰처럼 적 수에 맞춰 넓어지는 영역
+        std::mt19937 rng(nSeed);
+        const float fExtent = 4.0f * std::sqrt(static_cast<float>(nCount));
+        std::uniform_real_distribution<float> pos(-fExtent, fExtent);
+        std::vector<Enemy> vEnemies(nCount);
+        for (Enemy& enemy : vEnemies)
+            enemy = { pos(rng), pos(rng) };
+        return vEnemies;
+    }
+
+    void BuildGrid(EnemyNeighborGrid& grid, const std::vector<Enemy>& vEnemies, std::vector<float>& vX, std::vector<float>& vZ)
+    {
+        vX.resize(vEnemies.size());
+        vZ.resize(vEnemies.size());
+        for (size_t i = 0; i < vEnemies.size(); ++i)
+        {
+            vX[i] = vEnemies[i].x;
+            vZ[i] = vEnemies[i].z;
+        }
+        grid.Build(vX.data(), vZ.data(), static_cast<int>(vEnemies.size()));
+    }
+
+    // EnemyComponent::MoveTowardsTarget 의 분리 힘. pCandidates 가 없으면 예전처럼 전체 순회
+    void SeparationForce(const std::vector<Enemy>& vEnemies, int nSelf, const std::vector<int>* pCandidates,
+                         float& outX, float& outZ)
+    {
+        const Enemy& me = vEnemies[nSelf];
+        outX = outZ = 0.0f;
+        auto accumulate = [&](int nOther)
+        {
+            if (nOther == nSelf)
+                return;
+            const float dx = me.x - vEnemies[nOther].x, dz = me.z - vEnemies[nOther].z;
+            const float d = std::sqrt(dx * dx + dz * dz);
+            if (d > 0.001f && d < kSeparationRadius)
+            {
+                const float strength = (kSeparationRadius - d) / kSeparationRadius;
+                outX += dx / d * strength;
+                outZ += dz / d * strength;
+            }
+        };
+
+        if (pCandidates)
+        {
+            for (int nOther : *pCandidates)
+                accumulate(nOther);
+        }
+        else
+        {
+            for (int nOther = 0; nOther < static_cast<int>(vEnemies.size()); ++nOther)
+                accumulate(nOther);
+        }
+    }
+
+    // 원점 (플레이어) 을 향해 추적 + 분리
+    void Step(std::vector<Enemy>& vEnemies, int i, float sepX, float sepZ, float dt)
+    {
+        Enemy& me = vEnemies[i];
+        const float fDist = std::sqrt(me.x * me.x + me.z * me.z);
+        const float dirX = fDist > 0.0f ? -me.x / fDist : 0.0f;
+        const float dirZ = fDist > 0.0f ? -me.z / fDist : 0.0f;
+        me.x += (dirX * kMoveSpeed + sepX * kSeparationStrength) * dt;
+        me.z += (dirZ * kMoveSpeed + sepZ * kSeparationStrength) * dt;
+    }
+
+    // CRoom::QueryEnemiesInRadius2D 와 같음: 격자 후보 → 현재 위치로 판정
+    void QueryNeighbors(const EnemyNeighborGrid& grid, const std::vector<Enemy>& vEnemies, int nSelf, float fMargin,
+                        std::vector<int>& vScratch, std::vector<int>& outNeighbors)
+    {
+        const Enemy& me = vEnemies[nSelf];
+        grid.Query(me.x, me.z, kSeparationRadius + fMargin, vScratch);
+        outNeighbors.clear();
+        for (int nItem : vScratch)
+        {
+            const float dx = vEnemies[nItem].x - me.x, dz = vEnemies[nItem].z - me.z;
+            if (dx * dx + dz * dz <= kSeparationRadius * kSeparationRadius)
+                outNeighbors.push_back(nItem);
+        }
+    }
+
+    bool TestQuery()
+    {
+        bool bOk = true;
+        std::mt19937 rng(1);
+        EnemyNeighborGrid grid;
+        std::vector<float> vX, vZ;
+        std::vector<int> vFound, vReference;
+
+        for (int nCase = 0; nCase < 2; ++nCase)
+        {
+            std::vector<Enemy> vEnemies = Scatter(500, 100 + nCase);
+            if (nCase == 1)
+                vEnemies.push_back({ 5000.0f, -5000.0f });   // 멀리 떨어진 적 하나 → 셀 크기 확대
+            BuildGrid(grid, vEnemies, vX, vZ);
+
+            std::uniform_real_distribution<float> pos(-100.0f, 100.0f), radius(0.5f, 20.0f);
+            for (int nQuery = 0; nQuery < 2000; ++nQuery)
+            {
+                const float x = pos(rng), z = pos(rng), r = radius(rng);
+                grid.Query(x, z, r, vFound);
+                std::sort(vFound.begin(), vFound.end());
+
+                vReference.clear();
+                for (int i = 0; i < static_cast<int>(vEnemies.size()); ++i)
+                {
+                    const float dx = vEnemies[i].x - x, dz = vEnemies[i].z - z;
+                    if (dx * dx + dz * dz <= r * r)
+                        vReference.push_back(i);
+                }
+                if (vFound != vReference)
+                {
+                    fprintf(stderr, "[NeighborGrid] case %d query %d: %zu found vs %zu in range\n",
+                            nCase, nQuery, vFound.size(), vReference.size());
+                    bOk = false;
+                    break;
+                }
+            }
+        }
+        return Check(bOk, "grid queries match a full scan");
+    }
+
+    bool TestSteering()
+    {
+        bool bOk = true;
+        EnemyNeighborGrid grid;
+        std::vector<float> vX, vZ;
+        std::vector<int> vScratch, vNeighbors;
+
+        for (int nCount : { 20, 200, 1000 })
+        {
+            // 한 걸음: 같은 상태에서 힘만 비교 (더하는 순서만 다름)
+            const std::vector<Enemy> vStart = Scatter(nCount, nCount);
+            BuildGrid(grid, vStart, vX, vZ);
+            float fMaxForceDiff = 0.0f;
+            for (int i = 0; i < nCount; ++i)
+            {
+                float allX, allZ, gridX, gridZ;
+                SeparationForce(vStart, i, nullptr, allX, allZ);
+                QueryNeighbors(grid, vStart, i, kGridMargin, vScratch, vNeighbors);
+                SeparationForce(vStart, i, &vNeighbors, gridX, gridZ);
+                fMaxForceDiff = (std::max)(fMaxForceDiff, (std::max)(std::fabs(allX - gridX), std::fabs(allZ - gridZ)));
+            }
+
+            // 여러 프레임: 격자는 프레임 시작 (이전 Update 끝) 위치, 적은 차례로 움직인다
+            const float fMargin = kGridMargin + (kMoveSpeed + kSeparationStrength) * kDt;
+            std::vector<Enemy> vEnemies = vStart;
+            int nMissed = 0;
+            for (int nFrame = 0; nFrame < 120; ++nFrame)
+            {
+                BuildGrid(grid, vEnemies, vX, vZ);
+                for (int i = 0; i < nCount; ++i)
+                {
+                    QueryNeighbors(grid, vEnemies, i, fMargin, vScratch, vNeighbors);
+                    float gridX, gridZ, allX, allZ;
+                    SeparationForce(vEnemies, i, &vNeighbors, gridX, gridZ);
+                    SeparationForce(vEnemies, i, nullptr, allX, allZ);
+                    if ((std::max)(std::fabs(allX - gridX), std::fabs(allZ - gridZ)) > 1e-4f)
+                        nMissed++;
+                    Step(vEnemies, i, gridX, gridZ, kDt);
+                }
+            }
+
+            printf("[NeighborGrid] %4d enemies: one-step force diff %g, 120 frames with stale grid + %.2f margin: %d steering misses\n",
+                   nCount, fMaxForceDiff, fMargin, nMissed);
+            bOk &= Check(fMaxForceDiff < 1e-4f, "grid separation matches all-pairs within rounding");
+            bOk &= Check(nMissed == 0, "the dt margin keeps every neighbor within the separation radius");
+        }
+        return bOk;
+    }
+
+    void RunBench()
+    {
+        EnemyNeighborGrid grid;
+        std::vector<float> vX, vZ;
+        std::vector<int> vScratch, vNeighbors;
+
+        for (int nCount : { 20, 50, 100, 200, 500, 1000 })
+        {
+            const int nFrames = nCount <= 200 ? 2000 : 300;
+            const float fMargin = kGridMargin + (kMoveSpeed + kSeparationStrength) * kDt;
+            std::vector<Enemy> vAllPairs = Scatter(nCount, nCount);
+            std::vector<Enemy> vGrid = vAllPairs;
+
+            auto t0 = std::chrono::steady_clock::now();
+            for (int nFrame = 0; nFrame < nFrames; ++nFrame)
+            {
+                for (int i = 0; i < nCount; ++i)
+                {
+                    float sepX, sepZ;
+                    SeparationForce(vAllPairs, i, nullptr, sepX, sepZ);
+                    Step(vAllPairs, i, sepX, sepZ, kDt);
+                }
+            }
+            const double fAllPairsUs = ElapsedUs(t0) / nFrames;
+
+            t0 = std::chrono::steady_clock::now();
+            for (int nFrame = 0; nFrame < nFrames; ++nFrame)
+            {
+                BuildGrid(grid, vGrid, vX, vZ);
+                for (int i = 0; i < nCount; ++i)
+                {
+                    float sepX, sepZ;
+                    QueryNeighbors(grid, vGrid, i, fMargin, vScratch, vNeighbors);
+                    SeparationForce(vGrid, i, &vNeighbors, sepX, sepZ);
+                    Step(vGrid, i, sepX, sepZ, kDt);
+                }
+            }
+            const double fGridUs = ElapsedUs(t0) / nFrames;
+
+            // 더하는 순서 차이가 군집 안에서 누적되는 정도 (참고용)
+            float fMaxDrift = 0.0f;
+            for (int i = 0; i < nCount; ++i)
+                fMaxDrift = (std::max)(fMaxDrift, (std::max)(std::fabs(vAllPairs[i].x - vGrid[i].x), std::fabs(vAllPairs[i].z - vGrid[i].z)));
+
+            printf("[NeighborGrid] %4d enemies: all-pairs %9.1f us/frame, grid %7.1f us/frame (x%.1f), "
+                   "max position drift after %d frames %g\n",
+                   nCount, fAllPairsUs, fGridUs, fAllPairsUs / fGridUs, nFrames, fMaxDrift);
+        }
+    }
+}
+
+int main()
+{
+    bool bOk = TestQuery();
+    bOk = TestSteering() && bOk;
+    RunBench();
+    return bOk ? 0 : 1;
+}
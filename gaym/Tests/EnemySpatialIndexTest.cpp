@@ -0,0 +1,292 @@
+#include "EnemySpatialIndex.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+// EnemySpatialIndex (투사체 스윕 충돌) 검증
+//  1) 터널링: 60 u/s, 반지름 0.5 파이어볼 vs 반지름 1.5 적 — dt 가 커도 스윕은 맞고, 접촉점이 해석해와 같다
+//  2) 결정적 순서: 같은 t 는 등록 순, 핸들 재사용과 무관
+//  3) 적 200 이 움직이는 중 무작위 스윕 2 만 번 — 전체 스윕 (brute force) 과 결과/순서가 같다
+//  4) MAX_PROJECTILES 256 x 적 200 (방 오브젝트 880): 예전 방 전체 순회 vs 색인
+namespace
+{
+    constexpr float kProjectileRadius = 0.5f;
+    constexpr int kProjectiles = 256;         // ProjectileManager::MAX_PROJECTILES
+    constexpr int kEnemies = 200;
+    constexpr int kRoomObjects = 880;         // room_Room3.json 의 맵 오브젝트 수
+    constexpr int kFrames = 2000;
+    constexpr float kDt = 1.0f / 60.0f;
+    constexpr float kSpeed = 40.0f;
+
+    struct Sphere
+    {
+        float center[3];
+        float fRadius;
+    };
+
+    bool Check(bool condition, const char* what)
+    {
+        if (!condition)
+            fprintf(stderr, "[EnemyIndex] FAILED: %s\n", what);
+        return condition;
+    }
+
+    // 예전 CheckProjectileCollisions: 프레임 끝 위치에서 구 대 구
+    bool Overlaps(const float p[3], float r, const Sphere& enemy)
+    {
+        const float dx = p[0] - enemy.center[0], dy = p[1] - enemy.center[1], dz = p[2] - enemy.center[2];
+        const float s = r + enemy.fRadius;
+        return dx * dx + dy * dy + dz * dz <= s * s;
+    }
+
+    double ElapsedUs(std::chrono::steady_clock::time_point t0)
+    {
+        return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - t0).count();
+    }
+
+    bool TestTunneling()
+    {
+        bool bOk = true;
+        const Sphere enemy = { { 10.0f, 1.0f, 0.0f }, 1.5f };
+        for (float dt : { 1.0f / 60.0f, 0.1f, 0.25f, 0.5f })
+        {
+            EnemySpatialIndex index;
+            index.Add(enemy.center, enemy.fRadius);
+
+            std::vector<EnemySweepHit> vHits;
+            bool bSweepHit = false, bDiscreteHit = false;
+            float fContactX = 0.0f;
+            float p[3] = { 0.0f, 1.0f, 0.0f };
+            for (int nFrame = 0; nFrame < 200 && p[0] < 40.0f; ++nFrame)
+            {
+                const float next[3] = { p[0] + 60.0f * dt, 1.0f, 0.0f };
+                index.SweepSphere(p, next, kProjectileRadius, vHits);
+                if (!vHits.empty() && !bSweepHit)
+                {
+                    bSweepHit = true;
+                    fContactX = p[0] + (next[0] - p[0]) * vHits[0].t;
+                }
+                bDiscreteHit |= Overlaps(next, kProjectileRadius, enemy);
+                p[0] = next[0];
+            }
+
+            printf("[EnemyIndex] dt %.3f: discrete %s, swept %s (contact x %.3f)\n",
+                   dt, bDiscreteHit ? "hit" : "miss", bSweepHit ? "hit" : "miss", fContactX);
+            bOk &= Check(bSweepHit, "the sweep hits at every dt");
+            bOk &= Check(std::fabs(fContactX - 8.0f) < 1e-3f, "contact is at the analytic point (10 - 1.5 - 0.5)");
+        }
+        return bOk;
+    }
+
+    bool TestTieOrder()
+    {
+        EnemySpatialIndex index;
+        std::vector<int> vHandles;
+        for (int i = 0; i < 8; ++i)
+        {
+            const float center[3] = { i * 3.0f, 50.0f, 0.0f };
+            vHandles.push_back(index.Add(center, 1.0f));
+        }
+        for (int i = 0; i < 8; i += 2)
+            index.Remove(vHandles[i]);
+
+        // 빈 핸들을 다시 쓰지만 등록 순서는 first → second
+        const float center[3] = { 5.0f, 0.0f, 0.0f };
+        const int nFirst = index.Add(center, 1.0f);
+        const int nSecond = index.Add(center, 1.0f);
+
+        const float p0[3] = { 5.0f, 0.0f, 0.0f }, p1[3] = { 5.0f, 0.0f, 10.0f };
+        std::vector<EnemySweepHit> vHits;
+        index.SweepSphere(p0, p1, kProjectileRadius, vHits);
+        return Check(vHits.size() == 2 && vHits[0].nHandle == nFirst && vHits[1].nHandle == nSecond,
+                     "equal-t hits come back in registration order");
+    }
+
+    bool TestRandomAgainstBruteForce()
+    {
+        std::mt19937 rng(3);
+        std::uniform_real_distribution<float> pos(-60.0f, 60.0f), radius(0.8f, 3.0f);
+
+        EnemySpatialIndex index;
+        std::vector<Sphere> vEnemies;
+        std::vector<int> vHandles;
+        for (int i = 0; i < kEnemies; ++i)
+        {
+            const Sphere enemy = { { pos(rng), pos(rng) * 0.05f, pos(rng) }, radius(rng) };
+            vEnemies.push_back(enemy);
+            vHandles.push_back(index.Add(enemy.center, enemy.fRadius));
+        }
+
+        std::vector<EnemySweepHit> vHits;
+        std::vector<std::pair<float, int>> vReference;
+        int nMismatches = 0;
+        size_t nHitSum = 0;
+        for (int nStep = 0; nStep < 20000; ++nStep)
+        {
+            if (nStep % 100 == 0)
+            {
+                for (int i = 0; i < kEnemies; ++i)
+                {
+                    vEnemies[i].center[0] += pos(rng) * 0.02f;
+                    vEnemies[i].center[2] += pos(rng) * 0.02f;
+                    index.Move(vHandles[i], vEnemies[i].center, vEnemies[i].fRadius);
+                }
+            }
+
+            const float p0[3] = { pos(rng), pos(rng) * 0.05f, pos(rng) };
+            const float p1[3] = { p0[0] + pos(rng) * 0.2f, p0[1], p0[2] + pos(rng) * 0.2f };
+            index.SweepSphere(p0, p1, kProjectileRadius, vHits);
+
+            // 등록 순 = 인덱스 순이므로 (t, i) 정렬이 기대 순서
+            vReference.clear();
+            for (int i = 0; i < kEnemies; ++i)
+            {
+                float t;
+                if (EnemySpatialIndex::SweepSphereSphere(p0, p1, kProjectileRadius, vEnemies[i].center, vEnemies[i].fRadius, t))
+                    vReference.emplace_back(t, i);
+            }
+            std::sort(vReference.begin(), vReference.end());
+
+            bool bSame = vReference.size() == vHits.size();
+            for (size_t k = 0; bSame && k < vReference.size(); ++k)
+                bSame = vHits[k].nHandle == vHandles[vReference[k].second];
+            if (!bSame)
+                nMismatches++;
+            nHitSum += vReference.size();
+        }
+
+        printf("[EnemyIndex] 20000 random sweeps among %d moving enemies: %d mismatches (%zu hits)\n",
+               kEnemies, nMismatches, nHitSum);
+        return Check(nMismatches == 0 && nHitSum > 0, "indexed sweeps match a brute-force sweep including order");
+    }
+
+    // 방 오브젝트: 예전 경로는 GetComponent<EnemyComponent> 로 적인지 확인하고 트랜스폼에서 구체를 만든다
+    struct RoomObject
+    {
+        float position[3];
+        float fScale;
+        bool  bEnemy;
+    };
+
+    float HitSphere(const RoomObject& obj, float outCenter[3])
+    {
+        const float fRadius = (std::max)(1.5f, 1.5f * obj.fScale);
+        outCenter[0] = obj.position[0];
+        outCenter[1] = obj.position[1] + fRadius * 0.7f;
+        outCenter[2] = obj.position[2];
+        return fRadius;
+    }
+
+    void RunBench()
+    {
+        std::mt19937 rng(5);
+        std::uniform_real_distribution<float> pos(-60.0f, 60.0f);
+
+        std::vector<RoomObject> vObjects(kRoomObjects);
+        std::vector<int> vEnemyObjects;
+        for (int i = 0; i < kRoomObjects; ++i)
+        {
+            vObjects[i] = { { pos(rng), 0.0f, pos(rng) }, 1.0f, false };
+            if (i % 4 == 0 && vEnemyObjects.size() < static_cast<size_t>(kEnemies))
+            {
+                vObjects[i].bEnemy = true;
+                vEnemyObjects.push_back(i);
+            }
+        }
+
+        EnemySpatialIndex index;
+        std::vector<int> vHandles;
+        for (int nObject : vEnemyObjects)
+        {
+            float center[3];
+            const float fRadius = HitSphere(vObjects[nObject], center);
+            vHandles.push_back(index.Add(center, fRadius));
+        }
+
+        std::vector<float> vStartX(kProjectiles), vStartZ(kProjectiles), vDirX(kProjectiles), vDirZ(kProjectiles);
+        for (int i = 0; i < kProjectiles; ++i)
+        {
+            vStartX[i] = pos(rng);
+            vStartZ[i] = pos(rng);
+            const float fAngle = pos(rng);
+            vDirX[i] = std::cos(fAngle);
+            vDirZ[i] = std::sin(fAngle);
+        }
+
+        auto moveEnemies = [&](int nFrame, bool bIndex)
+        {
+            for (size_t i = 0; i < vEnemyObjects.size(); ++i)
+            {
+                RoomObject& obj = vObjects[vEnemyObjects[i]];
+                obj.position[0] += 0.05f * (static_cast<int>((nFrame + i) % 7) - 3);
+                if (bIndex)
+                {
+                    float center[3];
+                    const float fRadius = HitSphere(obj, center);
+                    index.Move(vHandles[i], center, fRadius);
+                }
+            }
+        };
+
+        // 예전: 투사체마다 방 오브젝트 전체
+        long nScanHits = 0;
+        auto t0 = std::chrono::steady_clock::now();
+        for (int nFrame = 0; nFrame < kFrames; ++nFrame)
+        {
+            moveEnemies(nFrame, false);
+            for (int i = 0; i < kProjectiles; ++i)
+            {
+                const float fTravel = kSpeed * kDt * (nFrame % 60 + 1);
+                const float p[3] = { vStartX[i] + vDirX[i] * fTravel, 1.0f, vStartZ[i] + vDirZ[i] * fTravel };
+                for (const RoomObject& obj : vObjects)
+                {
+                    if (!obj.bEnemy)
+                        continue;
+                    Sphere enemy;
+                    enemy.fRadius = HitSphere(obj, enemy.center);
+                    if (Overlaps(p, kProjectileRadius, enemy))
+                    {
+                        nScanHits++;
+                        break;
+                    }
+                }
+            }
+        }
+        const double fScanUs = ElapsedUs(t0) / kFrames;
+
+        // 이후: 색인 갱신 + 이동 구간 스윕
+        long nSweepHits = 0;
+        std::vector<EnemySweepHit> vHits;
+        t0 = std::chrono::steady_clock::now();
+        for (int nFrame = 0; nFrame < kFrames; ++nFrame)
+        {
+            moveEnemies(nFrame, true);
+            for (int i = 0; i < kProjectiles; ++i)
+            {
+                const float fTravel = kSpeed * kDt * (nFrame % 60);
+                const float p0[3] = { vStartX[i] + vDirX[i] * fTravel, 1.0f, vStartZ[i] + vDirZ[i] * fTravel };
+                const float p1[3] = { p0[0] + vDirX[i] * kSpeed * kDt, 1.0f, p0[2] + vDirZ[i] * kSpeed * kDt };
+                index.SweepSphere(p0, p1, kProjectileRadius, vHits);
+                if (!vHits.empty())
+                    nSweepHits++;
+            }
+        }
+        const double fIndexUs = ElapsedUs(t0) / kFrames;
+
+        printf("[EnemyIndex] %d projectiles x %d enemies (%d room objects): room scan %.1f us/frame, "
+               "index + sweep %.1f us/frame (hits %ld / %ld)\n",
+               kProjectiles, kEnemies, kRoomObjects, fScanUs, fIndexUs, nScanHits, nSweepHits);
+    }
+}
+
+int main()
+{
+    bool bOk = TestTunneling();
+    bOk = TestTieOrder() && bOk;
+    bOk = TestRandomAgainstBruteForce() && bOk;
+    RunBench();
+    return bOk ? 0 : 1;
+}
@@ -0,0 +1,178 @@
+#include "FluidSPHSolver.h"
+#include "WorkerPool.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <random>
+#include <vector>
+
+// FluidSPHSolver (CPU fallback SPH)
+//  1) 직렬 Step 과 워커 1 / 3 / 7 개 풀의 병렬 Step 이 여러 스텝 뒤에도 비트 단위로 같은 상태를 낸다
+//     (CP 인력 모드, 중력 + ConfinementBox 모드)
+//  2) 최대 등급 6144 파티클 ms/step — 직렬 대 풀 크기별 (장비의 코어 수만큼만 빨라진다)
+namespace
+{
+    constexpr int   kMaxParticles = 6144;     // FluidSimStatePool::kMaxCapacity
+    constexpr float kDeltaTime = 1.0f / 60.0f;
+    const int kWorkerCounts[] = { 1, 3, 7 };
+
+    bool Check(bool condition, const char* what)
+    {
+        if (!condition)
+            fprintf(stderr, "[FluidSPH] FAILED: %s\n", what);
+        return condition;
+    }
+
+    // FluidParticleConfig 기본값의 밀도 (반경 2.5 에 ~200 개) 를 유지하는 스폰 반경
+    float SpawnRadius(int nCount)
+    {
+        return 2.5f * cbrtf(nCount / 200.0f);
+    }
+
+    // FluidParticleSystem::RandInSphere 와 같은 분포 (중심 쪽이 더 빽빽)
+    void Spawn(FluidSPHSolver& solver, int nCount, unsigned int seed)
+    {
+        const float fRadius = SpawnRadius(nCount);
+        std::mt19937 rng(seed);
+        std::uniform_real_distribution<float> range(-1.0f, 1.0f);
+        std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+
+        solver.Resize(nCount);
+        for (int i = 0; i < nCount; ++i)
+        {
+            float x, y, z, r;
+            do
+            {
+                x = range(rng); y = range(rng); z = range(rng);
+                r = x * x + y * y + z * z;
+            } while (r > 1.0f || r < 0.0001f);
+            const float s = fRadius * unit(rng) / sqrtf(r);
+
+            solver.PosX()[i] = x * s;
+            solver.PosY()[i] = y * s;
+            solver.PosZ()[i] = z * s;
+            solver.VelX()[i] = range(rng);
+            solver.VelY()[i] = range(rng);
+            solver.VelZ()[i] = range(rng);
+        }
+    }
+
+    FluidSPHParams MakeControlPointParams(int nCount)
+    {
+        FluidSPHParams params;
+        FluidSPHControlPoint core;
+        core.sphereRadius = SpawnRadius(nCount);
+        FluidSPHControlPoint satellite;
+        satellite.position = { core.sphereRadius + 0.5f, 0.5f, 0.0f };
+        satellite.attractionStrength = 8.0f;
+        satellite.sphereRadius = 1.0f;
+        params.controlPoints = { core, satellite };
+        return params;
+    }
+
+    FluidSPHParams MakeGravityBoxParams(int nCount)
+    {
+        const float fHalf = SpawnRadius(nCount) * 0.8f;
+        FluidSPHParams params;
+        params.useGravity = true;
+        params.globalGravity = 2.0f;
+        params.boxActive = true;
+        params.boxHalfExtents = { fHalf, fHalf * 0.75f, fHalf };
+        const float c = cosf(0.5f), s = sinf(0.5f);    // Y 축으로 돌린 상자
+        params.boxAxisX = { c, 0.0f, -s };
+        params.boxAxisZ = { s, 0.0f, c };
+        return params;
+    }
+
+    bool SameState(FluidSPHSolver& a, FluidSPHSolver& b)
+    {
+        const size_t nBytes = sizeof(float) * a.GetCount();
+        bool bSame = a.GetCount() == b.GetCount();
+        bSame = bSame && memcmp(a.PosX(), b.PosX(), nBytes) == 0 && memcmp(a.PosY(), b.PosY(), nBytes) == 0
+                      && memcmp(a.PosZ(), b.PosZ(), nBytes) == 0 && memcmp(a.VelX(), b.VelX(), nBytes) == 0
+                      && memcmp(a.VelY(), b.VelY(), nBytes) == 0 && memcmp(a.VelZ(), b.VelZ(), nBytes) == 0;
+        bSame = bSame && memcmp(a.Density(), b.Density(), nBytes) == 0 && memcmp(a.NearDensity(), b.NearDensity(), nBytes) == 0
+                      && memcmp(a.ForceX(), b.ForceX(), nBytes) == 0 && memcmp(a.ForceY(), b.ForceY(), nBytes) == 0
+                      && memcmp(a.ForceZ(), b.ForceZ(), nBytes) == 0;
+        return bSame;
+    }
+
+    bool TestDeterminism(const char* pstrMode, const FluidSPHParams& params, int nCount, int nSteps)
+    {
+        FluidSPHSolver serial;
+        Spawn(serial, nCount, 11);
+        for (int step = 0; step < nSteps; ++step)
+            serial.Step(params, kDeltaTime, false);
+
+        bool bOk = true;
+        for (int nWorkers : kWorkerCounts)
+        {
+            WorkerPool pool(nWorkers);
+            FluidSPHSolver parallel;
+            parallel.SetWorkerPool(&pool);
+            Spawn(parallel, nCount, 11);
+            for (int step = 0; step < nSteps; ++step)
+                parallel.Step(params, kDeltaTime, true);
+
+            const bool bSame = SameState(serial, parallel);
+            printf("[FluidSPH] %s, %d particles x %d steps: serial vs %d workers %s\n",
+                   pstrMode, nCount, nSteps, nWorkers, bSame ? "bitwise equal" : "DIFFER");
+            bOk &= Check(bSame, "parallel steps match the serial step bit for bit");
+        }
+
+        // 움직이긴 했는지 (전부 0 이면 같아도 의미가 없다)
+        float fMaxSpeed = 0.0f;
+        for (int i = 0; i < nCount; ++i)
+            fMaxSpeed = (std::max)(fMaxSpeed, fabsf(serial.VelX()[i]) + fabsf(serial.VelY()[i]) + fabsf(serial.VelZ()[i]));
+        bOk &= Check(fMaxSpeed > 0.0f && std::isfinite(fMaxSpeed), "the fluid moves and stays finite");
+        return bOk;
+    }
+
+    double MsPerStep(FluidSPHSolver& solver, const FluidSPHParams& params, bool bParallel, int nSteps)
+    {
+        solver.Step(params, kDeltaTime, bParallel);    // 워밍업 (이웃 버퍼 확보)
+        const auto t0 = std::chrono::steady_clock::now();
+        for (int step = 0; step < nSteps; ++step)
+            solver.Step(params, kDeltaTime, bParallel);
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t0).count() / nSteps;
+    }
+
+    void BenchMaxTier()
+    {
+        constexpr int kSteps = 60;
+        const FluidSPHParams params = MakeControlPointParams(kMaxParticles);
+
+        FluidSPHSolver serial;
+        Spawn(serial, kMaxParticles, 23);
+        const double fSerialMs = MsPerStep(serial, params, false, kSteps);
+        printf("[FluidSPH] %d particles: serial %.2f ms/step\n", kMaxParticles, fSerialMs);
+
+        for (int nWorkers : kWorkerCounts)
+        {
+            WorkerPool pool(nWorkers);
+            FluidSPHSolver solver;
+            solver.SetWorkerPool(&pool);
+            Spawn(solver, kMaxParticles, 23);
+            const double fMs = MsPerStep(solver, params, true, kSteps);
+            printf("[FluidSPH] %d particles: %d workers + caller %.2f ms/step (x%.2f)\n",
+                   kMaxParticles, nWorkers, fMs, fSerialMs / fMs);
+        }
+
+        // 게임이 쓰는 공용 풀 (hardware_concurrency - 1)
+        FluidSPHSolver solver;
+        Spawn(solver, kMaxParticles, 23);
+        const double fMs = MsPerStep(solver, params, true, kSteps);
+        printf("[FluidSPH] %d particles: shared pool (%d workers) + caller %.2f ms/step (x%.2f)\n",
+               kMaxParticles, WorkerPool::Get().GetWorkerCount(), fMs, fSerialMs / fMs);
+    }
+}
+
+int main()
+{
+    bool bOk = TestDeterminism("control points", MakeControlPointParams(2000), 2000, 30);
+    bOk = TestDeterminism("gravity + box", MakeGravityBoxParams(kMaxParticles), kMaxParticles, 30) && bOk;
+    BenchMaxTier();
+    return bOk ? 0 : 1;
+}
@@ -0,0 +1,174 @@
+#include "FluidSimStatePool.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <random>
+
+// FluidSimStatePool + NullFluidSimStateBackend (디바이스 없음)
+//  1) 등급 배치: 파티클 수 → 용량/해시 크기, 해시 부하율, CB 정렬, 업로드 영역 겹침 없음
+//  2) 재사용 / 예산 Trim / Clear 와 통계
+//  3) 버스트: 이펙트 64 개를 한꺼번에 띄우고 전부 끝내기를 200 번 — 예전 슬롯 고정 할당과 메모리 비교
+namespace
+{
+    constexpr int kEffects = 64;            // FluidSkillVFXManager::MAX_EFFECTS
+    constexpr int kRounds = 200;
+    constexpr uint64_t kCommitAlign = 64 * 1024;
+
+    // FluidSkillVFXManager 의 스킬 정의에서 나오는 파티클 수 (기본 80~130, 강화/합성 스킬은 수백)
+    const int kParticleCounts[] = { 80, 100, 120, 200, 256, 300, 420, 600, 900 };
+
+    bool Check(bool condition, const char* what)
+    {
+        if (!condition)
+            fprintf(stderr, "[FluidPool] FAILED: %s\n", what);
+        return condition;
+    }
+
+    uint64_t Commit(uint64_t nBytes) { return (nBytes + kCommitAlign - 1) / kCommitAlign * kCommitAlign; }
+
+    // 예전 FluidParticleSystem::Init 이 슬롯마다 만들던 최대 크기 버퍼 (6144 파티클, 해시 8192 셀)
+    uint64_t OldSlotBytes()
+    {
+        const uint64_t nParticles = FluidSimStatePool::kMaxCapacity;
+        const uint64_t nHash = 8192;
+        return Commit(nParticles * FluidSimStatePool::kParticleStateStride)      // GPU 상태
+             + Commit(nParticles * FluidSimStatePool::kRenderDataStride)         // GPU 렌더 데이터
+             + Commit(nParticles * FluidSimStatePool::kParticleStateStride)      // Spawn 초기 상태 업로드
+             + Commit(nParticles * FluidSimStatePool::kRenderDataStride)         // 빌보드 업로드
+             + Commit(nHash * sizeof(uint32_t))                                  // 해시 카운트
+             + Commit(nHash * FluidSimStatePool::kHashMaxPerCell * sizeof(uint32_t))   // 해시 엔트리
+             + 4 * kCommitAlign;                                                 // Pass / DepthPass / SPH / CP
+    }
+
+    bool TestDescs()
+    {
+        bool bOk = true;
+        int nPrevCapacity = 0;
+        for (int nParticles = 1; nParticles <= FluidSimStatePool::kMaxCapacity; nParticles += 37)
+        {
+            const FluidSimStateDesc desc = FluidSimStatePool::MakeDesc(nParticles);
+            bOk &= Check(desc.nCapacity >= nParticles, "tier holds the requested particles");
+            bOk &= Check(desc.nCapacity >= nPrevCapacity, "tiers grow with the particle count");
+            bOk &= Check((desc.nHashTableSize & (desc.nHashTableSize - 1)) == 0, "hash table is a power of two");
+            bOk &= Check(desc.nHashTableSize >= 1024 && desc.nHashTableSize <= 8192, "hash table stays in 1024..8192");
+            bOk &= Check(desc.nCapacity * 4 <= desc.nHashTableSize || desc.nHashTableSize == 8192,
+                         "hash load factor is at most 0.25 below the top tier");
+            bOk &= Check(desc.nPassCBOffset % 256 == 0 && desc.nDepthPassCBOffset % 256 == 0
+                         && desc.nSPHCBOffset % 256 == 0 && desc.nCPOffset % 256 == 0, "constant buffers are 256-aligned");
+            bOk &= Check(desc.nRenderDataOffset >= desc.nCPOffset
+                             + uint64_t(FluidSimStatePool::kControlPointStride) * FluidSimStatePool::kMaxControlPoints
+                         && desc.nInitOffset >= desc.nRenderDataOffset + uint64_t(desc.nCapacity) * FluidSimStatePool::kRenderDataStride
+                         && desc.nUploadBytes == desc.nInitOffset + uint64_t(desc.nCapacity) * FluidSimStatePool::kParticleStateStride,
+                         "upload regions do not overlap");
+            nPrevCapacity = desc.nCapacity;
+        }
+        bOk &= Check(FluidSimStatePool::MakeDesc(0).nCapacity == FluidSimStatePool::kTierCapacities[0], "zero particles uses the smallest tier");
+        bOk &= Check(FluidSimStatePool::MakeDesc(100000).nCapacity == FluidSimStatePool::kMaxCapacity, "oversized requests clamp to the top tier");
+        return bOk;
+    }
+
+    bool TestReuseAndTrim()
+    {
+        FluidSimStatePool& pool = FluidSimStatePool::Get();
+        bool bOk = true;
+
+        const FluidSimStatePoolStats s0 = pool.GetStats();
+        FluidSimState* a = pool.Acquire(100);
+        FluidSimState* b = pool.Acquire(3000);
+        bOk &= Check(a && b && a->pMappedUpload && b->pMappedUpload, "acquire gives mapped states");
+        if (!a || !b)
+            return false;
+        bOk &= Check(a->desc.nCapacity == 256 && b->desc.nCapacity == 4096, "states come from the matching tiers");
+
+        FluidSimStatePoolStats s = pool.GetStats();
+        bOk &= Check(s.creates == s0.creates + 2 && s.liveStates == 2 && s.liveBytes == a->gpuBytes + b->gpuBytes, "two live states");
+
+        pool.Release(a);
+        FluidSimState* c = pool.Acquire(130);
+        s = pool.GetStats();
+        bOk &= Check(c == a && s.reuses == s0.reuses + 1 && s.creates == s0.creates + 2, "same tier reuses the released state");
+
+        pool.Release(b);
+        pool.Release(c);
+        s = pool.GetStats();
+        bOk &= Check(s.liveStates == 0 && s.liveBytes == 0 && s.idleStates == 2, "released states go idle");
+
+        // 예산이 작은 등급 하나 크기면 큰 등급부터 해제
+        pool.SetIdleBudget(a->gpuBytes);
+        pool.Trim();
+        s = pool.GetStats();
+        bOk &= Check(s.idleStates == 1 && s.trims == s0.trims + 1, "trim drops the larger idle state first");
+        bOk &= Check(pool.Acquire(50) == a, "the smaller idle state survives trim");
+        pool.Release(a);
+
+        pool.Clear();
+        pool.SetIdleBudget(48ull * 1024 * 1024);
+        s = pool.GetStats();
+        bOk &= Check(s.idleStates == 0 && s.idleBytes == 0, "clear releases every idle state");
+        return bOk;
+    }
+
+    bool RunBurst()
+    {
+        FluidSimStatePool& pool = FluidSimStatePool::Get();
+        std::mt19937 rng(7);
+        FluidSimState* vLive[kEffects] = {};
+
+        const FluidSimStatePoolStats s0 = pool.GetStats();
+        double fTotalUs = 0.0, fColdUs = 0.0, fWorstWarmUs = 0.0;
+        uint64_t nPeakLive = 0;
+        for (int nRound = 0; nRound < kRounds; ++nRound)
+        {
+            auto t0 = std::chrono::steady_clock::now();
+            for (int i = 0; i < kEffects; ++i)
+            {
+                const int nParticles = kParticleCounts[rng() % (sizeof(kParticleCounts) / sizeof(kParticleCounts[0]))];
+                vLive[i] = pool.Acquire(nParticles);
+                if (!Check(vLive[i] != nullptr, "burst acquire"))
+                    return false;
+                // Spawn 초기 상태 기록
+                memset(vLive[i]->pMappedUpload + vLive[i]->desc.nInitOffset, 0,
+                       size_t(nParticles) * FluidSimStatePool::kParticleStateStride);
+            }
+            nPeakLive = (std::max)(nPeakLive, pool.GetStats().liveBytes);
+            for (int i = 0; i < kEffects; ++i)
+                pool.Release(vLive[i]);
+            pool.Trim();
+
+            const double fUs = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - t0).count();
+            fTotalUs += fUs;
+            if (nRound == 0)
+                fColdUs = fUs;
+            else
+                fWorstWarmUs = (std::max)(fWorstWarmUs, fUs);
+        }
+        const FluidSimStatePoolStats s = pool.GetStats();
+
+        const uint64_t nOldBytes = OldSlotBytes() * kEffects;
+        printf("[FluidPool] %d effects x %d bursts: fixed slots %.1f MB, pooled peak %.1f MB live / %.1f MB with idle\n",
+               kEffects, kRounds, nOldBytes / (1024.0 * 1024.0), nPeakLive / (1024.0 * 1024.0),
+               s.peakBytes / (1024.0 * 1024.0));
+        printf("[FluidPool] spawn+retire per burst: cold %.1f us, warm avg %.1f us, worst warm %.1f us "
+               "(%llu creates, %llu reuses, %llu trims)\n",
+               fColdUs, (fTotalUs - fColdUs) / (kRounds - 1), fWorstWarmUs, (unsigned long long)(s.creates - s0.creates),
+               (unsigned long long)(s.reuses - s0.reuses), (unsigned long long)(s.trims - s0.trims));
+        printf("[FluidPool] %s", pool.BuildReport().c_str());
+
+        bool bOk = Check(s.liveStates == 0, "every burst state is returned");
+        bOk &= Check(s.reuses - s0.reuses > (s.creates - s0.creates) * 10, "warm bursts reuse idle states");
+        bOk &= Check(s.peakBytes < nOldBytes, "the pool peak stays below the fixed per-slot cost");
+        pool.Clear();
+        return bOk;
+    }
+}
+
+int main()
+{
+    FluidSimStatePool::Get().SetBackend(std::make_unique<NullFluidSimStateBackend>());
+
+    bool bOk = TestDescs();
+    bOk = TestReuseAndTrim() && bOk;
+    bOk = RunBurst() && bOk;
+    return bOk ? 0 : 1;
+}
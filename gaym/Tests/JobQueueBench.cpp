@@ -0,0 +1,195 @@
+#include "pch.h"
+#include "JobQueue.h"
+#include "GlobalQueue.h"
+#include "LockQueue.h"
+#include "ThreadManager.h"
+#include <chrono>
+#include <cstdio>
+
+// JobQueue (MPSC 침습형 큐) 검증 + 생산자 경합 벤치
+//  1) 실행되지 못한 일감을 남긴 채 큐가 사라지면 일감 (과 캡처한 객체) 도 풀려야 한다
+//  2) 생산자 1 ~ 8 이 한 JobQueue 에 DoAsync — 워커 2 개가 GlobalQueue 를 돌리는 서버 구조 그대로, 전부 실행될 때까지
+//  3) 같은 생산자 수로 큐만: MpscQueue vs 예전 LockQueue<JobRef> (소비자 1)
+// 스레드는 GThreadManager 로 띄운다 (WRITE_LOCK 이 LThreadId 로 소유자를 구분)
+namespace
+{
+    constexpr int32 kJobsPerProducer = 100000;
+    constexpr int32 kWorkers = 2;
+
+    bool Check(bool condition, const char* what)
+    {
+        if (!condition)
+            fprintf(stderr, "[JobQueueBench] FAILED: %s\n", what);
+        return condition;
+    }
+
+    double ElapsedMs(chrono::steady_clock::time_point t0)
+    {
+        return chrono::duration<double, milli>(chrono::steady_clock::now() - t0).count();
+    }
+
+    bool TestDrainOnDestroy()
+    {
+        auto sentinel = make_shared<int32>(0);
+        Atomic<int32> executed = 0;
+
+        // 다른 JobQueue 를 실행 중인 척해서 Push 가 바로 실행하지 않고 GlobalQueue 로 넘기게 한다
+        JobQueue outer;
+        LCurrentJobQueue = &outer;
+
+        JobQueueRef queue = MakeShared<JobQueue>();
+        for (int32 i = 0; i < 100; ++i)
+            queue->DoAsync([sentinel, &executed]() { executed.fetch_add(1); });
+
+        LCurrentJobQueue = nullptr;
+        const bool handedOff = GGlobalQueue->Pop() == queue;
+        const long heldByJobs = sentinel.use_count() - 1;
+
+        queue = nullptr;
+        printf("[JobQueueBench] destroy with 100 queued jobs: %ld captures held before, %ld after, %d executed\n",
+               heldByJobs, sentinel.use_count() - 1, executed.load());
+
+        bool bOk = Check(handedOff, "the first push hands the queue to the GlobalQueue");
+        bOk &= Check(heldByJobs == 100, "queued jobs hold their captures");
+        bOk &= Check(sentinel.use_count() == 1, "destroying the queue releases every queued job");
+        bOk &= Check(executed == 0, "queued jobs are dropped, not run");
+        return bOk;
+    }
+
+    // 서버 워커 루프: 제한 시간 동안 GlobalQueue 에 넘어온 JobQueue 를 실행
+    void LaunchWorkers(Atomic<bool>& stop)
+    {
+        for (int32 i = 0; i < kWorkers; ++i)
+        {
+            GThreadManager->Launch([&stop]()
+            {
+                while (stop == false)
+                {
+                    LEndTickCount = ::GetTickCount64() + 64;
+                    ThreadManager::DoGlobalQueueWork();
+                    this_thread::yield();
+                }
+            });
+        }
+    }
+
+    bool RunDoAsync(int32 producers)
+    {
+        JobQueueRef queue = MakeShared<JobQueue>();
+        Atomic<int64> executed = 0;
+        Atomic<int32> ready = 0;
+        Atomic<bool> go = false;
+        Atomic<bool> stop = false;
+        const int64 total = static_cast<int64>(producers) * kJobsPerProducer;
+
+        LaunchWorkers(stop);
+        for (int32 p = 0; p < producers; ++p)
+        {
+            GThreadManager->Launch([&]()
+            {
+                ready.fetch_add(1);
+                while (go == false)
+                    this_thread::yield();
+
+                // 먼저 넣은 생산자는 그 자리에서 실행을 맡는다 (LEndTickCount 를 넘기면 GlobalQueue 로)
+                LEndTickCount = ::GetTickCount64() + 64;
+                for (int32 i = 0; i < kJobsPerProducer; ++i)
+                    queue->DoAsync([&executed]() { executed.fetch_add(1, memory_order_relaxed); });
+            });
+        }
+
+        while (ready < producers)
+            this_thread::yield();
+        const auto t0 = chrono::steady_clock::now();
+        go = true;
+        while (executed < total && ElapsedMs(t0) < 20000.0)
+            this_thread::yield();
+        const double ms = ElapsedMs(t0);
+
+        stop = true;
+        GThreadManager->Join();
+
+        printf("[JobQueueBench] DoAsync %d producers x %d jobs, %d workers: %.1f ms, %.2f M jobs/s\n",
+               producers, kJobsPerProducer, kWorkers, ms, total / ms / 1000.0);
+        return Check(executed == total, "every DoAsync job runs");
+    }
+
+    struct QueueResult
+    {
+        double	ms;
+        int64	popped;
+    };
+
+    template <typename TPush, typename TPop>
+    QueueResult RunQueue(int32 producers, TPush push, TPop pop)
+    {
+        Atomic<int32> ready = 0;
+        Atomic<bool> go = false;
+        const int64 total = static_cast<int64>(producers) * kJobsPerProducer;
+
+        for (int32 p = 0; p < producers; ++p)
+        {
+            GThreadManager->Launch([&, p]()
+            {
+                ready.fetch_add(1);
+                while (go == false)
+                    this_thread::yield();
+                for (int32 i = 0; i < kJobsPerProducer; ++i)
+                    push(p, i);
+            });
+        }
+
+        while (ready < producers)
+            this_thread::yield();
+        const auto t0 = chrono::steady_clock::now();
+        go = true;
+        int64 popped = 0;
+        while (popped < total && ElapsedMs(t0) < 20000.0)
+        {
+            if (pop())
+                popped++;
+        }
+        const double ms = ElapsedMs(t0);
+        GThreadManager->Join();
+        return { ms, popped };
+    }
+
+    bool RunQueues(int32 producers)
+    {
+        // 일감은 미리 만들어 둔다 (할당은 재지 않는다)
+        Vector<Vector<JobRef>> jobs(producers);
+        for (Vector<JobRef>& list : jobs)
+        {
+            list.reserve(kJobsPerProducer);
+            for (int32 i = 0; i < kJobsPerProducer; ++i)
+                list.push_back(ObjectPool<Job>::MakeShared([]() { }));
+        }
+
+        MpscQueue mpsc;
+        const QueueResult mpscResult = RunQueue(producers,
+            [&](int32 p, int32 i) { mpsc.Push(jobs[p][i].get()); },
+            [&]() { return mpsc.Pop() != nullptr; });
+
+        LockQueue<JobRef> locked;
+        const QueueResult lockedResult = RunQueue(producers,
+            [&](int32 p, int32 i) { locked.Push(jobs[p][i]); },
+            [&]() { return locked.Pop() != nullptr; });
+
+        const int64 total = static_cast<int64>(producers) * kJobsPerProducer;
+        printf("[JobQueueBench] queue only, %d producers: MpscQueue %.2f M/s, LockQueue<JobRef> %.2f M/s\n",
+               producers, total / mpscResult.ms / 1000.0, total / lockedResult.ms / 1000.0);
+        return Check(mpscResult.popped == total && lockedResult.popped == total, "every pushed item is popped once");
+    }
+}
+
+int main()
+{
+    ThreadManager::InitTLS();
+
+    bool bOk = TestDrainOnDestroy();
+    for (int32 producers : { 1, 2, 4, 8 })
+        bOk = RunDoAsync(producers) && bOk;
+    for (int32 producers : { 1, 2, 4, 8 })
+        bOk = RunQueues(producers) && bOk;
+    return bOk ? 0 : 1;
+}
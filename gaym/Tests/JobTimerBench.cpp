@@ -0,0 +1,176 @@
+#include "pch.h"
+#include "JobQueue.h"
+#include "JobTimer.h"
+#include "ThreadManager.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <random>
+
+// JobTimer (4단 타이밍 휠) 검증 + 예약 / 발사 / 지터 벤치, 타이머 10만 개
+//  1) 휠만 1 tick 씩 돌려서: 모든 타이머가 정확히 예약한 tick 에 나와야 한다 (위 단에서 내려온 타이머 포함)
+//  2) 예약 / 취소 ns/op, 한 번에 5분을 건너뛸 때의 Distribute 비용
+//  3) 실제 시간: GJobTimer 로 1 ~ 1000ms 예약, 1ms 마다 Distribute 할 때 늦게 실행된 정도 (p50 / p99 / max)
+namespace
+{
+    constexpr int32 kTimerCount = 100000;
+    constexpr uint64 kLongestDelay = 5 * 60 * 1000;
+
+    bool Check(bool condition, const char* what)
+    {
+        if (!condition)
+            fprintf(stderr, "[JobTimerBench] FAILED: %s\n", what);
+        return condition;
+    }
+
+    double ElapsedMs(chrono::steady_clock::time_point t0)
+    {
+        return chrono::duration<double, milli>(chrono::steady_clock::now() - t0).count();
+    }
+
+    // 60% 는 한 바퀴 (64ms) 안, 30% 는 두 번째 단, 나머지는 5분까지
+    std::vector<uint64> MakeDelays(int32 count, uint64 longest)
+    {
+        mt19937 rng(7);
+        std::vector<uint64> delays(count);
+        for (uint64& delay : delays)
+        {
+            const uint32 kind = rng() % 10;
+            const uint64 range = kind < 6 ? 63 : (kind < 9 ? 4095 : longest);
+            delay = 1 + rng() % range;
+        }
+        return delays;
+    }
+
+    bool TestExactFire()
+    {
+        TimerWheel wheel;
+        const uint64 base = ::GetTickCount64();
+        Vector<JobData> jobs;
+        wheel.Distribute(base, OUT jobs);       // 생성 시각 이후 밀린 tick 을 맞춰 둔다
+
+        const std::vector<uint64> delays = MakeDelays(kTimerCount, kLongestDelay);
+        uint64 firedTick = 0;
+        int64 fired = 0, early = 0, late = 0, maxLate = 0;
+
+        const auto t0 = chrono::steady_clock::now();
+        for (uint64 delay : delays)
+        {
+            const uint64 executeTick = base + delay;
+            uint32 generation;
+            wheel.Reserve(executeTick, weak_ptr<JobQueue>(), ObjectPool<Job>::MakeShared([&, executeTick]()
+            {
+                fired++;
+                if (firedTick < executeTick)
+                    early++;
+                else if (firedTick > executeTick)
+                {
+                    late++;
+                    maxLate = (std::max)(maxLate, static_cast<int64>(firedTick - executeTick));
+                }
+            }), OUT generation);
+        }
+        const double reserveMs = ElapsedMs(t0);
+
+        const auto t1 = chrono::steady_clock::now();
+        for (firedTick = base + 1; firedTick <= base + kLongestDelay; ++firedTick)
+        {
+            wheel.Distribute(firedTick, OUT jobs);
+            for (JobData& data : jobs)
+                data.job->Execute();
+            jobs.clear();
+        }
+        const double stepMs = ElapsedMs(t1);
+
+        printf("[JobTimerBench] tick by tick over %llu ticks: reserve %.1f ns/op, %.1f ms stepping, %lld fired, %lld early, %lld late (max %lld ticks)\n",
+               (unsigned long long)kLongestDelay, reserveMs * 1.0e6 / kTimerCount, stepMs,
+               (long long)fired, (long long)early, (long long)late, (long long)maxLate);
+
+        bool bOk = Check(fired == kTimerCount, "every timer fires once");
+        bOk &= Check(early == 0 && late == 0, "every timer fires on its own tick, including ones cascaded from upper levels");
+        return bOk;
+    }
+
+    bool BenchReserveCancelJump()
+    {
+        TimerWheel wheel;
+        const uint64 base = ::GetTickCount64();
+        const std::vector<uint64> delays = MakeDelays(kTimerCount, kLongestDelay);
+        JobRef job = ObjectPool<Job>::MakeShared([]() { });
+
+        struct Handle { uint32 index; uint32 generation; };
+        std::vector<Handle> handles(kTimerCount);
+
+        auto t0 = chrono::steady_clock::now();
+        for (int32 i = 0; i < kTimerCount; ++i)
+            handles[i].index = wheel.Reserve(base + delays[i], weak_ptr<JobQueue>(), job, OUT handles[i].generation);
+        const double reserveMs = ElapsedMs(t0);
+
+        // 절반 취소 (스킬 캔슬 / 몬스터 사망으로 예약이 무효가 되는 경우)
+        int32 cancelled = 0;
+        t0 = chrono::steady_clock::now();
+        for (int32 i = 0; i < kTimerCount; i += 2)
+            cancelled += wheel.Cancel(handles[i].index, handles[i].generation) ? 1 : 0;
+        const double cancelMs = ElapsedMs(t0);
+
+        Vector<JobData> jobs;
+        t0 = chrono::steady_clock::now();
+        wheel.Distribute(base + kLongestDelay, OUT jobs);
+        const double jumpMs = ElapsedMs(t0);
+
+        printf("[JobTimerBench] %d timers: reserve %.1f ns/op, cancel %.1f ns/op, 5 min jump %.2f ms for %zu fired\n",
+               kTimerCount, reserveMs * 1.0e6 / kTimerCount, cancelMs * 1.0e6 / (kTimerCount / 2), jumpMs, jobs.size());
+
+        bool bOk = Check(cancelled == kTimerCount / 2, "every live handle cancels");
+        bOk &= Check(static_cast<int32>(jobs.size()) == kTimerCount - cancelled, "every uncancelled timer fires");
+        return bOk;
+    }
+
+    bool BenchWallClockJitter()
+    {
+        constexpr uint64 kLongest = 1000;
+        JobQueueRef queue = MakeShared<JobQueue>();
+        const std::vector<uint64> delays = MakeDelays(kTimerCount, kLongest);
+        std::vector<int64> lateness;
+        lateness.reserve(kTimerCount);
+
+        for (uint64 delay : delays)
+        {
+            const uint64 expected = ::GetTickCount64() + delay;
+            queue->DoTimer(delay, [&lateness, expected]()
+            {
+                lateness.push_back(static_cast<int64>(::GetTickCount64()) - static_cast<int64>(expected));
+            });
+        }
+
+        // 워커 루프처럼 1ms 마다 Distribute (Execute 모드: 비어 있는 큐면 이 쓰레드에서 바로 실행)
+        const auto t0 = chrono::steady_clock::now();
+        while (static_cast<int32>(lateness.size()) < kTimerCount && ElapsedMs(t0) < 10000.0)
+        {
+            GJobTimer->Distribute(::GetTickCount64());
+            this_thread::sleep_for(chrono::milliseconds(1));
+        }
+
+        const int32 fired = static_cast<int32>(lateness.size());
+        std::sort(lateness.begin(), lateness.end());
+        const int64 p50 = fired ? lateness[fired / 2] : 0;
+        const int64 p99 = fired ? lateness[fired * 99 / 100] : 0;
+        const int64 maxLate = fired ? lateness.back() : 0;
+        printf("[JobTimerBench] wall clock, %d timers over %llu ms: fired %d, late p50 %lldms p99 %lldms max %lldms\n",
+               kTimerCount, (unsigned long long)kLongest, fired, (long long)p50, (long long)p99, (long long)maxLate);
+
+        bool bOk = Check(fired == kTimerCount, "every wall clock timer fires");
+        bOk &= Check(fired == 0 || lateness.front() >= 0, "no timer fires before its tick");
+        return bOk;
+    }
+}
+
+int main()
+{
+    ThreadManager::InitTLS();
+
+    bool bOk = TestExactFire();
+    bOk = BenchReserveCancelJump() && bOk;
+    bOk = BenchWallClockJitter() && bOk;
+    return bOk ? 0 : 1;
+}
@@ -0,0 +1,411 @@
+#include "JsonDoc.h"
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <new>
+#include <random>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// JsonDoc (제자리 파싱 + 노드 아레나)
+//  1) 문자열: 모든 이스케이프, \u 2 / 3 바이트, 서로게이트 쌍은 4 바이트 UTF-8, 짝 없는 서로게이트는 U+FFFD
+//  2) 깨진 입력: 모든 길이의 잘린 문서, 잘못된 이스케이프 / \u, 콜론·쉼표 빠짐, 루트 뒤 찌꺼기, 너무 깊은 중첩은 실패.
+//     무작위 변조도 안전하게 끝난다
+//  3) Assets/MapData 의 모든 .json: 예전 JsonVal (MapLoader 안의 재귀 파서) 과 같은 트리, 파싱 MB/s, 패스당 할당 횟수 / 바이트,
+//     mapObjects 키 조회 비용. 에셋 경로가 상대 경로라 gaym/ 에서 실행
+namespace
+{
+    int64_t g_nAllocations = 0;
+    int64_t g_nAllocatedBytes = 0;
+}
+
+// 파싱 한 번에 힙을 몇 번 / 얼마나 잡는지 센다 (단일 스레드)
+void* operator new(size_t size)
+{
+    g_nAllocations++;
+    g_nAllocatedBytes += static_cast<int64_t>(size);
+    if (void* p = std::malloc(size ? size : 1))
+        return p;
+    throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete(void* p, size_t) noexcept { std::free(p); }
+
+namespace
+{
+    constexpr int kPasses = 10;
+
+    bool Check(bool condition, const char* what)
+    {
+        if (!condition)
+            fprintf(stderr, "[JsonDoc] FAILED: %s\n", what);
+        return condition;
+    }
+
+    double ElapsedMs(std::chrono::steady_clock::time_point t0)
+    {
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t0).count();
+    }
+
+    // ------------------------------------------------------------------------
+    // user-017 이전의 JsonVal (노드마다 std::string / vector / unordered_map)
+    // ------------------------------------------------------------------------
+    struct OldJsonVal
+    {
+        enum class T { Null, Bool, Num, Str, Arr, Obj };
+        T    type = T::Null;
+        double num = 0.0;
+        bool   b   = false;
+        std::string str;
+        std::vector<OldJsonVal>                        arr;
+        std::unordered_map<std::string, OldJsonVal>    obj;
+
+        const OldJsonVal& operator[](const std::string& k) const
+        {
+            static OldJsonVal sNull;
+            auto it = obj.find(k);
+            return it != obj.end() ? it->second : sNull;
+        }
+    };
+
+    struct OldParser
+    {
+        const char* p;
+        const char* end;
+
+        OldParser(const char* s, size_t n) : p(s), end(s + n) {}
+
+        void skipWS()
+        {
+            while (p < end && ((unsigned char)*p <= 0x20 ||
+                   (unsigned char)*p == 0xEF ||   // UTF-8 BOM bytes
+                   (unsigned char)*p == 0xBB ||
+                   (unsigned char)*p == 0xBF))
+                p++;
+        }
+
+        OldJsonVal parseValue()
+        {
+            skipWS();
+            if (p >= end) return {};
+            switch (*p) {
+            case '{': return parseObject();
+            case '[': return parseArray();
+            case '"': return parseString();
+            case 't': { p += 4; OldJsonVal v; v.type = OldJsonVal::T::Bool; v.b = true;  return v; }
+            case 'f': { p += 5; OldJsonVal v; v.type = OldJsonVal::T::Bool; v.b = false; return v; }
+            case 'n': { p += 4; return {}; }
+            default:  return parseNumber();
+            }
+        }
+
+        OldJsonVal parseObject()
+        {
+            OldJsonVal v; v.type = OldJsonVal::T::Obj;
+            p++; // skip '{'
+            while (p < end) {
+                skipWS();
+                if (*p == '}') { p++; break; }
+                if (*p == ',') { p++; continue; }
+                if (*p != '"') { p++; continue; } // malformed – skip
+                std::string key = parseString().str;
+                skipWS();
+                if (p < end && *p == ':') p++;
+                v.obj[key] = parseValue();
+            }
+            return v;
+        }
+
+        OldJsonVal parseArray()
+        {
+            OldJsonVal v; v.type = OldJsonVal::T::Arr;
+            p++; // skip '['
+            while (p < end) {
+                skipWS();
+                if (*p == ']') { p++; break; }
+                if (*p == ',') { p++; continue; }
+                v.arr.push_back(parseValue());
+            }
+            return v;
+        }
+
+        OldJsonVal parseString()
+        {
+            OldJsonVal v; v.type = OldJsonVal::T::Str;
+            p++; // skip opening '"'
+            while (p < end && *p != '"') {
+                if (*p == '\\') {
+                    p++;
+                    if (p >= end) break;
+                    switch (*p) {
+                    case '"':  v.str += '"';  break;
+                    case '\\': v.str += '\\'; break;
+                    case '/':  v.str += '/';  break;
+                    case 'n':  v.str += '\n'; break;
+                    case 'r':  v.str += '\r'; break;
+                    case 't':  v.str += '\t'; break;
+                    default:   v.str += *p;   break;
+                    }
+                    p++;
+                } else {
+                    v.str += *p++;
+                }
+            }
+            if (p < end) p++; // skip closing '"'
+            return v;
+        }
+
+        OldJsonVal parseNumber()
+        {
+            OldJsonVal v; v.type = OldJsonVal::T::Num;
+            char* endptr = nullptr;
+            v.num = strtod(p, &endptr);
+            if (endptr > p) p = endptr;
+            else p++;
+            return v;
+        }
+    };
+
+    OldJsonVal OldParse(const std::string& text)
+    {
+        if (text.empty()) return {};
+        OldParser jp(text.data(), text.size());
+        return jp.parseValue();
+    }
+
+    bool SameTree(const OldJsonVal& a, const JsonVal& b)
+    {
+        if (static_cast<int>(a.type) != static_cast<int>(b.type))
+            return false;
+        switch (b.type)
+        {
+        case JsonVal::T::Bool: return a.b == b.b;
+        case JsonVal::T::Num:  return a.num == b.num;
+        case JsonVal::T::Str:  return a.str == b.str;
+        case JsonVal::T::Arr:
+            if (a.arr.size() != b.count) return false;
+            for (uint32_t n = 0; n < b.count; ++n)
+                if (!SameTree(a.arr[n], b.items[n])) return false;
+            return true;
+        case JsonVal::T::Obj:
+            if (a.obj.size() != b.count) return false;
+            for (uint32_t n = 0; n < b.count; ++n)
+            {
+                auto it = a.obj.find(std::string(b.keys[n]));
+                if (it == a.obj.end() || !SameTree(it->second, b.items[n])) return false;
+            }
+            return true;
+        default:
+            return true;
+        }
+    }
+
+    std::string ReadFile(const std::filesystem::path& path)
+    {
+        std::ifstream fs(path, std::ios::binary);
+        std::ostringstream ss;
+        ss << fs.rdbuf();
+        return ss.str();
+    }
+
+    // ------------------------------------------------------------------------
+    // 1) 문자열
+    // ------------------------------------------------------------------------
+    bool ParsesTo(const char* pstrJson, const char* pstrExpected)
+    {
+        JsonDoc doc;
+        return doc.parse(pstrJson) && doc.root().type == JsonVal::T::Str && doc.root().str == pstrExpected;
+    }
+
+    bool TestStrings()
+    {
+        bool bOk = Check(ParsesTo(R"("a\"b\\c\/d\be\ff\ng\rh\ti")", "a\"b\\c/d\be\ff\ng\rh\ti"), "simple escapes");
+        bOk &= Check(ParsesTo(R"("A\u00e9\u00E9\uD55C")", "A\xC3\xA9\xC3\xA9\xED\x95\x9C"), "\\u escapes to 1 / 2 / 3 byte UTF-8, either hex case");
+        bOk &= Check(ParsesTo(R"("x\uD83D\uDE00y")", "x\xF0\x9F\x98\x80y"), "a surrogate pair becomes one 4 byte character");
+        bOk &= Check(ParsesTo(R"("\uD83Dz")", "\xEF\xBF\xBDz"), "a high surrogate without a pair becomes U+FFFD");
+        bOk &= Check(ParsesTo(R"("\uD83D\u0041")", "\xEF\xBF\xBD" "A"), "the escape after an unpaired high surrogate is kept");
+        bOk &= Check(ParsesTo(R"("\uD83D\uD83D\uDE00")", "\xEF\xBF\xBD\xF0\x9F\x98\x80"), "a high surrogate before a full pair");
+        bOk &= Check(ParsesTo(R"("\uDE00")", "\xEF\xBF\xBD"), "a lone low surrogate becomes U+FFFD");
+        bOk &= Check(ParsesTo("\"\xEC\x8A\xAC\xEB\x9D\xBC\xEC\x9E\x84\"", "\xEC\x8A\xAC\xEB\x9D\xBC\xEC\x9E\x84"), "raw UTF-8 passes through");
+        bOk &= Check(ParsesTo(R"("")", ""), "empty string");
+
+        // 이스케이프가 든 키도 풀린 값으로 찾는다
+        JsonDoc doc;
+        bOk &= Check(doc.parse("\xEF\xBB\xBF { \"k\\u0065y\" : [1, -2.5e1, true, null, \"v\",] , }") && doc.root()["key"].size() == 5
+                     && doc.root()["key"][1].num == -25.0 && doc.root()["key"][2].b && doc.root()["key"][3].isNull(),
+                     "BOM, escaped keys, numbers, literals and trailing commas");
+        printf("[JsonDoc] escapes / surrogates: %s\n", bOk ? "ok" : "FAILED");
+        return bOk;
+    }
+
+    // ------------------------------------------------------------------------
+    // 2) 깨진 입력
+    // ------------------------------------------------------------------------
+    bool Rejects(const std::string& text)
+    {
+        JsonDoc doc;
+        return !doc.parse(text) && doc.root().isNull();
+    }
+
+    bool TestMalformed()
+    {
+        const std::string valid = R"({"a":[1,2.5,{"b":"x\u00e9\n"}],"c":true,"d":null,"e":"\uD83D\uDE00"})";
+        JsonDoc doc;
+        bool bOk = Check(doc.parse(valid), "the reference document parses");
+
+        int nAccepted = 0;
+        for (size_t len = 0; len < valid.size(); ++len)
+            nAccepted += Rejects(valid.substr(0, len)) ? 0 : 1;
+        bOk &= Check(nAccepted == 0, "every truncation is rejected");
+
+        const char* bad[] =
+        {
+            R"("\x")", R"("\u12G4")", R"("\u12")", R"("abc)", R"("abc\)",
+            R"({"a" 1})", R"({"a":1 "b":2})", R"([1 2])", R"({a:1})", R"({"a":})",
+            R"(tru)", R"(nul)", R"(-)", R"([1,,2])", R"({,})",
+            R"({} x)", R"([1]])", R"("a" "b")", R"(1 2)",
+        };
+        int nBadAccepted = 0;
+        for (const char* pstrBad : bad)
+        {
+            if (!Rejects(pstrBad))
+            {
+                fprintf(stderr, "[JsonDoc] accepted: %s\n", pstrBad);
+                nBadAccepted++;
+            }
+        }
+        bOk &= Check(nBadAccepted == 0, "bad escapes, missing separators, unquoted keys and trailing content are rejected");
+
+        bOk &= Check(Rejects(std::string(100000, '[')) && Rejects(std::string(100000, '{')), "deep nesting is rejected without overflowing the stack");
+        std::string deep = std::string(200, '[') + std::string(200, ']');
+        bOk &= Check(doc.parse(deep), "200 levels still parse");
+
+        // 무작위 변조: 결과는 상관없고 범위 밖을 읽거나 쓰지 않아야 한다 (ASAN 빌드에서 확인)
+        std::mt19937 rng(4);
+        int nFuzzOk = 0;
+        for (int i = 0; i < 20000; ++i)
+        {
+            std::string fuzz = valid;
+            const int nFlips = 1 + rng() % 4;
+            for (int f = 0; f < nFlips; ++f)
+                fuzz[rng() % fuzz.size()] = "{}[],:\"\\u0x9 DdE"[rng() % 17];
+            nFuzzOk += doc.parse(fuzz) ? 1 : 0;
+        }
+        printf("[JsonDoc] malformed input: %zu truncations, %zu bad documents rejected, 20000 fuzzed (%d still valid)\n",
+               valid.size(), sizeof(bad) / sizeof(bad[0]), nFuzzOk);
+        return bOk;
+    }
+
+    // ------------------------------------------------------------------------
+    // 3) Assets/MapData
+    // ------------------------------------------------------------------------
+    bool BenchMapData()
+    {
+        std::vector<std::string> vNames, vTexts;
+        size_t nTotalBytes = 0;
+        for (const auto& entry : std::filesystem::directory_iterator("Assets/MapData"))
+        {
+            if (entry.path().extension() != ".json")
+                continue;
+            vNames.push_back(entry.path().filename().string());
+            vTexts.push_back(ReadFile(entry.path()));
+            nTotalBytes += vTexts.back().size();
+        }
+        if (!Check(!vTexts.empty(), "Assets/MapData has .json files (run from gaym/)"))
+            return false;
+
+        bool bOk = true;
+        for (size_t n = 0; n < vTexts.size(); ++n)
+        {
+            JsonDoc doc;
+            const bool bParsed = doc.parse(vTexts[n]);
+            if (!bParsed || !SameTree(OldParse(vTexts[n]), doc.root()))
+            {
+                fprintf(stderr, "[JsonDoc] %s: %s\n", vNames[n].c_str(), bParsed ? "tree differs from the old parser" : "parse failed");
+                bOk = false;
+            }
+        }
+        bOk = Check(bOk, "every map file parses to the same tree as the old JsonVal") && bOk;
+
+        // 파싱만 잰다 (파일은 미리 읽어 둠). 문서는 패스마다 새로 만들고 버린다 — MapLoader 캐시 미스와 같다
+        int64_t nAllocs = g_nAllocations, nBytes = g_nAllocatedBytes;
+        auto t0 = std::chrono::steady_clock::now();
+        double fSink = 0.0;
+        for (int pass = 0; pass < kPasses; ++pass)
+            for (const std::string& text : vTexts)
+                fSink += OldParse(text)["mapObjects"].arr.size();
+        const double fOldMs = ElapsedMs(t0) / kPasses;
+        const int64_t nOldAllocs = (g_nAllocations - nAllocs) / kPasses;
+        const int64_t nOldBytes = (g_nAllocatedBytes - nBytes) / kPasses;
+
+        nAllocs = g_nAllocations; nBytes = g_nAllocatedBytes;
+        t0 = std::chrono::steady_clock::now();
+        for (int pass = 0; pass < kPasses; ++pass)
+            for (const std::string& text : vTexts)
+            {
+                JsonDoc doc;
+                doc.parse(text);
+                fSink += doc.root()["mapObjects"].size();
+            }
+        const double fNewMs = ElapsedMs(t0) / kPasses;
+        const int64_t nNewAllocs = (g_nAllocations - nAllocs) / kPasses;
+        const int64_t nNewBytes = (g_nAllocatedBytes - nBytes) / kPasses;
+
+        const double fMb = nTotalBytes / (1024.0 * 1024.0);
+        printf("[JsonDoc] %zu files, %.2f MB: old JsonVal %.0f MB/s, %lld allocs, %.1f MB allocated per pass\n",
+               vTexts.size(), fMb, fMb / (fOldMs / 1000.0), (long long)nOldAllocs, nOldBytes / (1024.0 * 1024.0));
+        printf("[JsonDoc] %zu files, %.2f MB: JsonDoc      %.0f MB/s, %lld allocs, %.1f MB allocated per pass\n",
+               vTexts.size(), fMb, fMb / (fNewMs / 1000.0), (long long)nNewAllocs, nNewBytes / (1024.0 * 1024.0));
+
+        // MapLoader 가 mapObjects 마다 하는 조회
+        const char* keys[] = { "name", "meshFile", "position", "rotation", "scale", "color", "texture" };
+        std::vector<OldJsonVal> vOld;
+        std::vector<JsonDoc> vDocs(vTexts.size());
+        size_t nObjects = 0;
+        for (size_t n = 0; n < vTexts.size(); ++n)
+        {
+            vOld.push_back(OldParse(vTexts[n]));
+            vDocs[n].parse(vTexts[n]);
+            nObjects += vDocs[n].root()["mapObjects"].size();
+        }
+        const std::vector<std::string> vKeyStrings(std::begin(keys), std::end(keys));
+
+        t0 = std::chrono::steady_clock::now();
+        for (int pass = 0; pass < kPasses; ++pass)
+            for (const OldJsonVal& root : vOld)
+                for (const OldJsonVal& obj : root["mapObjects"].arr)
+                    for (const std::string& key : vKeyStrings)
+                        fSink += static_cast<double>(obj[key].type);
+        const double fOldLookupNs = ElapsedMs(t0) * 1.0e6 / (kPasses * nObjects * vKeyStrings.size());
+
+        t0 = std::chrono::steady_clock::now();
+        for (int pass = 0; pass < kPasses; ++pass)
+            for (const JsonDoc& doc : vDocs)
+            {
+                const JsonVal& objects = doc.root()["mapObjects"];
+                for (size_t i = 0; i < objects.size(); ++i)
+                    for (const char* key : keys)
+                        fSink += static_cast<double>(objects[i][key].type);
+            }
+        const double fNewLookupNs = ElapsedMs(t0) * 1.0e6 / (kPasses * nObjects * vKeyStrings.size());
+
+        printf("[JsonDoc] %zu mapObjects x %zu keys: lookup old %.1f ns, JsonDoc %.1f ns (checksum %.0f)\n",
+               nObjects, vKeyStrings.size(), fOldLookupNs, fNewLookupNs, fSink);
+        return bOk;
+    }
+}
+
+int main()
+{
+    bool bOk = TestStrings();
+    bOk = TestMalformed() && bOk;
+    bOk = BenchMapData() && bOk;
+    return bOk ? 0 : 1;
+}
@@ -0,0 +1,151 @@
+#include "pch.h"
+#include "Logger.h"
+#include "ThreadManager.h"
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <cwchar>
+#include <string>
+
+// Logger (스레드별 링 + Flush 스레드 포맷) 검증 + 호출 스레드 비용 벤치
+//  1) char 문자열 인자: UTF-8 (한글, 4바이트 문자 포함) 이 파일에 그대로 나오고, 잘못된 바이트는 U+FFFD 가 된다
+//     (예전에는 바이트 하나를 WCHAR 하나로 늘려서 한글이 깨졌다)
+//  2) 스레드 1 / 2 / 4: LOG_INFO (정수 2 + 실수 1 + 문자열 1) 의 호출 스레드 ns/call 과 파일까지 간 줄 수
+//     — 호출 스레드에서 바로 포맷해서 쓰는 경우 (ConsoleLog::WriteStdOut 방식) 와 비교
+namespace
+{
+    constexpr int32 kCallsPerThread = 50000;
+    constexpr int32 kBurst = 1000;          // 이만큼 쓰고 나서 (재지 않는 구간에서) 링을 비운다. 코어가 적으면 Flush 스레드가 못 따라온다
+    const char* kLogPath = "logger_bench.log";
+
+    bool Check(bool condition, const char* what)
+    {
+        if (!condition)
+            fprintf(stderr, "[LoggerBench] FAILED: %s\n", what);
+        return condition;
+    }
+
+    double ElapsedNs(chrono::steady_clock::time_point t0)
+    {
+        return chrono::duration<double, nano>(chrono::steady_clock::now() - t0).count();
+    }
+
+    std::string ReadLog()
+    {
+        std::string text;
+        if (FILE* file = ::fopen(kLogPath, "rb"))
+        {
+            char buffer[4096];
+            size_t read;
+            while ((read = ::fread(buffer, 1, sizeof(buffer), file)) > 0)
+                text.append(buffer, read);
+            ::fclose(file);
+        }
+        return text;
+    }
+
+    int32 CountLines(const std::string& text, const char* marker)
+    {
+        int32 count = 0;
+        for (size_t pos = text.find(marker); pos != std::string::npos; pos = text.find(marker, pos + 1))
+            count++;
+        return count;
+    }
+
+    bool TestUtf8Strings()
+    {
+        ::remove(kLogPath);
+        GLogger->OpenFile(kLogPath);
+
+        const std::string name = "슬라임 왕 \xF0\x9F\x91\x91";     // 4바이트 문자 (U+1F451)
+        LOG_INFO(L"spawn %s at %d", name.c_str(), 3);
+        LOG_INFO(L"pad [%8s] [%-6s]", "ab", "한");
+        LOG_INFO(L"bad [%s]", "\xFF" "x\xC3(" "\xE2\x82");     // 시작 바이트 아님 / 잘린 2바이트 / 끝에서 잘린 3바이트
+        LOG_INFO(L"wide [%s]", L"몬스터");
+        GLogger->Flush();
+        GLogger->CloseFile();
+
+        const std::string text = ReadLog();
+        bool bOk = Check(text.find("spawn 슬라임 왕 \xF0\x9F\x91\x91 at 3\n") != std::string::npos, "UTF-8 char strings reach the file unchanged");
+        bOk &= Check(text.find("pad [      ab] [한     ]") != std::string::npos, "width and alignment count characters, not bytes");
+        bOk &= Check(text.find("bad [\xEF\xBF\xBDx\xEF\xBF\xBD(\xEF\xBF\xBD]") != std::string::npos, "invalid UTF-8 becomes U+FFFD");
+        bOk &= Check(text.find("wide [몬스터]") != std::string::npos, "WCHAR strings are unchanged");
+        printf("[LoggerBench] char string arguments: %s\n", bOk ? "UTF-8 preserved" : "mangled");
+        return bOk;
+    }
+
+    // 호출 스레드에서 바로 포맷하고 쓰는 경우 (ConsoleLog::WriteStdOut 과 같이 4096 버퍼 + 락)
+    Mutex GDirectLock;
+    void WriteDirect(FILE* file, int32 thread, int32 i, double value, const char* name)
+    {
+        WCHAR buffer[4096];
+        ::swprintf(buffer, 4096, L"[direct] thread %d call %d value %.3f name %s\n", thread, i, value, name);
+        LockGuard guard(GDirectLock);
+        ::fputws(buffer, file);
+    }
+
+    template<typename CallFunc, typename PauseFunc>
+    double RunThreads(int32 threads, CallFunc call, PauseFunc pause)
+    {
+        Atomic<int64> totalNs = 0;
+        for (int32 t = 0; t < threads; ++t)
+        {
+            GThreadManager->Launch([&, t]()
+            {
+                double ns = 0.0;
+                for (int32 i = 0; i < kCallsPerThread; i += kBurst)
+                {
+                    const auto t0 = chrono::steady_clock::now();
+                    for (int32 j = i; j < i + kBurst; ++j)
+                        call(t, j);
+                    ns += ElapsedNs(t0);
+                    pause();
+                }
+                totalNs.fetch_add(static_cast<int64>(ns));
+            });
+        }
+        GThreadManager->Join();
+        return static_cast<double>(totalNs.load()) / (static_cast<double>(threads) * kCallsPerThread);
+    }
+
+    bool BenchCallingThread(int32 threads)
+    {
+        ::remove(kLogPath);
+        GLogger->OpenFile(kLogPath);
+        const double loggerNs = RunThreads(threads, [](int32 t, int32 i)
+        {
+            LOG_INFO(L"[bench] thread %d call %d value %.3f name %s", t, i, i * 0.5, "goblin_archer");
+        }, []() { GLogger->Flush(); });
+        GLogger->Flush();
+        GLogger->CloseFile();
+        const int32 lines = CountLines(ReadLog(), "[bench]");
+
+        ::remove(kLogPath);
+        FILE* file = ::fopen(kLogPath, "wb");
+        const double directNs = RunThreads(threads, [file](int32 t, int32 i)
+        {
+            WriteDirect(file, t, i, i * 0.5, "goblin_archer");
+        }, []() { });
+        ::fclose(file);
+
+        printf("[LoggerBench] %d threads x %d calls: Logger %.1f ns/call (%d of %d lines written), format + write on caller %.1f ns/call\n",
+               threads, kCallsPerThread, loggerNs, lines, threads * kCallsPerThread, directNs);
+        return Check(lines == threads * kCallsPerThread, "every record reaches the file when the rings are drained between bursts");
+    }
+}
+
+int main()
+{
+    ThreadManager::InitTLS();
+    GLogger->SetConsole(false);
+
+    bool bOk = TestUtf8Strings();
+
+    // 같은 호출 지점을 계속 부르므로 속도 제한을 끈다 (켜 두면 초당 100 개 뒤로는 ShouldLog 에서 끝난다)
+    GLogger->SetRateLimit(0);
+    for (int32 threads : { 1, 2, 4 })
+        bOk = BenchCallingThread(threads) && bOk;
+
+    ::remove(kLogPath);
+    return bOk ? 0 : 1;
+}
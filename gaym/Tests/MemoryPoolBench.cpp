@@ -0,0 +1,218 @@
+#include "pch.h"
+#include "MemoryPool.h"
+#include <chrono>
+#include <cstdio>
+#include <thread>
+
+// MemoryPool (스레드별 매거진 캐시) 검증 + 멀티스레드 할당 벤치
+//  1) 캐시 테이블 밖의 풀 (id >= MAX_CACHED_POOLS): OS 로 바로 가지 않고 창고에서 재사용한다
+//  2) 다른 스레드에서 해제: hits / misses 가 단조 증가하고 음수가 되지 않는다
+//  3) 스레드 1 ~ 8: 매거진 풀 vs 캐시 없는 풀 (창고만) vs 예전 SList 풀 (리눅스에서는 CorePlatform.h 의 mutex 목록) vs _aligned_malloc
+namespace
+{
+    constexpr int32 kBatch = 64;            // 한 번에 잡았다 놓는 블록 수 (패킷 하나 처리에서 생기는 임시 객체 정도)
+    constexpr int32 kRounds = 20000;
+
+    bool Check(bool condition, const char* what)
+    {
+        if (!condition)
+            fprintf(stderr, "[MemoryPoolBench] FAILED: %s\n", what);
+        return condition;
+    }
+
+    // user-005 이전의 MemoryPool: 풀 하나에 SList 하나
+    class SListPool
+    {
+    public:
+        SListPool(int32 allocSize) : _allocSize(allocSize) { ::InitializeSListHead(&_header); }
+        ~SListPool()
+        {
+            while (MemoryHeader* memory = static_cast<MemoryHeader*>(::InterlockedPopEntrySList(&_header)))
+                ::_aligned_free(memory);
+        }
+
+        void Push(MemoryHeader* ptr)
+        {
+            ptr->allocSize = 0;
+            ::InterlockedPushEntrySList(&_header, static_cast<PSLIST_ENTRY>(ptr));
+        }
+
+        MemoryHeader* Pop()
+        {
+            MemoryHeader* memory = static_cast<MemoryHeader*>(::InterlockedPopEntrySList(&_header));
+            if (memory == nullptr)
+                memory = reinterpret_cast<MemoryHeader*>(::_aligned_malloc(_allocSize, SLIST_ALIGNMENT));
+            return memory;
+        }
+
+    private:
+        SLIST_HEADER	_header;
+        int32			_allocSize = 0;
+    };
+
+    class MallocPool
+    {
+    public:
+        MallocPool(int32 allocSize) : _allocSize(allocSize) { }
+        void Push(MemoryHeader* ptr) { ::_aligned_free(ptr); }
+        MemoryHeader* Pop() { return reinterpret_cast<MemoryHeader*>(::_aligned_malloc(_allocSize, SLIST_ALIGNMENT)); }
+
+    private:
+        int32 _allocSize = 0;
+    };
+
+    // 풀 id 는 재사용하지 않으므로 Memory 의 크기별 풀 + 여기서 만든 풀이 MAX_CACHED_POOLS (128) 를 넘으면
+    // 이후 풀은 스레드 캐시 없이 창고만 쓴다. 넘길 만큼 만들어 두고 마지막 풀들을 돌려준다
+    std::vector<MemoryPool*> GFillerPools;     // GMemory 를 정리한 뒤에 소멸하므로 std::vector
+
+    MemoryPool* MakeUncachedPool(int32 allocSize)
+    {
+        while (GFillerPools.size() < 160)
+            GFillerPools.push_back(new MemoryPool(16));
+        GFillerPools.push_back(new MemoryPool(allocSize));
+        return GFillerPools.back();
+    }
+
+    bool TestUncachedPool()
+    {
+        MemoryPool* pool = MakeUncachedPool(64);
+
+        Vector<MemoryHeader*> blocks;
+        for (int32 round = 0; round < 1000; ++round)
+        {
+            for (int32 i = 0; i < kBatch; ++i)
+            {
+                MemoryHeader* block = pool->Pop();
+                MemoryHeader::AttachHeader(block, 64);
+                blocks.push_back(block);
+            }
+            for (MemoryHeader* block : blocks)
+                pool->Push(block);
+            blocks.clear();
+        }
+
+        const MemoryPoolStats stats = pool->GetStats();
+        printf("[MemoryPoolBench] uncached pool: %lld hits, %lld misses, %lld live, %lld bytes held\n",
+               (long long)stats.hits, (long long)stats.misses, (long long)stats.live, (long long)stats.bytes);
+        bool bOk = Check(stats.misses <= kBatch, "a pool past the cache table reuses blocks through the depot");
+        bOk &= Check(stats.hits == 1000LL * kBatch - stats.misses, "every other pop is a hit");
+        bOk &= Check(stats.live == 0, "every block came back");
+        return bOk;
+    }
+
+    bool TestCrossThreadFree()
+    {
+        MemoryPool pool(128);
+        Vector<MemoryHeader*> blocks;
+        bool bOk = true;
+        int64 lastHits = 0, lastMisses = 0;
+
+        for (int32 round = 0; round < 200; ++round)
+        {
+            // 이 스레드에서 잡고 다른 스레드에서 놓는다 (세션 송신 완료 스레드가 버퍼를 놓는 모양)
+            for (int32 i = 0; i < kBatch * 4; ++i)
+            {
+                MemoryHeader* block = pool.Pop();
+                MemoryHeader::AttachHeader(block, 128);
+                blocks.push_back(block);
+            }
+            std::thread([&]() { for (MemoryHeader* block : blocks) pool.Push(block); }).join();
+            blocks.clear();
+
+            const MemoryPoolStats stats = pool.GetStats();
+            if (stats.hits < lastHits || stats.misses < lastMisses || stats.hits < 0)
+            {
+                fprintf(stderr, "[MemoryPoolBench] round %d: hits %lld -> %lld, misses %lld -> %lld\n", round,
+                        (long long)lastHits, (long long)stats.hits, (long long)lastMisses, (long long)stats.misses);
+                bOk = false;
+                break;
+            }
+            lastHits = stats.hits;
+            lastMisses = stats.misses;
+        }
+
+        MemoryPool::FlushThreadCache();
+        const MemoryPoolStats stats = pool.GetStats();
+        printf("[MemoryPoolBench] cross-thread free: %lld hits, %lld misses\n", (long long)stats.hits, (long long)stats.misses);
+        bOk &= Check(stats.hits > 0, "blocks freed on another thread are reused");
+        return Check(bOk, "hits and misses only grow under cross-thread frees");
+    }
+
+    template <typename TPool>
+    double RunThreads(TPool& pool, int32 allocSize, int32 threadCount)
+    {
+        Atomic<int32> ready = 0;
+        Atomic<bool> go = false;
+        Vector<std::thread> threads;
+        for (int32 t = 0; t < threadCount; ++t)
+        {
+            threads.emplace_back([&]()
+            {
+                MemoryHeader* blocks[kBatch];
+                ready.fetch_add(1);
+                while (go == false)
+                    std::this_thread::yield();
+
+                for (int32 round = 0; round < kRounds; ++round)
+                {
+                    for (int32 i = 0; i < kBatch; ++i)
+                    {
+                        blocks[i] = pool.Pop();
+                        MemoryHeader::AttachHeader(blocks[i], allocSize);
+                    }
+                    for (int32 i = kBatch - 1; i >= 0; --i)
+                        pool.Push(blocks[i]);
+                }
+            });
+        }
+
+        while (ready < threadCount)
+            std::this_thread::yield();
+        const auto t0 = std::chrono::steady_clock::now();
+        go = true;
+        for (std::thread& thread : threads)
+            thread.join();
+        const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+
+        // 스레드당 alloc + free 쌍
+        return static_cast<double>(threadCount) * kRounds * kBatch / seconds / 1.0e6;
+    }
+
+    void RunBench(const int32 (&allocSizes)[2], MemoryPool* (&cachedPools)[2])
+    {
+        for (int32 k = 0; k < 2; ++k)
+        {
+            const int32 allocSize = allocSizes[k];
+            MemoryPool* uncachedPool = MakeUncachedPool(allocSize);
+            for (int32 threadCount : { 1, 2, 4, 8 })
+            {
+                SListPool slistPool(allocSize);
+                MallocPool mallocPool(allocSize);
+
+                const double magazine = RunThreads(*cachedPools[k], allocSize, threadCount);
+                const double depot = RunThreads(*uncachedPool, allocSize, threadCount);
+                const double slist = RunThreads(slistPool, allocSize, threadCount);
+                const double malloc = RunThreads(mallocPool, allocSize, threadCount);
+                printf("[MemoryPoolBench] %4dB x %d threads: magazine %7.1f, depot only %7.1f, SList pool %7.1f, malloc %7.1f M alloc+free/s\n",
+                       allocSize, threadCount, magazine, depot, slist, malloc);
+            }
+        }
+    }
+}
+
+int main()
+{
+    // 캐시를 쓰는 풀은 id 를 다 쓰기 전에 만든다
+    const int32 allocSizes[2] = { 64, 512 };
+    MemoryPool* cachedPools[2] = { new MemoryPool(allocSizes[0]), new MemoryPool(allocSizes[1]) };
+
+    bool bOk = TestCrossThreadFree();
+    bOk = TestUncachedPool() && bOk;
+    RunBench(allocSizes, cachedPools);
+
+    for (MemoryPool* pool : GFillerPools)
+        delete pool;
+    delete cachedPools[0];
+    delete cachedPools[1];
+    return bOk ? 0 : 1;
+}
@@ -0,0 +1,469 @@
+#include "MeshFileParser.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
+#include <thread>
+
+// Assets/Player, Assets/Enemies 의 모든 메쉬 .bin 을
+//  1) 예전 경로 — 필드마다 fread, 정수/토큰마다 OutputDebugString (MeshLoader 의 옛 Read*FromFile 흐름)
+//  2) ParseMeshFile — 파일 한 번 읽고 메모리에서 파싱
+//  3) ParseMeshFile 을 파일 단위로 병렬 (PreloadFiles 와 같은 단위)
+// 로 읽어 시간을 비교하고, 1) 과 2) 의 결과 트리가 완전히 같은지 확인한다.
+// 리눅스에서는 OutputDebugString 이 빈 함수라 1) 의 비용이 윈도우보다 작게 나온다. 에셋 경로가 상대 경로라 gaym/ 에서 실행
+namespace
+{
+    long g_nFreads = 0;
+    long g_nDebugStrings = 0;
+
+    // ------------------------------------------------------------------------
+    // 예전 경로 (GameObject 생성만 빼고 같은 읽기 순서)
+    // ------------------------------------------------------------------------
+    size_t CountedRead(void* pDest, size_t nSize, size_t nCount, FILE* pInFile)
+    {
+        g_nFreads++;
+        return ::fread(pDest, nSize, nCount, pInFile);
+    }
+
+    void DebugString(const wchar_t* pstrText)
+    {
+        g_nDebugStrings++;
+        OutputDebugStringW(pstrText);
+    }
+
+    int OldReadInteger(FILE* pInFile)
+    {
+        int nValue = 0;
+        CountedRead(&nValue, sizeof(int), 1, pInFile);
+
+        wchar_t buffer[128];
+        swprintf_s(buffer, 128, L"  Read Integer: %d\n", nValue);
+        DebugString(buffer);
+        return nValue;
+    }
+
+    BYTE OldReadString(FILE* pInFile, char* pstrToken, int nBufferSize)
+    {
+        int nStrLength = 0, shift = 0;
+        BYTE byteRead = 0;
+        do {
+            if (CountedRead(&byteRead, sizeof(BYTE), 1, pInFile) != 1) return 0;
+            nStrLength |= (byteRead & 0x7F) << shift;
+            shift += 7;
+        } while (byteRead & 0x80);
+
+        if (nStrLength >= nBufferSize)
+        {
+            fseek(pInFile, nStrLength, SEEK_CUR);
+            return 0;
+        }
+
+        CountedRead(pstrToken, sizeof(char), nStrLength, pInFile);
+        pstrToken[nStrLength] = '\0';
+        return (BYTE)nStrLength;
+    }
+
+    void OldReadMaterials(FILE* pInFile, MeshFrameInfo& frameInfo)
+    {
+        char pstrToken[64] = { '\0' };
+        OldReadInteger(pInFile);
+
+        for (; ; )
+        {
+            if (OldReadString(pInFile, pstrToken, 64) == 0) break;
+            if (!strcmp(pstrToken, "</Materials>")) break;
+
+            if (!strcmp(pstrToken, "<Material>:"))
+            {
+                OldReadInteger(pInFile);
+            }
+            else if (!strcmp(pstrToken, "<AlbedoColor>:"))
+            {
+                MeshMaterialEvent event;
+                CountedRead(&event.m_xmf4AlbedoColor, sizeof(float), 4, pInFile);
+                frameInfo.m_vMaterialEvents.push_back(event);
+            }
+            else if (!strcmp(pstrToken, "<AlbedoMap>:"))
+            {
+                char pstrTextureName[64] = { 0 };
+                OldReadString(pInFile, pstrTextureName, 64);
+                MeshMaterialEvent event;
+                event.m_bAlbedoMap = true;
+                event.m_strAlbedoMap = pstrTextureName;
+                frameInfo.m_vMaterialEvents.push_back(std::move(event));
+            }
+            else if (!strcmp(pstrToken, "<EmissiveColor>:") || !strcmp(pstrToken, "<SpecularColor>:"))
+            {
+                XMFLOAT4 xmf4Color;
+                CountedRead(&xmf4Color, sizeof(float), 4, pInFile);
+            }
+            else if (!strcmp(pstrToken, "<Glossiness>:") || !strcmp(pstrToken, "<Metallic>:") ||
+                     !strcmp(pstrToken, "<SpecularHighlight>:") || !strcmp(pstrToken, "<GlossyReflection>:") ||
+                     !strcmp(pstrToken, "<Smoothness>:"))
+            {
+                float fValue;
+                CountedRead(&fValue, sizeof(float), 1, pInFile);
+            }
+        }
+    }
+
+    std::unique_ptr<MeshLoadInfo> OldReadMeshInfo(FILE* pInFile)
+    {
+        char pstrToken[64] = { '\0' };
+        auto pMeshInfo = std::make_unique<MeshLoadInfo>();
+
+        pMeshInfo->m_nVertices = OldReadInteger(pInFile);
+        OldReadString(pInFile, pMeshInfo->m_pstrMeshName, 64);
+
+        for ( ; ; )
+        {
+            if (OldReadString(pInFile, pstrToken, 64) == 0) break;
+
+            if (!strcmp(pstrToken, "<Bounds>:"))
+            {
+                CountedRead(&pMeshInfo->m_xmf3AABBCenter, sizeof(XMFLOAT3), 1, pInFile);
+                CountedRead(&pMeshInfo->m_xmf3AABBExtents, sizeof(XMFLOAT3), 1, pInFile);
+            }
+            else if (!strcmp(pstrToken, "<Positions>:"))
+            {
+                int nPositions = OldReadInteger(pInFile);
+                if (nPositions > 0)
+                {
+                    pMeshInfo->m_nType |= VERTEXT_POSITION;
+                    pMeshInfo->m_vPositions.resize(nPositions);
+                    CountedRead(pMeshInfo->m_vPositions.data(), sizeof(XMFLOAT3), nPositions, pInFile);
+                }
+            }
+            else if (!strcmp(pstrToken, "<Colors>:"))
+            {
+                int nColors = OldReadInteger(pInFile);
+                if (nColors > 0)
+                {
+                    pMeshInfo->m_nType |= VERTEXT_COLOR;
+                    pMeshInfo->m_vColors.resize(nColors);
+                    CountedRead(pMeshInfo->m_vColors.data(), sizeof(XMFLOAT4), nColors, pInFile);
+                }
+            }
+            else if (!strcmp(pstrToken, "<Normals>:"))
+            {
+                int nNormals = OldReadInteger(pInFile);
+                if (nNormals > 0)
+                {
+                    pMeshInfo->m_nType |= VERTEXT_NORMAL;
+                    pMeshInfo->m_vNormals.resize(nNormals);
+                    CountedRead(pMeshInfo->m_vNormals.data(), sizeof(XMFLOAT3), nNormals, pInFile);
+                }
+            }
+            else if (!strcmp(pstrToken, "<TexCoords>:"))
+            {
+                int nTextureCoords = OldReadInteger(pInFile);
+                if (nTextureCoords > 0)
+                {
+                    pMeshInfo->m_nType |= VERTEXT_TEXTURE_COORD0;
+                    pMeshInfo->m_vTextureCoords0.resize(nTextureCoords);
+                    for (XMFLOAT2& uv : pMeshInfo->m_vTextureCoords0)
+                    {
+                        CountedRead(&uv, sizeof(XMFLOAT2), 1, pInFile);
+                        uv.y = 1.0f - uv.y;
+                    }
+                }
+            }
+            else if (!strcmp(pstrToken, "<BoneWeights>:"))
+            {
+                int nBoneWeights = OldReadInteger(pInFile);
+                if (nBoneWeights > 0)
+                {
+                    pMeshInfo->m_nType |= VERTEXT_BONE_INDEX_WEIGHT;
+                    pMeshInfo->m_vBoneIndices.resize(nBoneWeights);
+                    pMeshInfo->m_vBoneWeights.resize(nBoneWeights);
+                    for (int i = 0; i < nBoneWeights; i++)
+                    {
+                        int* pnIndex = &pMeshInfo->m_vBoneIndices[i].x;
+                        float* pfWeight = &pMeshInfo->m_vBoneWeights[i].x;
+                        for (int k = 0; k < 4; k++)
+                        {
+                            CountedRead(&pnIndex[k], sizeof(int), 1, pInFile);
+                            CountedRead(&pfWeight[k], sizeof(float), 1, pInFile);
+                        }
+                    }
+                }
+            }
+            else if (!strcmp(pstrToken, "<BindPoses>:"))
+            {
+                int nBindPoses = OldReadInteger(pInFile);
+                for (int i = 0; i < nBindPoses; i++)
+                {
+                    XMFLOAT4X4 xmf4x4BindPose;
+                    CountedRead(&xmf4x4BindPose, sizeof(float), 16, pInFile);
+                    pMeshInfo->m_vBindPoses.push_back(xmf4x4BindPose);
+                }
+            }
+            else if (!strcmp(pstrToken, "<BoneNames>:"))
+            {
+                int nBoneNames = OldReadInteger(pInFile);
+                char pstrBoneName[64] = { 0 };
+                for (int i = 0; i < nBoneNames; i++)
+                {
+                    OldReadString(pInFile, pstrBoneName, 64);
+                    pMeshInfo->m_vBoneNames.push_back(pstrBoneName);
+                }
+            }
+            else if (!strcmp(pstrToken, "<Indices>:"))
+            {
+                int nIndices = OldReadInteger(pInFile);
+                if (nIndices > 0)
+                {
+                    pMeshInfo->m_vIndices.resize(nIndices);
+                    CountedRead(pMeshInfo->m_vIndices.data(), sizeof(UINT), nIndices, pInFile);
+                }
+            }
+            else if (!strcmp(pstrToken, "<SubMeshes>:"))
+            {
+                int nSubMeshes = OldReadInteger(pInFile);
+                pMeshInfo->m_nSubMeshes = (std::max)(nSubMeshes, 0);
+                pMeshInfo->m_vSubSetIndexCounts.assign(pMeshInfo->m_nSubMeshes, 0);
+                pMeshInfo->m_vSubSetIndexStarts.assign(pMeshInfo->m_nSubMeshes, 0);
+                for (int i = 0; i < nSubMeshes; i++)
+                {
+                    pMeshInfo->m_vSubSetIndexStarts[i] = (UINT)pMeshInfo->m_vSubSetIndices.size();
+                    OldReadString(pInFile, pstrToken, 64);
+                    if (!strcmp(pstrToken, "<SubMesh>:"))
+                    {
+                        OldReadInteger(pInFile);
+                        int nSubIndices = OldReadInteger(pInFile);
+                        pMeshInfo->m_vSubSetIndexCounts[i] = nSubIndices;
+                        if (nSubIndices > 0)
+                        {
+                            size_t nStart = pMeshInfo->m_vSubSetIndices.size();
+                            pMeshInfo->m_vSubSetIndices.resize(nStart + nSubIndices);
+                            CountedRead(pMeshInfo->m_vSubSetIndices.data() + nStart, sizeof(UINT), nSubIndices, pInFile);
+                        }
+                    }
+                }
+            }
+            else if (!strcmp(pstrToken, "</Mesh>"))
+            {
+                break;
+            }
+        }
+        return pMeshInfo;
+    }
+
+    void OldReadFrameHierarchy(FILE* pInFile, MeshFrameInfo& frameInfo)
+    {
+        char pstrToken[64] = { '\0' };
+
+        for ( ; ; )
+        {
+            if (OldReadString(pInFile, pstrToken, 64) == 0) break;
+
+            wchar_t buffer[128];
+            swprintf_s(buffer, 128, L"  Read Token: %hs\n", pstrToken);
+            DebugString(buffer);
+
+            if (!strcmp(pstrToken, "<Frame>:"))
+            {
+                OldReadInteger(pInFile);
+                OldReadString(pInFile, frameInfo.m_pstrFrameName, 64);
+            }
+            else if (!strcmp(pstrToken, "<Transform>:"))
+            {
+                float pfTransform[13];
+                CountedRead(&pfTransform[0], sizeof(float), 3, pInFile);
+                CountedRead(&pfTransform[3], sizeof(float), 3, pInFile);
+                CountedRead(&pfTransform[6], sizeof(float), 3, pInFile);
+                CountedRead(&pfTransform[9], sizeof(float), 4, pInFile);
+            }
+            else if (!strcmp(pstrToken, "<TransformMatrix>:"))
+            {
+                CountedRead(&frameInfo.m_xmf4x4Transform, sizeof(float), 16, pInFile);
+                frameInfo.m_bHasTransform = true;
+            }
+            else if (!strcmp(pstrToken, "<Mesh>:"))
+            {
+                frameInfo.m_pMeshInfo = OldReadMeshInfo(pInFile);
+            }
+            else if (!strcmp(pstrToken, "<Materials>:"))
+            {
+                OldReadMaterials(pInFile, frameInfo);
+            }
+            else if (!strcmp(pstrToken, "<Children>:"))
+            {
+                int nChilds = OldReadInteger(pInFile);
+                frameInfo.m_vChildren.resize((std::max)(nChilds, 0));
+                for (int i = 0; i < nChilds; i++)
+                    OldReadFrameHierarchy(pInFile, frameInfo.m_vChildren[i]);
+            }
+            else if (!strcmp(pstrToken, "</Frame>"))
+            {
+                break;
+            }
+        }
+    }
+
+    std::unique_ptr<MeshFrameInfo> OldParseFile(const char* pstrFileName)
+    {
+        FILE* pInFile = NULL;
+        if (::fopen_s(&pInFile, pstrFileName, "rb") != 0 || !pInFile)
+            return nullptr;
+
+        std::unique_ptr<MeshFrameInfo> pRoot;
+        char pstrToken[64] = { '\0' };
+        for ( ; ; )
+        {
+            if (OldReadString(pInFile, pstrToken, 64) == 0) break;
+
+            if (!strcmp(pstrToken, "<Hierarchy>:"))
+            {
+                pRoot = std::make_unique<MeshFrameInfo>();
+                OldReadFrameHierarchy(pInFile, *pRoot);
+            }
+            else if (!strcmp(pstrToken, "</Hierarchy>"))
+            {
+                break;
+            }
+        }
+        ::fclose(pInFile);
+        return pRoot;
+    }
+
+    // ------------------------------------------------------------------------
+    // 비교
+    // ------------------------------------------------------------------------
+    template <typename T>
+    bool SameBytes(const std::vector<T>& a, const std::vector<T>& b)
+    {
+        return a.size() == b.size() && (a.empty() || memcmp(a.data(), b.data(), sizeof(T) * a.size()) == 0);
+    }
+
+    bool SameMesh(const MeshLoadInfo& a, const MeshLoadInfo& b)
+    {
+        return !strcmp(a.m_pstrMeshName, b.m_pstrMeshName) && a.m_nType == b.m_nType && a.m_nVertices == b.m_nVertices
+            && !memcmp(&a.m_xmf3AABBCenter, &b.m_xmf3AABBCenter, sizeof(XMFLOAT3))
+            && !memcmp(&a.m_xmf3AABBExtents, &b.m_xmf3AABBExtents, sizeof(XMFLOAT3))
+            && SameBytes(a.m_vPositions, b.m_vPositions) && SameBytes(a.m_vColors, b.m_vColors)
+            && SameBytes(a.m_vNormals, b.m_vNormals) && SameBytes(a.m_vTextureCoords0, b.m_vTextureCoords0)
+            && SameBytes(a.m_vBoneIndices, b.m_vBoneIndices) && SameBytes(a.m_vBoneWeights, b.m_vBoneWeights)
+            && a.m_vBoneNames == b.m_vBoneNames && SameBytes(a.m_vBindPoses, b.m_vBindPoses)
+            && SameBytes(a.m_vIndices, b.m_vIndices) && a.m_nSubMeshes == b.m_nSubMeshes
+            && a.m_vSubSetIndexCounts == b.m_vSubSetIndexCounts && a.m_vSubSetIndexStarts == b.m_vSubSetIndexStarts
+            && SameBytes(a.m_vSubSetIndices, b.m_vSubSetIndices);
+    }
+
+    bool SameFrame(const MeshFrameInfo& a, const MeshFrameInfo& b)
+    {
+        if (strcmp(a.m_pstrFrameName, b.m_pstrFrameName) || a.m_bHasTransform != b.m_bHasTransform)
+            return false;
+        if (a.m_bHasTransform && memcmp(&a.m_xmf4x4Transform, &b.m_xmf4x4Transform, sizeof(XMFLOAT4X4)))
+            return false;
+        if (!a.m_pMeshInfo != !b.m_pMeshInfo || (a.m_pMeshInfo && !SameMesh(*a.m_pMeshInfo, *b.m_pMeshInfo)))
+            return false;
+        if (a.m_vMaterialEvents.size() != b.m_vMaterialEvents.size() || a.m_vChildren.size() != b.m_vChildren.size())
+            return false;
+        for (size_t i = 0; i < a.m_vMaterialEvents.size(); ++i)
+        {
+            const MeshMaterialEvent& ea = a.m_vMaterialEvents[i];
+            const MeshMaterialEvent& eb = b.m_vMaterialEvents[i];
+            if (ea.m_bAlbedoMap != eb.m_bAlbedoMap || ea.m_strAlbedoMap != eb.m_strAlbedoMap
+                || memcmp(&ea.m_xmf4AlbedoColor, &eb.m_xmf4AlbedoColor, sizeof(XMFLOAT4)))
+                return false;
+        }
+        for (size_t i = 0; i < a.m_vChildren.size(); ++i)
+        {
+            if (!SameFrame(a.m_vChildren[i], b.m_vChildren[i]))
+                return false;
+        }
+        return true;
+    }
+
+    bool IsMeshFile(const std::string& strPath)
+    {
+        // 같은 폴더의 *_Anim.bin 은 애니메이션 (AnimationSet 이 읽는다)
+        return strPath.size() > 4 && strPath.compare(strPath.size() - 4, 4, ".bin") == 0
+            && (strPath.size() < 9 || strPath.compare(strPath.size() - 9, 9, "_Anim.bin") != 0);
+    }
+
+    double ElapsedMs(std::chrono::steady_clock::time_point t0)
+    {
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t0).count();
+    }
+}
+
+int main()
+{
+    std::vector<std::string> vPaths;
+    uintmax_t nTotalBytes = 0;
+    for (const char* pstrDir : { "Assets/Player", "Assets/Enemies" })
+    {
+        std::error_code ec;
+        for (const auto& entry : std::filesystem::recursive_directory_iterator(pstrDir, ec))
+        {
+            const std::string strPath = entry.path().generic_string();
+            if (entry.is_regular_file() && IsMeshFile(strPath))
+            {
+                vPaths.push_back(strPath);
+                nTotalBytes += entry.file_size();
+            }
+        }
+    }
+    std::sort(vPaths.begin(), vPaths.end());
+    if (vPaths.empty())
+    {
+        fprintf(stderr, "[MeshBench] no mesh .bin under Assets/Player or Assets/Enemies (run from gaym/)\n");
+        return 1;
+    }
+
+    // 1) 예전 경로
+    std::vector<std::unique_ptr<MeshFrameInfo>> vOld(vPaths.size());
+    auto t0 = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < vPaths.size(); ++i)
+        vOld[i] = OldParseFile(vPaths[i].c_str());
+    const double fOldMs = ElapsedMs(t0);
+
+    // 2) 한 번 읽기
+    std::vector<std::shared_ptr<const MeshFrameInfo>> vNew(vPaths.size());
+    t0 = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < vPaths.size(); ++i)
+        vNew[i] = ParseMeshFile(vPaths[i].c_str());
+    const double fNewMs = ElapsedMs(t0);
+
+    // 3) 파일 단위 병렬
+    const unsigned nThreads = (std::max)(1u, std::thread::hardware_concurrency());
+    std::vector<std::shared_ptr<const MeshFrameInfo>> vParallel(vPaths.size());
+    std::atomic<size_t> nNext = 0;
+    t0 = std::chrono::steady_clock::now();
+    {
+        std::vector<std::thread> vThreads;
+        for (unsigned t = 0; t < nThreads; ++t)
+        {
+            vThreads.emplace_back([&]()
+            {
+                for (size_t i = nNext++; i < vPaths.size(); i = nNext++)
+                    vParallel[i] = ParseMeshFile(vPaths[i].c_str());
+            });
+        }
+        for (std::thread& thread : vThreads)
+            thread.join();
+    }
+    const double fParallelMs = ElapsedMs(t0);
+
+    int nMismatches = 0;
+    for (size_t i = 0; i < vPaths.size(); ++i)
+    {
+        const bool bSame = vOld[i] && vNew[i] && vParallel[i]
+            && SameFrame(*vOld[i], *vNew[i]) && SameFrame(*vNew[i], *vParallel[i]);
+        if (!bSame)
+        {
+            fprintf(stderr, "[MeshBench] parse differs: %s\n", vPaths[i].c_str());
+            nMismatches++;
+        }
+    }
+
+    printf("[MeshBench] %zu files, %.1f MB\n", vPaths.size(), nTotalBytes / (1024.0 * 1024.0));
+    printf("[MeshBench] fread per field: %.1f ms (%ld freads, %ld OutputDebugString)\n", fOldMs, g_nFreads, g_nDebugStrings);
+    printf("[MeshBench] single read:     %.1f ms (%.1fx)\n", fNewMs, fOldMs / fNewMs);
+    printf("[MeshBench] single read x%u threads: %.1f ms (%.1fx)\n", nThreads, fParallelMs, fOldMs / fParallelMs);
+    printf("[MeshBench] %d of %zu files differ\n", nMismatches, vPaths.size());
+    return nMismatches == 0 ? 0 : 1;
+}
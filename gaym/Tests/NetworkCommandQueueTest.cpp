@@ -0,0 +1,408 @@
+#include "NetworkCommandQueue.h"
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+// NetworkCommandQueue (Dispatch 스레드 → NetworkManager::Update, SPSC 링 + 보조 큐)
+//  1) 순서: 소비자가 불규칙하게 늦어져 링이 넘치고 보조 큐로 갔다가 다시 링으로 돌아오기를 반복해도
+//     Spill 은 모든 명령이 보낸 순서 그대로, DropMoves 는 이동만 빠지고 나머지 순서는 그대로 나온다
+//  2) NetworkNameTable: 같은 이름은 같은 인덱스, 소비자 스레드에서 발행된 이름을 읽는다
+//  3) 벤치: 프레임마다 명령 10k 버스트를 200 프레임 재생 — 예전 mutex + vector (std::string 든 큰 명령) 대 링,
+//     Push ns/명령, 프레임당 Drain 시간, 명령당 힙 할당
+namespace
+{
+    std::atomic<int64_t> g_nAllocations{ 0 };
+}
+
+// 벤치 구간의 힙 할당 수를 센다
+void* operator new(size_t size)
+{
+    g_nAllocations.fetch_add(1, std::memory_order_relaxed);
+    if (void* p = std::malloc(size ? size : 1))
+        return p;
+    throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete(void* p, size_t) noexcept { std::free(p); }
+
+namespace
+{
+    constexpr int32_t kFrames = 200;
+    constexpr int32_t kCommandsPerFrame = 10000;
+
+    bool Check(bool condition, const char* what)
+    {
+        if (!condition)
+            fprintf(stderr, "[NetworkCommandQueue] FAILED: %s\n", what);
+        return condition;
+    }
+
+    double ElapsedUs(std::chrono::steady_clock::time_point t0)
+    {
+        return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - t0).count();
+    }
+
+    // 이동 (DropMoves 로 버릴 수 있는 것) 과 피해 (버리면 안 되는 것) 를 섞고, ID 자리에 보낸 순번을 넣는다
+    NetworkCommandData MakeOrdered(uint64 seq, bool bMove)
+    {
+        NetworkCommandData cmd{};
+        if (bMove)
+        {
+            cmd.type = NetworkCommand::MonsterMove;
+            cmd.monsterMove.monsterId = seq;
+        }
+        else
+        {
+            cmd.type = NetworkCommand::MonsterDamage;
+            cmd.monsterDamage.monsterId = seq;
+        }
+        return cmd;
+    }
+
+    uint64 SequenceOf(const NetworkCommandData& cmd)
+    {
+        return cmd.type == NetworkCommand::MonsterMove ? cmd.monsterMove.monsterId : cmd.monsterDamage.monsterId;
+    }
+
+    bool TestOrdering(NetworkOverflowPolicy ePolicy, const char* pstrPolicy)
+    {
+        constexpr uint64 kTotal = 1000000;
+
+        std::mt19937 rng(21);
+        std::vector<bool> vIsMove(kTotal + 1);
+        for (uint64 seq = 1; seq <= kTotal; ++seq)
+            vIsMove[seq] = rng() % 4 != 0;
+
+        auto pQueue = std::make_unique<NetworkCommandQueue>();     // 링이 768KB 라 스택에 두지 않는다
+        pQueue->SetOverflowPolicy(ePolicy);
+
+        std::atomic<bool> bDone{ false };
+        std::thread producer([&]()
+        {
+            for (uint64 seq = 1; seq <= kTotal; ++seq)
+            {
+                pQueue->Push(MakeOrdered(seq, vIsMove[seq]));
+                if (seq % 200000 == 0)      // 가끔 쉬어서 소비자가 따라잡고 링으로 돌아오게
+                    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+            }
+            bDone.store(true, std::memory_order_release);
+        });
+
+        // 소비자: 프레임이 들쭉날쭉한 메인 스레드
+        std::vector<NetworkCommandData> vCommands;
+        uint64 nReceived = 0, nLastSeq = 0, nOutOfOrder = 0, nMissing = 0, nMissingNonMoves = 0;
+        int32_t nDrains = 0;
+        while (true)
+        {
+            const bool bFinal = bDone.load(std::memory_order_acquire);
+            vCommands.clear();
+            pQueue->Drain(vCommands);
+            nDrains++;
+            for (const NetworkCommandData& cmd : vCommands)
+            {
+                const uint64 seq = SequenceOf(cmd);
+                if (seq <= nLastSeq)
+                {
+                    nOutOfOrder++;
+                    continue;
+                }
+                for (uint64 skipped = nLastSeq + 1; skipped < seq; ++skipped)
+                {
+                    nMissing++;
+                    nMissingNonMoves += vIsMove[skipped] ? 0 : 1;
+                }
+                nLastSeq = seq;
+                nReceived++;
+            }
+            if (bFinal)
+                break;
+            std::this_thread::sleep_for(std::chrono::microseconds(rng() % 4000));
+        }
+        producer.join();
+        for (uint64 skipped = nLastSeq + 1; skipped <= kTotal; ++skipped)
+        {
+            nMissing++;
+            nMissingNonMoves += vIsMove[skipped] ? 0 : 1;
+        }
+
+        const NetworkQueueStats stats = pQueue->GetStats();
+        printf("[NetworkCommandQueue] %s, %llu commands over %d drains: %llu received, %llu spilled, %llu dropped, max drain %u, out of order %llu\n",
+               pstrPolicy, (unsigned long long)kTotal, nDrains, (unsigned long long)nReceived, (unsigned long long)stats.spilled,
+               (unsigned long long)stats.dropped, stats.maxDrain, (unsigned long long)nOutOfOrder);
+
+        bool bOk = Check(nOutOfOrder == 0, "commands come out in the order they were pushed, across ring and spill");
+        bOk &= Check(stats.spilled > 0 && stats.spilled < kTotal, "the run overflows into the spill queue and returns to the ring");
+        bOk &= Check(stats.pushed == nReceived && nMissing == stats.dropped, "every command is either delivered or counted as dropped");
+        bOk &= Check(nMissingNonMoves == 0, "only moves are ever dropped");
+        if (ePolicy == NetworkOverflowPolicy::Spill)
+            bOk &= Check(nMissing == 0, "Spill loses nothing");
+        else
+            bOk &= Check(stats.dropped > 0, "DropMoves drops moves while the ring is full");
+        return bOk;
+    }
+
+    bool TestNameTable()
+    {
+        auto pTable = std::make_unique<NetworkNameTable>();
+        const uint32 a = pTable->Intern("Knight_01");
+        const uint32 b = pTable->Intern("궁수_긴이름_힙에_잡히는_이름");
+        bool bOk = Check(a != 0 && b != 0 && a != b, "distinct names get distinct indices");
+        bOk &= Check(pTable->Intern("Knight_01") == a && pTable->Intern("") == 0, "the same name keeps its index, empty is 0");
+
+        std::string strRead;
+        std::thread consumer([&]() { strRead = pTable->Get(b); });
+        consumer.join();
+        bOk &= Check(strRead == "궁수_긴이름_힙에_잡히는_이름" && pTable->Get(NetworkNameTable::CAPACITY + 5).empty(),
+                     "published names read back on another thread, unknown indices are empty");
+
+        for (uint32 i = 0; i < NetworkNameTable::CAPACITY + 10; ++i)
+            pTable->Intern("p" + std::to_string(i));
+        bOk &= Check(pTable->Intern("overflow_name") == 0, "a full table hands out the empty name");
+        return bOk;
+    }
+
+    // user-016 이전: std::string 이름까지 든 큰 명령을 mutex 로 잠근 vector 에 넣고 Update 에서 swap
+    struct LegacyCommandData
+    {
+        NetworkCommand type;
+        uint64 playerId;
+        std::string name;
+        int playerType;
+        float x, y, z;
+        float dirX, dirY, dirZ;
+        int skillType;
+        uint32 stageIndex;
+        uint32 roomIndex;
+        bool isBossRoom;
+        uint64 monsterId;
+        uint32 monsterType;
+        float monsterYaw;
+        float monsterHp;
+        bool monsterIsBoss;
+        uint32 attackType;
+        float windupSec;
+        uint64 targetPlayerId;
+        float damage;
+        float currentHp;
+        bool isDead;
+        uint64 attackerMonsterId;
+        uint64 attackerPlayerId;
+    };
+
+    class LegacyCommandQueue
+    {
+    public:
+        void Push(const LegacyCommandData& cmd)
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_vQueue.push_back(cmd);
+        }
+
+        void Drain(std::vector<LegacyCommandData>& out)
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            out.swap(m_vQueue);
+            m_vQueue.clear();
+        }
+
+    private:
+        std::mutex m_mutex;
+        std::vector<LegacyCommandData> m_vQueue;
+    };
+
+    // 몬스터 많은 방 한 프레임: 이동 위주, 가끔 스폰 (이름 있음) / 공격 / 피해
+    struct ReplayCommand
+    {
+        NetworkCommand type;
+        uint64 id;
+        float x, y, z, yaw;
+    };
+
+    std::vector<ReplayCommand> MakeFrameScript()
+    {
+        std::mt19937 rng(8);
+        std::uniform_real_distribution<float> pos(-40.0f, 40.0f);
+        std::vector<ReplayCommand> vScript(kCommandsPerFrame);
+        for (ReplayCommand& cmd : vScript)
+        {
+            const uint32_t kind = rng() % 100;
+            cmd.type = kind < 60 ? NetworkCommand::MonsterMove
+                     : kind < 80 ? NetworkCommand::Move
+                     : kind < 90 ? NetworkCommand::MonsterAttack
+                     : kind < 95 ? NetworkCommand::MonsterDamage
+                     : kind < 98 ? NetworkCommand::PlayerDamage
+                                 : NetworkCommand::Spawn;
+            cmd.id = 1 + rng() % 500;
+            cmd.x = pos(rng); cmd.y = 0.0f; cmd.z = pos(rng); cmd.yaw = pos(rng);
+        }
+        return vScript;
+    }
+
+    const std::string& PlayerName(uint64 id)
+    {
+        static std::vector<std::string> vNames = []()
+        {
+            std::vector<std::string> v;
+            for (int i = 0; i <= 500; ++i)
+                v.push_back("Adventurer_" + std::to_string(i) + "_of_the_Realm");
+            return v;
+        }();
+        return vNames[id % vNames.size()];
+    }
+
+    NetworkCommandData ToCommand(const ReplayCommand& src, NetworkNameTable& names)
+    {
+        NetworkCommandData cmd{};
+        cmd.type = src.type;
+        switch (src.type)
+        {
+        case NetworkCommand::MonsterMove:   cmd.monsterMove = { src.id, src.x, src.y, src.z, src.yaw }; break;
+        case NetworkCommand::Move:          cmd.move = { src.id, src.x, src.y, src.z, 0.0f, 0.0f, 1.0f }; break;
+        case NetworkCommand::MonsterAttack: cmd.monsterAttack = { src.id, 1, 0, src.x, src.y, src.z, src.yaw, 0.5f }; break;
+        case NetworkCommand::MonsterDamage: cmd.monsterDamage = { src.id, 1, 10.0f, 90.0f, 0, false }; break;
+        case NetworkCommand::PlayerDamage:  cmd.playerDamage = { src.id, 2, 5.0f, 95.0f, false }; break;
+        default:                            cmd.spawn = { src.id, names.Intern(PlayerName(src.id)), 0, src.x, src.y, src.z }; break;
+        }
+        return cmd;
+    }
+
+    LegacyCommandData ToLegacy(const ReplayCommand& src)
+    {
+        LegacyCommandData cmd{};
+        cmd.type = src.type;
+        cmd.playerId = src.id;
+        cmd.monsterId = src.id;
+        cmd.x = src.x; cmd.y = src.y; cmd.z = src.z;
+        cmd.monsterYaw = src.yaw;
+        if (src.type == NetworkCommand::Spawn)
+            cmd.name = PlayerName(src.id);
+        return cmd;
+    }
+
+    struct ReplayResult
+    {
+        double fPushNsPerCommand = 0.0;
+        double fDrainUsPerFrame = 0.0;
+        double fAllocsPerCommand = 0.0;
+        double fChecksum = 0.0;
+        int64_t nReceived = 0;
+    };
+
+    // 생산자가 한 프레임 분량을 밀어 넣는 동안 소비자는 계속 Drain, 다 받으면 다음 프레임
+    template<typename Queue, typename Command, typename Convert, typename Consume>
+    ReplayResult Replay(Queue& queue, const std::vector<ReplayCommand>& vScript, Convert convert, Consume consume)
+    {
+        ReplayResult result;
+        std::atomic<int32_t> nFrameDone{ 0 };
+        double fPushUs = 0.0;
+
+        const int64_t nAllocsBefore = g_nAllocations.load();
+        std::thread producer([&]()
+        {
+            for (int32_t frame = 0; frame < kFrames; ++frame)
+            {
+                const auto t0 = std::chrono::steady_clock::now();
+                for (const ReplayCommand& src : vScript)
+                    queue.Push(convert(src));
+                fPushUs += ElapsedUs(t0);
+                while (nFrameDone.load(std::memory_order_acquire) <= frame)
+                    std::this_thread::yield();
+            }
+        });
+
+        std::vector<Command> vCommands;
+        double fDrainUs = 0.0;
+        for (int32_t frame = 0; frame < kFrames; ++frame)
+        {
+            int32_t nFrameReceived = 0;
+            while (nFrameReceived < kCommandsPerFrame)
+            {
+                vCommands.clear();
+                const auto t0 = std::chrono::steady_clock::now();
+                queue.Drain(vCommands);
+                fDrainUs += ElapsedUs(t0);
+                for (const Command& cmd : vCommands)
+                    result.fChecksum += consume(cmd);
+                nFrameReceived += static_cast<int32_t>(vCommands.size());
+                if (vCommands.empty())
+                    std::this_thread::yield();
+            }
+            result.nReceived += nFrameReceived;
+            nFrameDone.store(frame + 1, std::memory_order_release);
+        }
+        producer.join();
+
+        const double fTotal = static_cast<double>(kFrames) * kCommandsPerFrame;
+        result.fPushNsPerCommand = fPushUs * 1000.0 / fTotal;
+        result.fDrainUsPerFrame = fDrainUs / kFrames;
+        result.fAllocsPerCommand = (g_nAllocations.load() - nAllocsBefore) / fTotal;
+        return result;
+    }
+
+    bool BenchReplay()
+    {
+        const std::vector<ReplayCommand> vScript = MakeFrameScript();
+
+        LegacyCommandQueue legacy;
+        const ReplayResult old = Replay<LegacyCommandQueue, LegacyCommandData>(legacy, vScript,
+            [](const ReplayCommand& src) { return ToLegacy(src); },
+            [](const LegacyCommandData& cmd)
+            {
+                switch (cmd.type)
+                {
+                case NetworkCommand::MonsterMove:
+                case NetworkCommand::Move:
+                case NetworkCommand::MonsterAttack: return static_cast<double>(cmd.x);
+                case NetworkCommand::Spawn:         return static_cast<double>(cmd.x) + cmd.name.size();
+                default:                            return 0.0;
+                }
+            });
+
+        auto pQueue = std::make_unique<NetworkCommandQueue>();
+        auto pNames = std::make_unique<NetworkNameTable>();
+        NetworkNameTable& names = *pNames;
+        const ReplayResult ring = Replay<NetworkCommandQueue, NetworkCommandData>(*pQueue, vScript,
+            [&names](const ReplayCommand& src) { return ToCommand(src, names); },
+            [&names](const NetworkCommandData& cmd)
+            {
+                // NetworkManager::Update 처럼 타입별로 꺼내 쓴다
+                switch (cmd.type)
+                {
+                case NetworkCommand::MonsterMove:   return static_cast<double>(cmd.monsterMove.x);
+                case NetworkCommand::Move:          return static_cast<double>(cmd.move.x);
+                case NetworkCommand::MonsterAttack: return static_cast<double>(cmd.monsterAttack.x);
+                case NetworkCommand::Spawn:         return static_cast<double>(cmd.spawn.x) + names.Get(cmd.spawn.nameIndex).size();
+                default:                            return 0.0;
+                }
+            });
+
+        const NetworkQueueStats stats = pQueue->GetStats();
+        printf("[NetworkCommandQueue] replay %d frames x %d commands: mutex + vector push %.1f ns, drain %.1f us/frame, %.3f allocs/command\n",
+               kFrames, kCommandsPerFrame, old.fPushNsPerCommand, old.fDrainUsPerFrame, old.fAllocsPerCommand);
+        printf("[NetworkCommandQueue] replay %d frames x %d commands: SPSC ring    push %.1f ns, drain %.1f us/frame, %.3f allocs/command (spilled %llu, max drain %u)\n",
+               kFrames, kCommandsPerFrame, ring.fPushNsPerCommand, ring.fDrainUsPerFrame, ring.fAllocsPerCommand,
+               (unsigned long long)stats.spilled, stats.maxDrain);
+
+        bool bOk = Check(old.nReceived == ring.nReceived && old.fChecksum == ring.fChecksum, "both queues deliver the same commands");
+        bOk &= Check(stats.spilled == 0, "a 10k burst fits in the ring");
+        return bOk;
+    }
+}
+
+int main()
+{
+    bool bOk = TestOrdering(NetworkOverflowPolicy::Spill, "Spill");
+    bOk = TestOrdering(NetworkOverflowPolicy::DropMoves, "DropMoves") && bOk;
+    bOk = TestNameTable() && bOk;
+    bOk = BenchReplay() && bOk;
+    return bOk ? 0 : 1;
+}
@@ -0,0 +1,300 @@
+#include "pch.h"
+#include "ServerPacketHandler.h"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <new>
+#include <random>
+
+// ServerPacketHandler::HandlePacket (switch + 쓰레드별 메시지 재사용) 와 이전 방식
+// (65536 칸 std::function 표 + 패킷마다 새 메시지) 을 같은 패킷 열로 비교한다.
+// 핸들러는 필드 하나만 읽으므로 파싱 + 분기 비용만 남는다. ns/packet 과 allocations/packet 보고.
+// 패킷 열은 서버 송신 패턴을 흉내 낸 세 가지 혼합 (전투 / 방 입장 / 로비·채팅)
+namespace
+{
+    size_t g_nAllocs = 0;
+    volatile double g_fSink = 0.0;
+}
+
+void* operator new(size_t nSize)
+{
+    ++g_nAllocs;
+    if (void* p = malloc(nSize ? nSize : 1))
+        return p;
+    throw std::bad_alloc();
+}
+void operator delete(void* p) noexcept { free(p); }
+void operator delete(void* p, size_t) noexcept { free(p); }
+
+// 클라이언트 핸들러 대신: 필드 하나 읽기
+bool Handle_INVALID(PacketSessionRef&, BYTE*, int32) { return false; }
+bool Handle_S_LOGIN(PacketSessionRef&, Protocol::S_LOGIN& pkt) { g_fSink += pkt.players_size(); return true; }
+bool Handle_S_ENTER_GAME(PacketSessionRef&, Protocol::S_ENTER_GAME& pkt) { g_fSink += pkt.playerid(); return true; }
+bool Handle_S_CHAT(PacketSessionRef&, Protocol::S_CHAT& pkt) { g_fSink += pkt.msg().size(); return true; }
+bool Handle_S_SPAWN(PacketSessionRef&, Protocol::S_SPAWN& pkt) { g_fSink += pkt.player().x(); return true; }
+bool Handle_S_DESPAWN(PacketSessionRef&, Protocol::S_DESPAWN& pkt) { g_fSink += pkt.playerid(); return true; }
+bool Handle_S_MOVE(PacketSessionRef&, Protocol::S_MOVE& pkt) { g_fSink += pkt.x(); return true; }
+bool Handle_S_SKILL(PacketSessionRef&, Protocol::S_SKILL& pkt) { g_fSink += pkt.dirx(); return true; }
+bool Handle_S_ROOM_TRANSITION(PacketSessionRef&, Protocol::S_ROOM_TRANSITION& pkt) { g_fSink += pkt.roomindex(); return true; }
+bool Handle_S_MONSTER_SPAWN(PacketSessionRef&, Protocol::S_MONSTER_SPAWN& pkt) { g_fSink += pkt.monster().hp(); return true; }
+bool Handle_S_MONSTER_MOVE(PacketSessionRef&, Protocol::S_MONSTER_MOVE& pkt) { g_fSink += pkt.x(); return true; }
+bool Handle_S_MONSTER_DESPAWN(PacketSessionRef&, Protocol::S_MONSTER_DESPAWN& pkt) { g_fSink += pkt.monsterid(); return true; }
+bool Handle_S_MONSTER_ATTACK(PacketSessionRef&, Protocol::S_MONSTER_ATTACK& pkt) { g_fSink += pkt.windupsec(); return true; }
+bool Handle_S_PLAYER_DAMAGE(PacketSessionRef&, Protocol::S_PLAYER_DAMAGE& pkt) { g_fSink += pkt.damage(); return true; }
+bool Handle_S_MONSTER_DAMAGE(PacketSessionRef&, Protocol::S_MONSTER_DAMAGE& pkt) { g_fSink += pkt.damage(); return true; }
+bool Handle_S_ROOM_CLEARED(PacketSessionRef&, Protocol::S_ROOM_CLEARED& pkt) { g_fSink += pkt.stageindex(); return true; }
+bool Handle_S_MONSTER_SNAPSHOT(PacketSessionRef&, BYTE*, int32 len) { g_fSink += len; return true; }
+
+namespace
+{
+    // 이전 ServerPacketHandler: GPacketHandler[UINT16_MAX] + 패킷마다 메시지 생성
+    using PacketHandlerFunc = std::function<bool(PacketSessionRef&, BYTE*, int32)>;
+    PacketHandlerFunc g_TableHandler[UINT16_MAX];
+
+    template<typename PacketType, typename ProcessFunc>
+    bool TableHandlePacket(ProcessFunc func, PacketSessionRef& session, BYTE* buffer, int32 len)
+    {
+        PacketType pkt;
+        if (pkt.ParseFromArray(buffer + sizeof(PacketHeader), len - sizeof(PacketHeader)) == false)
+            return false;
+        return func(session, pkt);
+    }
+
+#define TABLE_ENTRY(NAME) \
+    g_TableHandler[PKT_##NAME] = [](PacketSessionRef& s, BYTE* b, int32 l) { return TableHandlePacket<Protocol::NAME>(Handle_##NAME, s, b, l); }
+
+    void InitTable()
+    {
+        for (int32 i = 0; i < UINT16_MAX; i++)
+            g_TableHandler[i] = Handle_INVALID;
+        TABLE_ENTRY(S_LOGIN);
+        TABLE_ENTRY(S_ENTER_GAME);
+        TABLE_ENTRY(S_CHAT);
+        TABLE_ENTRY(S_SPAWN);
+        TABLE_ENTRY(S_DESPAWN);
+        TABLE_ENTRY(S_MOVE);
+        TABLE_ENTRY(S_SKILL);
+        TABLE_ENTRY(S_ROOM_TRANSITION);
+        TABLE_ENTRY(S_MONSTER_SPAWN);
+        TABLE_ENTRY(S_MONSTER_MOVE);
+        TABLE_ENTRY(S_MONSTER_DESPAWN);
+        TABLE_ENTRY(S_MONSTER_ATTACK);
+        TABLE_ENTRY(S_PLAYER_DAMAGE);
+        TABLE_ENTRY(S_MONSTER_DAMAGE);
+        TABLE_ENTRY(S_ROOM_CLEARED);
+        g_TableHandler[PKT_S_MONSTER_SNAPSHOT] = Handle_S_MONSTER_SNAPSHOT;
+    }
+#undef TABLE_ENTRY
+
+    using Packet = std::vector<BYTE>;
+
+    template<typename T>
+    Packet MakePacket(const T& pkt, uint16 id)
+    {
+        const uint32 dataSize = static_cast<uint32>(pkt.ByteSizeLong());
+        Packet packet(PacketSession::HeaderSize(dataSize) + dataSize);
+        const uint32 headerSize = PacketSession::WriteHeader(packet.data(), id, dataSize) - dataSize;
+        pkt.SerializeToArray(packet.data() + headerSize, static_cast<int>(dataSize));
+        return packet;
+    }
+
+    class PacketMix
+    {
+    public:
+        explicit PacketMix(uint32 nSeed) : m_rng(nSeed) {}
+
+        float Pos() { return std::uniform_real_distribution<float>(-50.0f, 50.0f)(m_rng); }
+        uint64 MonsterId() { return 1000 + m_rng() % 300; }
+        bool Chance(int nPercent) { return static_cast<int>(m_rng() % 100) < nPercent; }
+
+        Packet MonsterMove()
+        {
+            Protocol::S_MONSTER_MOVE pkt;
+            pkt.set_monsterid(MonsterId()); pkt.set_x(Pos()); pkt.set_y(0.5f); pkt.set_z(Pos()); pkt.set_yaw(Pos());
+            return MakePacket(pkt, PKT_S_MONSTER_MOVE);
+        }
+        Packet PlayerMove()
+        {
+            Protocol::S_MOVE pkt;
+            pkt.set_playerid(2); pkt.set_x(Pos()); pkt.set_y(1.0f); pkt.set_z(Pos()); pkt.set_dirx(1.0f);
+            return MakePacket(pkt, PKT_S_MOVE);
+        }
+        Packet MonsterDamage()
+        {
+            Protocol::S_MONSTER_DAMAGE pkt;
+            pkt.set_monsterid(MonsterId()); pkt.set_damage(12.5f); pkt.set_currenthp(40.0f); pkt.set_attackerplayerid(2);
+            return MakePacket(pkt, PKT_S_MONSTER_DAMAGE);
+        }
+        Packet MonsterAttack()
+        {
+            Protocol::S_MONSTER_ATTACK pkt;
+            pkt.set_monsterid(MonsterId()); pkt.set_targetplayerid(2); pkt.set_attacktype(1);
+            pkt.set_x(Pos()); pkt.set_z(Pos()); pkt.set_windupsec(0.4f);
+            return MakePacket(pkt, PKT_S_MONSTER_ATTACK);
+        }
+        Packet PlayerDamage()
+        {
+            Protocol::S_PLAYER_DAMAGE pkt;
+            pkt.set_playerid(2); pkt.set_damage(8.0f); pkt.set_currenthp(70.0f); pkt.set_attackermonsterid(MonsterId());
+            return MakePacket(pkt, PKT_S_PLAYER_DAMAGE);
+        }
+        Packet Skill()
+        {
+            Protocol::S_SKILL pkt;
+            pkt.set_playerid(3); pkt.set_x(Pos()); pkt.set_z(Pos()); pkt.set_dirx(0.7f); pkt.set_dirz(0.7f);
+            return MakePacket(pkt, PKT_S_SKILL);
+        }
+        Packet MonsterSpawn()
+        {
+            Protocol::S_MONSTER_SPAWN pkt;
+            Protocol::MonsterInfo* pInfo = pkt.mutable_monster();
+            pInfo->set_monsterid(MonsterId()); pInfo->set_monstertype(m_rng() % 4);
+            pInfo->set_x(Pos()); pInfo->set_z(Pos()); pInfo->set_hp(100.0f);
+            return MakePacket(pkt, PKT_S_MONSTER_SPAWN);
+        }
+        Packet Spawn()
+        {
+            Protocol::S_SPAWN pkt;
+            Protocol::Player* pPlayer = pkt.mutable_player();
+            pPlayer->set_playerid(m_rng() % 8); pPlayer->set_name("player_with_a_long_name_" + std::to_string(m_rng() % 8));
+            pPlayer->set_x(Pos()); pPlayer->set_z(Pos());
+            return MakePacket(pkt, PKT_S_SPAWN);
+        }
+        Packet Chat()
+        {
+            Protocol::S_CHAT pkt;
+            pkt.set_playerid(3); pkt.set_msg(std::string(40 + m_rng() % 40, 'x'));
+            return MakePacket(pkt, PKT_S_CHAT);
+        }
+        Packet Login()
+        {
+            Protocol::S_LOGIN pkt;
+            pkt.set_success(true);
+            for (int i = 0; i < 3; ++i)
+            {
+                Protocol::Player* pPlayer = pkt.add_players();
+                pPlayer->set_playerid(i); pPlayer->set_name("player_with_a_long_name_" + std::to_string(i));
+            }
+            return MakePacket(pkt, PKT_S_LOGIN);
+        }
+
+    private:
+        std::mt19937 m_rng;
+    };
+
+    constexpr int kPacketCount = 10000;
+
+    // 전투 중: 몬스터 이동이 대부분, 피격/공격/스킬 섞임
+    std::vector<Packet> MakeCombatMix()
+    {
+        PacketMix mix(1);
+        std::vector<Packet> v;
+        while (v.size() < kPacketCount)
+        {
+            const int k = static_cast<int>(v.size() * 7919 % 100);
+            if      (k < 70) v.push_back(mix.MonsterMove());
+            else if (k < 80) v.push_back(mix.PlayerMove());
+            else if (k < 88) v.push_back(mix.MonsterDamage());
+            else if (k < 93) v.push_back(mix.MonsterAttack());
+            else if (k < 97) v.push_back(mix.PlayerDamage());
+            else             v.push_back(mix.Skill());
+        }
+        return v;
+    }
+
+    // 방 입장: 전환 → 몬스터 30 마리 스폰 → 이동 몇 프레임
+    std::vector<Packet> MakeRoomEnterMix()
+    {
+        PacketMix mix(2);
+        std::vector<Packet> v;
+        while (v.size() < kPacketCount)
+        {
+            Protocol::S_ROOM_TRANSITION transition;
+            transition.set_stageindex(1); transition.set_roomindex(static_cast<uint32>(v.size() % 7));
+            v.push_back(MakePacket(transition, PKT_S_ROOM_TRANSITION));
+            for (int i = 0; i < 30; ++i)
+                v.push_back(mix.MonsterSpawn());
+            for (int i = 0; i < 90; ++i)
+                v.push_back(mix.MonsterMove());
+        }
+        v.resize(kPacketCount);
+        return v;
+    }
+
+    // 로비/마을: 채팅, 접속, 플레이어 스폰/이동
+    std::vector<Packet> MakeLobbyMix()
+    {
+        PacketMix mix(3);
+        std::vector<Packet> v;
+        while (v.size() < kPacketCount)
+        {
+            if      (mix.Chance(40)) v.push_back(mix.Chat());
+            else if (mix.Chance(15)) v.push_back(mix.Login());
+            else if (mix.Chance(35)) v.push_back(mix.Spawn());
+            else                     v.push_back(mix.PlayerMove());
+        }
+        return v;
+    }
+
+    struct Result
+    {
+        double fNsPerPacket;
+        double fAllocsPerPacket;
+    };
+
+    template<typename DispatchFunc>
+    Result Measure(std::vector<Packet>& vPackets, DispatchFunc dispatch)
+    {
+        PacketSessionRef session;
+        constexpr int kReps = 30;
+
+        for (Packet& packet : vPackets)   // 워밍업 (쓰레드별 메시지 버퍼가 자리 잡도록)
+            dispatch(session, packet.data(), static_cast<int32>(packet.size()));
+
+        const size_t nAllocs = g_nAllocs;
+        const auto t0 = std::chrono::steady_clock::now();
+        for (int rep = 0; rep < kReps; ++rep)
+        {
+            for (Packet& packet : vPackets)
+                dispatch(session, packet.data(), static_cast<int32>(packet.size()));
+        }
+        const double fNs = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - t0).count();
+        const double fPackets = static_cast<double>(kReps) * vPackets.size();
+        return { fNs / fPackets, (g_nAllocs - nAllocs) / fPackets };
+    }
+}
+
+int main()
+{
+    InitTable();
+
+    struct Mix { const char* pName; std::vector<Packet> vPackets; };
+    Mix mixes[] =
+    {
+        { "combat",     MakeCombatMix() },
+        { "room enter", MakeRoomEnterMix() },
+        { "lobby/chat", MakeLobbyMix() },
+    };
+
+    bool bOk = true;
+    printf("[PacketBench] %-10s  %14s %12s  %14s %12s\n", "mix", "table ns/pkt", "allocs/pkt", "switch ns/pkt", "allocs/pkt");
+    for (Mix& mix : mixes)
+    {
+        const Result table = Measure(mix.vPackets, [](PacketSessionRef& s, BYTE* b, int32 l)
+            { return g_TableHandler[reinterpret_cast<PacketHeader*>(b)->id](s, b, l); });
+        const Result dispatch = Measure(mix.vPackets, [](PacketSessionRef& s, BYTE* b, int32 l)
+            { return ServerPacketHandler::HandlePacket(s, b, l); });
+
+        printf("[PacketBench] %-10s  %14.1f %12.2f  %14.1f %12.2f\n", mix.pName,
+               table.fNsPerPacket, table.fAllocsPerPacket, dispatch.fNsPerPacket, dispatch.fAllocsPerPacket);
+
+        // 재사용 메시지는 워밍업 뒤 할당이 없어야 한다
+        if (dispatch.fAllocsPerPacket > 0.01)
+        {
+            fprintf(stderr, "[PacketBench] %s: switch dispatch still allocates (%.2f/packet)\n", mix.pName, dispatch.fAllocsPerPacket);
+            bOk = false;
+        }
+    }
+    return bOk ? 0 : 1;
+}
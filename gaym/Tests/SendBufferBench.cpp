@@ -0,0 +1,168 @@
+#include "pch.h"
+#include "SendBuffer.h"
+#include "ThreadManager.h"
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <random>
+
+// SendBufferManager (등급별 청크 + 스레드 캐시 + 창고) 검증 + 작은/큰 패킷 섞인 송신 벤치
+//  1) 창고 바이트 한도: 1MB Large 청크 64 개 / Medium 청크 250 개를 한꺼번에 돌려줘도 등급별 한도 안에서만 남는다
+//     (예전 DEPOT_MAX = 256 개 기준이면 Large 는 최대 256MB 가 묶였다)
+//  2) 크기가 바뀌면 Large 창고는 오래된 청크부터 밀어내고 새 크기를 들고 있는다
+//  3) 스레드 1 / 2 / 4: 95% 작은 패킷 (64B ~ 1.5KB), 4% 중간 (2 ~ 16KB), 1% 큰 패킷 (20KB ~ 1MB),
+//     송신 중인 패킷 64 개를 들고 있다가 오래된 것부터 놓는다 — SendBufferManager 대 패킷마다 새 버퍼
+namespace
+{
+    constexpr int32 kOpsPerThread = 100000;
+    constexpr int32 kInFlight = 64;
+
+    bool Check(bool condition, const char* what)
+    {
+        if (!condition)
+            fprintf(stderr, "[SendBufferBench] FAILED: %s\n", what);
+        return condition;
+    }
+
+    double ElapsedMs(chrono::steady_clock::time_point t0)
+    {
+        return chrono::duration<double, milli>(chrono::steady_clock::now() - t0).count();
+    }
+
+    double Mb(uint64 bytes)
+    {
+        return bytes / (1024.0 * 1024.0);
+    }
+
+    SendBufferRef OpenPacket(uint32 size)
+    {
+        SendBufferRef sendBuffer = GSendBufferManager->Open(size);
+        ::memset(sendBuffer->Buffer(), 0, 4);      // PacketHeader 만 쓴다
+        sendBuffer->Close(size);
+        return sendBuffer;
+    }
+
+    // 한꺼번에 열었다가 한꺼번에 놓는다 (맵 전체 동기화, 접속 폭주 뒤)
+    void Burst(uint32 size, int32 count)
+    {
+        Vector<SendBufferRef> held;
+        for (int32 i = 0; i < count; ++i)
+            held.push_back(OpenPacket(size));
+    }
+
+    bool TestDepotBudget()
+    {
+        // 메인 스레드: 돌려준 청크는 스레드 캐시 (Large 4 개) 를 넘치는 만큼 창고로 간다
+        Burst(SendBufferChunk::LARGE_CACHE_MAX, 64);
+        const uint64 largeBytes = GSendBufferManager->GetDepotBytes(SendBufferClass::Large);
+
+        // 다른 스레드: 끝날 때 캐시까지 전부 창고로 (16KB 패킷 4 개가 64KB 청크 하나)
+        GThreadManager->Launch([]() { Burst(SendBufferChunk::MEDIUM_ALLOC_MAX, 1000); });
+        GThreadManager->Join();
+        const uint64 mediumBytes = GSendBufferManager->GetDepotBytes(SendBufferClass::Medium);
+
+        printf("[SendBufferBench] after 64 x 1MB and 250 x 64KB chunks come back: depot Large %.1f MB (max %.1f, was up to 256), Medium %.1f MB (max %.1f, was up to 16)\n",
+               Mb(largeBytes), Mb(SendBufferManager::DEPOT_LARGE_BYTES_MAX),
+               Mb(mediumBytes), Mb(SendBufferManager::DEPOT_MEDIUM_BYTES_MAX));
+
+        bool bOk = Check(largeBytes > 0 && largeBytes <= SendBufferManager::DEPOT_LARGE_BYTES_MAX, "the Large depot stays within its byte budget");
+        bOk &= Check(mediumBytes > 0 && mediumBytes <= SendBufferManager::DEPOT_MEDIUM_BYTES_MAX, "the Medium depot stays within its byte budget");
+
+        // 128KB 로 바뀌면 1MB 청크가 밀려나고, 다음 128KB 버스트는 창고에서 받아 간다
+        Burst(SendBufferChunk::LARGE_CHUNK_MIN, 64);
+        const uint64 shiftedBytes = GSendBufferManager->GetDepotBytes(SendBufferClass::Large);
+        uint64 heldBytes = 0;
+        {
+            Vector<SendBufferRef> held;
+            for (int32 i = 0; i < 32; ++i)
+                held.push_back(OpenPacket(SendBufferChunk::LARGE_CHUNK_MIN));
+            heldBytes = GSendBufferManager->GetDepotBytes(SendBufferClass::Large);
+        }
+
+        printf("[SendBufferBench] after 64 x 128KB: depot Large %.1f MB, %.1f MB while the next 32 x 128KB are held\n",
+               Mb(shiftedBytes), Mb(heldBytes));
+        bOk &= Check(shiftedBytes <= SendBufferManager::DEPOT_LARGE_BYTES_MAX, "the Large depot stays within budget after a size change");
+        bOk &= Check(shiftedBytes % SendBufferChunk::LARGE_CACHE_MAX != 0, "old 1MB chunks make room for the new size");
+        bOk &= Check(heldBytes + 16 * SendBufferChunk::LARGE_CHUNK_MIN <= shiftedBytes, "the next burst of the new size reuses depot chunks");
+        return bOk;
+    }
+
+    uint32 PacketSize(mt19937& rng)
+    {
+        const uint32 kind = rng() % 100;
+        if (kind < 95)
+            return 64 + rng() % (1500 - 64);
+        if (kind < 99)
+            return 2048 + rng() % (SendBufferChunk::MEDIUM_ALLOC_MAX - 2048);
+        return 20 * 1024 + rng() % (SendBufferChunk::LARGE_CACHE_MAX - 20 * 1024);
+    }
+
+    template<typename OpenFunc>
+    double RunMixed(int32 threads, OpenFunc open)
+    {
+        Atomic<int32> ready = 0;
+        Atomic<bool> go = false;
+        for (int32 t = 0; t < threads; ++t)
+        {
+            GThreadManager->Launch([&, t]()
+            {
+                mt19937 rng(17 + t);
+                ready.fetch_add(1);
+                while (go == false)
+                    this_thread::yield();
+
+                open(rng);
+            });
+        }
+
+        while (ready < threads)
+            this_thread::yield();
+        const auto t0 = chrono::steady_clock::now();
+        go = true;
+        GThreadManager->Join();
+        return ElapsedMs(t0);
+    }
+
+    void BenchMixed(int32 threads)
+    {
+        const double poolMs = RunMixed(threads, [](mt19937& rng)
+        {
+            Vector<SendBufferRef> inFlight(kInFlight);
+            for (int32 i = 0; i < kOpsPerThread; ++i)
+                inFlight[i % kInFlight] = OpenPacket(PacketSize(rng));
+        });
+
+        const uint64 depotBytes = GSendBufferManager->GetDepotBytes(SendBufferClass::Small)
+                                + GSendBufferManager->GetDepotBytes(SendBufferClass::Medium)
+                                + GSendBufferManager->GetDepotBytes(SendBufferClass::Large);
+
+        // 패킷마다 버퍼를 새로 잡는 경우 (user-013 이전처럼 캐시 없이)
+        const double newMs = RunMixed(threads, [](mt19937& rng)
+        {
+            std::vector<shared_ptr<std::vector<BYTE>>> inFlight(kInFlight);
+            for (int32 i = 0; i < kOpsPerThread; ++i)
+            {
+                auto buffer = make_shared<std::vector<BYTE>>(PacketSize(rng));
+                ::memset(buffer->data(), 0, 4);
+                inFlight[i % kInFlight] = std::move(buffer);
+            }
+        });
+
+        const double totalOps = static_cast<double>(threads) * kOpsPerThread;
+        printf("[SendBufferBench] mixed sends, %d threads: SendBufferManager %.1f ns/op (depot %.1f MB after), new buffer per packet %.1f ns/op\n",
+               threads, poolMs * 1.0e6 / totalOps, Mb(depotBytes), newMs * 1.0e6 / totalOps);
+    }
+}
+
+int main()
+{
+    ThreadManager::InitTLS();
+
+    bool bOk = TestDepotBudget();
+    for (int32 threads : { 1, 2, 4 })
+        BenchMixed(threads);
+
+    const uint64 largeBytes = GSendBufferManager->GetDepotBytes(SendBufferClass::Large);
+    bOk = Check(largeBytes <= SendBufferManager::DEPOT_LARGE_BYTES_MAX, "the Large depot stays within budget under mixed load") && bOk;
+    return bOk ? 0 : 1;
+}
@@ -0,0 +1,382 @@
+#include "SortedDrawList.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <set>
+
+// SortedDrawList (Shader 의 그리기 목록) CPU 검증
+//  1) 무작위 장면 편집 (생성/삭제/표시/숨김/텍스처 교체) 을 Insert/Remove 로만 반영한 목록이
+//     살아 있는 전체를 다시 모아 Assign 한 목록과 같은지 (키 열, 같은 키 안의 항목 집합, 패스 구간)
+//  2) 투명 패스: 재질/메쉬와 상관없이 넣은 순서 (Assign 은 모은 순서) 그대로, 중간에서 빼도 나머지 순서는 그대로
+//  3) 오브젝트 10k 에서 프레임당 비용 — 예전 방식 (매 프레임 다시 모으기), 매 프레임 정렬 재구성, 증분
+namespace
+{
+    // RenderComponent::GetSortKey 와 같은 배치: 패스(2) | 머티리얼(30) | 메쉬(32)
+    uint64_t MakeKey(uint32_t nPass, uint32_t nMaterial, uint32_t nMesh)
+    {
+        return (uint64_t(nPass) << 62) | (uint64_t(nMaterial & 0x3FFFFFFF) << 32) | nMesh;
+    }
+
+    struct SceneObject
+    {
+        bool     bAlive = false;
+        bool     bVisible = false;
+        uint64_t nListedKey = 0;    // RenderComponent::GetListedKey — Insert 가 돌려준 키
+        uint32_t nPass = 0;
+        uint32_t nMaterial = 0;
+        uint32_t nMesh = 0;
+        uint64_t GetKey() const { return MakeKey(nPass, nMaterial, nMesh); }
+    };
+
+    // 장면 + 증분 목록. 오브젝트 인덱스가 항목 (RenderComponent* 대신)
+    class DrawScene
+    {
+    public:
+        explicit DrawScene(uint32_t nSeed) : m_rng(nSeed) {}
+
+        int Create()
+        {
+            SceneObject obj;
+            obj.bAlive = true;
+            obj.bVisible = true;
+            obj.nPass = Pick(10) == 0 ? 1 : (Pick(20) == 0 ? 2 : 0);   // 대부분 불투명
+            obj.nMaterial = Pick(24);
+            obj.nMesh = 0x1000 + Pick(40) * 0x40;
+            m_vObjects.push_back(obj);
+
+            const int nIndex = static_cast<int>(m_vObjects.size()) - 1;
+            Show(nIndex);
+            return nIndex;
+        }
+
+        bool Destroy(int nIndex)
+        {
+            const bool bRemoved = Hide(nIndex);
+            m_vObjects[nIndex].bAlive = false;
+            return bRemoved;
+        }
+
+        void Show(int nIndex)
+        {
+            SceneObject& obj = m_vObjects[nIndex];
+            obj.bVisible = true;
+            obj.nListedKey = m_List.Insert(obj.GetKey(), nIndex);
+        }
+
+        bool Hide(int nIndex)
+        {
+            SceneObject& obj = m_vObjects[nIndex];
+            if (!obj.bVisible)
+                return true;
+            obj.bVisible = false;
+            return m_List.Remove(obj.nListedKey, nIndex);
+        }
+
+        // 텍스처 교체: 키가 바뀌므로 빼고 새 키로 다시 넣는다
+        bool ChangeMaterial(int nIndex)
+        {
+            SceneObject& obj = m_vObjects[nIndex];
+            const bool bWasVisible = obj.bVisible;
+            const bool bRemoved = Hide(nIndex);
+            obj.nMaterial = Pick(24);
+            if (bWasVisible)
+                Show(nIndex);
+            return bRemoved;
+        }
+
+        // 무작위 편집 한 번. Remove 가 항목을 못 찾으면 false
+        bool Edit()
+        {
+            const uint32_t nOp = Pick(100);
+            const int nIndex = RandomAlive();
+            if (nOp < 30 || nIndex < 0)
+            {
+                Create();
+                return true;
+            }
+            if (nOp < 50)
+                return Destroy(nIndex);
+            if (nOp < 75)
+            {
+                if (m_vObjects[nIndex].bVisible)
+                    return Hide(nIndex);
+                Show(nIndex);
+                return true;
+            }
+            return ChangeMaterial(nIndex);
+        }
+
+        // Scene 의 전체 재구성과 같음: 살아 있고 보이는 것을 장면 순서대로 모아 Assign
+        void Rebuild(SortedDrawList<int>& outList, std::vector<std::pair<uint64_t, int>>& vScratch) const
+        {
+            vScratch.clear();
+            for (int i = 0; i < static_cast<int>(m_vObjects.size()); ++i)
+            {
+                const SceneObject& obj = m_vObjects[i];
+                if (obj.bAlive && obj.bVisible)
+                    vScratch.emplace_back(obj.GetKey(), i);
+            }
+            outList.Assign(vScratch);
+        }
+
+        // 예전 Scene::UpdateRenderList: 비우고 장면 순서대로 다시 모은다 (정렬 없음)
+        void Gather(std::vector<int>& vOut, std::vector<uint64_t>& vOutKeys) const
+        {
+            vOut.clear();
+            vOutKeys.clear();
+            for (int i = 0; i < static_cast<int>(m_vObjects.size()); ++i)
+            {
+                const SceneObject& obj = m_vObjects[i];
+                if (obj.bAlive && obj.bVisible)
+                {
+                    vOut.push_back(i);
+                    vOutKeys.push_back(obj.GetKey());
+                }
+            }
+        }
+
+        const SortedDrawList<int>& GetList() const { return m_List; }
+        size_t GetObjectCount() const { return m_vObjects.size(); }
+
+    private:
+        uint32_t Pick(uint32_t n) { return std::uniform_int_distribution<uint32_t>(0, n - 1)(m_rng); }
+
+        int RandomAlive()
+        {
+            if (m_vObjects.empty())
+                return -1;
+            for (int nTry = 0; nTry < 16; ++nTry)
+            {
+                const int nIndex = static_cast<int>(Pick(static_cast<uint32_t>(m_vObjects.size())));
+                if (m_vObjects[nIndex].bAlive)
+                    return nIndex;
+            }
+            return -1;
+        }
+
+        std::mt19937 m_rng;
+        std::vector<SceneObject> m_vObjects;
+        SortedDrawList<int> m_List;
+    };
+
+    // [nBegin, nEnd) 의 항목 집합이 같은지
+    bool SameItems(const SortedDrawList<int>& a, const SortedDrawList<int>& b, size_t nBegin, size_t nEnd)
+    {
+        const std::multiset<int> setA(a.GetItems().begin() + nBegin, a.GetItems().begin() + nEnd);
+        const std::multiset<int> setB(b.GetItems().begin() + nBegin, b.GetItems().begin() + nEnd);
+        return setA == setB;
+    }
+
+    // 같은 키끼리의 순서는 다를 수 있다 (Insert 는 뒤에, Assign 은 장면 순서) — 구간별 집합으로 비교.
+    // 투명 패스 키는 순번이라 두 목록에서 다르다 — 패스 구간의 집합만 비교한다
+    bool SameList(const SortedDrawList<int>& a, const SortedDrawList<int>& b)
+    {
+        constexpr uint32_t kOrdered = SortedDrawList<int>::kOrderedPass;
+        if (a.Size() != b.Size())
+            return false;
+        for (uint32_t nPass = 0; nPass < SortedDrawList<int>::kPassCount; ++nPass)
+        {
+            if (a.GetPassBegin(nPass) != b.GetPassBegin(nPass) || a.GetPassEnd(nPass) != b.GetPassEnd(nPass))
+                return false;
+            for (size_t i = a.GetPassBegin(nPass); i < a.GetPassEnd(nPass); ++i)
+            {
+                if (SortedDrawList<int>::GetPass(a.GetKeys()[i]) != nPass)
+                    return false;
+            }
+        }
+        if (!SameItems(a, b, a.GetPassBegin(kOrdered), a.GetPassEnd(kOrdered)))
+            return false;
+
+        const std::vector<uint64_t>& vKeys = a.GetKeys();
+        const std::vector<uint64_t>& vOtherKeys = b.GetKeys();
+        if (!std::equal(vKeys.begin(), vKeys.begin() + a.GetPassBegin(kOrdered), vOtherKeys.begin()) ||
+            !std::equal(vKeys.begin() + a.GetPassEnd(kOrdered), vKeys.end(), vOtherKeys.begin() + a.GetPassEnd(kOrdered)))
+            return false;
+        for (size_t nBegin = 0; nBegin < vKeys.size(); )
+        {
+            if (nBegin == a.GetPassBegin(kOrdered))
+            {
+                nBegin = a.GetPassEnd(kOrdered);
+                continue;
+            }
+            size_t nEnd = nBegin;
+            while (nEnd < vKeys.size() && vKeys[nEnd] == vKeys[nBegin])
+                nEnd++;
+            if (!SameItems(a, b, nBegin, nEnd))
+                return false;
+            nBegin = nEnd;
+        }
+        return true;
+    }
+
+    // 투명 패스 구간의 항목 순서
+    std::vector<int> TransparentOrder(const SortedDrawList<int>& list)
+    {
+        constexpr uint32_t kOrdered = SortedDrawList<int>::kOrderedPass;
+        return std::vector<int>(list.GetItems().begin() + list.GetPassBegin(kOrdered),
+                                list.GetItems().begin() + list.GetPassEnd(kOrdered));
+    }
+
+    bool TestTransparentOrder()
+    {
+        // 물 타일: 재질/메쉬 키가 넣은 순서와 반대로 가게 해서 정렬되면 바로 드러나게 한다
+        SortedDrawList<int> list;
+        std::vector<uint64_t> vListed(16);
+        std::vector<int> vExpected;
+        for (int i = 0; i < 16; ++i)
+        {
+            if (i % 3 == 0)
+                list.Insert(MakeKey(0, 16 - i, 0x1000), 100 + i);     // 불투명이 사이사이 들어와도 상관없다
+            vListed[i] = list.Insert(MakeKey(1, 16 - i, 0x2000 - i * 0x40), i);
+            vExpected.push_back(i);
+        }
+        list.Insert(MakeKey(2, 1, 0x3000), 200);
+
+        bool bOk = true;
+        if (TransparentOrder(list) != vExpected)
+        {
+            fprintf(stderr, "[DrawList] transparent pass is not in insertion order\n");
+            bOk = false;
+        }
+
+        // 가운데를 빼고 다시 넣으면 맨 뒤로 간다. 나머지 순서는 그대로
+        for (int i : { 0, 7, 15 })
+        {
+            if (!list.Remove(vListed[i], i))
+            {
+                fprintf(stderr, "[DrawList] transparent item %d not found by its listed key\n", i);
+                return false;
+            }
+            vExpected.erase(std::find(vExpected.begin(), vExpected.end(), i));
+        }
+        vListed[7] = list.Insert(MakeKey(1, 0, 0), 7);
+        vExpected.push_back(7);
+        if (TransparentOrder(list) != vExpected)
+        {
+            fprintf(stderr, "[DrawList] transparent pass order changed after remove / re-insert\n");
+            bOk = false;
+        }
+
+        // 전체 재구성: 모은 순서 그대로
+        std::vector<std::pair<uint64_t, int>> vKeyed;
+        std::vector<int> vCollected;
+        for (int i = 0; i < 16; ++i)
+        {
+            const int nItem = (i * 5) % 16;
+            vKeyed.emplace_back(MakeKey(1, nItem, 0x2000 + nItem), nItem);
+            vKeyed.emplace_back(MakeKey(0, nItem % 4, 0x1000), 100 + nItem);
+            vCollected.push_back(nItem);
+        }
+        list.Assign(vKeyed);
+        if (TransparentOrder(list) != vCollected || list.GetPassEnd(0) != 16)
+        {
+            fprintf(stderr, "[DrawList] Assign reordered the transparent pass\n");
+            bOk = false;
+        }
+
+        if (bOk)
+            printf("[DrawList] transparent pass keeps insertion / collection order regardless of material and mesh\n");
+        return bOk;
+    }
+
+    // 키가 바뀌는 횟수 = 상태 변경 수
+    size_t CountStateChanges(const std::vector<uint64_t>& vKeys)
+    {
+        size_t nChanges = 0;
+        for (size_t i = 0; i < vKeys.size(); ++i)
+        {
+            if (i == 0 || vKeys[i] != vKeys[i - 1])
+                nChanges++;
+        }
+        return nChanges;
+    }
+
+    bool TestRandomEdits()
+    {
+        DrawScene scene(7);
+        SortedDrawList<int> rebuilt;
+        std::vector<std::pair<uint64_t, int>> vScratch;
+
+        for (int i = 0; i < 200; ++i)
+            scene.Create();
+
+        for (int nBatch = 0; nBatch < 400; ++nBatch)
+        {
+            const int nEdits = 1 + nBatch % 25;
+            for (int i = 0; i < nEdits; ++i)
+            {
+                if (!scene.Edit())
+                {
+                    fprintf(stderr, "[DrawList] batch %d: Remove did not find a listed item\n", nBatch);
+                    return false;
+                }
+            }
+
+            scene.Rebuild(rebuilt, vScratch);
+            if (!SameList(scene.GetList(), rebuilt))
+            {
+                fprintf(stderr, "[DrawList] batch %d: incremental list differs from a full rebuild (%zu vs %zu)\n",
+                        nBatch, scene.GetList().Size(), rebuilt.Size());
+                return false;
+            }
+        }
+
+        printf("[DrawList] 400 edit batches over %zu objects: incremental list matches a full rebuild (%zu listed)\n",
+               scene.GetObjectCount(), scene.GetList().Size());
+        return true;
+    }
+
+    double ElapsedUs(std::chrono::steady_clock::time_point t0)
+    {
+        return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - t0).count();
+    }
+
+    void RunBench()
+    {
+        constexpr int kObjects = 10000;
+        constexpr int kFrames = 600;
+        constexpr int kEditsPerFrame = 20;   // 탄/파편 생성과 삭제 정도
+
+        DrawScene scene(11);
+        for (int i = 0; i < kObjects; ++i)
+            scene.Create();
+
+        SortedDrawList<int> rebuilt;
+        std::vector<std::pair<uint64_t, int>> vScratch;
+        std::vector<int> vGathered;
+        std::vector<uint64_t> vGatheredKeys;
+        double fGatherUs = 0.0, fRebuildUs = 0.0, fIncrementalUs = 0.0;
+
+        for (int nFrame = 0; nFrame < kFrames; ++nFrame)
+        {
+            auto t0 = std::chrono::steady_clock::now();
+            for (int i = 0; i < kEditsPerFrame; ++i)
+                scene.Edit();
+            fIncrementalUs += ElapsedUs(t0);
+
+            // 트리 순회와 GetComponent 비용은 빠져 있으므로 예전 방식의 하한
+            t0 = std::chrono::steady_clock::now();
+            scene.Gather(vGathered, vGatheredKeys);
+            fGatherUs += ElapsedUs(t0);
+
+            t0 = std::chrono::steady_clock::now();
+            scene.Rebuild(rebuilt, vScratch);
+            fRebuildUs += ElapsedUs(t0);
+        }
+
+        printf("[DrawList] %d objects, %d edits/frame: re-gather %.1f us/frame, sorted rebuild %.1f us/frame, "
+               "incremental %.1f us/frame (0 on frames without edits)\n",
+               kObjects, kEditsPerFrame, fGatherUs / kFrames, fRebuildUs / kFrames, fIncrementalUs / kFrames);
+        printf("[DrawList] state changes: %zu in key order vs %zu in scene order (%zu draws)\n",
+               CountStateChanges(scene.GetList().GetKeys()), CountStateChanges(vGatheredKeys), scene.GetList().Size());
+    }
+}
+
+int main()
+{
+    if (!TestRandomEdits() || !TestTransparentOrder())
+        return 1;
+    RunBench();
+    return 0;
+}
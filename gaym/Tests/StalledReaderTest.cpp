@@ -0,0 +1,182 @@
+#include "pch.h"
+#include "Service.h"
+#include "ThreadManager.h"
+#include "SendBuffer.h"
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+
+// 읽지 않는 클라이언트 (수신 버퍼 4KB) 에 서버 세션이 1초 동안 계속 Send 한다.
+// stalled_reader_test <Queue|Drop|Merge|Disconnect>
+//  - 모든 정책: 큐 최고치가 hardLimitBytes (+ 버퍼 하나) 를 넘지 않는다
+//  - Queue / Merge : hardLimitBytes 에서 끊긴다 (Merge 는 작은 버퍼를 합친 흔적이 있어야 함)
+//  - Drop          : 연결 유지, 큐는 highWaterBytes 이하, 클라이언트가 다시 읽으면 큐가 비워진다
+//  - Disconnect    : 첫 워터마크 초과에서 끊긴다
+// 리눅스 epoll 빌드 전용 (클라이언트 쪽은 POSIX 소켓)
+namespace
+{
+    constexpr int32 kHighWaterBytes = 1 << 20;
+    constexpr int32 kHardLimitBytes = 4 << 20;
+    constexpr uint32 kMaxPacketSize = 64 + 3 * 300;
+
+    SendOverflowAction GAction = SendOverflowAction::Disconnect;
+    Mutex GLock;
+    SessionRef GServerSession;
+
+    class StallServerSession : public PacketSession
+    {
+    protected:
+        virtual void OnConnected() override
+        {
+            SendConfig config;
+            config.highWaterBytes = kHighWaterBytes;
+            config.hardLimitBytes = kHardLimitBytes;
+            config.overflowAction = GAction;
+            SetSendConfig(config);
+
+            LockGuard guard(GLock);
+            GServerSession = GetSessionRef();
+        }
+        virtual void OnRecvPacket(BYTE* buffer, int32 len) override { }
+    };
+
+    bool ParseAction(const char* name, SendOverflowAction& outAction)
+    {
+        const char* names[] = { "Queue", "Drop", "Merge", "Disconnect" };
+        for (int i = 0; i < 4; ++i)
+        {
+            if (::strcmp(name, names[i]) == 0)
+            {
+                outAction = static_cast<SendOverflowAction>(i);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    bool Check(bool condition, const char* what)
+    {
+        if (!condition)
+            fprintf(stderr, "[StalledReader] FAILED: %s\n", what);
+        return condition;
+    }
+}
+
+int main(int argc, char** argv)
+{
+    if (argc < 2 || !ParseAction(argv[1], GAction))
+    {
+        fprintf(stderr, "usage: stalled_reader_test <Queue|Drop|Merge|Disconnect>\n");
+        return 2;
+    }
+    const uint16 port = static_cast<uint16>(27788 + static_cast<int>(GAction));
+
+    auto core = MakeShared<IocpCore>();
+    auto server = MakeShared<ServerService>(NetAddress(L"127.0.0.1", port), core, MakeShared<StallServerSession>, 1);
+    ASSERT_CRASH(server->Start());
+    Atomic<bool> stop = false;
+    GThreadManager->Launch([&]() { while (!stop) core->Dispatch(10); });
+
+    // 읽지 않는 클라이언트
+    int fd = ::socket(AF_INET, SOCK_STREAM, 0);
+    int recvSize = 4096;
+    ::setsockopt(fd, SOL_SOCKET, SO_RCVBUF, &recvSize, sizeof(recvSize));
+    sockaddr_in addr = {};
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons(port);
+    ::inet_pton(AF_INET, "127.0.0.1", &addr.sin_addr);
+    ASSERT_CRASH(::connect(fd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) == 0);
+
+    SessionRef session;
+    const auto connectStart = chrono::steady_clock::now();
+    while (!session && chrono::steady_clock::now() - connectStart < chrono::seconds(5))
+    {
+        this_thread::sleep_for(chrono::milliseconds(10));
+        LockGuard guard(GLock);
+        session = GServerSession;
+    }
+    ASSERT_CRASH(session != nullptr);
+
+    int64 attempts = 0;
+    const auto floodStart = chrono::steady_clock::now();
+    while (chrono::steady_clock::now() - floodStart < chrono::seconds(1) && session->IsConnected())
+    {
+        const uint32 size = 64 + static_cast<uint32>(attempts % 4) * 300;
+        SendBufferRef sendBuffer = GSendBufferManager->Open(size);
+        PacketHeader* header = reinterpret_cast<PacketHeader*>(sendBuffer->Buffer());
+        header->size = static_cast<uint16>(size);
+        header->id = 1;
+        sendBuffer->Close(size);
+        session->Send(sendBuffer);
+        attempts++;
+    }
+
+    const SendStats stalled = session->GetSendStats();
+    const bool bConnected = session->IsConnected();
+    printf("[StalledReader] %s: attempts=%lld connected=%d queued=%lldB/%lld peak=%lldB sent=%lldB in %lld calls "
+           "coalesced=%lld dropped=%lld (%lldB) overflow=%lld\n",
+           argv[1], (long long)attempts, (int)bConnected, (long long)stalled.queuedBytes, (long long)stalled.queuedCount,
+           (long long)stalled.peakQueuedBytes, (long long)stalled.sentBytes, (long long)stalled.sendCalls,
+           (long long)stalled.coalescedBuffers, (long long)stalled.droppedBuffers, (long long)stalled.droppedBytes,
+           (long long)stalled.overflowCount);
+
+    bool bOk = Check(stalled.peakQueuedBytes <= kHardLimitBytes + kMaxPacketSize, "peak queue stays under the hard limit");
+    bOk &= Check(stalled.overflowCount > 0, "the stalled reader crossed a watermark");
+
+    switch (GAction)
+    {
+    case SendOverflowAction::Queue:
+        bOk &= Check(!bConnected, "Queue disconnects at the hard limit");
+        break;
+    case SendOverflowAction::Merge:
+        bOk &= Check(!bConnected, "Merge disconnects at the hard limit");
+        bOk &= Check(stalled.coalescedBuffers > 0, "Merge coalesced small buffers");
+        break;
+    case SendOverflowAction::Disconnect:
+        bOk &= Check(!bConnected, "Disconnect drops the session");
+        bOk &= Check(stalled.peakQueuedBytes <= kHighWaterBytes + kMaxPacketSize, "Disconnect acts at the first watermark");
+        break;
+    case SendOverflowAction::Drop:
+    {
+        bOk &= Check(bConnected, "Drop keeps the session");
+        bOk &= Check(stalled.queuedBytes <= kHighWaterBytes, "Drop keeps the queue under the high watermark");
+        bOk &= Check(stalled.droppedBuffers > 0, "Drop dropped buffers");
+
+        // 클라이언트가 다시 읽기 시작하면 큐가 비워져야 한다.
+        // 4KB 수신 창 그대로면 zero window probe 간격으로만 흘러가므로 창을 넓혀서 읽는다
+        ::fcntl(fd, F_SETFL, ::fcntl(fd, F_GETFL, 0) | O_NONBLOCK);
+        recvSize = 1 << 20;
+        ::setsockopt(fd, SOL_SOCKET, SO_RCVBUF, &recvSize, sizeof(recvSize));
+        char readBuffer[65536];
+        int64 readBytes = 0;
+        SendStats drained = stalled;
+        const auto drainStart = chrono::steady_clock::now();
+        while (chrono::steady_clock::now() - drainStart < chrono::seconds(5))
+        {
+            ssize_t numOfBytes;
+            while ((numOfBytes = ::recv(fd, readBuffer, sizeof(readBuffer), 0)) > 0)
+                readBytes += numOfBytes;
+            drained = session->GetSendStats();
+            if (drained.queuedBytes == 0 && readBytes == drained.sentBytes)
+                break;
+            this_thread::sleep_for(chrono::milliseconds(1));
+        }
+        printf("[StalledReader] Drop: after resume queued=%lldB sent=%lldB read=%lldB\n",
+               (long long)drained.queuedBytes, (long long)drained.sentBytes, (long long)readBytes);
+        bOk &= Check(drained.queuedBytes == 0, "queue drains once the reader resumes");
+        bOk &= Check(drained.sentBytes > stalled.sentBytes, "sending resumes");
+        bOk &= Check(readBytes == drained.sentBytes, "every sent byte reaches the reader");
+        break;
+    }
+    }
+
+    // 서비스/스레드 정리 대신 바로 종료 (테스트 전용)
+    fflush(stdout);
+    fflush(stderr);
+    _exit(bOk ? 0 : 1);
+}
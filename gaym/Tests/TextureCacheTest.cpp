@@ -0,0 +1,190 @@
+#include "TextureCache.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
+#include <vector>
+
+// TextureCache + NullTextureBackend (디바이스 없음)
+//  1) 참조 카운트 / 히트 / GPU 축출 뒤 CPU 이미지 재업로드 / CPU 축출 뒤 재디코드
+//  2) 적 30 마리 웨이브: 캐시 없이 적마다 디코드+업로드 (예전 GameObject 경로) 와
+//     캐시를 거친 로드의 시간 / 디코드 수 / 상주 메모리 비교
+// 에셋 경로가 상대 경로라 gaym/ 에서 실행
+namespace
+{
+    constexpr int kWaveSize = 30;
+
+    // 웨이브 구성: 적 프리셋마다 메쉬 옆 Textures 폴더의 이미지를 전부 쓴다
+    const char* const kPresets[] =
+    {
+        "Assets/Enemies/Golem/Textures",
+        "Assets/Enemies/Elementals/AirElemental_Bl/Textures",
+        "Assets/Enemies/Elementals/WaterElemental_Bl/Textures",
+    };
+
+    bool Check(bool condition, const char* what)
+    {
+        if (!condition)
+            fprintf(stderr, "[TextureCache] FAILED: %s\n", what);
+        return condition;
+    }
+
+    std::vector<std::string> ListTextures(const char* dir)
+    {
+        std::vector<std::string> vPaths;
+        std::error_code ec;
+        for (const auto& entry : std::filesystem::directory_iterator(dir, ec))
+        {
+            if (entry.is_regular_file(ec))
+                vPaths.push_back(entry.path().generic_string());
+        }
+        std::sort(vPaths.begin(), vPaths.end());
+        return vPaths;
+    }
+
+    double ElapsedMs(std::chrono::steady_clock::time_point t0)
+    {
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t0).count();
+    }
+
+    bool TestRefCounting(const std::vector<std::string>& vPaths)
+    {
+        TextureCache& cache = TextureCache::Get();
+        const std::string& path = vPaths[0];
+        bool bOk = true;
+
+        const TextureCacheStats s0 = cache.GetStats();
+        bOk &= Check(!cache.Acquire("Assets/__missing__.png"), "a missing file gives an empty handle");
+        bOk &= Check(cache.GetStats().failures == s0.failures + 1, "a missing file counts as a failure");
+
+        TextureHandle a = cache.Acquire(path);
+        TextureHandle b = cache.Acquire(path);
+        TextureCacheStats s = cache.GetStats();
+        bOk &= Check(a && b && a.GetResource() == b.GetResource(), "the same path shares one resource");
+        bOk &= Check(s.misses == s0.misses + 1 && s.hits == s0.hits + 1, "second acquire is a hit");
+        bOk &= Check(s.textures == s0.textures + 1 && s.referenced == s0.referenced + 1, "one texture, referenced");
+
+        TextureHandle c = a;
+        TextureHandle d = std::move(b);
+        a.Reset();
+        c.Reset();
+        bOk &= Check(!b && d && cache.GetStats().referenced == s0.referenced + 1, "copy/move keep the reference");
+        d.Reset();
+        s = cache.GetStats();
+        bOk &= Check(s.referenced == s0.referenced && s.textures == s0.textures + 1, "unreferenced texture stays resident");
+
+        // GPU 예산 0 : GPU 리소스만 축출, CPU 이미지는 남아서 다음 Acquire 는 디코드 없이 업로드
+        TextureHandle held = cache.Acquire(vPaths[1]);
+        cache.SetGpuBudget(0);
+        cache.Trim();
+        s = cache.GetStats();
+        bOk &= Check(s.evictions == s0.evictions + 1, "only the unreferenced texture is evicted");
+        bOk &= Check(held.GetResource() != nullptr, "a referenced texture survives Trim");
+        bOk &= Check(s.cpuResidentBytes > 0, "the CPU image outlives the GPU eviction");
+
+        TextureHandle again = cache.Acquire(path);
+        TextureCacheStats s2 = cache.GetStats();
+        bOk &= Check(again && s2.imageHits == s0.imageHits + 1 && s2.misses == s.misses, "re-acquire uploads from the CPU image");
+        again.Reset();
+
+        // CPU 예산도 0 : 이미지까지 버리면 다음 Acquire 는 다시 디코드
+        cache.SetCpuBudget(0);
+        cache.Trim();
+        s = cache.GetStats();
+        bOk &= Check(s.imageEvictions > s0.imageEvictions && s.cpuResidentBytes == 0, "CPU images are evicted over budget");
+        again = cache.Acquire(path);
+        bOk &= Check(again && cache.GetStats().misses == s.misses + 1, "re-acquire after both evictions decodes");
+
+        again.Reset();
+        held.Reset();
+        cache.Clear();
+        cache.SetGpuBudget(256ull * 1024 * 1024);
+        cache.SetCpuBudget(64ull * 1024 * 1024);
+        s = cache.GetStats();
+        bOk &= Check(s.textures == 0 && s.referenced == 0 && s.gpuResidentBytes == 0 && s.cpuResidentBytes == 0,
+                     "Clear releases everything unreferenced");
+        return bOk;
+    }
+
+    bool RunWave()
+    {
+        TextureCache& cache = TextureCache::Get();
+        NullTextureBackend& backend = *static_cast<NullTextureBackend*>(cache.GetBackend());
+
+        std::vector<std::vector<std::string>> vPresetPaths;
+        size_t nUniqueTextures = 0;
+        for (const char* dir : kPresets)
+        {
+            vPresetPaths.push_back(ListTextures(dir));
+            nUniqueTextures += vPresetPaths.back().size();
+        }
+
+        // 캐시 없이: 적마다 디코드 + 업로드, GPU 사본도 적마다 하나
+        uint64_t nUncachedBytes = 0;
+        int nUncachedDecodes = 0;
+        std::vector<TextureResource> vUncached;
+        auto t0 = std::chrono::steady_clock::now();
+        for (int i = 0; i < kWaveSize; ++i)
+        {
+            for (const std::string& path : vPresetPaths[i % vPresetPaths.size()])
+            {
+                TextureImage image;
+                TextureResource resource;
+                if (!backend.Decode(path, image) || !backend.Upload(image, resource))
+                    return Check(false, "uncached load");
+                nUncachedDecodes++;
+                nUncachedBytes += resource.gpuBytes;
+                vUncached.push_back(resource);
+            }
+        }
+        const double fUncachedMs = ElapsedMs(t0);
+        for (TextureResource& resource : vUncached)
+            backend.Release(resource);
+
+        // 캐시: 적마다 핸들을 잡는다 (GameObject 가 머티리얼 텍스처를 들고 있는 것과 같음)
+        const TextureCacheStats s0 = cache.GetStats();
+        std::vector<std::vector<TextureHandle>> vEnemies(kWaveSize);
+        t0 = std::chrono::steady_clock::now();
+        for (int i = 0; i < kWaveSize; ++i)
+        {
+            for (const std::string& path : vPresetPaths[i % vPresetPaths.size()])
+                vEnemies[i].push_back(cache.Acquire(path));
+        }
+        const double fCachedMs = ElapsedMs(t0);
+        const TextureCacheStats s = cache.GetStats();
+
+        printf("[TextureCache] %d-enemy wave (%zu presets, %zu textures): uncached %d decodes %.1f ms %.2f MB, "
+               "cached %llu decodes %.1f ms %.2f MB gpu + %.2f MB cpu\n",
+               kWaveSize, vPresetPaths.size(), nUniqueTextures, nUncachedDecodes, fUncachedMs,
+               nUncachedBytes / (1024.0 * 1024.0), (unsigned long long)(s.misses - s0.misses), fCachedMs,
+               s.gpuResidentBytes / (1024.0 * 1024.0), s.cpuResidentBytes / (1024.0 * 1024.0));
+        printf("[TextureCache] %s", cache.BuildReport().c_str());
+
+        bool bOk = Check(nUniqueTextures > 0, "wave presets have textures");
+        bOk &= Check(s.misses - s0.misses == nUniqueTextures, "each texture is decoded once per wave");
+        bOk &= Check(s.hits - s0.hits == nUncachedDecodes - nUniqueTextures, "every other acquire is a hit");
+        bOk &= Check(s.textures == nUniqueTextures && s.referenced == nUniqueTextures, "one GPU copy per texture");
+        bOk &= Check(s.gpuResidentBytes * (kWaveSize / vPresetPaths.size()) == nUncachedBytes,
+                     "GPU memory is one copy instead of one per enemy");
+
+        vEnemies.clear();
+        cache.Clear();
+        return bOk;
+    }
+}
+
+int main()
+{
+    TextureCache::Get().SetBackend(std::make_unique<NullTextureBackend>());
+
+    const std::vector<std::string> vPaths = ListTextures(kPresets[0]);
+    if (vPaths.size() < 2)
+    {
+        fprintf(stderr, "[TextureCache] no textures under %s (run from gaym/)\n", kPresets[0]);
+        return 1;
+    }
+
+    bool bOk = TestRefCounting(vPaths);
+    bOk = RunWave() && bOk;
+    return bOk ? 0 : 1;
+}
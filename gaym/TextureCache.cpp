@@ -0,0 +1,352 @@
+#include "TextureCache.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+
+struct TextureHandle::Entry
+{
+    std::string     path;
+    uint32_t        refCount = 0;
+    uint64_t        lastUse = 0;
+    TextureResource gpu;                    // pResource == nullptr 이면 GPU 에 없음
+    std::unique_ptr<TextureImage> image;    // CPU 이미지 층 (없을 수 있음)
+};
+
+// =============================================================================
+// TextureHandle
+// =============================================================================
+
+TextureHandle::TextureHandle(Entry* pEntry)
+    : m_pEntry(pEntry)
+{
+    if (m_pEntry)
+        TextureCache::Get().AddRef(m_pEntry);
+}
+
+TextureHandle::TextureHandle(const TextureHandle& other)
+    : TextureHandle(other.m_pEntry)
+{
+}
+
+TextureHandle::TextureHandle(TextureHandle&& other) noexcept
+    : m_pEntry(other.m_pEntry)
+{
+    other.m_pEntry = nullptr;
+}
+
+TextureHandle& TextureHandle::operator=(const TextureHandle& other)
+{
+    if (this != &other)
+    {
+        if (other.m_pEntry)
+            TextureCache::Get().AddRef(other.m_pEntry);
+        Reset();
+        m_pEntry = other.m_pEntry;
+    }
+    return *this;
+}
+
+TextureHandle& TextureHandle::operator=(TextureHandle&& other) noexcept
+{
+    if (this != &other)
+    {
+        Reset();
+        m_pEntry = other.m_pEntry;
+        other.m_pEntry = nullptr;
+    }
+    return *this;
+}
+
+void TextureHandle::Reset()
+{
+    if (m_pEntry)
+    {
+        TextureCache::Get().ReleaseRef(m_pEntry);
+        m_pEntry = nullptr;
+    }
+}
+
+void* TextureHandle::GetResource() const
+{
+    return m_pEntry ? m_pEntry->gpu.pResource : nullptr;
+}
+
+const std::string& TextureHandle::GetPath() const
+{
+    static const std::string s_Empty;
+    return m_pEntry ? m_pEntry->path : s_Empty;
+}
+
+// =============================================================================
+// TextureCache
+// =============================================================================
+
+TextureCache& TextureCache::Get()
+{
+    static TextureCache s_Cache;
+    return s_Cache;
+}
+
+TextureCache::~TextureCache()
+{
+    // 종료 시점엔 참조가 남아 있어도 백엔드 리소스는 돌려준다
+    for (auto& [path, pEntry] : m_mapEntries)
+        ReleaseGpu(pEntry.get());
+    m_mapEntries.clear();
+}
+
+void TextureCache::SetBackend(std::unique_ptr<TextureBackend> pBackend)
+{
+    for (auto& [path, pEntry] : m_mapEntries)
+        ReleaseGpu(pEntry.get());
+    m_pBackend = std::move(pBackend);
+}
+
+TextureHandle TextureCache::Acquire(const std::string& path)
+{
+    if (path.empty() || !m_pBackend)
+        return {};
+
+    auto it = m_mapEntries.find(path);
+    if (it == m_mapEntries.end())
+    {
+        auto pEntry = std::make_unique<TextureHandle::Entry>();
+        pEntry->path = path;
+        it = m_mapEntries.emplace(path, std::move(pEntry)).first;
+    }
+    TextureHandle::Entry* pEntry = it->second.get();
+    pEntry->lastUse = ++m_nUseClock;
+
+    if (pEntry->gpu.pResource)
+    {
+        m_Stats.hits++;
+        return TextureHandle(pEntry);
+    }
+
+    // GPU 에 없으면 CPU 이미지 → 없으면 디스크 디코드
+    if (pEntry->image)
+    {
+        m_Stats.imageHits++;
+    }
+    else
+    {
+        auto pImage = std::make_unique<TextureImage>();
+        if (!m_pBackend->Decode(path, *pImage))
+        {
+            m_Stats.failures++;
+            m_mapEntries.erase(it);
+            return {};
+        }
+        m_Stats.misses++;
+        m_Stats.cpuResidentBytes += pImage->sizeBytes;
+        pEntry->image = std::move(pImage);
+    }
+
+    if (!m_pBackend->Upload(*pEntry->image, pEntry->gpu))
+    {
+        m_Stats.failures++;
+        ReleaseImage(pEntry);
+        m_mapEntries.erase(it);
+        return {};
+    }
+    m_Stats.gpuResidentBytes += pEntry->gpu.gpuBytes;
+    m_Stats.textures++;
+
+    // CPU 예산을 넘으면 이미지는 바로 버린다 (Upload 가 픽셀을 이미 복사해 갔다)
+    if (m_Stats.cpuResidentBytes > m_nCpuBudget)
+    {
+        ReleaseImage(pEntry);
+        m_Stats.imageEvictions++;
+    }
+
+    return TextureHandle(pEntry);
+}
+
+void TextureCache::AddRef(TextureHandle::Entry* pEntry)
+{
+    if (pEntry->refCount++ == 0)
+        m_Stats.referenced++;
+}
+
+void TextureCache::ReleaseRef(TextureHandle::Entry* pEntry)
+{
+    // 0 이 돼도 남겨 둔다 — 축출은 Trim 에서만
+    if (--pEntry->refCount == 0)
+    {
+        m_Stats.referenced--;
+        pEntry->lastUse = ++m_nUseClock;
+    }
+}
+
+void TextureCache::ReleaseGpu(TextureHandle::Entry* pEntry)
+{
+    if (!pEntry->gpu.pResource)
+        return;
+
+    m_Stats.gpuResidentBytes -= pEntry->gpu.gpuBytes;
+    m_Stats.textures--;
+    if (m_pBackend)
+        m_pBackend->Release(pEntry->gpu);
+    pEntry->gpu = {};
+}
+
+void TextureCache::ReleaseImage(TextureHandle::Entry* pEntry)
+{
+    if (!pEntry->image)
+        return;
+
+    m_Stats.cpuResidentBytes -= pEntry->image->sizeBytes;
+    pEntry->image.reset();
+}
+
+void TextureCache::OnGpuIdle()
+{
+    if (m_pBackend)
+        m_pBackend->OnGpuIdle();
+    Trim();
+}
+
+void TextureCache::Trim()
+{
+    if (m_Stats.gpuResidentBytes <= m_nGpuBudget && m_Stats.cpuResidentBytes <= m_nCpuBudget)
+        return;
+
+    std::vector<TextureHandle::Entry*> lru;
+    lru.reserve(m_mapEntries.size());
+    for (auto& [path, pEntry] : m_mapEntries)
+        lru.push_back(pEntry.get());
+    std::sort(lru.begin(), lru.end(),
+        [](const TextureHandle::Entry* a, const TextureHandle::Entry* b) { return a->lastUse < b->lastUse; });
+
+    // GPU 리소스는 참조가 없는 것만 축출. 축출해도 CPU 이미지는 남겨 두어 다음 Acquire 가 디코드를 건너뛴다
+    for (TextureHandle::Entry* pEntry : lru)
+    {
+        if (m_Stats.gpuResidentBytes <= m_nGpuBudget)
+            break;
+        if (pEntry->refCount == 0 && pEntry->gpu.pResource)
+        {
+            ReleaseGpu(pEntry);
+            m_Stats.evictions++;
+        }
+    }
+
+    // CPU 이미지는 참조 여부와 상관없이 오래 안 쓴 것부터 버린다 (업로드는 Acquire 안에서 끝나므로 안전).
+    // 위에서 GPU 리소스까지 축출된 항목은 다음 Acquire 때 다시 디코드한다
+    for (TextureHandle::Entry* pEntry : lru)
+    {
+        if (m_Stats.cpuResidentBytes <= m_nCpuBudget)
+            break;
+        if (pEntry->image)
+        {
+            ReleaseImage(pEntry);
+            m_Stats.imageEvictions++;
+        }
+    }
+
+    for (auto it = m_mapEntries.begin(); it != m_mapEntries.end(); )
+    {
+        const TextureHandle::Entry* pEntry = it->second.get();
+        if (pEntry->refCount == 0 && !pEntry->gpu.pResource && !pEntry->image)
+            it = m_mapEntries.erase(it);
+        else
+            ++it;
+    }
+}
+
+void TextureCache::Clear()
+{
+    for (auto it = m_mapEntries.begin(); it != m_mapEntries.end(); )
+    {
+        TextureHandle::Entry* pEntry = it->second.get();
+        if (pEntry->refCount == 0)
+        {
+            ReleaseGpu(pEntry);
+            ReleaseImage(pEntry);
+            it = m_mapEntries.erase(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+}
+
+TextureCacheStats TextureCache::GetStats() const
+{
+    return m_Stats;
+}
+
+std::string TextureCache::BuildReport() const
+{
+    char line[256];
+    snprintf(line, sizeof(line),
+        "textures: %u (referenced %u)  gpu: %.2f MB  cpu: %.2f MB\n"
+        "hits: %llu  imageHits: %llu  misses: %llu  failures: %llu  evictions: %llu  imageEvictions: %llu\n",
+        m_Stats.textures, m_Stats.referenced,
+        m_Stats.gpuResidentBytes / (1024.0 * 1024.0), m_Stats.cpuResidentBytes / (1024.0 * 1024.0),
+        (unsigned long long)m_Stats.hits, (unsigned long long)m_Stats.imageHits,
+        (unsigned long long)m_Stats.misses, (unsigned long long)m_Stats.failures,
+        (unsigned long long)m_Stats.evictions, (unsigned long long)m_Stats.imageEvictions);
+    return line;
+}
+
+// =============================================================================
+// NullTextureBackend
+// =============================================================================
+
+namespace
+{
+    inline uint32_t ReadBE32(const uint8_t* p)
+    {
+        return (uint32_t(p[0]) << 24) | (uint32_t(p[1]) << 16) | (uint32_t(p[2]) << 8) | uint32_t(p[3]);
+    }
+}
+
+bool NullTextureBackend::Decode(const std::string& path, TextureImage& image)
+{
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    if (!file.is_open())
+        return false;
+
+    const std::streamsize fileSize = file.tellg();
+    if (fileSize <= 0)
+        return false;
+    file.seekg(0, std::ios::beg);
+
+    std::vector<uint8_t> bytes((size_t)fileSize);
+    if (!file.read(reinterpret_cast<char*>(bytes.data()), fileSize))
+        return false;
+
+    // PNG: 8바이트 시그니처 뒤 IHDR 의 width/height. 그 밖의 형식은 1x1
+    static const uint8_t s_PngSig[8] = { 0x89, 'P', 'N', 'G', 0x0D, 0x0A, 0x1A, 0x0A };
+    uint32_t width = 1, height = 1;
+    if (bytes.size() >= 24 && memcmp(bytes.data(), s_PngSig, 8) == 0)
+    {
+        width  = (std::max)(ReadBE32(&bytes[16]), 1u);
+        height = (std::max)(ReadBE32(&bytes[20]), 1u);
+    }
+
+    image.width     = width;
+    image.height    = height;
+    image.format    = 28;   // DXGI_FORMAT_R8G8B8A8_UNORM
+    image.rowPitch  = width * 4;
+    image.sizeBytes = (size_t)image.rowPitch * height;
+    image.pixels.reset(new uint8_t[image.sizeBytes]);
+    memset(image.pixels.get(), 0xFF, image.sizeBytes);
+    return true;
+}
+
+bool NullTextureBackend::Upload(const TextureImage& image, TextureResource& resource)
+{
+    // 가짜 리소스 — 크기만 기록
+    resource.pResource = new uint64_t(image.sizeBytes);
+    resource.gpuBytes  = image.sizeBytes;
+    return true;
+}
+
+void NullTextureBackend::Release(TextureResource& resource)
+{
+    delete static_cast<uint64_t*>(resource.pResource);
+    resource = {};
+}
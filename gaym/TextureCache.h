@@ -0,0 +1,151 @@
+#pragma once
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// ============================================================================
+// TextureCache
+// 경로를 키로 하는 참조 카운트 텍스처 캐시. 두 층으로 나뉜다.
+//
+//  - 이미지 층 : 디코드된 CPU 픽셀 (TextureImage). GPU 쪽이 축출돼도 CPU 예산 안에서 남겨 두어
+//                다시 필요하면 디스크 디코드 없이 업로드만 한다
+//  - 핸들 층   : 백엔드가 만든 GPU 리소스 + 참조 카운트. 렌더러는 TextureHandle::GetResource() 를 바인딩
+//
+// 참조가 0 이 된 텍스처는 바로 지우지 않는다 (방 전환 때 같은 파일을 다시 쓰는 경우가 대부분).
+// GPU 예산을 넘으면 Trim 에서 가장 오래 안 쓴 것부터 축출한다.
+// Trim / OnGpuIdle 은 GPU 가 멈춘 지점(FrameAdvance 의 WaitForGpuComplete 직후)에서만 부른다.
+//
+// 실제 디코드/업로드는 TextureBackend 가 한다 — D3D12TextureBackend (WIC) 또는
+// NullTextureBackend (디바이스 없이 리눅스에서 로드 시간/메모리 측정용).
+// 메인 스레드 전용.
+// ============================================================================
+
+// 디코드 결과 (CPU)
+struct TextureImage
+{
+    uint32_t width = 0;
+    uint32_t height = 0;
+    uint32_t format = 0;        // DXGI_FORMAT 값
+    uint32_t rowPitch = 0;
+    size_t   sizeBytes = 0;
+    std::unique_ptr<uint8_t[]> pixels;
+};
+
+// 백엔드가 소유하는 GPU 리소스
+struct TextureResource
+{
+    void*    pResource = nullptr;   // D3D12: ID3D12Resource* (AddRef 된 상태)
+    uint64_t gpuBytes = 0;
+};
+
+class TextureBackend
+{
+public:
+    virtual ~TextureBackend() = default;
+
+    virtual bool Decode(const std::string& path, TextureImage& image) = 0;
+    // image.pixels 는 호출 안에서 복사해 가야 한다 (반환 뒤 캐시가 버릴 수 있음)
+    virtual bool Upload(const TextureImage& image, TextureResource& resource) = 0;
+    virtual void Release(TextureResource& resource) = 0;
+
+    // GPU 가 멈춘 지점 — 업로드 버퍼 등 지연 해제
+    virtual void OnGpuIdle() { }
+};
+
+// 디바이스 없는 백엔드. 파일을 통째로 읽고 PNG 헤더 크기대로 RGBA8 픽셀을 채운다
+// (I/O 와 메모리는 실제와 같고, 압축 해제 비용만 빠짐)
+class NullTextureBackend : public TextureBackend
+{
+public:
+    bool Decode(const std::string& path, TextureImage& image) override;
+    bool Upload(const TextureImage& image, TextureResource& resource) override;
+    void Release(TextureResource& resource) override;
+};
+
+struct TextureCacheStats
+{
+    uint64_t hits = 0;              // GPU 리소스 재사용
+    uint64_t imageHits = 0;         // CPU 이미지에서 재업로드 (디코드 생략)
+    uint64_t misses = 0;            // 디스크 디코드
+    uint64_t failures = 0;
+    uint64_t evictions = 0;         // GPU 리소스 축출
+    uint64_t imageEvictions = 0;    // CPU 이미지 축출
+    uint64_t gpuResidentBytes = 0;
+    uint64_t cpuResidentBytes = 0;
+    uint32_t textures = 0;          // GPU 에 올라가 있는 텍스처 수
+    uint32_t referenced = 0;        // 그중 참조 중인 수
+};
+
+class TextureCache;
+
+// 캐시 항목 참조 (RAII). 복사하면 참조가 늘고, 소멸하면 줄어든다
+class TextureHandle
+{
+public:
+    TextureHandle() = default;
+    TextureHandle(const TextureHandle& other);
+    TextureHandle(TextureHandle&& other) noexcept;
+    TextureHandle& operator=(const TextureHandle& other);
+    TextureHandle& operator=(TextureHandle&& other) noexcept;
+    ~TextureHandle() { Reset(); }
+
+    void Reset();
+
+    explicit operator bool() const { return m_pEntry != nullptr; }
+    bool operator==(std::nullptr_t) const { return m_pEntry == nullptr; }
+    bool operator!=(std::nullptr_t) const { return m_pEntry != nullptr; }
+
+    void*              GetResource() const;
+    const std::string& GetPath() const;
+
+private:
+    friend class TextureCache;
+    struct Entry;
+    explicit TextureHandle(Entry* pEntry);
+
+    Entry* m_pEntry = nullptr;
+};
+
+class TextureCache
+{
+public:
+    static TextureCache& Get();
+
+    void            SetBackend(std::unique_ptr<TextureBackend> pBackend);
+    TextureBackend* GetBackend() const { return m_pBackend.get(); }
+
+    // 참조 0 인 텍스처를 남겨 둘 한도 (참조 중인 텍스처는 한도와 상관없이 유지)
+    void SetGpuBudget(uint64_t bytes) { m_nGpuBudget = bytes; }
+    void SetCpuBudget(uint64_t bytes) { m_nCpuBudget = bytes; }
+
+    // 실패하면 빈 핸들
+    TextureHandle Acquire(const std::string& path);
+
+    void OnGpuIdle();   // 백엔드 지연 해제 + Trim
+    void Trim();        // 예산 초과분 축출 (LRU, 참조 0 인 것만)
+    void Clear();       // 참조 0 인 것 전부 해제 (종료 시)
+
+    TextureCacheStats GetStats() const;
+    std::string       BuildReport() const;
+
+private:
+    TextureCache() = default;
+    ~TextureCache();
+
+    friend class TextureHandle;
+    void AddRef(TextureHandle::Entry* pEntry);
+    void ReleaseRef(TextureHandle::Entry* pEntry);
+    void ReleaseGpu(TextureHandle::Entry* pEntry);
+    void ReleaseImage(TextureHandle::Entry* pEntry);
+
+private:
+    std::unique_ptr<TextureBackend> m_pBackend;
+    std::unordered_map<std::string, std::unique_ptr<TextureHandle::Entry>> m_mapEntries;
+
+    uint64_t m_nGpuBudget = 256ull * 1024 * 1024;
+    uint64_t m_nCpuBudget = 64ull * 1024 * 1024;
+    uint64_t m_nUseClock = 0;       // LRU 순서
+    TextureCacheStats m_Stats;
+};
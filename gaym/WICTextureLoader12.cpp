@@ -269,14 +269,15 @@ namespace
     }
 
     //---------------------------------------------------------------------------------
-    HRESULT CreateTextureFromWIC (_In_ ID3D12Device* d3dDevice,
+    HRESULT CreateTextureFromWIC (_In_opt_ ID3D12Device* d3dDevice,
                                 _In_ IWICBitmapFrameDecode *frame,
                                 size_t maxsize,
                                 D3D12_RESOURCE_FLAGS resFlags,
                                 unsigned int loadFlags,
-                                _Outptr_ ID3D12Resource** texture,
+                                _Outptr_opt_ ID3D12Resource** texture,
                                 std::unique_ptr<uint8_t[]>& decodedData,
-                                D3D12_SUBRESOURCE_DATA& subresource)
+                                D3D12_SUBRESOURCE_DATA& subresource,
+                                _Out_opt_ D3D12_RESOURCE_DESC* outDesc = nullptr)
     {
         UINT width, height;
         HRESULT hr = frame->GetSize(&width, &height);
@@ -504,6 +505,21 @@ namespace
         desc.Flags = resFlags;
         desc.Dimension = D3D12_RESOURCE_DIMENSION_TEXTURE2D;
 
+        subresource.pData = decodedData.get();
+        subresource.RowPitch = rowPitch;
+        subresource.SlicePitch = imageSize;
+
+        if (outDesc)
+        {
+            *outDesc = desc;
+        }
+
+        // Decode only (no device): caller creates the resource later
+        if (!texture)
+        {
+            return S_OK;
+        }
+
         CD3DX12_HEAP_PROPERTIES defaultHeapProperties(D3D12_HEAP_TYPE_DEFAULT);
 
         ID3D12Resource* tex = nullptr;
@@ -522,10 +538,6 @@ namespace
 
         _Analysis_assume_(tex != 0);
 
-        subresource.pData = decodedData.get();
-        subresource.RowPitch = rowPitch;
-        subresource.SlicePitch = imageSize;
-
         *texture = tex;
         return hr;
     }
@@ -704,3 +716,36 @@ HRESULT DirectX::LoadWICTextureFromFileEx(
 
     return hr;
 }
+
+
+//--------------------------------------------------------------------------------------
+_Use_decl_annotations_
+HRESULT DirectX::DecodeWICTextureFromFile(
+    const wchar_t* fileName,
+    size_t maxsize,
+    unsigned int loadFlags,
+    std::unique_ptr<uint8_t[]>& decodedData,
+    D3D12_SUBRESOURCE_DATA& subresource,
+    D3D12_RESOURCE_DESC& desc)
+{
+    if ( !fileName )
+        return E_INVALIDARG;
+
+    auto pWIC = _GetWIC();
+    if ( !pWIC )
+        return E_NOINTERFACE;
+
+    ComPtr<IWICBitmapDecoder> decoder;
+    HRESULT hr = pWIC->CreateDecoderFromFilename( fileName, 0, GENERIC_READ, WICDecodeMetadataCacheOnDemand, decoder.GetAddressOf() );
+    if ( FAILED(hr) )
+        return hr;
+
+    ComPtr<IWICBitmapFrameDecode> frame;
+    hr = decoder->GetFrame( 0, frame.GetAddressOf() );
+    if ( FAILED(hr) )
+        return hr;
+
+    return CreateTextureFromWIC( nullptr, frame.Get(), maxsize,
+                                 D3D12_RESOURCE_FLAG_NONE, loadFlags,
+                                 nullptr, decodedData, subresource, &desc );
+}
@@ -78,4 +78,13 @@ namespace DirectX
         _Outptr_ ID3D12Resource** texture,
         std::unique_ptr<uint8_t[]>& decodedData,
         D3D12_SUBRESOURCE_DATA& subresource);
+
+    // Decode only - no resource is created. desc describes the texture to create
+    HRESULT __cdecl DecodeWICTextureFromFile(
+        _In_z_ const wchar_t* szFileName,
+        size_t maxsize,
+        unsigned int loadFlags,
+        std::unique_ptr<uint8_t[]>& decodedData,
+        D3D12_SUBRESOURCE_DATA& subresource,
+        D3D12_RESOURCE_DESC& desc);
 }
\ No newline at end of file
@@ -233,8 +233,8 @@ void WaveSlashBehavior::UpdateFireTrail(float deltaTime)
     CRoom* pRoom = m_pScene->GetCurrentRoom();
     if (!pRoom) return;
 
-    const auto& gameObjects = pRoom->GetGameObjects();
     float dotDamage = m_SkillData.damage * m_damageMult * TRAIL_DMG_MULT;
+    std::vector<EnemyComponent*> vInZone;
 
     for (auto& zone : m_fireTrail)
     {
@@ -245,22 +245,11 @@ void WaveSlashBehavior::UpdateFireTrail(float deltaTime)
         zone.tickTimer = 0.f;
 
         // 존 안의 적에게 DoT (경직 없음)
-        for (const auto& obj : gameObjects)
+        pRoom->QueryEnemiesInRadius2D(zone.center, TRAIL_ZONE_RADIUS, vInZone);
+        for (EnemyComponent* pEnemy : vInZone)
         {
-            if (!obj) continue;
-            EnemyComponent* pEnemy = obj->GetComponent<EnemyComponent>();
-            if (!pEnemy || pEnemy->IsDead()) continue;
-
-            TransformComponent* pT = obj->GetTransform();
-            if (!pT) continue;
-
-            XMFLOAT3 ePos = pT->GetPosition();
-            float dx = ePos.x - zone.center.x;
-            float dz = ePos.z - zone.center.z;
-            if (dx * dx + dz * dz <= TRAIL_ZONE_RADIUS * TRAIL_ZONE_RADIUS)
-            {
+            if (!pEnemy->IsDead())
                 pEnemy->TakeDamage(dotDamage, false);
-            }
         }
     }
 
@@ -0,0 +1,109 @@
+#include "WorkerPool.h"
+#include <algorithm>
+
+WorkerPool::WorkerPool(int workerCount)
+{
+    if (workerCount < 0)
+    {
+        const int hw = static_cast<int>(std::thread::hardware_concurrency());
+        workerCount = (std::max)(hw - 1, 0);
+    }
+
+    m_Workers.reserve(workerCount);
+    for (int i = 0; i < workerCount; ++i)
+        m_Workers.emplace_back([this]() { WorkerLoop(); });
+}
+
+WorkerPool::~WorkerPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        m_bStop = true;
+    }
+    m_WakeCV.notify_all();
+
+    for (auto& t : m_Workers)
+        t.join();
+}
+
+WorkerPool& WorkerPool::Get()
+{
+    static WorkerPool s_Pool;
+    return s_Pool;
+}
+
+void WorkerPool::ParallelFor(int count, int grain, const RangeFunc& func)
+{
+    if (count <= 0) return;
+    grain = (std::max)(grain, 1);
+
+    const int chunkCount = (count + grain - 1) / grain;
+
+    // 워커가 없거나 청크가 하나뿐이면 깨우는 비용이 더 크다
+    if (m_Workers.empty() || chunkCount == 1)
+    {
+        for (int begin = 0; begin < count; begin += grain)
+            func(begin, (std::min)(begin + grain, count));
+        return;
+    }
+
+    std::lock_guard<std::mutex> dispatch(m_DispatchMutex);
+
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        m_pFunc      = &func;
+        m_Count      = count;
+        m_Grain      = grain;
+        m_ChunkCount = chunkCount;
+        m_NextChunk.store(0);
+        m_DoneChunks.store(0);
+        ++m_Generation;
+    }
+    m_WakeCV.notify_all();
+
+    // 호출한 쓰레드도 같이 처리
+    RunChunks();
+
+    // 모든 청크가 끝나고, 이번 작업을 집은 워커가 전부 손을 뗄 때까지 대기 (func 수명 보장)
+    std::unique_lock<std::mutex> lock(m_Mutex);
+    m_DoneCV.wait(lock, [this]() { return m_DoneChunks.load() == m_ChunkCount && m_ActiveWorkers == 0; });
+    m_pFunc = nullptr;
+}
+
+void WorkerPool::WorkerLoop()
+{
+    uint64_t seenGeneration = 0;
+
+    while (true)
+    {
+        {
+            std::unique_lock<std::mutex> lock(m_Mutex);
+            m_WakeCV.wait(lock, [&]() { return m_bStop || m_Generation != seenGeneration; });
+            if (m_bStop) return;
+
+            seenGeneration = m_Generation;
+            ++m_ActiveWorkers;
+        }
+
+        RunChunks();
+
+        {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            --m_ActiveWorkers;
+        }
+        m_DoneCV.notify_all();
+    }
+}
+
+void WorkerPool::RunChunks()
+{
+    while (true)
+    {
+        const int chunk = m_NextChunk.fetch_add(1);
+        if (chunk >= m_ChunkCount) break;
+
+        const int begin = chunk * m_Grain;
+        (*m_pFunc)(begin, (std::min)(begin + m_Grain, m_Count));
+        m_DoneChunks.fetch_add(1);
+    }
+}
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// 게임 쓰레드에서 데이터 병렬 루프를 나눠 돌리기 위한 고정 크기 워커 풀.
+// ParallelFor는 [0, count)를 grain 크기 청크로 자르고, 호출한 쓰레드도 청크를 함께 처리한다.
+// 청크 경계는 워커 수와 무관하므로 청크마다 겹치지 않는 출력만 쓰면 결과가 항상 같다.
+class WorkerPool
+{
+public:
+    using RangeFunc = std::function<void(int begin, int end)>;
+
+    // workerCount < 0 이면 (hardware_concurrency - 1)
+    explicit WorkerPool(int workerCount = -1);
+    ~WorkerPool();
+
+    WorkerPool(const WorkerPool&) = delete;
+    WorkerPool& operator=(const WorkerPool&) = delete;
+
+    // 프로세스 공용 풀 (처음 호출할 때 생성)
+    static WorkerPool& Get();
+
+    void ParallelFor(int count, int grain, const RangeFunc& func);
+
+    int  GetWorkerCount() const { return static_cast<int>(m_Workers.size()); }
+
+private:
+    void WorkerLoop();
+    void RunChunks();
+
+    std::vector<std::thread> m_Workers;
+
+    std::mutex               m_DispatchMutex;   // ParallelFor 호출끼리 직렬화
+    std::mutex               m_Mutex;
+    std::condition_variable  m_WakeCV;
+    std::condition_variable  m_DoneCV;
+
+    const RangeFunc*         m_pFunc       = nullptr;
+    int                      m_Count       = 0;
+    int                      m_Grain       = 1;
+    int                      m_ChunkCount  = 0;
+    std::atomic<int>         m_NextChunk   { 0 };
+    std::atomic<int>         m_DoneChunks  { 0 };
+    uint64_t                 m_Generation  = 0;
+    int                      m_ActiveWorkers = 0;
+    bool                     m_bStop       = false;
+};
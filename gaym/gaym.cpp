@@ -1,6 +1,9 @@
 #include "stdafx.h"
 #include "gaym.h"
 #include "Dx12App.h"
+#include <shellapi.h>
+#include <algorithm>
+#include <fstream>
 
 #define MAX_LOADSTRING 100
 
@@ -13,6 +16,9 @@ Dx12App* g_pDx12App;
 ATOM MyRegisterClass(HINSTANCE hInstance);
 BOOL InitInstance(HINSTANCE, int);
 LRESULT CALLBACK WndProc(HWND, UINT, WPARAM, LPARAM);
+int RunHeadless(const std::vector<std::wstring>& vArgs);
+static std::vector<std::wstring> SplitCmdLine(LPCWSTR lpCmdLine);
+static bool HasCmdArg(const std::vector<std::wstring>& vArgs, LPCWSTR name);
 
 int APIENTRY wWinMain(_In_ HINSTANCE hInstance,
                      _In_opt_ HINSTANCE hPrevInstance,
@@ -20,7 +26,14 @@ int APIENTRY wWinMain(_In_ HINSTANCE hInstance,
                      _In_ int       nCmdShow)
 {
     UNREFERENCED_PARAMETER(hPrevInstance);
-    UNREFERENCED_PARAMETER(lpCmdLine);
+
+    // 헤드리스 프로파일링: gaym.exe -headless [-frames N] [-dt 초] [-room 인덱스] [-out 파일]
+    const std::vector<std::wstring> vArgs = SplitCmdLine(lpCmdLine);
+    if (HasCmdArg(vArgs, L"-headless"))
+    {
+        hInst = hInstance;
+        return RunHeadless(vArgs);
+    }
 
     // DPI awareness 설정 - 마우스/윈도우 좌표 일관성 보장
     SetProcessDpiAwarenessContext(DPI_AWARENESS_CONTEXT_PER_MONITOR_AWARE_V2);
@@ -62,6 +75,89 @@ int APIENTRY wWinMain(_In_ HINSTANCE hInstance,
     return (int) msg.wParam;
 }
 
+// 명령줄을 인자 단위로 나눈다 (따옴표 규칙은 CommandLineToArgvW 와 같음)
+static std::vector<std::wstring> SplitCmdLine(LPCWSTR lpCmdLine)
+{
+    std::vector<std::wstring> vArgs;
+    if (!lpCmdLine || !*lpCmdLine)
+        return vArgs;
+
+    // lpCmdLine 에는 프로그램 이름이 없다. CommandLineToArgvW 는 첫 토큰을 프로그램 이름으로 읽으므로 자리만 채운다
+    std::wstring strLine = L"gaym ";
+    strLine += lpCmdLine;
+
+    int nArgs = 0;
+    LPWSTR* ppArgs = CommandLineToArgvW(strLine.c_str(), &nArgs);
+    if (!ppArgs)
+        return vArgs;
+    for (int i = 1; i < nArgs; ++i)
+        vArgs.emplace_back(ppArgs[i]);
+    LocalFree(ppArgs);
+    return vArgs;
+}
+
+static bool HasCmdArg(const std::vector<std::wstring>& vArgs, LPCWSTR name)
+{
+    return std::find(vArgs.begin(), vArgs.end(), name) != vArgs.end();
+}
+
+// "-name 값" 형태 인자의 값. 이름이 통째로 같은 인자 다음 토큰 (없으면 nullptr)
+static const wchar_t* FindCmdArg(const std::vector<std::wstring>& vArgs, LPCWSTR name)
+{
+    for (size_t i = 0; i + 1 < vArgs.size(); ++i)
+    {
+        if (vArgs[i] == name)
+            return vArgs[i + 1].c_str();
+    }
+    return nullptr;
+}
+
+int RunHeadless(const std::vector<std::wstring>& vArgs)
+{
+    int nFrames = 3600;           // 60Hz 기준 1분
+    float fDeltaTime = 1.0f / 60.0f;
+    int nRoomIndex = -1;          // -1 = Scene::Init 기본 방
+    std::wstring strOut = L"headless_profile.txt";
+
+    if (const wchar_t* p = FindCmdArg(vArgs, L"-frames")) nFrames = _wtoi(p);
+    if (const wchar_t* p = FindCmdArg(vArgs, L"-dt"))     fDeltaTime = static_cast<float>(_wtof(p));
+    if (const wchar_t* p = FindCmdArg(vArgs, L"-room"))   nRoomIndex = _wtoi(p);
+    if (const wchar_t* p = FindCmdArg(vArgs, L"-out"))    strOut = p;
+
+    std::string report;
+    int nExitCode = 0;
+
+    g_pDx12App = new Dx12App();
+    try
+    {
+        g_pDx12App->OnCreateHeadless();
+        report = g_pDx12App->RunHeadless(nFrames, fDeltaTime, nRoomIndex);
+        g_pDx12App->OnDestroy();
+    }
+    catch (const std::exception& e)
+    {
+        report = std::string("[Headless] failed: ") + e.what() + "\n";
+        nExitCode = 1;
+    }
+    delete g_pDx12App;
+    g_pDx12App = nullptr;
+
+    OutputDebugStringA(report.c_str());
+
+    std::ofstream ofs(strOut);
+    ofs << report;
+
+    // 콘솔에서 실행했으면 결과를 그쪽에도 출력
+    if (AttachConsole(ATTACH_PARENT_PROCESS))
+    {
+        DWORD nWritten = 0;
+        WriteFile(GetStdHandle(STD_OUTPUT_HANDLE), report.data(), static_cast<DWORD>(report.size()), &nWritten, NULL);
+        FreeConsole();
+    }
+
+    return nExitCode;
+}
+
 ATOM MyRegisterClass(HINSTANCE hInstance)
 {
     WNDCLASSEXW wcex;
@@ -20,7 +20,7 @@ cbuffer cbGameObject : register(b0)
     float g_HitFlash;
     uint bIsRocky;
     MATERIAL gMaterial;
-    matrix gBoneTransforms[128];
+    uint gBoneOffset;  // gBonePalette 안에서 이 메쉬 본 행렬의 시작 위치
 };
 
 // Torch light struct
@@ -88,6 +88,9 @@ Texture2D gNormalMap2   : register(t7);  // Water normal map 2 (Water_6)
 Texture2D gHeightMap2   : register(t8);  // Water height map 2 (Water_6)
 Texture2D gFoamOpacity  : register(t9);  // Foam opacity map (foam4)
 Texture2D gFoamDiffuse  : register(t10); // Foam diffuse map (foam4)
+
+// Skinning palette — 모든 스킨드 메쉬의 본 행렬 (root SRV, BonePalette)
+StructuredBuffer<float4x4> gBonePalette : register(t11);
 SamplerState gSampler : register(s0);
 SamplerComparisonState gShadowSampler : register(s1);
 
@@ -326,8 +329,8 @@ PS_INPUT VS(VS_INPUT input)
             
             if (weight > 0.0f)
             {
-                posL += weight * mul(float4(input.position, 1.0f), gBoneTransforms[idx]).xyz;
-                normalL += weight * mul(input.normal, (float3x3)gBoneTransforms[idx]);
+                posL += weight * mul(float4(input.position, 1.0f), gBonePalette[gBoneOffset + idx]).xyz;
+                normalL += weight * mul(input.normal, (float3x3)gBonePalette[gBoneOffset + idx]);
             }
         }
     }
@@ -393,7 +396,7 @@ float4 VS_Shadow(VS_INPUT input) : SV_POSITION
 
             if (weight > 0.0f)
             {
-                posL += weight * mul(float4(input.position, 1.0f), gBoneTransforms[idx]).xyz;
+                posL += weight * mul(float4(input.position, 1.0f), gBonePalette[gBoneOffset + idx]).xyz;
             }
         }
     }